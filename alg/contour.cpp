@@ -19,11 +19,21 @@
 #include "contour_generator.h"
 #include "segment_merger.h"
 #include <algorithm>
+#include <iterator>
+#include <list>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "gdal.h"
 #include "gdal_alg.h"
+#include "gdal_alg_priv.h"
+#include "gdal_thread_pool.h"
 #include "cpl_conv.h"
 #include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_srs_api.h"
 #include "ogr_geometry.h"
@@ -387,6 +397,338 @@ CPLErr GDALContourGenerate(GDALRasterBandH hBand, double dfContourInterval,
     return err;
 }
 
+namespace
+{
+
+/************************************************************************/
+/*                        ContourStripLevelIndex                        */
+/************************************************************************/
+
+// Level generator of the segment merger of a strip, passing the index of
+// the levels to the line writer instead of their value.
+struct ContourStripLevelIndex
+{
+    double level(int idx) const
+    {
+        return idx;
+    }
+};
+
+/************************************************************************/
+/*                           ContourStripLine                           */
+/************************************************************************/
+
+struct ContourStripLine
+{
+    int levelIdx = 0;
+    marching_squares::LineString ls{};
+};
+
+/************************************************************************/
+/*                          ContourStripLines                           */
+/************************************************************************/
+
+// Line writer collecting the lines of a horizontal strip of the raster.
+struct ContourStripLines
+{
+    std::vector<ContourStripLine> lines{};
+
+    void addLine(double levelIdx, marching_squares::LineString &ls,
+                 bool /*closed*/)
+    {
+        lines.emplace_back();
+        lines.back().levelIdx = static_cast<int>(levelIdx);
+        lines.back().ls.swap(ls);
+    }
+};
+
+/************************************************************************/
+/*                         ContourStripStitcher                         */
+/************************************************************************/
+
+// Joins the lines of consecutive strips that end on the line of pixel
+// centers shared by the two strips, and passes the finished lines to the
+// line writer. Lines that reach the bottom of a strip are kept until the
+// next strip has been processed.
+template <typename LineWriter, typename LevelGenerator>
+class ContourStripStitcher
+{
+  public:
+    ContourStripStitcher(LineWriter &writer, const LevelGenerator &levels,
+                         const std::vector<int> &skipLevels)
+        : writer_(writer), levels_(levels), skipLevels_(skipLevels)
+    {
+    }
+
+    // Add the lines of the next strip, whose first and last lines of pixel
+    // centers are at yTop and yBottom.
+    void addStrip(std::vector<ContourStripLine> &lines, double yTop,
+                  double yBottom, bool lastStrip)
+    {
+        typedef std::list<ContourStripLine> Chains;
+        Chains chains;
+        // Ends of the chains on the top of the strip, by level and x
+        std::multimap<std::pair<int, double>, typename Chains::iterator>
+            topEnds;
+
+        const auto addChain = [&chains, &topEnds,
+                               yTop](ContourStripLine &&line)
+        {
+            chains.push_back(std::move(line));
+            const auto it = std::prev(chains.end());
+            const auto &ls = it->ls;
+            if (ls.front().y == yTop)
+                topEnds.emplace(std::make_pair(it->levelIdx, ls.front().x),
+                                it);
+            if (ls.back().y == yTop)
+                topEnds.emplace(std::make_pair(it->levelIdx, ls.back().x),
+                                it);
+        };
+
+        const auto eraseTopEnd =
+            [&topEnds, yTop](typename Chains::iterator chain,
+                             const marching_squares::Point &end)
+        {
+            if (end.y != yTop)
+                return;
+            const auto range =
+                topEnds.equal_range(std::make_pair(chain->levelIdx, end.x));
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                if (it->second == chain)
+                {
+                    topEnds.erase(it);
+                    return;
+                }
+            }
+        };
+
+        const auto findTopEnd =
+            [&topEnds, yTop](int levelIdx, const marching_squares::Point &end)
+        {
+            return end.y == yTop ? topEnds.find(std::make_pair(levelIdx, end.x))
+                                 : topEnds.end();
+        };
+
+        for (auto &line : pending_)
+            addChain(std::move(line));
+        pending_.clear();
+
+        for (auto &line : lines)
+        {
+            auto &ls = line.ls;
+            if (ls.empty())
+                continue;
+            while (!(ls.front() == ls.back()))
+            {
+                bool atFront = true;
+                auto found = findTopEnd(line.levelIdx, ls.front());
+                if (found == topEnds.end())
+                {
+                    atFront = false;
+                    found = findTopEnd(line.levelIdx, ls.back());
+                    if (found == topEnds.end())
+                        break;
+                }
+                const auto other = found->second;
+                eraseTopEnd(other, other->ls.front());
+                eraseTopEnd(other, other->ls.back());
+                join(ls, other->ls, atFront);
+                chains.erase(other);
+            }
+
+            if (ls.front() == ls.back())
+                emit(line.levelIdx, ls, /* closed */ true);
+            else
+                addChain(std::move(line));
+        }
+        lines.clear();
+
+        for (auto &chain : chains)
+        {
+            if (!lastStrip && (chain.ls.front().y == yBottom ||
+                               chain.ls.back().y == yBottom))
+                pending_.push_back(std::move(chain));
+            else
+                emit(chain.levelIdx, chain.ls, /* closed */ false);
+        }
+    }
+
+  private:
+    LineWriter &writer_;
+    const LevelGenerator &levels_;
+    const std::vector<int> &skipLevels_;
+    std::vector<ContourStripLine> pending_{};
+
+    // Join other to the front or the back of ls, other having an end equal
+    // to it.
+    static void join(marching_squares::LineString &ls,
+                     marching_squares::LineString &other, bool atFront)
+    {
+        if (atFront)
+        {
+            const bool sameDirection = other.back() == ls.front();
+            ls.pop_front();
+            if (sameDirection)
+                ls.splice(ls.begin(), other);
+            else
+                for (const auto &p : other)
+                    ls.push_front(p);
+        }
+        else
+        {
+            const bool sameDirection = other.front() == ls.back();
+            ls.pop_back();
+            if (sameDirection)
+                ls.splice(ls.end(), other);
+            else
+                for (auto rit = other.rbegin(); rit != other.rend(); ++rit)
+                    ls.push_back(*rit);
+        }
+    }
+
+    // Same as SegmentMerger::emitLine_()
+    void emit(int levelIdx, marching_squares::LineString &ls, bool closed)
+    {
+        if (std::find(skipLevels_.begin(), skipLevels_.end(), levelIdx) !=
+            skipLevels_.end())
+        {
+            if (!closed)
+                return;
+            ls.clear();
+        }
+        writer_.addLine(levels_.level(levelIdx), ls, closed);
+    }
+};
+
+/************************************************************************/
+/*                       ContourGenerateByStrips()                      */
+/************************************************************************/
+
+// Run independent contour generators on horizontal strips of the raster,
+// with several threads, and stitch the lines of consecutive strips. The
+// raster is read, and the lines written, by the calling thread.
+template <typename LineWriter>
+static bool ContourGenerateByStrips(
+    GDALRasterBandH hBand, bool useNoData, double noDataValue,
+    LineWriter &writer, const marching_squares::FixedLevelRangeIterator &levels,
+    bool polygonize, const std::vector<int> &skipLevels, int nThreads,
+    GDALProgressFunc pfnProgress, void *pProgressArg)
+{
+    using namespace marching_squares;
+
+    const int nXSize = GDALGetRasterBandXSize(hBand);
+    const int nYSize = GDALGetRasterBandYSize(hBand);
+    // Strips of about 1 million pixels
+    const int nRowsPerStrip = GDALGetRowsPerStrip(
+        hBand, nXSize, 1024 * 1024, "GDAL_CONTOUR_ROWS_PER_STRIP");
+    const int nStrips =
+        nYSize / nRowsPerStrip + (nYSize % nRowsPerStrip != 0 ? 1 : 0);
+
+    std::unique_ptr<CPLJobQueue> poJobQueue;
+    CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    if (poThreadPool)
+        poJobQueue = poThreadPool->CreateJobQueue();
+
+    struct Strip
+    {
+        int nYOff = 0;
+        int nRows = 0;
+        // Line before the strip (if any), and lines of the strip.
+        std::vector<double> adfValues{};
+        ContourStripLines oLines{};
+        std::string osError{};
+    };
+
+    std::vector<Strip> aoStrips(std::max(1, std::min(nThreads, nStrips)));
+    const int nBatchSize = static_cast<int>(aoStrips.size());
+
+    const auto ProcessStrip = [&](Strip &oStrip)
+    {
+        try
+        {
+            // Each generator gets its own copy of the levels.
+            FixedLevelRangeIterator stripLevels(levels);
+            ContourStripLevelIndex levelIndex;
+            SegmentMerger<ContourStripLines, ContourStripLevelIndex> merger(
+                oStrip.oLines, levelIndex, polygonize);
+            merger.setPartial(true);
+            ContourGenerator<decltype(merger), FixedLevelRangeIterator> cg(
+                nXSize, nYSize, useNoData, noDataValue, merger, stripLevels);
+            const double *padfLine = oStrip.adfValues.data();
+            if (oStrip.nYOff > 0)
+            {
+                cg.startAtLine(oStrip.nYOff, padfLine);
+                padfLine += nXSize;
+            }
+            for (int i = 0; i < oStrip.nRows; i++, padfLine += nXSize)
+                cg.feedLine(padfLine);
+        }
+        catch (const std::exception &e)
+        {
+            oStrip.osError = e.what();
+        }
+    };
+
+    ContourStripStitcher<LineWriter, FixedLevelRangeIterator> stitcher(
+        writer, levels, skipLevels);
+
+    for (int iFirstStrip = 0; iFirstStrip < nStrips; iFirstStrip += nBatchSize)
+    {
+        const int nBatchStrips = std::min(nBatchSize, nStrips - iFirstStrip);
+        for (int i = 0; i < nBatchStrips; i++)
+        {
+            auto &oStrip = aoStrips[i];
+            oStrip.nYOff = (iFirstStrip + i) * nRowsPerStrip;
+            oStrip.nRows = std::min(nRowsPerStrip, nYSize - oStrip.nYOff);
+            oStrip.osError.clear();
+            const int nReadYOff = std::max(0, oStrip.nYOff - 1);
+            const int nReadRows = oStrip.nYOff + oStrip.nRows - nReadYOff;
+            oStrip.adfValues.resize(static_cast<size_t>(nXSize) * nReadRows);
+            if (GDALRasterIO(hBand, GF_Read, 0, nReadYOff, nXSize, nReadRows,
+                             oStrip.adfValues.data(), nXSize, nReadRows,
+                             GDT_Float64, 0, 0) != CE_None)
+            {
+                CPLDebug("CONTOUR", "failed fetch %d %d", nReadYOff,
+                         nReadRows);
+                return false;
+            }
+        }
+
+        // One job per strip
+        GDALRunParallel(poJobQueue.get(), nBatchStrips, nBatchStrips,
+                        [&ProcessStrip, &aoStrips](int, int iStart, int iEnd)
+                        {
+                            for (int i = iStart; i < iEnd; i++)
+                                ProcessStrip(aoStrips[i]);
+                        });
+
+        for (int i = 0; i < nBatchStrips; i++)
+        {
+            auto &oStrip = aoStrips[i];
+            if (!oStrip.osError.empty())
+            {
+                CPLError(CE_Failure, CPLE_AppDefined, "%s",
+                         oStrip.osError.c_str());
+                return false;
+            }
+            stitcher.addStrip(oStrip.oLines.lines, oStrip.nYOff - 0.5,
+                              oStrip.nYOff + oStrip.nRows - 0.5,
+                              iFirstStrip + i == nStrips - 1);
+        }
+
+        if (!pfnProgress(double(iFirstStrip + nBatchStrips) / nStrips,
+                         "Processing line", pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
 /**
  * Create vector contours from raster DEM.
  *
@@ -563,6 +905,18 @@ mode.
  * A negative value means a single transaction. The function takes care of
  * issuing the starting transaction and committing the final one.
  *
+ *   NUM_THREADS=number|ALL_CPUS
+ *
+ * (GDAL >= 3.12) Number of worker threads. Defaults to 1. When greater than
+ * 1, horizontal strips of the raster are contoured concurrently, and the lines
+ * (or polygon rings) crossing the strip boundaries are joined afterwards.
+ * Reading of the raster and writing of the features are still done by the
+ * calling thread. The contours are the same, but the features are written
+ * strip by strip: the lines closed within the rows processed so far first,
+ * in the order they are completed, then the open lines that end in the strip.
+ * The order of the features, and the starting point of closed lines, thus
+ * differ from the single-threaded case.
+ *
  * @return CE_None on success or CE_Failure if an error occurs.
  */
 CPLErr GDALContourGenerateEx(GDALRasterBandH hBand, void *hLayer,
@@ -680,6 +1034,12 @@ CPLErr GDALContourGenerateEx(GDALRasterBandH hBand, void *hLayer,
 
     bool polygonize = CPLFetchBool(options, "POLYGONIZE", false);
 
+    const char *pszThreads = CSLFetchNameValueDef(options, "NUM_THREADS", "1");
+    const int nThreads =
+        std::max(1, std::min(128, EQUAL(pszThreads, "ALL_CPUS")
+                                      ? CPLGetNumCPUs()
+                                      : atoi(pszThreads)));
+
     using namespace marching_squares;
 
     OGRContourWriterInfo oCWI;
@@ -847,17 +1207,27 @@ CPLErr GDALContourGenerateEx(GDALRasterBandH hBand, void *hLayer,
                 FixedLevelRangeIterator levels(
                     &fixedLevels[0], fixedLevels.size(),
                     -std::numeric_limits<double>::infinity(), dfMaximum);
-                SegmentMerger<RingAppender, FixedLevelRangeIterator> writer(
-                    appender, levels, /* polygonize */ true);
                 std::vector<int> aoiSkipLevels;
                 // Skip first and last levels (min/max) in polygonal case
                 aoiSkipLevels.push_back(0);
                 aoiSkipLevels.push_back(static_cast<int>(levels.levelsCount()));
-                writer.setSkipLevels(aoiSkipLevels);
-                ContourGeneratorFromRaster<decltype(writer),
-                                           FixedLevelRangeIterator>
-                    cg(hBand, useNoData, noDataValue, writer, levels);
-                ok = cg.process(pfnProgress, pProgressArg);
+                if (nThreads > 1)
+                {
+                    ok = ContourGenerateByStrips(
+                        hBand, useNoData, noDataValue, appender, levels,
+                        /* polygonize */ true, aoiSkipLevels, nThreads,
+                        pfnProgress, pProgressArg);
+                }
+                else
+                {
+                    SegmentMerger<RingAppender, FixedLevelRangeIterator>
+                        writer(appender, levels, /* polygonize */ true);
+                    writer.setSkipLevels(aoiSkipLevels);
+                    ContourGeneratorFromRaster<decltype(writer),
+                                               FixedLevelRangeIterator>
+                        cg(hBand, useNoData, noDataValue, writer, levels);
+                    ok = cg.process(pfnProgress, pProgressArg);
+                }
             }
         }
         else
@@ -895,12 +1265,22 @@ CPLErr GDALContourGenerateEx(GDALRasterBandH hBand, void *hLayer,
                 fixedLevels.erase(uniqueIt, fixedLevels.end());
                 FixedLevelRangeIterator levels(
                     &fixedLevels[0], fixedLevels.size(), dfMinimum, dfMaximum);
-                SegmentMerger<GDALRingAppender, FixedLevelRangeIterator> writer(
-                    appender, levels, /* polygonize */ false);
-                ContourGeneratorFromRaster<decltype(writer),
-                                           FixedLevelRangeIterator>
-                    cg(hBand, useNoData, noDataValue, writer, levels);
-                ok = cg.process(pfnProgress, pProgressArg);
+                if (nThreads > 1)
+                {
+                    ok = ContourGenerateByStrips(
+                        hBand, useNoData, noDataValue, appender, levels,
+                        /* polygonize */ false, std::vector<int>(), nThreads,
+                        pfnProgress, pProgressArg);
+                }
+                else
+                {
+                    SegmentMerger<GDALRingAppender, FixedLevelRangeIterator>
+                        writer(appender, levels, /* polygonize */ false);
+                    ContourGeneratorFromRaster<decltype(writer),
+                                               FixedLevelRangeIterator>
+                        cg(hBand, useNoData, noDataValue, writer, levels);
+                    ok = cg.process(pfnProgress, pProgressArg);
+                }
             }
         }
     }
@@ -44,6 +44,16 @@ int CPL_DLL CPL_STDCALL GDALDitherRGB2PCT(
 int CPL_DLL CPL_STDCALL GDALChecksumImage(GDALRasterBandH hBand, int nXOff,
                                           int nYOff, int nXSize, int nYSize);
 
+char CPL_DLL *GDALComputeRasterBandHash(GDALRasterBandH hBand,
+                                        CSLConstList papszOptions,
+                                        GDALProgressFunc pfnProgress,
+                                        void *pProgressData);
+
+char CPL_DLL *GDALComputeDatasetHash(GDALDatasetH hDS,
+                                     CSLConstList papszOptions,
+                                     GDALProgressFunc pfnProgress,
+                                     void *pProgressData);
+
 CPLErr CPL_DLL CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
                                                 GDALRasterBandH hProximityBand,
                                                 char **papszOptions,
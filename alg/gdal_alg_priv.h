@@ -18,10 +18,16 @@
 
 #ifndef DOXYGEN_SKIP
 
+#include <algorithm>
 #include <cstdint>
-
+#include <cstdlib>
+#include <functional>
+#include <limits>
 #include <set>
+#include <vector>
 
+#include "cpl_conv.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal_alg.h"
 #include "ogr_spatialref.h"
 
@@ -160,6 +166,13 @@ constexpr const char *GDAL_RPC_TRANSFORMER_CLASS_NAME = "GDALRPCTransformer";
 constexpr const char *GDAL_REPROJECTION_TRANSFORMER_CLASS_NAME =
     "GDALReprojectionTransformer";
 
+#ifdef HAVE_AVX_AT_COMPILE_TIME
+void GDALRPCEvaluateRatiosAVX(const double *padfCoefs, int nPointCount,
+                              const double *padfLong, const double *padfLat,
+                              const double *padfHeight, double *padfSampRatio,
+                              double *padfLineRatio);
+#endif
+
 bool GDALIsTransformer(void *hTransformerArg, const char *pszClassName);
 
 typedef void *(*GDALTransformDeserializeFunc)(CPLXMLNode *psTree);
@@ -203,6 +216,9 @@ typedef struct
     bool bReversed;
     double dfOversampleFactor;
 
+    // Number of threads used to build the backmap.
+    int nNumThreads;
+
     // Map from target georef coordinates back to geolocation array
     // pixel line coordinates.  Built only if needed.
     int nBackMapWidth;
@@ -307,6 +323,8 @@ struct GDALApproxTransformInfo
 /* ==================================================================== */
 /************************************************************************/
 
+struct GDALGenImgProjTransformGrid;
+
 struct GDALGenImgProjTransformPart
 {
     double adfGeoTransform[6];
@@ -336,8 +354,23 @@ typedef struct
     // Set to TRUE when the transformation pipline is a custom one.
     bool bHasCustomTransformationPipeline;
 
+    // Optional precomputed grid of source pixel/line coordinates, used for
+    // destination to source transformations (TRANSFORM_GRID_CACHE option).
+    // Reference counted, as it is shared by clones of the transformer.
+    GDALGenImgProjTransformGrid *poTransformGrid;
+
+    // TRANSFORM_GRID_* options, and dimensions of the target dataset, from
+    // which poTransformGrid is (re)built on the first destination to source
+    // transformation when it is not yet available.
+    char **papszTransformGridOptions;
+    int nDstXSize;
+    int nDstYSize;
+
 } GDALGenImgProjTransformInfo;
 
+void GDALSetGenImgProjTransformerDstSize(void *hTransformArg, int nXSize,
+                                         int nYSize);
+
 /************************************************************************/
 /*      Color table related                                             */
 /************************************************************************/
@@ -410,6 +443,155 @@ void *GDALCreateGeoLocTransformerEx(GDALDatasetH hBaseDS,
                                     int bReversed, const char *pszSourceDataset,
                                     CSLConstList papszTransformOptions);
 
+/************************************************************************/
+/*                        GDALGetRowsPerStrip()                         */
+/************************************************************************/
+
+// Number of rows of the strips into which an algorithm splits a band of
+// nXSize columns, so that a strip is about nPixelsPerStrip pixels. When
+// possible, this is a multiple of the block height of the band. The
+// pszConfigOption configuration option, if set, overrides this value.
+inline int GDALGetRowsPerStrip(GDALRasterBandH hBand, int nXSize,
+                               int nPixelsPerStrip,
+                               const char *pszConfigOption)
+{
+    const char *pszRows = CPLGetConfigOption(pszConfigOption, nullptr);
+    if (pszRows)
+        return std::max(1, atoi(pszRows));
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    GDALGetBlockSize(hBand, &nBlockXSize, &nBlockYSize);
+    int nRows = std::max(1, nPixelsPerStrip / std::max(1, nXSize));
+    if (nBlockYSize > 1 && nRows >= nBlockYSize)
+        nRows = nRows / nBlockYSize * nBlockYSize;
+    return nRows;
+}
+
+/************************************************************************/
+/*                          GDALRunParallel()                           */
+/************************************************************************/
+
+// Splits [0, nCount) into at most nThreads ranges, and runs
+// pfnFunc(iChunk, nStart, nEnd) on each of them, using the job queue if
+// there is one. Returns when all of them are done.
+inline void GDALRunParallel(CPLJobQueue *poJobQueue, int nThreads, int nCount,
+                            const std::function<void(int, int, int)> &pfnFunc)
+{
+    const int nChunks = std::max(1, std::min(nThreads, nCount));
+    if (poJobQueue == nullptr || nChunks == 1)
+    {
+        pfnFunc(0, 0, nCount);
+        return;
+    }
+    for (int iChunk = 0; iChunk < nChunks; iChunk++)
+    {
+        const int nStart = static_cast<int>(static_cast<GIntBig>(nCount) *
+                                            iChunk / nChunks);
+        const int nEnd = static_cast<int>(static_cast<GIntBig>(nCount) *
+                                          (iChunk + 1) / nChunks);
+        poJobQueue->SubmitJob([&pfnFunc, iChunk, nStart, nEnd]()
+                              { pfnFunc(iChunk, nStart, nEnd); });
+    }
+    poJobQueue->WaitCompletion();
+}
+
+/************************************************************************/
+/*                      GDALParabolaLowerEnvelope                       */
+/************************************************************************/
+
+// Lower envelope of the parabolas dfScaleXSquare * (x - q)^2 + h(q), for
+// sites q added in increasing order, computed in linear time. This is the
+// building block of the exact Euclidean distance transform described in
+// "Distance Transforms of Sampled Functions", P. Felzenszwalb and
+// D. Huttenlocher, Theory of Computing, 2012.
+class GDALParabolaLowerEnvelope
+{
+  public:
+    explicit GDALParabolaLowerEnvelope(double dfScaleXSquare = 1.0)
+        : m_dfScaleXSquare(dfScaleXSquare)
+    {
+    }
+
+    void Reserve(int nSites)
+    {
+        m_anSites.resize(nSites);
+        m_adfHeights.resize(nSites);
+        m_adfBounds.resize(nSites);
+    }
+
+    void Reset()
+    {
+        m_nSites = 0;
+    }
+
+    // q must be greater than the sites previously added
+    void Add(int q, double dfHeight)
+    {
+        const double dfQ = q;
+        double dfBound = -std::numeric_limits<double>::infinity();
+        while (m_nSites > 0)
+        {
+            const double dfP = m_anSites[m_nSites - 1];
+            dfBound = ((dfHeight - m_adfHeights[m_nSites - 1]) /
+                           m_dfScaleXSquare +
+                       (dfQ * dfQ - dfP * dfP)) /
+                      (2 * (dfQ - dfP));
+            if (dfBound > m_adfBounds[m_nSites - 1])
+                break;
+            m_nSites--;
+        }
+        if (m_nSites == 0)
+            dfBound = -std::numeric_limits<double>::infinity();
+        m_anSites[m_nSites] = q;
+        m_adfHeights[m_nSites] = dfHeight;
+        m_adfBounds[m_nSites] = dfBound;
+        m_nSites++;
+    }
+
+    int GetSiteCount() const
+    {
+        return m_nSites;
+    }
+
+    int GetSite(int k) const
+    {
+        return m_anSites[k];
+    }
+
+    double GetHeight(int k) const
+    {
+        return m_adfHeights[k];
+    }
+
+    // Abscissa from which the parabola of site k is below the one of
+    // site k - 1.
+    double GetBound(int k) const
+    {
+        return m_adfBounds[k];
+    }
+
+    // Value of the lower envelope at x, or infinity if it is empty.
+    double GetMin(int x) const
+    {
+        if (m_nSites == 0)
+            return std::numeric_limits<double>::infinity();
+        // Last parabola starting at or before x.
+        const auto oIter =
+            std::upper_bound(m_adfBounds.begin(),
+                             m_adfBounds.begin() + m_nSites, double(x));
+        const int k = static_cast<int>(oIter - m_adfBounds.begin()) - 1;
+        const double dfDX = static_cast<double>(x) - m_anSites[k];
+        return m_dfScaleXSquare * dfDX * dfDX + m_adfHeights[k];
+    }
+
+  private:
+    double m_dfScaleXSquare;
+    std::vector<int> m_anSites{};
+    std::vector<double> m_adfHeights{};
+    std::vector<double> m_adfBounds{};
+    int m_nSites = 0;
+};
+
 #endif /* #ifndef DOXYGEN_SKIP */
 
 #endif /* ndef GDAL_ALG_PRIV_H_INCLUDED */
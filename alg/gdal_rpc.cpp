@@ -24,6 +24,7 @@
 #include <string>
 
 #include "cpl_conv.h"
+#include "cpl_cpu_features.h"
 #include "cpl_error.h"
 #include "cpl_mem_cache.h"
 #include "cpl_minixml.h"
@@ -273,6 +274,10 @@ typedef struct
     double adfDoubles[20 * 4 + 1];
     // LINE_NUM_COEFF, LINE_DEN_COEFF, SAMP_NUM_COEFF and then SAMP_DEN_COEFF.
     double *padfCoeffs;
+    bool bUseBatch;
+#ifdef HAVE_AVX_AT_COMPILE_TIME
+    bool bUseAVX;
+#endif
 #endif
 
     bool bRPCInverseVerbose;
@@ -352,20 +357,15 @@ static double RPCEvaluate(const double *padfTerms, const double *padfCoefs)
 #endif
 
 /************************************************************************/
-/*                         RPCTransformPoint()                          */
+/*                         RPCNormalizePoint()                          */
 /************************************************************************/
 
-static void RPCTransformPoint(const GDALRPCTransformInfo *psRPCTransformInfo,
+static void RPCNormalizePoint(const GDALRPCTransformInfo *psRPCTransformInfo,
                               double dfLong, double dfLat, double dfHeight,
-                              double *pdfPixel, double *pdfLine)
+                              double &dfNormalizedLong, double &dfNormalizedLat,
+                              double &dfNormalizedHeight)
 
 {
-    double adfTermsWithMargin[20 + 1] = {};
-    // Make padfTerms aligned on 16-byte boundary for SSE2 aligned loads.
-    double *padfTerms =
-        adfTermsWithMargin +
-        (reinterpret_cast<GUIntptr_t>(adfTermsWithMargin) % 16) / 8;
-
     // Avoid dateline issues.
     double diffLong = dfLong - psRPCTransformInfo->sRPC.dfLONG_OFF;
     if (diffLong < -270)
@@ -377,12 +377,10 @@ static void RPCTransformPoint(const GDALRPCTransformInfo *psRPCTransformInfo,
         diffLong -= 360;
     }
 
-    const double dfNormalizedLong =
-        diffLong / psRPCTransformInfo->sRPC.dfLONG_SCALE;
-    const double dfNormalizedLat =
-        (dfLat - psRPCTransformInfo->sRPC.dfLAT_OFF) /
-        psRPCTransformInfo->sRPC.dfLAT_SCALE;
-    const double dfNormalizedHeight =
+    dfNormalizedLong = diffLong / psRPCTransformInfo->sRPC.dfLONG_SCALE;
+    dfNormalizedLat = (dfLat - psRPCTransformInfo->sRPC.dfLAT_OFF) /
+                      psRPCTransformInfo->sRPC.dfLAT_SCALE;
+    dfNormalizedHeight =
         (dfHeight - psRPCTransformInfo->sRPC.dfHEIGHT_OFF) /
         psRPCTransformInfo->sRPC.dfHEIGHT_SCALE;
 
@@ -434,6 +432,28 @@ static void RPCTransformPoint(const GDALRPCTransformInfo *psRPCTransformInfo,
             }
         }
     }
+}
+
+/************************************************************************/
+/*                         RPCTransformPoint()                          */
+/************************************************************************/
+
+static void RPCTransformPoint(const GDALRPCTransformInfo *psRPCTransformInfo,
+                              double dfLong, double dfLat, double dfHeight,
+                              double *pdfPixel, double *pdfLine)
+
+{
+    double adfTermsWithMargin[20 + 1] = {};
+    // Make padfTerms aligned on 16-byte boundary for SSE2 aligned loads.
+    double *padfTerms =
+        adfTermsWithMargin +
+        (reinterpret_cast<GUIntptr_t>(adfTermsWithMargin) % 16) / 8;
+
+    double dfNormalizedLong = 0.0;
+    double dfNormalizedLat = 0.0;
+    double dfNormalizedHeight = 0.0;
+    RPCNormalizePoint(psRPCTransformInfo, dfLong, dfLat, dfHeight,
+                      dfNormalizedLong, dfNormalizedLat, dfNormalizedHeight);
 
     RPCComputeTerms(dfNormalizedLong, dfNormalizedLat, dfNormalizedHeight,
                     padfTerms);
@@ -465,6 +485,173 @@ static void RPCTransformPoint(const GDALRPCTransformInfo *psRPCTransformInfo,
                psRPCTransformInfo->sRPC.dfLINE_OFF + 0.5;
 }
 
+/************************************************************************/
+/*                         RPCEvaluateRatios()                          */
+/************************************************************************/
+
+#ifdef USE_SSE2_OPTIM
+
+// Computes, for nPointCount normalized points (nPointCount being a multiple
+// of 4), the SAMP_NUM/SAMP_DEN and LINE_NUM/LINE_DEN ratios, with exactly the
+// same results as RPCComputeTerms() and RPCEvaluate4(), but evaluating 4
+// points at once, each SIMD lane processing one point.
+static void RPCEvaluateRatios(const double *padfCoefs, int nPointCount,
+                              const double *padfLong, const double *padfLat,
+                              const double *padfHeight, double *padfSampRatio,
+                              double *padfLineRatio)
+
+{
+    for (int iPoint = 0; iPoint < nPointCount; iPoint += 4)
+    {
+        const auto L = XMMReg4Double::Load4Val(padfLong + iPoint);
+        const auto P = XMMReg4Double::Load4Val(padfLat + iPoint);
+        const auto H = XMMReg4Double::Load4Val(padfHeight + iPoint);
+
+        // Same evaluation order as RPCComputeTerms().
+        XMMReg4Double aTerms[20];
+        aTerms[0] = XMMReg4Double::Set1(1.0);
+        aTerms[1] = L;
+        aTerms[2] = P;
+        aTerms[3] = H;
+        aTerms[4] = L * P;
+        aTerms[5] = L * H;
+        aTerms[6] = P * H;
+        aTerms[7] = L * L;
+        aTerms[8] = P * P;
+        aTerms[9] = H * H;
+        aTerms[10] = aTerms[4] * H;
+        aTerms[11] = aTerms[7] * L;
+        aTerms[12] = aTerms[4] * P;
+        aTerms[13] = aTerms[5] * H;
+        aTerms[14] = aTerms[7] * P;
+        aTerms[15] = aTerms[8] * P;
+        aTerms[16] = aTerms[6] * H;
+        aTerms[17] = aTerms[7] * H;
+        aTerms[18] = aTerms[8] * H;
+        aTerms[19] = aTerms[9] * H;
+
+        // RPCEvaluate4() sums the terms of even and odd indices separately,
+        // and then adds both sums.
+        XMMReg4Double aSums[4];
+        for (int j = 0; j < 4; ++j)
+        {
+            auto sumEven = XMMReg4Double::Zero();
+            auto sumOdd = XMMReg4Double::Zero();
+            for (int i = 0; i < 20; i += 2)
+            {
+                sumEven +=
+                    aTerms[i] * XMMReg4Double::Set1(padfCoefs[j * 20 + i]);
+                sumOdd += aTerms[i + 1] *
+                          XMMReg4Double::Set1(padfCoefs[j * 20 + i + 1]);
+            }
+            aSums[j] = sumEven + sumOdd;
+        }
+
+        (aSums[2] / aSums[3]).Store4Val(padfSampRatio + iPoint);
+        (aSums[0] / aSums[1]).Store4Val(padfLineRatio + iPoint);
+    }
+}
+
+#endif
+
+/************************************************************************/
+/*                         RPCTransformPoints()                         */
+/************************************************************************/
+
+// Batch version of RPCTransformPoint(), transforming in place the
+// (long, lat) points of padfX/padfY, with heights padfHeight, into
+// (pixel, line), for points whose panSuccess[] value is TRUE. Gives exactly
+// the same results as RPCTransformPoint() called on each point.
+static void RPCTransformPoints(const GDALRPCTransformInfo *psRPCTransformInfo,
+                               int nPointCount, double *padfX, double *padfY,
+                               const double *padfHeight, const int *panSuccess)
+
+{
+#ifdef USE_SSE2_OPTIM
+    if (!psRPCTransformInfo->bUseBatch)
+    {
+        for (int i = 0; i < nPointCount; ++i)
+        {
+            if (panSuccess[i])
+                RPCTransformPoint(psRPCTransformInfo, padfX[i], padfY[i],
+                                  padfHeight[i], padfX + i, padfY + i);
+        }
+        return;
+    }
+
+    const GDALRPCInfoV2 &sRPC = psRPCTransformInfo->sRPC;
+
+    // Points are normalized by chunks, whose size is a multiple of 4.
+    constexpr int CHUNK_SIZE = 64;
+    int anIdx[CHUNK_SIZE];
+    double adfLong[CHUNK_SIZE];
+    double adfLat[CHUNK_SIZE];
+    double adfHeight[CHUNK_SIZE];
+    double adfSampRatio[CHUNK_SIZE];
+    double adfLineRatio[CHUNK_SIZE];
+    int nInChunk = 0;
+
+    const auto EvaluateChunk = [&]()
+    {
+        // Unused lanes of the last SIMD register are evaluated at the origin,
+        // and their results are discarded.
+        const int nPaddedCount = (nInChunk + 3) / 4 * 4;
+        for (int k = nInChunk; k < nPaddedCount; ++k)
+        {
+            adfLong[k] = 0.0;
+            adfLat[k] = 0.0;
+            adfHeight[k] = 0.0;
+        }
+#ifdef HAVE_AVX_AT_COMPILE_TIME
+        if (psRPCTransformInfo->bUseAVX)
+        {
+            GDALRPCEvaluateRatiosAVX(psRPCTransformInfo->padfCoeffs,
+                                     nPaddedCount, adfLong, adfLat, adfHeight,
+                                     adfSampRatio, adfLineRatio);
+        }
+        else
+#endif
+        {
+            RPCEvaluateRatios(psRPCTransformInfo->padfCoeffs, nPaddedCount,
+                              adfLong, adfLat, adfHeight, adfSampRatio,
+                              adfLineRatio);
+        }
+
+        // RPCs are using the center of upper left pixel = 0,0 convention
+        // convert to top left corner = 0,0 convention used in GDAL.
+        for (int k = 0; k < nInChunk; ++k)
+        {
+            padfX[anIdx[k]] = adfSampRatio[k] * sRPC.dfSAMP_SCALE +
+                              sRPC.dfSAMP_OFF + 0.5;
+            padfY[anIdx[k]] = adfLineRatio[k] * sRPC.dfLINE_SCALE +
+                              sRPC.dfLINE_OFF + 0.5;
+        }
+        nInChunk = 0;
+    };
+
+    for (int i = 0; i < nPointCount; ++i)
+    {
+        if (!panSuccess[i])
+            continue;
+        anIdx[nInChunk] = i;
+        RPCNormalizePoint(psRPCTransformInfo, padfX[i], padfY[i],
+                          padfHeight[i], adfLong[nInChunk], adfLat[nInChunk],
+                          adfHeight[nInChunk]);
+        if (++nInChunk == CHUNK_SIZE)
+            EvaluateChunk();
+    }
+    if (nInChunk > 0)
+        EvaluateChunk();
+#else
+    for (int i = 0; i < nPointCount; ++i)
+    {
+        if (panSuccess[i])
+            RPCTransformPoint(psRPCTransformInfo, padfX[i], padfY[i],
+                              padfHeight[i], padfX + i, padfY + i);
+    }
+#endif
+}
+
 /************************************************************************/
 /*                     GDALSerializeRPCDEMResample()                    */
 /************************************************************************/
@@ -857,6 +1044,15 @@ void *GDALCreateRPCTransformerV2(const GDALRPCInfoV2 *psRPCInfo, int bReversed,
            20 * sizeof(double));
     memcpy(psTransform->padfCoeffs + 60, psRPCInfo->adfSAMP_DEN_COEFF,
            20 * sizeof(double));
+    // Mostly for testing purposes: the per-point evaluation is the reference
+    // of the batch one.
+    psTransform->bUseBatch =
+        CPLTestBool(CPLGetConfigOption("GDAL_RPC_BATCH_EVALUATION", "YES"));
+#ifdef HAVE_AVX_AT_COMPILE_TIME
+    psTransform->bUseAVX =
+        CPLTestBool(CPLGetConfigOption("GDAL_USE_AVX", "YES")) &&
+        CPLHaveRuntimeAVX();
+#endif
 #endif
 
     /* -------------------------------------------------------------------- */
@@ -1428,10 +1624,16 @@ GDALRPCTransformWholeLineWithDEM(const GDALRPCTransformInfo *psTransform,
 {
     double *padfDEMBuffer = static_cast<double *>(
         VSI_MALLOC3_VERBOSE(sizeof(double), nXWidth, nYHeight));
-    if (padfDEMBuffer == nullptr)
+    // Heights of the points, so that the RPC polynomials are evaluated on
+    // the whole line at once.
+    double *padfHeight = static_cast<double *>(
+        VSI_MALLOC2_VERBOSE(sizeof(double), nPointCount));
+    if (padfDEMBuffer == nullptr || padfHeight == nullptr)
     {
         for (int i = 0; i < nPointCount; i++)
             panSuccess[i] = FALSE;
+        VSIFree(padfDEMBuffer);
+        VSIFree(padfHeight);
         return FALSE;
     }
     CPLErr eErr = psTransform->poDS->GetRasterBand(1)->RasterIO(
@@ -1442,6 +1644,7 @@ GDALRPCTransformWholeLineWithDEM(const GDALRPCTransformInfo *psTransform,
         for (int i = 0; i < nPointCount; i++)
             panSuccess[i] = FALSE;
         VSIFree(padfDEMBuffer);
+        VSIFree(padfHeight);
         return FALSE;
     }
 
@@ -1566,11 +1769,9 @@ GDALRPCTransformWholeLineWithDEM(const GDALRPCTransformInfo *psTransform,
                             continue;
                         }
                         dfDEMH = adfElevData[k_valid_sample];
-                        RPCTransformPoint(
-                            psTransform, padfX[i], padfY[i],
+                        padfHeight[i] =
                             dfZ_i + (psTransform->dfHeightOffset + dfDEMH) *
-                                        psTransform->dfHeightScale,
-                            padfX + i, padfY + i);
+                                        psTransform->dfHeightScale;
 
                         panSuccess[i] = TRUE;
                         continue;
@@ -1586,11 +1787,9 @@ GDALRPCTransformWholeLineWithDEM(const GDALRPCTransformInfo *psTransform,
                             continue;
                         }
                         dfDEMH = psTransform->dfDEMMissingValue;
-                        RPCTransformPoint(
-                            psTransform, padfX[i], padfY[i],
+                        padfHeight[i] =
                             dfZ_i + (psTransform->dfHeightOffset + dfDEMH) *
-                                        psTransform->dfHeightScale,
-                            padfX + i, padfY + i);
+                                        psTransform->dfHeightScale;
 
                         panSuccess[i] = TRUE;
                         continue;
@@ -1646,15 +1845,17 @@ GDALRPCTransformWholeLineWithDEM(const GDALRPCTransformInfo *psTransform,
             padfY[i] = HUGE_VAL;
             continue;
         }
-        RPCTransformPoint(psTransform, padfX[i], padfY[i],
-                          dfZ_i + (psTransform->dfHeightOffset + dfDEMH) *
-                                      psTransform->dfHeightScale,
-                          padfX + i, padfY + i);
+        padfHeight[i] = dfZ_i + (psTransform->dfHeightOffset + dfDEMH) *
+                                    psTransform->dfHeightScale;
 
         panSuccess[i] = TRUE;
     }
 
+    RPCTransformPoints(psTransform, nPointCount, padfX, padfY, padfHeight,
+                       panSuccess);
+
     VSIFree(padfDEMBuffer);
+    VSIFree(padfHeight);
 
     return bRet;
 }
@@ -1918,32 +2119,42 @@ int GDALRPCTransform(void *pTransformArg, int bDstToSrc, int nPointCount,
             }
         }
 
+        // Fetch heights by chunks of points, and evaluate the RPC
+        // polynomials on each chunk at once.
+        constexpr int CHUNK_SIZE = 256;
+        double adfHeight[CHUNK_SIZE];
         int bRet = TRUE;
-        for (int i = 0; i < nPointCount; i++)
+        for (int iStart = 0; iStart < nPointCount; iStart += CHUNK_SIZE)
         {
-            if (!RPCIsValidLongLat(psTransform, padfX[i], padfY[i]))
-            {
-                bRet = FALSE;
-                panSuccess[i] = FALSE;
-                padfX[i] = HUGE_VAL;
-                padfY[i] = HUGE_VAL;
-                continue;
-            }
-            double dfHeight = 0.0;
-            if (!GDALRPCGetHeightAtLongLat(psTransform, padfX[i], padfY[i],
-                                           &dfHeight))
+            const int nChunkSize = std::min(CHUNK_SIZE, nPointCount - iStart);
+            for (int iChunk = 0; iChunk < nChunkSize; iChunk++)
             {
-                bRet = FALSE;
-                panSuccess[i] = FALSE;
-                padfX[i] = HUGE_VAL;
-                padfY[i] = HUGE_VAL;
-                continue;
+                const int i = iStart + iChunk;
+                if (!RPCIsValidLongLat(psTransform, padfX[i], padfY[i]))
+                {
+                    bRet = FALSE;
+                    panSuccess[i] = FALSE;
+                    padfX[i] = HUGE_VAL;
+                    padfY[i] = HUGE_VAL;
+                    continue;
+                }
+                double dfHeight = 0.0;
+                if (!GDALRPCGetHeightAtLongLat(psTransform, padfX[i],
+                                               padfY[i], &dfHeight))
+                {
+                    bRet = FALSE;
+                    panSuccess[i] = FALSE;
+                    padfX[i] = HUGE_VAL;
+                    padfY[i] = HUGE_VAL;
+                    continue;
+                }
+
+                adfHeight[iChunk] = (padfZ ? padfZ[i] : 0.0) + dfHeight;
+                panSuccess[i] = TRUE;
             }
 
-            RPCTransformPoint(psTransform, padfX[i], padfY[i],
-                              (padfZ ? padfZ[i] : 0.0) + dfHeight, padfX + i,
-                              padfY + i);
-            panSuccess[i] = TRUE;
+            RPCTransformPoints(psTransform, nChunkSize, padfX + iStart,
+                               padfY + iStart, adfHeight, panSuccess + iStart);
         }
 
         return bRet;
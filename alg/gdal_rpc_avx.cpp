@@ -0,0 +1,85 @@
+/******************************************************************************
+ *
+ * Project:  GDAL
+ * Purpose:  AVX evaluation of the polynomials of the rational polynomial
+ *           (RPC) based transformer.
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "gdal_alg_priv.h"
+
+#ifdef HAVE_AVX_AT_COMPILE_TIME
+#include <immintrin.h>
+
+/************************************************************************/
+/*                      GDALRPCEvaluateRatiosAVX()                      */
+/************************************************************************/
+
+// AVX version of RPCEvaluateRatios() from gdal_rpc.cpp. padfCoefs are the
+// LINE_NUM, LINE_DEN, SAMP_NUM and then SAMP_DEN coefficients, and
+// nPointCount must be a multiple of 4. The evaluation order is kept
+// identical to the one of the SSE2 code path, so that results are the same.
+void GDALRPCEvaluateRatiosAVX(const double *padfCoefs, int nPointCount,
+                              const double *padfLong, const double *padfLat,
+                              const double *padfHeight, double *padfSampRatio,
+                              double *padfLineRatio)
+{
+    for (int iPoint = 0; iPoint < nPointCount; iPoint += 4)
+    {
+        const __m256d L = _mm256_loadu_pd(padfLong + iPoint);
+        const __m256d P = _mm256_loadu_pd(padfLat + iPoint);
+        const __m256d H = _mm256_loadu_pd(padfHeight + iPoint);
+
+        __m256d aTerms[20];
+        aTerms[0] = _mm256_set1_pd(1.0);
+        aTerms[1] = L;
+        aTerms[2] = P;
+        aTerms[3] = H;
+        aTerms[4] = _mm256_mul_pd(L, P);
+        aTerms[5] = _mm256_mul_pd(L, H);
+        aTerms[6] = _mm256_mul_pd(P, H);
+        aTerms[7] = _mm256_mul_pd(L, L);
+        aTerms[8] = _mm256_mul_pd(P, P);
+        aTerms[9] = _mm256_mul_pd(H, H);
+        aTerms[10] = _mm256_mul_pd(aTerms[4], H);
+        aTerms[11] = _mm256_mul_pd(aTerms[7], L);
+        aTerms[12] = _mm256_mul_pd(aTerms[4], P);
+        aTerms[13] = _mm256_mul_pd(aTerms[5], H);
+        aTerms[14] = _mm256_mul_pd(aTerms[7], P);
+        aTerms[15] = _mm256_mul_pd(aTerms[8], P);
+        aTerms[16] = _mm256_mul_pd(aTerms[6], H);
+        aTerms[17] = _mm256_mul_pd(aTerms[7], H);
+        aTerms[18] = _mm256_mul_pd(aTerms[8], H);
+        aTerms[19] = _mm256_mul_pd(aTerms[9], H);
+
+        __m256d aSums[4];
+        for (int j = 0; j < 4; ++j)
+        {
+            __m256d sumEven = _mm256_setzero_pd();
+            __m256d sumOdd = _mm256_setzero_pd();
+            for (int i = 0; i < 20; i += 2)
+            {
+                const __m256d coefEven =
+                    _mm256_broadcast_sd(padfCoefs + j * 20 + i);
+                const __m256d coefOdd =
+                    _mm256_broadcast_sd(padfCoefs + j * 20 + i + 1);
+                sumEven =
+                    _mm256_add_pd(sumEven, _mm256_mul_pd(aTerms[i], coefEven));
+                sumOdd = _mm256_add_pd(sumOdd,
+                                       _mm256_mul_pd(aTerms[i + 1], coefOdd));
+            }
+            aSums[j] = _mm256_add_pd(sumEven, sumOdd);
+        }
+
+        _mm256_storeu_pd(padfSampRatio + iPoint,
+                         _mm256_div_pd(aSums[2], aSums[3]));
+        _mm256_storeu_pd(padfLineRatio + iPoint,
+                         _mm256_div_pd(aSums[0], aSums[1]));
+    }
+}
+
+#endif /* HAVE_AVX_AT_COMPILE_TIME */
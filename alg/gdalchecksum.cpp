@@ -16,13 +16,22 @@
 
 #include <cmath>
 #include <cstddef>
+#include <cstring>
 #include <algorithm>
+#include <deque>
+#include <future>
+#include <memory>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_sha256.h"
+#include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 
 /************************************************************************/
 /*                         GDALChecksumImage()                          */
@@ -373,3 +382,544 @@ int CPL_STDCALL GDALChecksumImage(GDALRasterBandH hBand, int nXOff, int nYOff,
     // coverity[return_overflow]
     return nChecksum;
 }
+
+/************************************************************************/
+/*                                XXH64()                               */
+/************************************************************************/
+
+namespace
+{
+
+// Implementation of the XXH64 hash function (https://xxhash.com/), whose
+// 4 independent accumulators are friendly to instruction-level parallelism
+// and auto-vectorization.
+
+constexpr uint64_t XXH_PRIME64_1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t XXH_PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t XXH_PRIME64_3 = 0x165667B19E3779F9ULL;
+constexpr uint64_t XXH_PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+constexpr uint64_t XXH_PRIME64_5 = 0x27D4EB2F165667C5ULL;
+
+inline uint64_t XXHRotl64(uint64_t x, int r)
+{
+    return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t XXHRead64(const GByte *p)
+{
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    CPL_LSBPTR64(&v);
+    return v;
+}
+
+inline uint32_t XXHRead32(const GByte *p)
+{
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    CPL_LSBPTR32(&v);
+    return v;
+}
+
+inline uint64_t XXHRound(uint64_t nAcc, uint64_t nInput)
+{
+    nAcc += nInput * XXH_PRIME64_2;
+    nAcc = XXHRotl64(nAcc, 31);
+    return nAcc * XXH_PRIME64_1;
+}
+
+inline uint64_t XXHMergeRound(uint64_t nAcc, uint64_t nVal)
+{
+    nAcc ^= XXHRound(0, nVal);
+    return nAcc * XXH_PRIME64_1 + XXH_PRIME64_4;
+}
+
+uint64_t XXH64(const void *pData, size_t nLen, uint64_t nSeed)
+{
+    const GByte *p = static_cast<const GByte *>(pData);
+    const GByte *const pEnd = p + nLen;
+    uint64_t h64;
+
+    if (nLen >= 32)
+    {
+        const GByte *const pLimit = pEnd - 32;
+        uint64_t v1 = nSeed + XXH_PRIME64_1 + XXH_PRIME64_2;
+        uint64_t v2 = nSeed + XXH_PRIME64_2;
+        uint64_t v3 = nSeed;
+        uint64_t v4 = nSeed - XXH_PRIME64_1;
+        do
+        {
+            v1 = XXHRound(v1, XXHRead64(p));
+            v2 = XXHRound(v2, XXHRead64(p + 8));
+            v3 = XXHRound(v3, XXHRead64(p + 16));
+            v4 = XXHRound(v4, XXHRead64(p + 24));
+            p += 32;
+        } while (p <= pLimit);
+
+        h64 = XXHRotl64(v1, 1) + XXHRotl64(v2, 7) + XXHRotl64(v3, 12) +
+              XXHRotl64(v4, 18);
+        h64 = XXHMergeRound(h64, v1);
+        h64 = XXHMergeRound(h64, v2);
+        h64 = XXHMergeRound(h64, v3);
+        h64 = XXHMergeRound(h64, v4);
+    }
+    else
+    {
+        h64 = nSeed + XXH_PRIME64_5;
+    }
+
+    h64 += static_cast<uint64_t>(nLen);
+
+    while (pEnd - p >= 8)
+    {
+        h64 ^= XXHRound(0, XXHRead64(p));
+        h64 = XXHRotl64(h64, 27) * XXH_PRIME64_1 + XXH_PRIME64_4;
+        p += 8;
+    }
+    if (pEnd - p >= 4)
+    {
+        h64 ^= static_cast<uint64_t>(XXHRead32(p)) * XXH_PRIME64_1;
+        h64 = XXHRotl64(h64, 23) * XXH_PRIME64_2 + XXH_PRIME64_3;
+        p += 4;
+    }
+    while (p < pEnd)
+    {
+        h64 ^= (*p) * XXH_PRIME64_5;
+        h64 = XXHRotl64(h64, 11) * XXH_PRIME64_1;
+        ++p;
+    }
+
+    h64 ^= h64 >> 33;
+    h64 *= XXH_PRIME64_2;
+    h64 ^= h64 >> 29;
+    h64 *= XXH_PRIME64_3;
+    h64 ^= h64 >> 32;
+    return h64;
+}
+
+/************************************************************************/
+/*                             GDALHasher                               */
+/************************************************************************/
+
+// Computes the hash of a buffer, for a "domain" that prevents a row hash
+// from colliding with a hash of the tree, or with a band hash.
+class GDALHasher
+{
+  public:
+    enum class Domain : GByte
+    {
+        ROW = 0,
+        NODE = 1,
+        BAND = 2,
+        DATASET = 3,
+    };
+
+    explicit GDALHasher(bool bSHA256) : m_bSHA256(bSHA256)
+    {
+    }
+
+    size_t GetSize() const
+    {
+        return m_bSHA256 ? CPL_SHA256_HASH_SIZE : sizeof(uint64_t);
+    }
+
+    void Hash(Domain eDomain, const void *pData, size_t nSize,
+              GByte *pabyHash) const
+    {
+        const GByte byDomain = static_cast<GByte>(eDomain);
+        if (m_bSHA256)
+        {
+            CPL_SHA256Context sContext;
+            CPL_SHA256Init(&sContext);
+            CPL_SHA256Update(&sContext, &byDomain, 1);
+            CPL_SHA256Update(&sContext, pData, nSize);
+            CPL_SHA256Final(&sContext, pabyHash);
+        }
+        else
+        {
+            // Big-endian, as the canonical representation of XXH64
+            uint64_t nHash = XXH64(pData, nSize, byDomain);
+            CPL_MSBPTR64(&nHash);
+            memcpy(pabyHash, &nHash, sizeof(nHash));
+        }
+    }
+
+  private:
+    const bool m_bSHA256;
+};
+
+/************************************************************************/
+/*                           HashRasterBands()                          */
+/************************************************************************/
+
+// Computes the hash of each band of apoBands, that must have the same
+// dimensions. The hash of a band is the root of a binary tree whose leaves
+// are the hashes of its rows (in native data type and little-endian order),
+// combined with its data type and dimensions. It hence depends neither on
+// the block structure nor on the number of threads.
+//
+// Data is read on the calling thread, by chunks of whole rows of blocks, and
+// rows are hashed by worker threads.
+bool HashRasterBands(const std::vector<GDALRasterBand *> &apoBands,
+                     const GDALHasher &oHasher, int nThreads,
+                     std::vector<GByte> &abyBandHashes,
+                     GDALProgressFunc pfnProgress, void *pProgressData)
+{
+    const size_t nHashSize = oHasher.GetSize();
+    const int nXSize = apoBands[0]->GetXSize();
+    const int nYSize = apoBands[0]->GetYSize();
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    apoBands[0]->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    nBlockYSize = std::max(1, std::min(nBlockYSize, nYSize));
+
+    size_t nMaxLineSize = 0;
+    for (auto *poBand : apoBands)
+    {
+        nMaxLineSize = std::max(
+            nMaxLineSize,
+            static_cast<size_t>(nXSize) *
+                GDALGetDataTypeSizeBytes(poBand->GetRasterDataType()));
+    }
+    // Group rows of blocks so that each job processes at least 1 MB
+    constexpr size_t MIN_CHUNK_SIZE = 1024 * 1024;
+    const size_t nBlockRowSize = nMaxLineSize * nBlockYSize;
+    const int nChunkYSize = static_cast<int>(std::min<size_t>(
+        nYSize,
+        static_cast<size_t>(nBlockYSize) *
+            std::max<size_t>(1, MIN_CHUNK_SIZE / std::max<size_t>(
+                                                     1, nBlockRowSize))));
+
+    std::vector<std::vector<GByte>> aabyRowHashes;
+    try
+    {
+        aabyRowHashes.resize(apoBands.size());
+        for (auto &abyRowHashes : aabyRowHashes)
+            abyRowHashes.resize(static_cast<size_t>(nYSize) * nHashSize);
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate memory for row hashes");
+        return false;
+    }
+
+    std::deque<std::future<void>> aoPendingJobs;
+    // Jobs write into aabyRowHashes. The destructor of the job queue waits
+    // for them, so it must run before aabyRowHashes is freed when returning
+    // early on error, hence the declaration after it.
+    std::unique_ptr<CPLJobQueue> poJobQueue;
+    if (nThreads > 1)
+    {
+        auto poThreadPool = GDALGetGlobalThreadPool(nThreads);
+        if (poThreadPool)
+            poJobQueue = poThreadPool->CreateJobQueue();
+    }
+
+    const GIntBig nTotalChunks =
+        static_cast<GIntBig>(DIV_ROUND_UP(nYSize, nChunkYSize)) *
+        static_cast<GIntBig>(apoBands.size());
+    GIntBig nChunksDone = 0;
+    for (int iY = 0; iY < nYSize; iY += nChunkYSize)
+    {
+        const int nRows = std::min(nChunkYSize, nYSize - iY);
+        for (size_t iBand = 0; iBand < apoBands.size(); ++iBand)
+        {
+            GDALRasterBand *poBand = apoBands[iBand];
+            const GDALDataType eDT = poBand->GetRasterDataType();
+            const int nDTSize = GDALGetDataTypeSizeBytes(eDT);
+            const size_t nLineSize = static_cast<size_t>(nXSize) * nDTSize;
+
+            auto pabyBuffer = std::make_shared<std::vector<GByte>>();
+            try
+            {
+                pabyBuffer->resize(nLineSize * nRows);
+            }
+            catch (const std::bad_alloc &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Cannot allocate memory for a chunk of %d rows",
+                         nRows);
+                return false;
+            }
+            if (poBand->RasterIO(GF_Read, 0, iY, nXSize, nRows,
+                                 pabyBuffer->data(), nXSize, nRows, eDT, 0, 0,
+                                 nullptr) != CE_None)
+            {
+                CPLError(CE_Failure, CPLE_FileIO,
+                         "Hash could not be computed due to I/O read error.");
+                return false;
+            }
+
+            GByte *pabyRowHashes = aabyRowHashes[iBand].data() +
+                                   static_cast<size_t>(iY) * nHashSize;
+            const int nWordSize =
+                GDALDataTypeIsComplex(eDT) ? nDTSize / 2 : nDTSize;
+            const auto HashRows = [&oHasher, pabyBuffer, pabyRowHashes,
+                                   nWordSize, nLineSize, nRows, nHashSize]()
+            {
+                if (!CPL_IS_LSB && nWordSize > 1)
+                {
+                    GDALSwapWordsEx(pabyBuffer->data(), nWordSize,
+                                    pabyBuffer->size() / nWordSize, nWordSize);
+                }
+                for (int iRow = 0; iRow < nRows; ++iRow)
+                {
+                    oHasher.Hash(GDALHasher::Domain::ROW,
+                                 pabyBuffer->data() + iRow * nLineSize,
+                                 nLineSize, pabyRowHashes + iRow * nHashSize);
+                }
+            };
+
+            if (!poJobQueue)
+            {
+                HashRows();
+            }
+            else
+            {
+                // Bound the number of chunks in memory
+                while (aoPendingJobs.size() >= static_cast<size_t>(nThreads))
+                {
+                    aoPendingJobs.front().get();
+                    aoPendingJobs.pop_front();
+                }
+                auto poPromise = std::make_shared<std::promise<void>>();
+                aoPendingJobs.push_back(poPromise->get_future());
+                poJobQueue->SubmitJob(
+                    [HashRows, poPromise]()
+                    {
+                        HashRows();
+                        poPromise->set_value();
+                    });
+            }
+
+            // Completion is only reported once all rows are hashed
+            ++nChunksDone;
+            if (pfnProgress && nChunksDone < nTotalChunks &&
+                !pfnProgress(static_cast<double>(nChunksDone) / nTotalChunks,
+                             "", pProgressData))
+            {
+                CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+                return false;
+            }
+        }
+    }
+    if (poJobQueue)
+        poJobQueue->WaitCompletion();
+
+    // Reduce the row hashes of each band to the root of the tree, and
+    // combine it with the band data type and dimensions
+    abyBandHashes.resize(apoBands.size() * nHashSize);
+    for (size_t iBand = 0; iBand < apoBands.size(); ++iBand)
+    {
+        std::vector<GByte> &abyLevel = aabyRowHashes[iBand];
+        std::vector<GByte> abyPair(2 * nHashSize);
+        size_t nCount = static_cast<size_t>(nYSize);
+        while (nCount > 1)
+        {
+            size_t nNewCount = 0;
+            for (size_t i = 0; i + 1 < nCount; i += 2, ++nNewCount)
+            {
+                memcpy(abyPair.data(), abyLevel.data() + i * nHashSize,
+                       2 * nHashSize);
+                oHasher.Hash(GDALHasher::Domain::NODE, abyPair.data(),
+                             abyPair.size(),
+                             abyLevel.data() + nNewCount * nHashSize);
+            }
+            if ((nCount % 2) != 0)
+            {
+                // Odd node promoted to the next level
+                memmove(abyLevel.data() + nNewCount * nHashSize,
+                        abyLevel.data() + (nCount - 1) * nHashSize, nHashSize);
+                ++nNewCount;
+            }
+            nCount = nNewCount;
+        }
+
+        std::string osHeader(
+            GDALGetDataTypeName(apoBands[iBand]->GetRasterDataType()));
+        osHeader += '\0';
+        for (uint32_t nVal : {static_cast<uint32_t>(nXSize),
+                              static_cast<uint32_t>(nYSize)})
+        {
+            CPL_LSBPTR32(&nVal);
+            osHeader.append(reinterpret_cast<const char *>(&nVal),
+                            sizeof(nVal));
+        }
+        osHeader.append(reinterpret_cast<const char *>(abyLevel.data()),
+                        nHashSize);
+        oHasher.Hash(GDALHasher::Domain::BAND, osHeader.data(),
+                     osHeader.size(), abyBandHashes.data() + iBand * nHashSize);
+    }
+
+    if (pfnProgress && !pfnProgress(1.0, "", pProgressData))
+    {
+        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+        return false;
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                          GetHashParameters()                         */
+/************************************************************************/
+
+bool GetHashParameters(CSLConstList papszOptions, bool &bSHA256, int &nThreads)
+{
+    const char *pszAlgorithm =
+        CSLFetchNameValueDef(papszOptions, "ALGORITHM", "XXH64");
+    if (EQUAL(pszAlgorithm, "XXH64"))
+        bSHA256 = false;
+    else if (EQUAL(pszAlgorithm, "SHA256"))
+        bSHA256 = true;
+    else
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Unsupported value for ALGORITHM: %s", pszAlgorithm);
+        return false;
+    }
+
+    const char *pszNumThreads = CSLFetchNameValueDef(
+        papszOptions, "NUM_THREADS",
+        CPLGetConfigOption("GDAL_NUM_THREADS", "1"));
+    nThreads = std::max(1, std::min(128, EQUAL(pszNumThreads, "ALL_CPUS")
+                                             ? CPLGetNumCPUs()
+                                             : atoi(pszNumThreads)));
+    return true;
+}
+
+/************************************************************************/
+/*                              ToHex()                                 */
+/************************************************************************/
+
+char *ToHex(const GByte *pabyHash, size_t nHashSize)
+{
+    std::string osHex;
+    for (size_t i = 0; i < nHashSize; ++i)
+        osHex += CPLSPrintf("%02x", pabyHash[i]);
+    return CPLStrdup(osHex.c_str());
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                     GDALComputeRasterBandHash()                      */
+/************************************************************************/
+
+/**
+ * Compute a hash of the pixel values of a raster band.
+ *
+ * Unlike GDALChecksumImage(), the hash is computed on the raw values of the
+ * band, with a strong hash function, and the band is read by chunks of
+ * blocks whose rows are hashed in parallel by worker threads. The
+ * hashes of the rows are combined in a binary tree, so that the result is
+ * deterministic: it depends only on the data type, dimensions and pixel
+ * values of the band, not on its block structure or the number of threads.
+ *
+ * Options are:
+ * <ul>
+ * <li>ALGORITHM=XXH64/SHA256: hash function. Defaults to XXH64, a fast
+ * non-cryptographic 64-bit hash. SHA256 is slower but cryptographically
+ * secure.</li>
+ * <li>NUM_THREADS=number_of_threads/ALL_CPUS: number of threads used to
+ * hash rows. Defaults to the value of the GDAL_NUM_THREADS configuration
+ * option, or 1.</li>
+ * </ul>
+ *
+ * @param hBand the raster band to read from.
+ * @param papszOptions NULL terminated list of options, or NULL.
+ * @param pfnProgress progress function, or NULL.
+ * @param pProgressData argument to pass to pfnProgress.
+ *
+ * @return the hash as a lowercase hexadecimal string, to free with CPLFree(),
+ * or NULL in case of error.
+ * @since GDAL 3.12
+ */
+
+char *GDALComputeRasterBandHash(GDALRasterBandH hBand,
+                                CSLConstList papszOptions,
+                                GDALProgressFunc pfnProgress,
+                                void *pProgressData)
+{
+    VALIDATE_POINTER1(hBand, "GDALComputeRasterBandHash", nullptr);
+
+    bool bSHA256 = false;
+    int nThreads = 1;
+    if (!GetHashParameters(papszOptions, bSHA256, nThreads))
+        return nullptr;
+    const GDALHasher oHasher(bSHA256);
+
+    std::vector<GByte> abyBandHashes;
+    if (!HashRasterBands({GDALRasterBand::FromHandle(hBand)}, oHasher,
+                         nThreads, abyBandHashes, pfnProgress, pProgressData))
+    {
+        return nullptr;
+    }
+    return ToHex(abyBandHashes.data(), abyBandHashes.size());
+}
+
+/************************************************************************/
+/*                       GDALComputeDatasetHash()                       */
+/************************************************************************/
+
+/**
+ * Compute a hash of the pixel values of all bands of a raster dataset.
+ *
+ * The result is the hash of the number of bands and of the hashes of each
+ * band, as computed by GDALComputeRasterBandHash(). All bands are read in a
+ * single pass, by chunks of rows of blocks. Metadata, georeferencing or
+ * nodata values are not taken into account.
+ *
+ * Options are the same as for GDALComputeRasterBandHash().
+ *
+ * @param hDS the raster dataset to read from.
+ * @param papszOptions NULL terminated list of options, or NULL.
+ * @param pfnProgress progress function, or NULL.
+ * @param pProgressData argument to pass to pfnProgress.
+ *
+ * @return the hash as a lowercase hexadecimal string, to free with CPLFree(),
+ * or NULL in case of error.
+ * @since GDAL 3.12
+ */
+
+char *GDALComputeDatasetHash(GDALDatasetH hDS, CSLConstList papszOptions,
+                             GDALProgressFunc pfnProgress,
+                             void *pProgressData)
+{
+    VALIDATE_POINTER1(hDS, "GDALComputeDatasetHash", nullptr);
+
+    bool bSHA256 = false;
+    int nThreads = 1;
+    if (!GetHashParameters(papszOptions, bSHA256, nThreads))
+        return nullptr;
+    const GDALHasher oHasher(bSHA256);
+
+    auto poDS = GDALDataset::FromHandle(hDS);
+    std::vector<GDALRasterBand *> apoBands;
+    for (int i = 1; i <= poDS->GetRasterCount(); ++i)
+        apoBands.push_back(poDS->GetRasterBand(i));
+
+    std::vector<GByte> abyData;
+    uint32_t nBandCount = static_cast<uint32_t>(apoBands.size());
+    CPL_LSBPTR32(&nBandCount);
+    abyData.insert(abyData.end(), reinterpret_cast<const GByte *>(&nBandCount),
+                   reinterpret_cast<const GByte *>(&nBandCount) +
+                       sizeof(nBandCount));
+    if (!apoBands.empty())
+    {
+        std::vector<GByte> abyBandHashes;
+        if (!HashRasterBands(apoBands, oHasher, nThreads, abyBandHashes,
+                             pfnProgress, pProgressData))
+        {
+            return nullptr;
+        }
+        abyData.insert(abyData.end(), abyBandHashes.begin(),
+                       abyBandHashes.end());
+    }
+
+    std::vector<GByte> abyHash(oHasher.GetSize());
+    oHasher.Hash(GDALHasher::Domain::DATASET, abyData.data(), abyData.size(),
+                 abyHash.data());
+    return ToHex(abyHash.data(), abyHash.size());
+}
@@ -26,7 +26,11 @@
 #include <cstring>
 
 #include <algorithm>
+#include <functional>
 #include <limits>
+#include <memory>
+#include <new>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -34,8 +38,10 @@
 #include "cpl_quad_tree.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "memdataset.h"
 
 constexpr float INVALID_BMXY = -10.0f;
@@ -148,6 +154,123 @@ inline double Clamp(double v, double minV, double maxV)
     }                                                                          \
     }
 
+/************************************************************************/
+/*                       GDALGeoLocPartialBackMap                       */
+/************************************************************************/
+
+// Backmap accumulated by a worker thread of GenerateBackMap(). It exposes
+// the same backmap accessor members as GDALGeoLocCArrayAccessors. As the
+// backmap rows hit by a strip of the geolocation array are not known in
+// advance, rows are allocated on demand, and reading a row that has not been
+// allocated returns zero.
+class GDALGeoLocPartialBackMap
+{
+    const int m_nWidth;
+    const int m_nHeight;
+    int m_nYOff = 0;
+    int m_nRows = 0;
+    // X, Y and weight values, interleaved
+    std::vector<float> m_afValues{};
+
+    GDALGeoLocPartialBackMap(const GDALGeoLocPartialBackMap &) = delete;
+    GDALGeoLocPartialBackMap &
+    operator=(const GDALGeoLocPartialBackMap &) = delete;
+
+    void Extend(int nY);
+
+    float Get(int iComponent, int nX, int nY) const
+    {
+        if (nY < m_nYOff || nY >= m_nYOff + m_nRows)
+            return 0;
+        return m_afValues[(static_cast<size_t>(nY - m_nYOff) * m_nWidth + nX) *
+                              3 +
+                          iComponent];
+    }
+
+    void Set(int iComponent, int nX, int nY, float fVal)
+    {
+        if (nY < m_nYOff || nY >= m_nYOff + m_nRows)
+            Extend(nY);
+        m_afValues[(static_cast<size_t>(nY - m_nYOff) * m_nWidth + nX) * 3 +
+                   iComponent] = fVal;
+    }
+
+  public:
+    struct Accessor
+    {
+        GDALGeoLocPartialBackMap *m_poParent;
+        int m_iComponent;
+
+        inline float Get(int nX, int nY) const
+        {
+            return m_poParent->Get(m_iComponent, nX, nY);
+        }
+
+        inline bool Set(int nX, int nY, float fVal)
+        {
+            m_poParent->Set(m_iComponent, nX, nY, fVal);
+            return true;
+        }
+    };
+
+    Accessor backMapXAccessor{this, 0};
+    Accessor backMapYAccessor{this, 1};
+    Accessor backMapWeightAccessor{this, 2};
+
+    GDALGeoLocPartialBackMap(int nWidth, int nHeight)
+        : m_nWidth(nWidth), m_nHeight(nHeight)
+    {
+    }
+
+    int GetYOff() const
+    {
+        return m_nYOff;
+    }
+
+    int GetRows() const
+    {
+        return m_nRows;
+    }
+};
+
+/************************************************************************/
+/*                  GDALGeoLocPartialBackMap::Extend()                  */
+/************************************************************************/
+
+// Makes row nY available. The allocated range is grown by at least half of
+// its size, so that reallocations are amortized.
+void GDALGeoLocPartialBackMap::Extend(int nY)
+{
+    int nNewYOff = nY;
+    int nNewEnd = nY + 1;
+    if (m_nRows > 0)
+    {
+        const int nGrow = std::max(1, m_nRows / 2);
+        if (nY < m_nYOff)
+        {
+            nNewYOff = std::min(nY, std::max(0, m_nYOff - nGrow));
+            nNewEnd = m_nYOff + m_nRows;
+        }
+        else
+        {
+            nNewYOff = m_nYOff;
+            nNewEnd = std::max(
+                nY + 1, std::min(m_nHeight, m_nYOff + m_nRows + nGrow));
+        }
+    }
+    std::vector<float> afNewValues(static_cast<size_t>(nNewEnd - nNewYOff) *
+                                   m_nWidth * 3);
+    if (m_nRows > 0)
+    {
+        std::copy(m_afValues.begin(), m_afValues.end(),
+                  afNewValues.begin() +
+                      static_cast<size_t>(m_nYOff - nNewYOff) * m_nWidth * 3);
+    }
+    m_afValues = std::move(afNewValues);
+    m_nYOff = nNewYOff;
+    m_nRows = nNewEnd - nNewYOff;
+}
+
 /************************************************************************/
 /*                    GDALGeoLoc::LoadGeolocFinish()                    */
 /************************************************************************/
@@ -656,12 +779,6 @@ int GDALGeoLoc<Accessors>::Transform(void *pTransformArg, int bDstToSrc,
         const bool bGeolocMaxAccuracy = CPLTestBool(
             CPLGetConfigOption("GDAL_GEOLOC_USE_MAX_ACCURACY", "YES"));
 
-        // Keep those objects in this outer scope, so they are re-used, to
-        // save memory allocations.
-        OGRPoint oPoint;
-        OGRLinearRing oRing;
-        oRing.setNumPoints(5);
-
         auto pAccessors = static_cast<Accessors *>(psTransform->pAccessors);
 
         for (int i = 0; i < nPointCount; i++)
@@ -791,8 +908,6 @@ int GDALGeoLoc<Accessors>::Transform(void *pTransformArg, int bDstToSrc,
             // the approximate solution should match the exact one, if the
             // backmap has correctly been built.
 
-            oPoint.setX(dfGeoX);
-            oPoint.setY(dfGeoY);
             // The thresholds and radius are rather empirical and have been
             // tuned on the product
             // S5P_TEST_L2__NO2____20190509T220707_20190509T234837_08137_01_010400_20200220T091343.nc
@@ -881,13 +996,9 @@ int GDALGeoLoc<Accessors>::Transform(void *pTransformArg, int bDstToSrc,
                                 x2 += 360;
                                 x3 += 360;
                             }
-                            oRing.setPoint(0, x0, y0);
-                            oRing.setPoint(1, x2, y2);
-                            oRing.setPoint(2, x3, y3);
-                            oRing.setPoint(3, x1, y1);
-                            oRing.setPoint(4, x0, y0);
-                            if (oRing.isPointInRing(&oPoint) ||
-                                oRing.isPointOnRingBoundary(&oPoint))
+                            if (GDALGeoLocIsPointInQuad(dfGeoX, dfGeoY, x0,
+                                                        y0, x1, y1, x2, y2, x3,
+                                                        y3))
                             {
                                 double dfX = static_cast<double>(iX);
                                 double dfY = static_cast<double>(iY);
@@ -1084,11 +1195,14 @@ bool GDALGeoLoc<Accessors>::GenerateBackMap(
     const double dfGeorefConventionOffset =
         psTransform->bOriginIsTopLeftCorner ? 0 : 0.5;
 
-    const auto UpdateBackmap =
-        [&](int iBMX, int iBMY, double dfX, double dfY, double tempwt)
+    // oBackMap is either *pAccessors, or a partial backmap of a worker
+    // thread. It must expose backMapXAccessor, backMapYAccessor and
+    // backMapWeightAccessor members.
+    const auto UpdateBackmap = [&](auto &oBackMap, int iBMX, int iBMY,
+                                   double dfX, double dfY, double tempwt)
     {
-        const auto fBMX = pAccessors->backMapXAccessor.Get(iBMX, iBMY);
-        const auto fBMY = pAccessors->backMapYAccessor.Get(iBMX, iBMY);
+        const auto fBMX = oBackMap.backMapXAccessor.Get(iBMX, iBMY);
+        const auto fBMY = oBackMap.backMapYAccessor.Get(iBMX, iBMY);
         const float fUpdatedBMX =
             fBMX +
             static_cast<float>(tempwt * ((dfX + dfGeorefConventionOffset) *
@@ -1100,7 +1214,7 @@ bool GDALGeoLoc<Accessors>::GenerateBackMap(
                                              psTransform->dfLINE_STEP +
                                          psTransform->dfLINE_OFFSET));
         const float fUpdatedWeight =
-            pAccessors->backMapWeightAccessor.Get(iBMX, iBMY) +
+            oBackMap.backMapWeightAccessor.Get(iBMX, iBMY) +
             static_cast<float>(tempwt);
 
         // Only update the backmap if the updated averaged value results in a
@@ -1134,19 +1248,188 @@ bool GDALGeoLoc<Accessors>::GenerateBackMap(
                   fabs(dfGLY - pAccessors->geolocYAccessor.Get(iX, iY)) <=
                       2 * dfPixelYSize)))
             {
-                pAccessors->backMapXAccessor.Set(iBMX, iBMY, fUpdatedBMX);
-                pAccessors->backMapYAccessor.Set(iBMX, iBMY, fUpdatedBMY);
-                pAccessors->backMapWeightAccessor.Set(iBMX, iBMY,
-                                                      fUpdatedWeight);
+                oBackMap.backMapXAccessor.Set(iBMX, iBMY, fUpdatedBMX);
+                oBackMap.backMapYAccessor.Set(iBMX, iBMY, fUpdatedBMY);
+                oBackMap.backMapWeightAccessor.Set(iBMX, iBMY, fUpdatedWeight);
             }
         }
     };
 
-    // Keep those objects in this outer scope, so they are re-used, to
-    // save memory allocations.
-    OGRPoint oPoint;
-    OGRLinearRing oRing;
-    oRing.setNumPoints(5);
+    // Use forward geolocation array interpolation to compute the
+    // georeferenced position corresponding to (dfX, dfY), and push it into
+    // the backmap.
+    const auto PushIntoBackmap = [&](auto &oBackMap, double dfX, double dfY)
+    {
+        double dfGeoLocX;
+        double dfGeoLocY;
+        if (!PixelLineToXY(psTransform, dfX, dfY, dfGeoLocX, dfGeoLocY))
+            return;
+
+        // Compute the floating point coordinates in the pixel space
+        // of the backmap
+        const double dBMX =
+            static_cast<double>((dfGeoLocX - dfMinX) / dfPixelXSize);
+
+        const double dBMY =
+            static_cast<double>((dfMaxY - dfGeoLocY) / dfPixelYSize);
+
+        // Get top left index by truncation
+        const int iBMX = static_cast<int>(std::floor(dBMX));
+        const int iBMY = static_cast<int>(std::floor(dBMY));
+
+        if (iBMX >= 0 && iBMX < nBMXSize && iBMY >= 0 && iBMY < nBMYSize)
+        {
+            // Compute the georeferenced position of the top-left
+            // index of the backmap
+            double dfGeoX = dfMinX + iBMX * dfPixelXSize;
+            const double dfGeoY = dfMaxY - iBMY * dfPixelYSize;
+
+            bool bMatchingGeoLocCellFound = false;
+
+            const int nOuterIters =
+                psTransform->bGeographicSRSWithMinus180Plus180LongRange &&
+                        fabs(dfGeoX) >= 180
+                    ? 2
+                    : 1;
+
+            for (int iOuterIter = 0; iOuterIter < nOuterIters; ++iOuterIter)
+            {
+                if (iOuterIter == 1 && dfGeoX >= 180)
+                    dfGeoX -= 360;
+                else if (iOuterIter == 1 && dfGeoX <= -180)
+                    dfGeoX += 360;
+
+                // Identify a cell (quadrilateral in georeferenced
+                // space) in the geolocation array in which dfGeoX,
+                // dfGeoY falls into.
+                const int nX = static_cast<int>(std::floor(dfX));
+                const int nY = static_cast<int>(std::floor(dfY));
+                for (int sx = -1; !bMatchingGeoLocCellFound && sx <= 0; sx++)
+                {
+                    for (int sy = -1; !bMatchingGeoLocCellFound && sy <= 0;
+                         sy++)
+                    {
+                        const int pixel = nX + sx;
+                        const int line = nY + sy;
+                        double x0, y0, x1, y1, x2, y2, x3, y3;
+                        if (!PixelLineToXY(psTransform, pixel, line, x0, y0) ||
+                            !PixelLineToXY(psTransform, pixel + 1, line, x2,
+                                           y2) ||
+                            !PixelLineToXY(psTransform, pixel, line + 1, x1,
+                                           y1) ||
+                            !PixelLineToXY(psTransform, pixel + 1, line + 1, x3,
+                                           y3))
+                        {
+                            break;
+                        }
+
+                        int nIters = 1;
+                        if (psTransform
+                                ->bGeographicSRSWithMinus180Plus180LongRange &&
+                            std::fabs(x0) > 170 && std::fabs(x1) > 170 &&
+                            std::fabs(x2) > 170 && std::fabs(x3) > 170 &&
+                            (std::fabs(x1 - x0) > 180 ||
+                             std::fabs(x2 - x0) > 180 ||
+                             std::fabs(x3 - x0) > 180))
+                        {
+                            nIters = 2;
+                            if (x0 > 0)
+                                x0 -= 360;
+                            if (x1 > 0)
+                                x1 -= 360;
+                            if (x2 > 0)
+                                x2 -= 360;
+                            if (x3 > 0)
+                                x3 -= 360;
+                        }
+                        for (int iIter = 0; iIter < nIters; ++iIter)
+                        {
+                            if (iIter == 1)
+                            {
+                                x0 += 360;
+                                x1 += 360;
+                                x2 += 360;
+                                x3 += 360;
+                            }
+
+                            if (GDALGeoLocIsPointInQuad(dfGeoX, dfGeoY, x0, y0,
+                                                        x1, y1, x2, y2, x3,
+                                                        y3))
+                            {
+                                bMatchingGeoLocCellFound = true;
+                                double dfBMXValue = pixel;
+                                double dfBMYValue = line;
+                                GDALInverseBilinearInterpolation(
+                                    dfGeoX, dfGeoY, x0, y0, x1, y1, x2, y2, x3,
+                                    y3, dfBMXValue, dfBMYValue);
+
+                                dfBMXValue =
+                                    (dfBMXValue + dfGeorefConventionOffset) *
+                                        psTransform->dfPIXEL_STEP +
+                                    psTransform->dfPIXEL_OFFSET;
+                                dfBMYValue =
+                                    (dfBMYValue + dfGeorefConventionOffset) *
+                                        psTransform->dfLINE_STEP +
+                                    psTransform->dfLINE_OFFSET;
+
+                                oBackMap.backMapXAccessor.Set(
+                                    iBMX, iBMY, static_cast<float>(dfBMXValue));
+                                oBackMap.backMapYAccessor.Set(
+                                    iBMX, iBMY, static_cast<float>(dfBMYValue));
+                                oBackMap.backMapWeightAccessor.Set(iBMX, iBMY,
+                                                                   1.0f);
+                            }
+                        }
+                    }
+                }
+            }
+            if (bMatchingGeoLocCellFound)
+                return;
+        }
+
+        // We will end up here in non-nominal cases, with nodata,
+        // holes, etc.
+
+        // Check if the center is in range
+        if (iBMX < -1 || iBMY < -1 || iBMX > nBMXSize || iBMY > nBMYSize)
+            return;
+
+        const double fracBMX = dBMX - iBMX;
+        const double fracBMY = dBMY - iBMY;
+
+        // Check logic for top left pixel
+        if ((iBMX >= 0) && (iBMY >= 0) && (iBMX < nBMXSize) &&
+            (iBMY < nBMYSize) &&
+            oBackMap.backMapWeightAccessor.Get(iBMX, iBMY) != 1.0f)
+        {
+            const double tempwt = (1.0 - fracBMX) * (1.0 - fracBMY);
+            UpdateBackmap(oBackMap, iBMX, iBMY, dfX, dfY, tempwt);
+        }
+
+        // Check logic for top right pixel
+        if ((iBMY >= 0) && (iBMX + 1 < nBMXSize) && (iBMY < nBMYSize) &&
+            oBackMap.backMapWeightAccessor.Get(iBMX + 1, iBMY) != 1.0f)
+        {
+            const double tempwt = fracBMX * (1.0 - fracBMY);
+            UpdateBackmap(oBackMap, iBMX + 1, iBMY, dfX, dfY, tempwt);
+        }
+
+        // Check logic for bottom right pixel
+        if ((iBMX + 1 < nBMXSize) && (iBMY + 1 < nBMYSize) &&
+            oBackMap.backMapWeightAccessor.Get(iBMX + 1, iBMY + 1) != 1.0f)
+        {
+            const double tempwt = fracBMX * fracBMY;
+            UpdateBackmap(oBackMap, iBMX + 1, iBMY + 1, dfX, dfY, tempwt);
+        }
+
+        // Check logic for bottom left pixel
+        if ((iBMX >= 0) && (iBMX < nBMXSize) && (iBMY + 1 < nBMYSize) &&
+            oBackMap.backMapWeightAccessor.Get(iBMX, iBMY + 1) != 1.0f)
+        {
+            const double tempwt = (1.0 - fracBMX) * fracBMY;
+            UpdateBackmap(oBackMap, iBMX, iBMY + 1, dfX, dfY, tempwt);
+        }
+    };
 
     /* -------------------------------------------------------------------- */
     /*      Run through the whole geoloc array forward projecting and       */
@@ -1205,228 +1488,154 @@ bool GDALGeoLoc<Accessors>::GenerateBackMap(
         xStartEnd[iXBlock].second = dfX + dfStep / 10;
     }
 
-    for (int iYBlock = 0; iYBlock < nYBlocks; ++iYBlock)
+    const auto ProcessGeoLocBlocks =
+        [&](auto &oBackMap, int iYBlockStart, int iYBlockEnd)
     {
-        for (int iXBlock = 0; iXBlock < nXBlocks; ++iXBlock)
+        for (int iYBlock = iYBlockStart; iYBlock < iYBlockEnd; ++iYBlock)
         {
+            for (int iXBlock = 0; iXBlock < nXBlocks; ++iXBlock)
+            {
 #if 0
-        CPLDebug("Process geoloc block (y=%d,x=%d) for y in [%f, %f] and x in [%f, %f]",
-                 iYBlock, iXBlock,
-                 yStartEnd[iYBlock].first, yStartEnd[iYBlock].second,
-                 xStartEnd[iXBlock].first, xStartEnd[iXBlock].second);
+            CPLDebug("Process geoloc block (y=%d,x=%d) for y in [%f, %f] and x in [%f, %f]",
+                     iYBlock, iXBlock,
+                     yStartEnd[iYBlock].first, yStartEnd[iYBlock].second,
+                     xStartEnd[iXBlock].first, xStartEnd[iXBlock].second);
 #endif
-            for (double dfY = yStartEnd[iYBlock].first;
-                 dfY < yStartEnd[iYBlock].second; dfY += dfStep)
-            {
-                for (double dfX = xStartEnd[iXBlock].first;
-                     dfX < xStartEnd[iXBlock].second; dfX += dfStep)
+                for (double dfY = yStartEnd[iYBlock].first;
+                     dfY < yStartEnd[iYBlock].second; dfY += dfStep)
                 {
-                    // Use forward geolocation array interpolation to compute
-                    // the georeferenced position corresponding to (dfX, dfY)
-                    double dfGeoLocX;
-                    double dfGeoLocY;
-                    if (!PixelLineToXY(psTransform, dfX, dfY, dfGeoLocX,
-                                       dfGeoLocY))
-                        continue;
+                    for (double dfX = xStartEnd[iXBlock].first;
+                         dfX < xStartEnd[iXBlock].second; dfX += dfStep)
+                    {
+                        PushIntoBackmap(oBackMap, dfX, dfY);
+                    }
+                }
+            }
+        }
+    };
 
-                    // Compute the floating point coordinates in the pixel space
-                    // of the backmap
-                    const double dBMX = static_cast<double>(
-                        (dfGeoLocX - dfMinX) / dfPixelXSize);
+    // With in-memory arrays, strips of geolocation blocks can be processed
+    // by several threads. The first strip is pushed directly into the
+    // backmap, and the other ones into partial backmaps, that are then merged
+    // in the order in which a single thread would have processed them.
+    std::unique_ptr<CPLJobQueue> poJobQueue;
+    if (Accessors::THREAD_SAFE && psTransform->nNumThreads > 1)
+    {
+        CPLWorkerThreadPool *poThreadPool =
+            GDALGetGlobalThreadPool(psTransform->nNumThreads);
+        if (poThreadPool)
+            poJobQueue = poThreadPool->CreateJobQueue();
+    }
+    const int nThreads = poJobQueue ? psTransform->nNumThreads : 1;
+    const int nStrips = std::min(nThreads, nYBlocks);
 
-                    const double dBMY = static_cast<double>(
-                        (dfMaxY - dfGeoLocY) / dfPixelYSize);
+    if (nStrips <= 1)
+    {
+        ProcessGeoLocBlocks(*pAccessors, 0, nYBlocks);
+    }
+    else
+    {
+        std::vector<std::unique_ptr<GDALGeoLocPartialBackMap>> apoPartials;
+        std::vector<int> anOutOfMemory(nStrips);
+        try
+        {
+            for (int i = 1; i < nStrips; ++i)
+            {
+                apoPartials.push_back(
+                    std::make_unique<GDALGeoLocPartialBackMap>(nBMXSize,
+                                                               nBMYSize));
+            }
+        }
+        catch (const std::bad_alloc &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Out of memory in backmap generation");
+            return false;
+        }
 
-                    // Get top left index by truncation
-                    const int iBMX = static_cast<int>(std::floor(dBMX));
-                    const int iBMY = static_cast<int>(std::floor(dBMY));
+        GDALRunParallel(
+            poJobQueue.get(), nStrips, nYBlocks,
+            [&](int iStrip, int iYBlockStart, int iYBlockEnd)
+            {
+                if (iStrip == 0)
+                {
+                    ProcessGeoLocBlocks(*pAccessors, iYBlockStart,
+                                        iYBlockEnd);
+                    return;
+                }
+                try
+                {
+                    ProcessGeoLocBlocks(*apoPartials[iStrip - 1],
+                                        iYBlockStart, iYBlockEnd);
+                }
+                catch (const std::bad_alloc &)
+                {
+                    anOutOfMemory[iStrip] = 1;
+                }
+            });
+        if (std::find(anOutOfMemory.begin(), anOutOfMemory.end(), 1) !=
+            anOutOfMemory.end())
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Out of memory in backmap generation");
+            return false;
+        }
 
-                    if (iBMX >= 0 && iBMX < nBMXSize && iBMY >= 0 &&
-                        iBMY < nBMYSize)
+        // A pixel with a weight of 1 has been set from a geolocation cell
+        // that contains it, and only another such cell may override it.
+        GDALRunParallel(
+            poJobQueue.get(), nThreads, nBMYSize,
+            [&](int, int iYStart, int iYEnd)
+            {
+                for (const auto &poPartial : apoPartials)
+                {
+                    const int iYFirst = std::max(iYStart, poPartial->GetYOff());
+                    const int iYLast = std::min(
+                        iYEnd, poPartial->GetYOff() + poPartial->GetRows());
+                    for (int iY = iYFirst; iY < iYLast; ++iY)
                     {
-                        // Compute the georeferenced position of the top-left
-                        // index of the backmap
-                        double dfGeoX = dfMinX + iBMX * dfPixelXSize;
-                        const double dfGeoY = dfMaxY - iBMY * dfPixelYSize;
-
-                        bool bMatchingGeoLocCellFound = false;
-
-                        const int nOuterIters =
-                            psTransform->bGeographicSRSWithMinus180Plus180LongRange &&
-                                    fabs(dfGeoX) >= 180
-                                ? 2
-                                : 1;
-
-                        for (int iOuterIter = 0; iOuterIter < nOuterIters;
-                             ++iOuterIter)
+                        for (int iX = 0; iX < nBMXSize; ++iX)
                         {
-                            if (iOuterIter == 1 && dfGeoX >= 180)
-                                dfGeoX -= 360;
-                            else if (iOuterIter == 1 && dfGeoX <= -180)
-                                dfGeoX += 360;
-
-                            // Identify a cell (quadrilateral in georeferenced
-                            // space) in the geolocation array in which dfGeoX,
-                            // dfGeoY falls into.
-                            oPoint.setX(dfGeoX);
-                            oPoint.setY(dfGeoY);
-                            const int nX = static_cast<int>(std::floor(dfX));
-                            const int nY = static_cast<int>(std::floor(dfY));
-                            for (int sx = -1;
-                                 !bMatchingGeoLocCellFound && sx <= 0; sx++)
+                            const float fWeight =
+                                poPartial->backMapWeightAccessor.Get(iX, iY);
+                            if (fWeight == 0)
+                                continue;
+                            const float fBMX =
+                                poPartial->backMapXAccessor.Get(iX, iY);
+                            const float fBMY =
+                                poPartial->backMapYAccessor.Get(iX, iY);
+                            const float fCurWeight =
+                                pAccessors->backMapWeightAccessor.Get(iX, iY);
+                            if (fWeight == 1.0f)
                             {
-                                for (int sy = -1;
-                                     !bMatchingGeoLocCellFound && sy <= 0; sy++)
-                                {
-                                    const int pixel = nX + sx;
-                                    const int line = nY + sy;
-                                    double x0, y0, x1, y1, x2, y2, x3, y3;
-                                    if (!PixelLineToXY(psTransform, pixel, line,
-                                                       x0, y0) ||
-                                        !PixelLineToXY(psTransform, pixel + 1,
-                                                       line, x2, y2) ||
-                                        !PixelLineToXY(psTransform, pixel,
-                                                       line + 1, x1, y1) ||
-                                        !PixelLineToXY(psTransform, pixel + 1,
-                                                       line + 1, x3, y3))
-                                    {
-                                        break;
-                                    }
-
-                                    int nIters = 1;
-                                    if (psTransform
-                                            ->bGeographicSRSWithMinus180Plus180LongRange &&
-                                        std::fabs(x0) > 170 &&
-                                        std::fabs(x1) > 170 &&
-                                        std::fabs(x2) > 170 &&
-                                        std::fabs(x3) > 170 &&
-                                        (std::fabs(x1 - x0) > 180 ||
-                                         std::fabs(x2 - x0) > 180 ||
-                                         std::fabs(x3 - x0) > 180))
-                                    {
-                                        nIters = 2;
-                                        if (x0 > 0)
-                                            x0 -= 360;
-                                        if (x1 > 0)
-                                            x1 -= 360;
-                                        if (x2 > 0)
-                                            x2 -= 360;
-                                        if (x3 > 0)
-                                            x3 -= 360;
-                                    }
-                                    for (int iIter = 0; iIter < nIters; ++iIter)
-                                    {
-                                        if (iIter == 1)
-                                        {
-                                            x0 += 360;
-                                            x1 += 360;
-                                            x2 += 360;
-                                            x3 += 360;
-                                        }
-
-                                        oRing.setPoint(0, x0, y0);
-                                        oRing.setPoint(1, x2, y2);
-                                        oRing.setPoint(2, x3, y3);
-                                        oRing.setPoint(3, x1, y1);
-                                        oRing.setPoint(4, x0, y0);
-                                        if (oRing.isPointInRing(&oPoint) ||
-                                            oRing.isPointOnRingBoundary(
-                                                &oPoint))
-                                        {
-                                            bMatchingGeoLocCellFound = true;
-                                            double dfBMXValue = pixel;
-                                            double dfBMYValue = line;
-                                            GDALInverseBilinearInterpolation(
-                                                dfGeoX, dfGeoY, x0, y0, x1, y1,
-                                                x2, y2, x3, y3, dfBMXValue,
-                                                dfBMYValue);
-
-                                            dfBMXValue =
-                                                (dfBMXValue +
-                                                 dfGeorefConventionOffset) *
-                                                    psTransform->dfPIXEL_STEP +
-                                                psTransform->dfPIXEL_OFFSET;
-                                            dfBMYValue =
-                                                (dfBMYValue +
-                                                 dfGeorefConventionOffset) *
-                                                    psTransform->dfLINE_STEP +
-                                                psTransform->dfLINE_OFFSET;
-
-                                            pAccessors->backMapXAccessor.Set(
-                                                iBMX, iBMY,
-                                                static_cast<float>(dfBMXValue));
-                                            pAccessors->backMapYAccessor.Set(
-                                                iBMX, iBMY,
-                                                static_cast<float>(dfBMYValue));
-                                            pAccessors->backMapWeightAccessor
-                                                .Set(iBMX, iBMY, 1.0f);
-                                        }
-                                    }
-                                }
+                                pAccessors->backMapXAccessor.Set(iX, iY, fBMX);
+                                pAccessors->backMapYAccessor.Set(iX, iY, fBMY);
+                                pAccessors->backMapWeightAccessor.Set(iX, iY,
+                                                                      fWeight);
+                            }
+                            else if (fCurWeight != 1.0f)
+                            {
+                                pAccessors->backMapXAccessor.Set(
+                                    iX, iY,
+                                    pAccessors->backMapXAccessor.Get(iX, iY) +
+                                        fBMX);
+                                pAccessors->backMapYAccessor.Set(
+                                    iX, iY,
+                                    pAccessors->backMapYAccessor.Get(iX, iY) +
+                                        fBMY);
+                                pAccessors->backMapWeightAccessor.Set(
+                                    iX, iY, fCurWeight + fWeight);
                             }
                         }
-                        if (bMatchingGeoLocCellFound)
-                            continue;
-                    }
-
-                    // We will end up here in non-nominal cases, with nodata,
-                    // holes, etc.
-
-                    // Check if the center is in range
-                    if (iBMX < -1 || iBMY < -1 || iBMX > nBMXSize ||
-                        iBMY > nBMYSize)
-                        continue;
-
-                    const double fracBMX = dBMX - iBMX;
-                    const double fracBMY = dBMY - iBMY;
-
-                    // Check logic for top left pixel
-                    if ((iBMX >= 0) && (iBMY >= 0) && (iBMX < nBMXSize) &&
-                        (iBMY < nBMYSize) &&
-                        pAccessors->backMapWeightAccessor.Get(iBMX, iBMY) !=
-                            1.0f)
-                    {
-                        const double tempwt = (1.0 - fracBMX) * (1.0 - fracBMY);
-                        UpdateBackmap(iBMX, iBMY, dfX, dfY, tempwt);
-                    }
-
-                    // Check logic for top right pixel
-                    if ((iBMY >= 0) && (iBMX + 1 < nBMXSize) &&
-                        (iBMY < nBMYSize) &&
-                        pAccessors->backMapWeightAccessor.Get(iBMX + 1, iBMY) !=
-                            1.0f)
-                    {
-                        const double tempwt = fracBMX * (1.0 - fracBMY);
-                        UpdateBackmap(iBMX + 1, iBMY, dfX, dfY, tempwt);
-                    }
-
-                    // Check logic for bottom right pixel
-                    if ((iBMX + 1 < nBMXSize) && (iBMY + 1 < nBMYSize) &&
-                        pAccessors->backMapWeightAccessor.Get(iBMX + 1,
-                                                              iBMY + 1) != 1.0f)
-                    {
-                        const double tempwt = fracBMX * fracBMY;
-                        UpdateBackmap(iBMX + 1, iBMY + 1, dfX, dfY, tempwt);
-                    }
-
-                    // Check logic for bottom left pixel
-                    if ((iBMX >= 0) && (iBMX < nBMXSize) &&
-                        (iBMY + 1 < nBMYSize) &&
-                        pAccessors->backMapWeightAccessor.Get(iBMX, iBMY + 1) !=
-                            1.0f)
-                    {
-                        const double tempwt = (1.0 - fracBMX) * fracBMY;
-                        UpdateBackmap(iBMX, iBMY + 1, dfX, dfY, tempwt);
                     }
                 }
-            }
-        }
+            });
     }
 
     // Each pixel in the backmap may have multiple entries.
     // We now go in average it out using the weights
-    START_ITER_PER_BLOCK(nBMXSize, TILE_SIZE, nBMYSize, TILE_SIZE, (void)0,
-                         iXStart, iXEnd, iYStart, iYEnd)
+    const auto AverageBackmap =
+        [pAccessors](int iXStart, int iXEnd, int iYStart, int iYEnd)
     {
         for (int iY = iYStart; iY < iYEnd; ++iY)
         {
@@ -1453,8 +1662,22 @@ bool GDALGeoLoc<Accessors>::GenerateBackMap(
                 }
             }
         }
+    };
+    if (poJobQueue)
+    {
+        GDALRunParallel(poJobQueue.get(), nThreads, nBMYSize,
+                        [&](int, int iYStart, int iYEnd)
+                        { AverageBackmap(0, nBMXSize, iYStart, iYEnd); });
+    }
+    else
+    {
+        START_ITER_PER_BLOCK(nBMXSize, TILE_SIZE, nBMYSize, TILE_SIZE, (void)0,
+                             iXStart, iXEnd, iYStart, iYEnd)
+        {
+            AverageBackmap(iXStart, iXEnd, iYStart, iYEnd);
+        }
+        END_ITER_PER_BLOCK
     }
-    END_ITER_PER_BLOCK
 
     pAccessors->FreeWghtsBackMap();
 
@@ -1475,12 +1698,16 @@ bool GDALGeoLoc<Accessors>::GenerateBackMap(
 
     constexpr double dfMaxSearchDist = 3.0;
     constexpr int nSmoothingIterations = 1;
+    CPLStringList aosFillOptions;
+    aosFillOptions.SetNameValue("NUM_THREADS",
+                                CPLSPrintf("%d", psTransform->nNumThreads));
     for (int i = 1; i <= 2; i++)
     {
         GDALFillNodata(GDALRasterBand::ToHandle(poBackmapDS->GetRasterBand(i)),
                        nullptr, dfMaxSearchDist,
                        0,  // unused parameter
-                       nSmoothingIterations, nullptr, nullptr, nullptr);
+                       nSmoothingIterations, aosFillOptions.List(), nullptr,
+                       nullptr);
     }
 
 #ifdef DEBUG_GEOLOC
@@ -1500,59 +1727,77 @@ bool GDALGeoLoc<Accessors>::GenerateBackMap(
         float bmX = 0;
     };
 
-    std::vector<LastValidStruct> lastValid(TILE_SIZE);
-    const auto reinitLine = [&lastValid]()
+    const auto FillLineHoles =
+        [pAccessors](int iBMY, int iXStart, int iXEnd, LastValidStruct &sLast)
     {
-        const size_t nSize = lastValid.size();
-        lastValid.clear();
-        lastValid.resize(nSize);
-    };
-    START_ITER_PER_BLOCK(nBMXSize, TILE_SIZE, nBMYSize, TILE_SIZE, reinitLine(),
-                         iXStart, iXEnd, iYStart, iYEnd)
-    {
-        const int iYCount = iYEnd - iYStart;
-        for (int iYIter = 0; iYIter < iYCount; ++iYIter)
+        int iLastValidIX = sLast.iX;
+        float bmXLastValid = sLast.bmX;
+        for (int iBMX = iXStart; iBMX < iXEnd; ++iBMX)
         {
-            int iLastValidIX = lastValid[iYIter].iX;
-            float bmXLastValid = lastValid[iYIter].bmX;
-            const int iBMY = iYStart + iYIter;
-            for (int iBMX = iXStart; iBMX < iXEnd; ++iBMX)
+            const float bmX = pAccessors->backMapXAccessor.Get(iBMX, iBMY);
+            if (bmX == INVALID_BMXY)
+                continue;
+            if (iLastValidIX != -1 && iBMX > iLastValidIX + 1 &&
+                fabs(bmX - bmXLastValid) <= 2)
             {
-                const float bmX = pAccessors->backMapXAccessor.Get(iBMX, iBMY);
-                if (bmX == INVALID_BMXY)
-                    continue;
-                if (iLastValidIX != -1 && iBMX > iLastValidIX + 1 &&
-                    fabs(bmX - bmXLastValid) <= 2)
+                const float bmY = pAccessors->backMapYAccessor.Get(iBMX, iBMY);
+                const float bmYLastValid =
+                    pAccessors->backMapYAccessor.Get(iLastValidIX, iBMY);
+                if (fabs(bmY - bmYLastValid) <= 2)
                 {
-                    const float bmY =
-                        pAccessors->backMapYAccessor.Get(iBMX, iBMY);
-                    const float bmYLastValid =
-                        pAccessors->backMapYAccessor.Get(iLastValidIX, iBMY);
-                    if (fabs(bmY - bmYLastValid) <= 2)
+                    for (int iBMXInner = iLastValidIX + 1; iBMXInner < iBMX;
+                         ++iBMXInner)
                     {
-                        for (int iBMXInner = iLastValidIX + 1; iBMXInner < iBMX;
-                             ++iBMXInner)
-                        {
-                            const float alpha =
-                                static_cast<float>(iBMXInner - iLastValidIX) /
-                                (iBMX - iLastValidIX);
-                            pAccessors->backMapXAccessor.Set(
-                                iBMXInner, iBMY,
-                                (1.0f - alpha) * bmXLastValid + alpha * bmX);
-                            pAccessors->backMapYAccessor.Set(
-                                iBMXInner, iBMY,
-                                (1.0f - alpha) * bmYLastValid + alpha * bmY);
-                        }
+                        const float alpha =
+                            static_cast<float>(iBMXInner - iLastValidIX) /
+                            (iBMX - iLastValidIX);
+                        pAccessors->backMapXAccessor.Set(
+                            iBMXInner, iBMY,
+                            (1.0f - alpha) * bmXLastValid + alpha * bmX);
+                        pAccessors->backMapYAccessor.Set(
+                            iBMXInner, iBMY,
+                            (1.0f - alpha) * bmYLastValid + alpha * bmY);
                     }
                 }
-                iLastValidIX = iBMX;
-                bmXLastValid = bmX;
             }
-            lastValid[iYIter].iX = iLastValidIX;
-            lastValid[iYIter].bmX = bmXLastValid;
+            iLastValidIX = iBMX;
+            bmXLastValid = bmX;
         }
+        sLast.iX = iLastValidIX;
+        sLast.bmX = bmXLastValid;
+    };
+
+    if (poJobQueue)
+    {
+        GDALRunParallel(poJobQueue.get(), nThreads, nBMYSize,
+                        [&](int, int iYStart, int iYEnd)
+                        {
+                            for (int iBMY = iYStart; iBMY < iYEnd; ++iBMY)
+                            {
+                                LastValidStruct sLast;
+                                FillLineHoles(iBMY, 0, nBMXSize, sLast);
+                            }
+                        });
+    }
+    else
+    {
+        std::vector<LastValidStruct> lastValid(TILE_SIZE);
+        const auto reinitLine = [&lastValid]()
+        {
+            const size_t nSize = lastValid.size();
+            lastValid.clear();
+            lastValid.resize(nSize);
+        };
+        START_ITER_PER_BLOCK(nBMXSize, TILE_SIZE, nBMYSize, TILE_SIZE,
+                             reinitLine(), iXStart, iXEnd, iYStart, iYEnd)
+        {
+            for (int iBMY = iYStart; iBMY < iYEnd; ++iBMY)
+            {
+                FillLineHoles(iBMY, iXStart, iXEnd, lastValid[iBMY - iYStart]);
+            }
+        }
+        END_ITER_PER_BLOCK
     }
-    END_ITER_PER_BLOCK
 
 #ifdef DEBUG_GEOLOC
     if (CPLTestBool(CPLGetConfigOption("GEOLOC_DUMP", "NO")))
@@ -1617,6 +1862,7 @@ static void *GDALCreateSimilarGeoLocTransformer(void *hTransformArg,
         static_cast<GDALGeoLocTransformInfo *>(GDALCreateGeoLocTransformer(
             nullptr, papszGeolocationInfo, psInfo->bReversed));
     psInfoNew->dfOversampleFactor = psInfo->dfOversampleFactor;
+    psInfoNew->nNumThreads = psInfo->nNumThreads;
 
     CSLDestroy(papszGeolocationInfo);
 
@@ -1785,6 +2031,16 @@ void *GDALCreateGeoLocTransformerEx(GDALDatasetH hBaseDS,
                      CPLGetConfigOption("GDAL_GEOLOC_BACKMAP_OVERSAMPLE_FACTOR",
                                         "1.3")))));
 
+    // Not defaulting to GDAL_NUM_THREADS, since the backmap, and thus
+    // the result of inverse transformations, marginally depends on the
+    // number of threads.
+    const char *pszNumThreads = CSLFetchNameValueDef(
+        papszTransformOptions, "GEOLOC_NUM_THREADS", "1");
+    psTransform->nNumThreads =
+        std::max(1, std::min(128, EQUAL(pszNumThreads, "ALL_CPUS")
+                                      ? CPLGetNumCPUs()
+                                      : atoi(pszNumThreads)));
+
     memcpy(psTransform->sTI.abySignature, GDAL_GTI2_SIGNATURE,
            strlen(GDAL_GTI2_SIGNATURE));
     psTransform->sTI.pszClassName = "GDALGeoLocTransformer";
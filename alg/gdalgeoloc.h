@@ -84,4 +84,80 @@ static double ShiftGeoX(const GDALGeoLocTransformInfo *psTransform,
     return dfX;
 }
 
+/************************************************************************/
+/*                       GDALGeoLocIsPointInQuad()                      */
+/************************************************************************/
+
+// Returns whether (x, y) is inside, or on the boundary of, the quadrilateral
+// (x0, y0), (x2, y2), (x3, y3), (x1, y1). This gives the same result as
+// OGRLinearRing::isPointInRing() || OGRLinearRing::isPointOnRingBoundary()
+// on the corresponding closed ring, without having to set up OGR geometries
+// for each cell that is tested.
+inline bool GDALGeoLocIsPointInQuad(double x, double y, double x0, double y0,
+                                    double x1, double y1, double x2, double y2,
+                                    double x3, double y3)
+{
+    const double adfX[] = {x0, x2, x3, x1, x0};
+    const double adfY[] = {y0, y2, y3, y1, y0};
+
+    // Envelope test, written as in OGRSimpleCurve::getEnvelope() so that
+    // NaN values are dealt with in the same way.
+    double dfMinX = adfX[0];
+    double dfMaxX = adfX[0];
+    double dfMinY = adfY[0];
+    double dfMaxY = adfY[0];
+    for (int i = 1; i < 5; ++i)
+    {
+        if (dfMaxX < adfX[i])
+            dfMaxX = adfX[i];
+        if (dfMaxY < adfY[i])
+            dfMaxY = adfY[i];
+        if (dfMinX > adfX[i])
+            dfMinX = adfX[i];
+        if (dfMinY > adfY[i])
+            dfMinY = adfY[i];
+    }
+    if (!(x >= dfMinX && x <= dfMaxX && y >= dfMinY && y <= dfMaxY))
+        return false;
+
+    // Crossing number test
+    int nCrossings = 0;
+    for (int i = 1; i < 5; ++i)
+    {
+        const double dx1 = adfX[i] - x;
+        const double dy1 = adfY[i] - y;
+        const double dx2 = adfX[i - 1] - x;
+        const double dy2 = adfY[i - 1] - y;
+        if (((dy1 > 0) && (dy2 <= 0)) || ((dy2 > 0) && (dy1 <= 0)))
+        {
+            if (0.0 < (dx1 * dy2 - dx2 * dy1) / (dy2 - dy1))
+                nCrossings++;
+        }
+    }
+    if ((nCrossings % 2) != 0)
+        return true;
+
+    // Boundary test
+    for (int i = 1; i < 5; ++i)
+    {
+        const double dx1 = x - adfX[i];
+        const double dy1 = y - adfY[i];
+        const double dx2 = x - adfX[i - 1];
+        const double dy2 = y - adfY[i - 1];
+        if (dx1 * dy2 - dx2 * dy1 == 0 && !(dx1 == dx2 && dy1 == dy2))
+        {
+            const double dx_segment = adfX[i] - adfX[i - 1];
+            const double dy_segment = adfY[i] - adfY[i - 1];
+            const double crossproduct = dx2 * dx_segment + dy2 * dy_segment;
+            if (crossproduct >= 0 &&
+                crossproduct <=
+                    dx_segment * dx_segment + dy_segment * dy_segment)
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 #endif
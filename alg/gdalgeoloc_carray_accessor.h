@@ -30,6 +30,10 @@ class GDALGeoLocCArrayAccessors
     bool LoadGeoloc(bool bIsRegularGrid);
 
   public:
+    // Different pixels of the backmap may be set concurrently, while the
+    // geolocation arrays are read.
+    static constexpr bool THREAD_SAFE = true;
+
     template <class Type> struct CArrayAccessor
     {
         Type *m_array;
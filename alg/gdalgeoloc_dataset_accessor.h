@@ -40,6 +40,10 @@ class GDALGeoLocDatasetAccessors
     static constexpr int TILE_SIZE = 256;
     static constexpr int TILE_COUNT = 64;
 
+    // The pixel accessors maintain caches, so they can't be used from
+    // several threads.
+    static constexpr bool THREAD_SAFE = false;
+
     GDALCachedPixelAccessor<double, TILE_SIZE, TILE_COUNT> geolocXAccessor;
     GDALCachedPixelAccessor<double, TILE_SIZE, TILE_COUNT> geolocYAccessor;
     GDALCachedPixelAccessor<float, TILE_SIZE, TILE_COUNT> backMapXAccessor;
@@ -16,9 +16,8 @@
 
 #include "cpl_quad_tree.h"
 
-#include "ogr_geometry.h"
-
 #include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <limits>
 
@@ -200,12 +199,6 @@ void GDALGeoLocInverseTransformQuadtree(
     const GDALGeoLocTransformInfo *psTransform, int nPointCount, double *padfX,
     double *padfY, int *panSuccess)
 {
-    // Keep those objects in this outer scope, so they are re-used, to
-    // save memory allocations.
-    OGRPoint oPoint;
-    OGRLinearRing oRing;
-    oRing.setNumPoints(5);
-
     const double dfGeorefConventionOffset =
         psTransform->bOriginIsTopLeftCorner ? 0 : 0.5;
 
@@ -237,8 +230,6 @@ void GDALGeoLocInverseTransformQuadtree(
             CPLQuadTreeSearch(psTransform->hQuadTree, &aoi, &nFeatureCount);
         if (nFeatureCount != 0)
         {
-            oPoint.setX(dfGeoX);
-            oPoint.setY(dfGeoY);
             for (int iFeat = 0; iFeat < nFeatureCount; iFeat++)
             {
                 size_t nIdx = reinterpret_cast<size_t>(pahFeatures[iFeat]);
@@ -264,14 +255,8 @@ void GDALGeoLocInverseTransformQuadtree(
                     x3 = ShiftGeoX(psTransform, dfXRef, x3);
                 }
 
-                oRing.setPoint(0, x0, y0);
-                oRing.setPoint(1, x2, y2);
-                oRing.setPoint(2, x3, y3);
-                oRing.setPoint(3, x1, y1);
-                oRing.setPoint(4, x0, y0);
-
-                if (oRing.isPointInRing(&oPoint) ||
-                    oRing.isPointOnRingBoundary(&oPoint))
+                if (GDALGeoLocIsPointInQuad(dfGeoX, dfGeoY, x0, y0, x1, y1, x2,
+                                            y2, x3, y3))
                 {
                     const size_t nExtendedWidth =
                         psTransform->nGeoLocXSize +
@@ -23,8 +23,10 @@
 
 #include <limits>
 #include <map>
+#include <memory>
 #include <utility>
 #include <algorithm>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_cpu_features.h"
@@ -56,6 +58,285 @@ static void GDALGridGetPointBounds(const void *hFeature, CPLRectObj *pBounds)
     pBounds->maxy = dfY;
 }
 
+/************************************************************************/
+/*                          GDALGridPointIndex                          */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+
+// Grid-bucket spatial index of the points: their extent is split into
+// square cells holding a few points each, and the indices of the points of
+// each cell are stored contiguously, in increasing order.
+// Points with non-finite coordinates are not indexed, since they can never
+// be within a search ellipse, nor be the nearest point.
+class GDALGridPointIndex
+{
+  public:
+    static constexpr GUInt32 INVALID_INDEX =
+        std::numeric_limits<GUInt32>::max();
+
+    static GDALGridPointIndex *Create(GUInt32 nPoints, const double *padfX,
+                                      const double *padfY);
+
+    void Search(double dfMinX, double dfMinY, double dfMaxX, double dfMaxY,
+                std::vector<GUInt32> &anIndices) const;
+
+    GUInt32 GetNearest(double dfX, double dfY) const;
+
+  private:
+    const double *m_padfX = nullptr;
+    const double *m_padfY = nullptr;
+    double m_dfMinX = 0;
+    double m_dfMinY = 0;
+    double m_dfCellSize = 0;
+    int m_nCellsX = 0;
+    int m_nCellsY = 0;
+    // Index in m_anPointIndices of the first point of each cell, plus one
+    // final element equal to the number of indexed points.
+    std::vector<GUInt32> m_anCellStart{};
+    std::vector<GUInt32> m_anPointIndices{};
+
+    GDALGridPointIndex() = default;
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALGridPointIndex)
+
+    int GetCellX(double dfX) const
+    {
+        const double dfCell = (dfX - m_dfMinX) / m_dfCellSize;
+        if (!(dfCell >= 0))
+            return 0;
+        if (dfCell >= m_nCellsX - 1)
+            return m_nCellsX - 1;
+        return static_cast<int>(dfCell);
+    }
+
+    int GetCellY(double dfY) const
+    {
+        const double dfCell = (dfY - m_dfMinY) / m_dfCellSize;
+        if (!(dfCell >= 0))
+            return 0;
+        if (dfCell >= m_nCellsY - 1)
+            return m_nCellsY - 1;
+        return static_cast<int>(dfCell);
+    }
+};
+
+/************************************************************************/
+/*                     GDALGridPointIndex::Create()                     */
+/************************************************************************/
+
+// Returns nullptr if there is no point to index or in case of memory
+// allocation failure.
+GDALGridPointIndex *GDALGridPointIndex::Create(GUInt32 nPoints,
+                                               const double *padfX,
+                                               const double *padfY)
+{
+    double dfMinX = std::numeric_limits<double>::infinity();
+    double dfMinY = std::numeric_limits<double>::infinity();
+    double dfMaxX = -std::numeric_limits<double>::infinity();
+    double dfMaxY = -std::numeric_limits<double>::infinity();
+    GUInt32 nValidPoints = 0;
+    for (GUInt32 i = 0; i < nPoints; i++)
+    {
+        if (std::isfinite(padfX[i]) && std::isfinite(padfY[i]))
+        {
+            dfMinX = std::min(dfMinX, padfX[i]);
+            dfMinY = std::min(dfMinY, padfY[i]);
+            dfMaxX = std::max(dfMaxX, padfX[i]);
+            dfMaxY = std::max(dfMaxY, padfY[i]);
+            ++nValidPoints;
+        }
+    }
+    if (nValidPoints == 0)
+        return nullptr;
+
+    // Aim at a few points per cell, assuming a rather uniform distribution
+    constexpr double POINTS_PER_CELL = 4;
+    const double dfWidth = dfMaxX - dfMinX;
+    const double dfHeight = dfMaxY - dfMinY;
+    double dfCellSize =
+        std::sqrt(dfWidth * dfHeight / nValidPoints * POINTS_PER_CELL);
+    if (!(dfCellSize > 0) || !std::isfinite(dfCellSize))
+    {
+        // Points aligned on a horizontal or vertical line
+        dfCellSize =
+            std::max(dfWidth, dfHeight) / (nValidPoints / POINTS_PER_CELL + 1);
+        if (!(dfCellSize > 0) || !std::isfinite(dfCellSize))
+            dfCellSize = 1.0;
+    }
+    // Limit the number of cells to the number of points
+    while ((std::floor(dfWidth / dfCellSize) + 1) *
+               (std::floor(dfHeight / dfCellSize) + 1) >
+           std::max(1.0, static_cast<double>(nValidPoints)))
+    {
+        dfCellSize *= 1.5;
+    }
+
+    std::unique_ptr<GDALGridPointIndex> poIndex(new GDALGridPointIndex());
+    poIndex->m_padfX = padfX;
+    poIndex->m_padfY = padfY;
+    poIndex->m_dfMinX = dfMinX;
+    poIndex->m_dfMinY = dfMinY;
+    poIndex->m_dfCellSize = dfCellSize;
+    poIndex->m_nCellsX = static_cast<int>(std::floor(dfWidth / dfCellSize)) + 1;
+    poIndex->m_nCellsY =
+        static_cast<int>(std::floor(dfHeight / dfCellSize)) + 1;
+
+    try
+    {
+        // Counting sort of the points by cell, which keeps them in
+        // increasing order within each cell.
+        const size_t nCells = static_cast<size_t>(poIndex->m_nCellsX) *
+                              poIndex->m_nCellsY;
+        poIndex->m_anCellStart.resize(nCells + 1);
+        std::vector<GUInt32> anCellOfPoint(nPoints);
+        for (GUInt32 i = 0; i < nPoints; i++)
+        {
+            if (std::isfinite(padfX[i]) && std::isfinite(padfY[i]))
+            {
+                const size_t iCell =
+                    static_cast<size_t>(poIndex->GetCellY(padfY[i])) *
+                        poIndex->m_nCellsX +
+                    poIndex->GetCellX(padfX[i]);
+                anCellOfPoint[i] = static_cast<GUInt32>(iCell);
+                ++poIndex->m_anCellStart[iCell + 1];
+            }
+        }
+        for (size_t iCell = 0; iCell < nCells; ++iCell)
+            poIndex->m_anCellStart[iCell + 1] +=
+                poIndex->m_anCellStart[iCell];
+
+        poIndex->m_anPointIndices.resize(nValidPoints);
+        std::vector<GUInt32> anNextInCell(poIndex->m_anCellStart.begin(),
+                                          poIndex->m_anCellStart.end() - 1);
+        for (GUInt32 i = 0; i < nPoints; i++)
+        {
+            if (std::isfinite(padfX[i]) && std::isfinite(padfY[i]))
+            {
+                poIndex->m_anPointIndices[anNextInCell[anCellOfPoint[i]]++] =
+                    i;
+            }
+        }
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate memory for spatial index of points");
+        return nullptr;
+    }
+
+    CPLDebug("GDAL_GRID", "Point index of %d x %d cells", poIndex->m_nCellsX,
+             poIndex->m_nCellsY);
+    return poIndex.release();
+}
+
+/************************************************************************/
+/*                     GDALGridPointIndex::Search()                     */
+/************************************************************************/
+
+// Appends to anIndices the indices of the points within the rectangle (with
+// boundaries included), in increasing order.
+void GDALGridPointIndex::Search(double dfMinX, double dfMinY, double dfMaxX,
+                                double dfMaxY,
+                                std::vector<GUInt32> &anIndices) const
+{
+    const size_t nInitialSize = anIndices.size();
+    const int nCellMinX = GetCellX(dfMinX);
+    const int nCellMaxX = GetCellX(dfMaxX);
+    const int nCellMinY = GetCellY(dfMinY);
+    const int nCellMaxY = GetCellY(dfMaxY);
+    for (int iCellY = nCellMinY; iCellY <= nCellMaxY; ++iCellY)
+    {
+        const size_t iCellStart =
+            static_cast<size_t>(iCellY) * m_nCellsX + nCellMinX;
+        const size_t iCellEnd =
+            static_cast<size_t>(iCellY) * m_nCellsX + nCellMaxX + 1;
+        for (GUInt32 j = m_anCellStart[iCellStart];
+             j < m_anCellStart[iCellEnd]; ++j)
+        {
+            const GUInt32 i = m_anPointIndices[j];
+            if (m_padfX[i] >= dfMinX && m_padfX[i] <= dfMaxX &&
+                m_padfY[i] >= dfMinY && m_padfY[i] <= dfMaxY)
+            {
+                anIndices.push_back(i);
+            }
+        }
+    }
+    std::sort(anIndices.begin() + nInitialSize, anIndices.end());
+}
+
+/************************************************************************/
+/*                   GDALGridPointIndex::GetNearest()                   */
+/************************************************************************/
+
+// Returns the index of the point nearest to (dfX, dfY), or INVALID_INDEX.
+// Among points at the same distance, the one of highest index is returned,
+// as the exhaustive search of GDALGridNearestNeighbor() does.
+GUInt32 GDALGridPointIndex::GetNearest(double dfX, double dfY) const
+{
+    const int nCellX = GetCellX(dfX);
+    const int nCellY = GetCellY(dfY);
+    GUInt32 iNearest = INVALID_INDEX;
+    double dfNearestRSquare = std::numeric_limits<double>::infinity();
+
+    const auto VisitCell = [this, dfX, dfY, &iNearest,
+                            &dfNearestRSquare](int iCellX, int iCellY)
+    {
+        const size_t iCell = static_cast<size_t>(iCellY) * m_nCellsX + iCellX;
+        for (GUInt32 j = m_anCellStart[iCell]; j < m_anCellStart[iCell + 1];
+             ++j)
+        {
+            const GUInt32 i = m_anPointIndices[j];
+            const double dfRX = m_padfX[i] - dfX;
+            const double dfRY = m_padfY[i] - dfY;
+            const double dfR2 = dfRX * dfRX + dfRY * dfRY;
+            if (dfR2 < dfNearestRSquare ||
+                (dfR2 == dfNearestRSquare && i > iNearest))
+            {
+                dfNearestRSquare = dfR2;
+                iNearest = i;
+            }
+        }
+    };
+
+    // Visit cells by rings of increasing Chebyshev distance. Once rings up
+    // to nRing have been visited, all points not visited yet are at a
+    // distance of at least nRing * m_dfCellSize.
+    const int nMaxRing = std::max(m_nCellsX, m_nCellsY);
+    for (int nRing = 0; nRing <= nMaxRing; ++nRing)
+    {
+        const int nMinX = nCellX - nRing;
+        const int nMaxX = nCellX + nRing;
+        const int nMinY = nCellY - nRing;
+        const int nMaxY = nCellY + nRing;
+        for (int iCellY = std::max(0, nMinY);
+             iCellY <= std::min(m_nCellsY - 1, nMaxY); ++iCellY)
+        {
+            if (iCellY == nMinY || iCellY == nMaxY)
+            {
+                for (int iCellX = std::max(0, nMinX);
+                     iCellX <= std::min(m_nCellsX - 1, nMaxX); ++iCellX)
+                {
+                    VisitCell(iCellX, iCellY);
+                }
+            }
+            else
+            {
+                if (nMinX >= 0)
+                    VisitCell(nMinX, iCellY);
+                if (nMaxX < m_nCellsX && nMaxX != nMinX)
+                    VisitCell(nMaxX, iCellY);
+            }
+        }
+        const double dfCoveredRadius = nRing * m_dfCellSize;
+        if (dfNearestRSquare < dfCoveredRadius * dfCoveredRadius)
+            break;
+    }
+    return iNearest;
+}
+
+//! @endcond
+
 /************************************************************************/
 /*                   GDALGridInverseDistanceToAPower()                  */
 /************************************************************************/
@@ -906,7 +1187,16 @@ CPLErr GDALGridNearestNeighbor(const void *poOptionsIn, GUInt32 nPoints,
     GUInt32 i = 0;
 
     double dfSearchRadius = psExtraParams->dfInitialSearchRadius;
-    if (hQuadTree != nullptr)
+    if (psExtraParams->poPointIndex != nullptr &&
+        poOptions->dfRadius1 == 0.0 && poOptions->dfRadius2 == 0.0)
+    {
+        // Exact search of the nearest point among all points.
+        const GUInt32 iNearest =
+            psExtraParams->poPointIndex->GetNearest(dfXPoint, dfYPoint);
+        if (iNearest != GDALGridPointIndex::INVALID_INDEX)
+            dfNearestValue = padfZ[iNearest];
+    }
+    else if (hQuadTree != nullptr)
     {
         if (poOptions->dfRadius1 > 0 || poOptions->dfRadius2 > 0)
             dfSearchRadius =
@@ -2556,6 +2846,9 @@ struct _GDALGridJob
     const void *poOptions;
     GDALGridFunction pfnGDALGridMethod;
     GDALGridExtraParameters *psExtraParameters;
+    // If positive, radius of the circle enclosing the search ellipse, and
+    // processing is done by tiles, using psExtraParameters->poPointIndex.
+    double dfTileSearchRadius;
     int (*pfnProgress)(GDALGridJob *psJob);
     GDALDataType eType;
 
@@ -2603,6 +2896,168 @@ static int GDALGridProgressMonoThread(GDALGridJob *psJob)
     return FALSE;
 }
 
+/************************************************************************/
+/*                      GDALGridJobProcessTiled()                       */
+/************************************************************************/
+
+// Process square tiles of output cells at once: the points of the search
+// neighbourhood of a tile are fetched once from the point index, and the
+// gridding function is evaluated on them for each cell of the tile.
+// The candidate points are passed in increasing order of their index in the
+// input arrays, so that the result is the same as with all the points.
+static void GDALGridJobProcessTiled(GDALGridJob *psJob)
+{
+    int (*pfnProgress)(GDALGridJob * psJob) = psJob->pfnProgress;
+    const GUInt32 nXSize = psJob->nXSize;
+    const GUInt32 nYSize = psJob->nYSize;
+    const GUInt32 nYStep = psJob->nYStep;
+    const double dfXMin = psJob->dfXMin;
+    const double dfYMin = psJob->dfYMin;
+    const double dfDeltaX = psJob->dfDeltaX;
+    const double dfDeltaY = psJob->dfDeltaY;
+    const double *padfX = psJob->padfX;
+    const double *padfY = psJob->padfY;
+    const double *padfZ = psJob->padfZ;
+    const void *poOptions = psJob->poOptions;
+    GDALGridFunction pfnGDALGridMethod = psJob->pfnGDALGridMethod;
+    GDALGridExtraParameters sExtraParameters = *psJob->psExtraParameters;
+    const GDALGridPointIndex *poPointIndex = sExtraParameters.poPointIndex;
+    // The gridding function works on the candidate arrays
+    sExtraParameters.poPointIndex = nullptr;
+    const GDALDataType eType = psJob->eType;
+    const int nDataTypeSize = GDALGetDataTypeSizeBytes(eType);
+    const size_t nLineSpace = static_cast<size_t>(nXSize) * nDataTypeSize;
+
+    // Margin to be robust to rounding errors on the boundary of the ellipse
+    const double dfRadius = psJob->dfTileSearchRadius * (1 + 1e-10);
+
+    // Tiles about the size of the search radius are a good trade-off
+    // between the cost of the searches and the number of candidates.
+    const double dfCellsInRadius =
+        psJob->dfTileSearchRadius /
+        std::max(std::fabs(dfDeltaX), std::fabs(dfDeltaY));
+    constexpr double MAX_TILE_SIZE = 64;
+    const GUInt32 nTileSize = static_cast<GUInt32>(
+        dfCellsInRadius >= 1 ? std::min(dfCellsInRadius, MAX_TILE_SIZE) : 1);
+
+    std::vector<double> adfValues;
+    std::vector<GUInt32> anCandidates;
+    std::vector<double> adfCandidateX;
+    std::vector<double> adfCandidateY;
+    std::vector<double> adfCandidateZ;
+    try
+    {
+        adfValues.resize(static_cast<size_t>(nXSize) * nTileSize);
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate memory for a row of tiles");
+        *(psJob->pbStop) = TRUE;
+        if (pfnProgress != nullptr)
+            pfnProgress(psJob);  // To notify the main thread.
+        return;
+    }
+
+    for (uint64_t nYTile = psJob->nYStart;
+         nYTile * nTileSize < nYSize && !*psJob->pbStop; nYTile += nYStep)
+    {
+        const GUInt32 nYTileStart = static_cast<GUInt32>(nYTile * nTileSize);
+        const GUInt32 nYTileEnd = std::min(nYTileStart + nTileSize, nYSize);
+        const double dfYFirst = dfYMin + (nYTileStart + 0.5) * dfDeltaY;
+        const double dfYLast = dfYMin + (nYTileEnd - 1 + 0.5) * dfDeltaY;
+
+        bool bError = false;
+        for (GUInt32 nXTileStart = 0; !bError && nXTileStart < nXSize;
+             nXTileStart += nTileSize)
+        {
+            const GUInt32 nXTileEnd =
+                std::min(nXSize - nXTileStart, nTileSize) + nXTileStart;
+            const double dfXFirst = dfXMin + (nXTileStart + 0.5) * dfDeltaX;
+            const double dfXLast = dfXMin + (nXTileEnd - 1 + 0.5) * dfDeltaX;
+
+            anCandidates.clear();
+            poPointIndex->Search(std::min(dfXFirst, dfXLast) - dfRadius,
+                                 std::min(dfYFirst, dfYLast) - dfRadius,
+                                 std::max(dfXFirst, dfXLast) + dfRadius,
+                                 std::max(dfYFirst, dfYLast) + dfRadius,
+                                 anCandidates);
+            const size_t nCandidates = anCandidates.size();
+            try
+            {
+                adfCandidateX.resize(nCandidates);
+                adfCandidateY.resize(nCandidates);
+                adfCandidateZ.resize(nCandidates);
+            }
+            catch (const std::bad_alloc &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Cannot allocate memory for candidate points");
+                bError = true;
+                break;
+            }
+            for (size_t k = 0; k < nCandidates; ++k)
+            {
+                const GUInt32 i = anCandidates[k];
+                adfCandidateX[k] = padfX[i];
+                adfCandidateY[k] = padfY[i];
+                adfCandidateZ[k] = padfZ[i];
+            }
+
+            for (GUInt32 nYPoint = nYTileStart; !bError && nYPoint < nYTileEnd;
+                 nYPoint++)
+            {
+                const double dfYPoint = dfYMin + (nYPoint + 0.5) * dfDeltaY;
+                double *padfValues =
+                    adfValues.data() +
+                    static_cast<size_t>(nYPoint - nYTileStart) * nXSize;
+                for (GUInt32 nXPoint = nXTileStart; nXPoint < nXTileEnd;
+                     nXPoint++)
+                {
+                    const double dfXPoint =
+                        dfXMin + (nXPoint + 0.5) * dfDeltaX;
+                    if ((*pfnGDALGridMethod)(
+                            poOptions, static_cast<GUInt32>(nCandidates),
+                            adfCandidateX.data(), adfCandidateY.data(),
+                            adfCandidateZ.data(), dfXPoint, dfYPoint,
+                            padfValues + nXPoint,
+                            &sExtraParameters) != CE_None)
+                    {
+                        CPLError(CE_Failure, CPLE_AppDefined,
+                                 "Gridding failed at X position %lu, Y "
+                                 "position %lu",
+                                 static_cast<long unsigned int>(nXPoint),
+                                 static_cast<long unsigned int>(nYPoint));
+                        bError = true;
+                        break;
+                    }
+                }
+            }
+        }
+        if (bError)
+        {
+            *psJob->pbStop = TRUE;
+            if (pfnProgress != nullptr)
+                pfnProgress(psJob);  // To notify the main thread.
+            break;
+        }
+
+        for (GUInt32 nYPoint = nYTileStart; nYPoint < nYTileEnd; nYPoint++)
+        {
+            GDALCopyWords(adfValues.data() +
+                              static_cast<size_t>(nYPoint - nYTileStart) *
+                                  nXSize,
+                          GDT_Float64, sizeof(double),
+                          psJob->pabyData + nYPoint * nLineSpace, eType,
+                          nDataTypeSize, nXSize);
+
+            if (*psJob->pbStop ||
+                (pfnProgress != nullptr && pfnProgress(psJob)))
+                break;
+        }
+    }
+}
+
 /************************************************************************/
 /*                         GDALGridJobProcess()                         */
 /************************************************************************/
@@ -2610,6 +3065,12 @@ static int GDALGridProgressMonoThread(GDALGridJob *psJob)
 static void GDALGridJobProcess(void *user_data)
 {
     GDALGridJob *const psJob = static_cast<GDALGridJob *>(user_data);
+    if (psJob->dfTileSearchRadius > 0 &&
+        psJob->psExtraParameters->poPointIndex != nullptr)
+    {
+        GDALGridJobProcessTiled(psJob);
+        return;
+    }
     int (*pfnProgress)(GDALGridJob * psJob) = psJob->pfnProgress;
     const GUInt32 nXSize = psJob->nXSize;
 
@@ -2704,6 +3165,8 @@ struct GDALGridContext
     double *padfY;
     double *padfZ;
     bool bFreePadfXYZArrays;
+    // See GDALGridJob::dfTileSearchRadius
+    double dfTileSearchRadius;
 
     CPLWorkerThreadPool *poWorkerThreadPool;
 };
@@ -3171,6 +3634,66 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
             return nullptr;
     }
 
+    /* -------------------------------------------------------------------- */
+    /*  Algorithms that only use the points of a search ellipse, or the     */
+    /*  nearest point, use a grid-bucket index of the points. With a        */
+    /*  search ellipse, output cells are processed by tiles, so that the    */
+    /*  candidate points found for a tile are shared by its cells.          */
+    /* -------------------------------------------------------------------- */
+    bool bCreatePointIndex = false;
+    double dfTileSearchRadius = 0;
+    if (nPoints > nPointCountThreshold)
+    {
+        const auto UseEllipse = [&bCreatePointIndex,
+                                 &dfTileSearchRadius](double dfRadius1,
+                                                      double dfRadius2)
+        {
+            if (dfRadius1 > 0 && dfRadius2 > 0)
+            {
+                bCreatePointIndex = true;
+                dfTileSearchRadius = std::max(dfRadius1, dfRadius2);
+            }
+        };
+
+        if (pfnGDALGridMethod == GDALGridNearestNeighbor)
+        {
+            const auto poNNOptions =
+                static_cast<const GDALGridNearestNeighborOptions *>(poOptions);
+            if (poNNOptions->dfRadius1 == 0.0 && poNNOptions->dfRadius2 == 0.0)
+                bCreatePointIndex = true;
+            else if (!bCreateQuadTree)
+                UseEllipse(poNNOptions->dfRadius1, poNNOptions->dfRadius2);
+        }
+        else if (pfnGDALGridMethod == GDALGridInverseDistanceToAPower)
+        {
+            const auto poPowerOptions =
+                static_cast<const GDALGridInverseDistanceToAPowerOptions *>(
+                    poOptions);
+            UseEllipse(poPowerOptions->dfRadius1, poPowerOptions->dfRadius2);
+        }
+        else if (pfnGDALGridMethod == GDALGridMovingAverage)
+        {
+            const auto poAverageOptions =
+                static_cast<const GDALGridMovingAverageOptions *>(poOptions);
+            UseEllipse(poAverageOptions->dfRadius1,
+                       poAverageOptions->dfRadius2);
+        }
+        else if (pfnGDALGridMethod == GDALGridDataMetricMinimum ||
+                 pfnGDALGridMethod == GDALGridDataMetricMaximum ||
+                 pfnGDALGridMethod == GDALGridDataMetricRange ||
+                 pfnGDALGridMethod == GDALGridDataMetricCount ||
+                 pfnGDALGridMethod == GDALGridDataMetricAverageDistance ||
+                 pfnGDALGridMethod == GDALGridDataMetricAverageDistancePts)
+        {
+            const auto poMetricsOptions =
+                static_cast<const GDALGridDataMetricsOptions *>(poOptions);
+            UseEllipse(poMetricsOptions->dfRadius1,
+                       poMetricsOptions->dfRadius2);
+        }
+        if (bCreatePointIndex)
+            bCreateQuadTree = false;
+    }
+
     if (pafXAligned == nullptr && !bCallerWillKeepPointArraysAlive)
     {
         double *padfXNew =
@@ -3204,6 +3727,7 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
     psContext->sXYArrays.padfX = padfX;
     psContext->sXYArrays.padfY = padfY;
     psContext->sExtraParameters.hQuadTree = nullptr;
+    psContext->sExtraParameters.poPointIndex = nullptr;
     psContext->sExtraParameters.dfInitialSearchRadius = 0.0;
     psContext->sExtraParameters.pafX = pafXAligned;
     psContext->sExtraParameters.pafY = pafYAligned;
@@ -3216,6 +3740,14 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
     psContext->bFreePadfXYZArrays =
         pafXAligned ? false : !bCallerWillKeepPointArraysAlive;
 
+    if (bCreatePointIndex)
+    {
+        psContext->sExtraParameters.poPointIndex =
+            GDALGridPointIndex::Create(nPoints, padfX, padfY);
+        if (psContext->sExtraParameters.poPointIndex != nullptr)
+            psContext->dfTileSearchRadius = dfTileSearchRadius;
+    }
+
     /* -------------------------------------------------------------------- */
     /*  Create quadtree if requested and possible.                          */
     /* -------------------------------------------------------------------- */
@@ -3364,6 +3896,7 @@ void GDALGridContextFree(GDALGridContext *psContext)
         CPLFree(psContext->pasGridPoints);
         if (psContext->sExtraParameters.hQuadTree != nullptr)
             CPLQuadTreeDestroy(psContext->sExtraParameters.hQuadTree);
+        delete psContext->sExtraParameters.poPointIndex;
         if (psContext->bFreePadfXYZArrays)
         {
             CPLFree(psContext->padfX);
@@ -3505,6 +4038,7 @@ CPLErr GDALGridContextProcess(GDALGridContext *psContext, double dfXMin,
     sJob.poOptions = psContext->poOptions;
     sJob.pfnGDALGridMethod = psContext->pfnGDALGridMethod;
     sJob.psExtraParameters = &psContext->sExtraParameters;
+    sJob.dfTileSearchRadius = psContext->dfTileSearchRadius;
     sJob.pfnProgress = nullptr;
     sJob.eType = eType;
     sJob.pfnRealProgress = pfnProgress;
@@ -21,6 +21,8 @@
 
 //! @cond Doxygen_Suppress
 
+class GDALGridPointIndex;
+
 typedef struct
 {
     const double *padfX;
@@ -36,6 +38,8 @@ typedef struct
 typedef struct
 {
     CPLQuadTree *hQuadTree;
+    /*! Spatial index of the points, or NULL. */
+    const GDALGridPointIndex *poPointIndex;
     double dfInitialSearchRadius;
     float *pafX;  // Aligned to be usable with AVX
     float *pafY;
@@ -13,25 +13,204 @@
 
 #include "cpl_port.h"
 #include "gdal_alg.h"
+#include "gdal_alg_priv.h"
 
 #include <cmath>
 #include <cstdlib>
 
 #include <algorithm>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <new>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
+#include "gdal_thread_pool.h"
 
-static CPLErr ProcessProximityLine(GInt32 *panSrcScanline, int *panNearX,
-                                   int *panNearY, int bForward, int iLine,
-                                   int nXSize, double nMaxDist,
-                                   float *pafProximity,
-                                   double *pdfSrcNoDataValue, int nTargetValues,
-                                   int *panTargetValues);
+namespace
+{
+
+/************************************************************************/
+/*                          GDALProximityParams                         */
+/************************************************************************/
+
+// Parameters shared by the passes of GDALComputeProximity(). Distances are
+// computed in pixels, or in georeferenced units with DISTUNITS=GEO.
+struct GDALProximityParams
+{
+    int nXSize = 0;
+    std::vector<int> anTargetValues{};
+    bool bHasSrcNoData = false;
+    double dfSrcNoDataValue = 0;
+    double dfPixelSizeX = 1;
+    double dfPixelSizeY = 1;
+    double dfMaxDistSquare = std::numeric_limits<double>::infinity();
+    float fNoDataValue = 0;
+    bool bFixedBufVal = false;
+    float fFixedBufVal = 0;
+
+    bool IsTarget(GInt32 nValue) const
+    {
+        if (anTargetValues.empty())
+            return nValue != 0;
+        return std::find(anTargetValues.begin(), anTargetValues.end(),
+                         nValue) != anTargetValues.end();
+    }
+
+    // Whether a target at nRows rows in the same column is within MAXDIST
+    bool IsWithinMaxDist(int nRows) const
+    {
+        const double dfDist = nRows * dfPixelSizeY;
+        return dfDist * dfDist <= dfMaxDistSquare;
+    }
+};
+
+}  // namespace
+
+/************************************************************************/
+/*                      ProcessProximityColumnsDown()                   */
+/************************************************************************/
+
+// First pass of the distance transform, from top to bottom, over the
+// columns [iXStart, iXEnd) of a strip of nRows rows starting at line nYOff.
+// panDist receives the number of rows to the nearest target pixel above in
+// the same column, 0 for target pixels, and -1 if there is none within
+// MAXDIST. panLastTarget holds the line of the last target pixel seen in each
+// column, and is carried over from one strip to the next.
+static void ProcessProximityColumnsDown(const GDALProximityParams &sParams,
+                                        const GInt32 *panSrc, GInt32 *panDist,
+                                        int nYOff, int nRows,
+                                        int *panLastTarget, int iXStart,
+                                        int iXEnd)
+{
+    const size_t nXSize = sParams.nXSize;
+    for (int iRow = 0; iRow < nRows; iRow++)
+    {
+        const int iLine = nYOff + iRow;
+        const GInt32 *panSrcLine = panSrc + iRow * nXSize;
+        GInt32 *panDistLine = panDist + iRow * nXSize;
+        for (int iPixel = iXStart; iPixel < iXEnd; iPixel++)
+        {
+            if (sParams.IsTarget(panSrcLine[iPixel]))
+            {
+                panLastTarget[iPixel] = iLine;
+                panDistLine[iPixel] = 0;
+            }
+            else if (panLastTarget[iPixel] >= 0 &&
+                     sParams.IsWithinMaxDist(iLine - panLastTarget[iPixel]))
+            {
+                panDistLine[iPixel] = iLine - panLastTarget[iPixel];
+            }
+            else
+            {
+                panDistLine[iPixel] = -1;
+            }
+        }
+    }
+}
+
+/************************************************************************/
+/*                       ProcessProximityColumnsUp()                    */
+/************************************************************************/
+
+// Second pass of the distance transform, from bottom to top. On output,
+// panDist holds the number of rows to the nearest target pixel in the same
+// column, or -1. panNextTarget holds the line of the last target pixel seen
+// in each column.
+static void ProcessProximityColumnsUp(const GDALProximityParams &sParams,
+                                      GInt32 *panDist, int nYOff, int nRows,
+                                      int *panNextTarget, int iXStart,
+                                      int iXEnd)
+{
+    const size_t nXSize = sParams.nXSize;
+    for (int iRow = nRows - 1; iRow >= 0; iRow--)
+    {
+        const int iLine = nYOff + iRow;
+        GInt32 *panDistLine = panDist + iRow * nXSize;
+        for (int iPixel = iXStart; iPixel < iXEnd; iPixel++)
+        {
+            if (panDistLine[iPixel] == 0)
+            {
+                panNextTarget[iPixel] = iLine;
+            }
+            else if (panNextTarget[iPixel] >= 0)
+            {
+                const int nDist = panNextTarget[iPixel] - iLine;
+                if ((panDistLine[iPixel] < 0 ||
+                     nDist < panDistLine[iPixel]) &&
+                    sParams.IsWithinMaxDist(nDist))
+                {
+                    panDistLine[iPixel] = nDist;
+                }
+            }
+        }
+    }
+}
+
+/************************************************************************/
+/*                         ProcessProximityRow()                        */
+/************************************************************************/
+
+// Last pass of the distance transform, on a single row, given the distance
+// to the nearest target pixel in each column. The squared distance from
+// pixel x to the nearest target pixel is the minimum over columns q of the
+// parabolas ((x - q) * dfPixelSizeX)^2 + h(q), with h(q) the squared distance
+// to the nearest target pixel in column q. Their lower envelope is computed
+// in linear time in oEnvelope, whose X scale must be dfPixelSizeX^2.
+// panSrc is only used if the source nodata value must be respected.
+static void ProcessProximityRow(const GDALProximityParams &sParams,
+                                const GInt32 *panDist, const GInt32 *panSrc,
+                                float *pafProximity,
+                                GDALParabolaLowerEnvelope &oEnvelope)
+{
+    const int nXSize = sParams.nXSize;
+
+    oEnvelope.Reset();
+    for (int q = 0; q < nXSize; q++)
+    {
+        if (panDist[q] < 0)
+            continue;
+        const double dfDY = panDist[q] * sParams.dfPixelSizeY;
+        oEnvelope.Add(q, dfDY * dfDY);
+    }
+    const int nSites = oEnvelope.GetSiteCount();
+
+    int k = 0;
+    for (int iPixel = 0; iPixel < nXSize; iPixel++)
+    {
+        if (panDist[iPixel] == 0)
+        {
+            pafProximity[iPixel] = 0.0f;
+            continue;
+        }
+        if (nSites == 0 || (sParams.bHasSrcNoData &&
+                            panSrc[iPixel] == sParams.dfSrcNoDataValue))
+        {
+            pafProximity[iPixel] = sParams.fNoDataValue;
+            continue;
+        }
+
+        while (k + 1 < nSites && oEnvelope.GetBound(k + 1) < iPixel)
+            k++;
+        const double dfDX =
+            (static_cast<double>(iPixel) - oEnvelope.GetSite(k)) *
+            sParams.dfPixelSizeX;
+        const double dfDistSq = dfDX * dfDX + oEnvelope.GetHeight(k);
+        if (dfDistSq > sParams.dfMaxDistSquare)
+            pafProximity[iPixel] = sParams.fNoDataValue;
+        else if (sParams.bFixedBufVal)
+            pafProximity[iPixel] = sParams.fFixedBufVal;
+        else
+            pafProximity[iPixel] = static_cast<float>(sqrt(dfDistSq));
+    }
+}
 
 /************************************************************************/
 /*                        GDALComputeProximity()                        */
@@ -49,6 +228,11 @@ default all non-zero pixels in hSrcBand will be considered the
 that target pixels are set to the value corresponding to a distance
 of zero.
 
+Since GDAL 3.12, the Euclidean distance to the nearest target pixel is
+computed exactly, with a separable distance transform. The raster is
+processed by strips of rows, so that memory use does not depend on the
+raster height.
+
 The progress function args may be NULL or a valid progress reporting function
 such as GDALTermProgress/NULL.
 
@@ -65,7 +249,8 @@ integers.
 
 Indicates whether distances will be computed in pixel units or
 in georeferenced units.  The default is pixel units.  This also
-determines the interpretation of MAXDIST.
+determines the interpretation of MAXDIST.  Since GDAL 3.12, pixels
+in georeferenced units do not need to be square.
 
   MAXDIST=n
 
@@ -89,6 +274,13 @@ the proximity output.
 
 If this option is set, all pixels within the MAXDIST threshold are
 set to this fixed value instead of to a proximity distance.
+
+  NUM_THREADS=number|ALL_CPUS
+
+(GDAL >= 3.12) Number of worker threads used to process the columns and
+the rows of each strip. Defaults to the value of the GDAL_NUM_THREADS
+configuration option, or 1. Reading and writing are done by the calling
+thread.
 */
 
 CPLErr CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
@@ -104,10 +296,13 @@ CPLErr CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
     if (pfnProgress == nullptr)
         pfnProgress = GDALDummyProgress;
 
+    GDALProximityParams sParams;
+
     /* -------------------------------------------------------------------- */
     /*      Are we using pixels or georeferenced coordinates for distances? */
     /* -------------------------------------------------------------------- */
-    double dfDistMult = 1.0;
+    double dfPixelSizeX = 1.0;
+    double dfPixelSizeY = 1.0;
     const char *pszOpt = CSLFetchNameValue(papszOptions, "DISTUNITS");
     if (pszOpt)
     {
@@ -119,12 +314,25 @@ CPLErr CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
                 double adfGeoTransform[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
 
                 GDALGetGeoTransform(hSrcDS, adfGeoTransform);
-                if (std::abs(adfGeoTransform[1]) !=
-                    std::abs(adfGeoTransform[5]))
+                // Length of the sides of a pixel, which are assumed to be
+                // perpendicular.
+                if (adfGeoTransform[1] * adfGeoTransform[2] +
+                        adfGeoTransform[4] * adfGeoTransform[5] !=
+                    0)
                     CPLError(
                         CE_Warning, CPLE_AppDefined,
-                        "Pixels not square, distances will be inaccurate.");
-                dfDistMult = std::abs(adfGeoTransform[1]);
+                        "Pixels not rectangular, distances will be "
+                        "inaccurate.");
+                dfPixelSizeX =
+                    std::hypot(adfGeoTransform[1], adfGeoTransform[4]);
+                dfPixelSizeY =
+                    std::hypot(adfGeoTransform[2], adfGeoTransform[5]);
+                if (!(dfPixelSizeX > 0) || !(dfPixelSizeY > 0))
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "Invalid geotransform: null pixel size.");
+                    return CE_Failure;
+                }
             }
         }
         else if (!EQUAL(pszOpt, "PIXEL"))
@@ -136,16 +344,20 @@ CPLErr CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
             return CE_Failure;
         }
     }
+    sParams.dfPixelSizeX = dfPixelSizeX;
+    sParams.dfPixelSizeY = dfPixelSizeY;
 
     /* -------------------------------------------------------------------- */
     /*      What is our maxdist value?                                      */
     /* -------------------------------------------------------------------- */
     pszOpt = CSLFetchNameValue(papszOptions, "MAXDIST");
-    const double dfMaxDist = pszOpt ? CPLAtof(pszOpt) / dfDistMult
-                                    : GDALGetRasterBandXSize(hSrcBand) +
-                                          GDALGetRasterBandYSize(hSrcBand);
-
-    CPLDebug("GDAL", "MAXDIST=%g, DISTMULT=%g", dfMaxDist, dfDistMult);
+    if (pszOpt)
+    {
+        const double dfMaxDist = CPLAtof(pszOpt);
+        sParams.dfMaxDistSquare = dfMaxDist * dfMaxDist;
+        CPLDebug("GDAL", "MAXDIST=%g, PIXELSIZE=%gx%g", dfMaxDist,
+                 dfPixelSizeX, dfPixelSizeY);
+    }
 
     /* -------------------------------------------------------------------- */
     /*      Verify the source and destination are compatible.               */
@@ -159,70 +371,74 @@ CPLErr CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
                  "Source and proximity bands are not the same size.");
         return CE_Failure;
     }
+    sParams.nXSize = nXSize;
 
     /* -------------------------------------------------------------------- */
     /*      Get input NODATA value.                                         */
     /* -------------------------------------------------------------------- */
-    double dfSrcNoDataValue = 0.0;
-    double *pdfSrcNoData = nullptr;
     if (CPLFetchBool(papszOptions, "USE_INPUT_NODATA", false))
     {
         int bSrcHasNoData = 0;
-        dfSrcNoDataValue = GDALGetRasterNoDataValue(hSrcBand, &bSrcHasNoData);
-        if (bSrcHasNoData)
-            pdfSrcNoData = &dfSrcNoDataValue;
+        sParams.dfSrcNoDataValue =
+            GDALGetRasterNoDataValue(hSrcBand, &bSrcHasNoData);
+        sParams.bHasSrcNoData = bSrcHasNoData != 0;
     }
 
     /* -------------------------------------------------------------------- */
     /*      Get output NODATA value.                                        */
     /* -------------------------------------------------------------------- */
-    float fNoDataValue = 0.0f;
     pszOpt = CSLFetchNameValue(papszOptions, "NODATA");
     if (pszOpt != nullptr)
     {
-        fNoDataValue = static_cast<float>(CPLAtof(pszOpt));
+        sParams.fNoDataValue = static_cast<float>(CPLAtof(pszOpt));
     }
     else
     {
         int bSuccess = FALSE;
 
-        fNoDataValue = static_cast<float>(
+        sParams.fNoDataValue = static_cast<float>(
             GDALGetRasterNoDataValue(hProximityBand, &bSuccess));
         if (!bSuccess)
-            fNoDataValue = 65535.0;
+            sParams.fNoDataValue = 65535.0;
     }
 
     /* -------------------------------------------------------------------- */
     /*      Is there a fixed value we wish to force the buffer area to?     */
     /* -------------------------------------------------------------------- */
-    double dfFixedBufVal = 0.0;
-    bool bFixedBufVal = false;
     pszOpt = CSLFetchNameValue(papszOptions, "FIXED_BUF_VAL");
     if (pszOpt)
     {
-        dfFixedBufVal = CPLAtof(pszOpt);
-        bFixedBufVal = true;
+        sParams.fFixedBufVal = static_cast<float>(CPLAtof(pszOpt));
+        sParams.bFixedBufVal = true;
     }
 
     /* -------------------------------------------------------------------- */
     /*      Get the target value(s).                                        */
     /* -------------------------------------------------------------------- */
-    int *panTargetValues = nullptr;
-    int nTargetValues = 0;
-
     pszOpt = CSLFetchNameValue(papszOptions, "VALUES");
     if (pszOpt != nullptr)
     {
-        char **papszValuesTokens =
-            CSLTokenizeStringComplex(pszOpt, ",", FALSE, FALSE);
-
-        nTargetValues = CSLCount(papszValuesTokens);
-        panTargetValues =
-            static_cast<int *>(CPLCalloc(sizeof(int), nTargetValues));
+        const CPLStringList aosValuesTokens(
+            CSLTokenizeStringComplex(pszOpt, ",", FALSE, FALSE));
+        for (int i = 0; i < aosValuesTokens.size(); i++)
+            sParams.anTargetValues.push_back(atoi(aosValuesTokens[i]));
+    }
 
-        for (int i = 0; i < nTargetValues; i++)
-            panTargetValues[i] = atoi(papszValuesTokens[i]);
-        CSLDestroy(papszValuesTokens);
+    /* -------------------------------------------------------------------- */
+    /*      How many threads?                                               */
+    /* -------------------------------------------------------------------- */
+    pszOpt = CSLFetchNameValue(papszOptions, "NUM_THREADS");
+    if (pszOpt == nullptr)
+        pszOpt = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    const int nThreads = std::max(
+        1, std::min(128, EQUAL(pszOpt, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                   : atoi(pszOpt)));
+    std::unique_ptr<CPLJobQueue> poJobQueue;
+    if (nThreads > 1)
+    {
+        CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+        if (poThreadPool)
+            poJobQueue = poThreadPool->CreateJobQueue();
     }
 
     /* -------------------------------------------------------------------- */
@@ -231,45 +447,38 @@ CPLErr CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
     if (!pfnProgress(0.0, "", pProgressArg))
     {
         CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-        CPLFree(panTargetValues);
         return CE_Failure;
     }
 
     /* -------------------------------------------------------------------- */
-    /*      We need a signed type for the working proximity values kept     */
-    /*      on disk.  If our proximity band is not signed, then create a    */
-    /*      temporary file for this purpose.                                */
+    /*      The distances to the nearest target pixel above, computed by    */
+    /*      the first pass, are kept on disk as integers. If our proximity  */
+    /*      band cannot store them exactly, then create a temporary file    */
+    /*      for this purpose.                                               */
     /* -------------------------------------------------------------------- */
     GDALRasterBandH hWorkProximityBand = hProximityBand;
     GDALDatasetH hWorkProximityDS = nullptr;
     const GDALDataType eProxType = GDALGetRasterDataType(hProximityBand);
     CPLErr eErr = CE_None;
-
-    // TODO(schwehr): Localize after removing gotos.
-    float *pafProximity = nullptr;
-    int *panNearX = nullptr;
-    int *panNearY = nullptr;
-    GInt32 *panSrcScanline = nullptr;
     bool bTempFileAlreadyDeleted = false;
 
-    if (eProxType == GDT_Byte || eProxType == GDT_UInt16 ||
-        eProxType == GDT_UInt32)
+    if (!(eProxType == GDT_Int32 || eProxType == GDT_Int64 ||
+          eProxType == GDT_Float64 ||
+          (eProxType == GDT_Float32 && nYSize <= (1 << 24))))
     {
         GDALDriverH hDriver = GDALGetDriverByName("GTiff");
         if (hDriver == nullptr)
         {
             CPLError(CE_Failure, CPLE_AppDefined,
                      "GDALComputeProximity needs GTiff driver");
-            eErr = CE_Failure;
-            goto end;
+            return CE_Failure;
         }
         CPLString osTmpFile = CPLGenerateTempFilenameSafe("proximity");
         hWorkProximityDS = GDALCreate(hDriver, osTmpFile, nXSize, nYSize, 1,
-                                      GDT_Float32, nullptr);
+                                      GDT_Int32, nullptr);
         if (hWorkProximityDS == nullptr)
         {
-            eErr = CE_Failure;
-            goto end;
+            return CE_Failure;
         }
         // On Unix, attempt at deleting the temporary file now, so that
         // if the process gets interrupted, it is automatically destroyed
@@ -279,63 +488,73 @@ CPLErr CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
     }
 
     /* -------------------------------------------------------------------- */
-    /*      Allocate buffer for two scanlines of distances as floats        */
-    /*      (the current and last line).                                    */
+    /*      Allocate buffers for a strip of rows.                           */
     /* -------------------------------------------------------------------- */
-    pafProximity =
-        static_cast<float *>(VSI_MALLOC2_VERBOSE(sizeof(float), nXSize));
-    panNearX = static_cast<int *>(VSI_MALLOC2_VERBOSE(sizeof(int), nXSize));
-    panNearY = static_cast<int *>(VSI_MALLOC2_VERBOSE(sizeof(int), nXSize));
-    panSrcScanline =
-        static_cast<GInt32 *>(VSI_MALLOC2_VERBOSE(sizeof(GInt32), nXSize));
-
-    if (pafProximity == nullptr || panNearX == nullptr || panNearY == nullptr ||
-        panSrcScanline == nullptr)
+    // Strips of about 4 million pixels
+    const int nRowsPerStrip = std::max(
+        1, std::min(nYSize, GDALGetRowsPerStrip(
+                                hProximityBand, nXSize, 4 * 1024 * 1024,
+                                "GDAL_PROXIMITY_ROWS_PER_STRIP")));
+    const int nStrips = (nYSize + nRowsPerStrip - 1) / nRowsPerStrip;
+    const size_t nStripPixels = static_cast<size_t>(nXSize) * nRowsPerStrip;
+    const int nChunks = std::max(1, std::min(nThreads, nXSize));
+    std::vector<GInt32> anSrc;
+    std::vector<GInt32> anDist;
+    std::vector<float> afProximity;
+    std::vector<int> anNearTarget;
+    std::vector<GDALParabolaLowerEnvelope> aoEnvelopes;
+    try
+    {
+        anSrc.resize(nStripPixels);
+        anDist.resize(nStripPixels);
+        afProximity.resize(nStripPixels);
+        anNearTarget.resize(nXSize, -1);
+        aoEnvelopes.resize(
+            nChunks, GDALParabolaLowerEnvelope(sParams.dfPixelSizeX *
+                                               sParams.dfPixelSizeX));
+        for (auto &oEnvelope : aoEnvelopes)
+            oEnvelope.Reserve(nXSize);
+    }
+    catch (const std::bad_alloc &)
     {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate proximity buffers");
         eErr = CE_Failure;
-        goto end;
     }
 
     /* -------------------------------------------------------------------- */
-    /*      Loop from top to bottom of the image.                           */
+    /*      Loop from top to bottom of the image, computing the distance    */
+    /*      to the nearest target pixel above in each column.               */
     /* -------------------------------------------------------------------- */
-
-    for (int i = 0; i < nXSize; i++)
+    for (int iStrip = 0; eErr == CE_None && iStrip < nStrips; iStrip++)
     {
-        panNearX[i] = -1;
-        panNearY[i] = -1;
-    }
+        const int nYOff = iStrip * nRowsPerStrip;
+        const int nRows = std::min(nRowsPerStrip, nYSize - nYOff);
 
-    for (int iLine = 0; eErr == CE_None && iLine < nYSize; iLine++)
-    {
-        // Read for target values.
-        eErr = GDALRasterIO(hSrcBand, GF_Read, 0, iLine, nXSize, 1,
-                            panSrcScanline, nXSize, 1, GDT_Int32, 0, 0);
+        eErr = GDALRasterIO(hSrcBand, GF_Read, 0, nYOff, nXSize, nRows,
+                            anSrc.data(), nXSize, nRows, GDT_Int32, 0, 0);
         if (eErr != CE_None)
             break;
 
-        for (int i = 0; i < nXSize; i++)
-            pafProximity[i] = -1.0;
-
-        // Left to right.
-        ProcessProximityLine(panSrcScanline, panNearX, panNearY, TRUE, iLine,
-                             nXSize, dfMaxDist, pafProximity, pdfSrcNoData,
-                             nTargetValues, panTargetValues);
-
-        // Right to Left.
-        ProcessProximityLine(panSrcScanline, panNearX, panNearY, FALSE, iLine,
-                             nXSize, dfMaxDist, pafProximity, pdfSrcNoData,
-                             nTargetValues, panTargetValues);
-
-        // Write out results.
-        eErr = GDALRasterIO(hWorkProximityBand, GF_Write, 0, iLine, nXSize, 1,
-                            pafProximity, nXSize, 1, GDT_Float32, 0, 0);
-
+        GDALRunParallel(
+            poJobQueue.get(), nThreads, nXSize,
+            [&sParams, &anSrc, &anDist, &anNearTarget, nYOff,
+             nRows](int, int iXStart, int iXEnd)
+            {
+                ProcessProximityColumnsDown(sParams, anSrc.data(),
+                                            anDist.data(), nYOff, nRows,
+                                            anNearTarget.data(), iXStart,
+                                            iXEnd);
+            });
+
+        eErr = GDALRasterIO(hWorkProximityBand, GF_Write, 0, nYOff, nXSize,
+                            nRows, anDist.data(), nXSize, nRows, GDT_Int32, 0,
+                            0);
         if (eErr != CE_None)
             break;
 
-        if (!pfnProgress(0.5 * (iLine + 1) / static_cast<double>(nYSize), "",
-                         pProgressArg))
+        if (!pfnProgress(0.5 * (nYOff + nRows) / static_cast<double>(nYSize),
+                         "", pProgressArg))
         {
             CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
             eErr = CE_Failure;
@@ -343,63 +562,64 @@ CPLErr CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
     }
 
     /* -------------------------------------------------------------------- */
-    /*      Loop from bottom to top of the image.                           */
+    /*      Loop from bottom to top of the image, completing the distance   */
+    /*      to the nearest target pixel in each column, and then computing  */
+    /*      the distance to the nearest target pixel on each row.           */
     /* -------------------------------------------------------------------- */
-    for (int i = 0; i < nXSize; i++)
-    {
-        panNearX[i] = -1;
-        panNearY[i] = -1;
-    }
+    std::fill(anNearTarget.begin(), anNearTarget.end(), -1);
 
-    for (int iLine = nYSize - 1; eErr == CE_None && iLine >= 0; iLine--)
+    for (int iStrip = nStrips - 1; eErr == CE_None && iStrip >= 0; iStrip--)
     {
-        // Read first pass proximity.
-        eErr = GDALRasterIO(hWorkProximityBand, GF_Read, 0, iLine, nXSize, 1,
-                            pafProximity, nXSize, 1, GDT_Float32, 0, 0);
+        const int nYOff = iStrip * nRowsPerStrip;
+        const int nRows = std::min(nRowsPerStrip, nYSize - nYOff);
 
+        eErr = GDALRasterIO(hWorkProximityBand, GF_Read, 0, nYOff, nXSize,
+                            nRows, anDist.data(), nXSize, nRows, GDT_Int32, 0,
+                            0);
         if (eErr != CE_None)
             break;
 
-        // Read pixel values.
-
-        eErr = GDALRasterIO(hSrcBand, GF_Read, 0, iLine, nXSize, 1,
-                            panSrcScanline, nXSize, 1, GDT_Int32, 0, 0);
-        if (eErr != CE_None)
-            break;
-
-        // Right to left.
-        ProcessProximityLine(panSrcScanline, panNearX, panNearY, FALSE, iLine,
-                             nXSize, dfMaxDist, pafProximity, pdfSrcNoData,
-                             nTargetValues, panTargetValues);
-
-        // Left to right.
-        ProcessProximityLine(panSrcScanline, panNearX, panNearY, TRUE, iLine,
-                             nXSize, dfMaxDist, pafProximity, pdfSrcNoData,
-                             nTargetValues, panTargetValues);
-
-        // Final post processing of distances.
-        for (int i = 0; i < nXSize; i++)
+        // Pixel values are only needed to check the input nodata value.
+        if (sParams.bHasSrcNoData)
         {
-            if (pafProximity[i] < 0.0)
-                pafProximity[i] = fNoDataValue;
-            else if (pafProximity[i] > 0.0)
-            {
-                if (bFixedBufVal)
-                    pafProximity[i] = static_cast<float>(dfFixedBufVal);
-                else
-                    pafProximity[i] =
-                        static_cast<float>(pafProximity[i] * dfDistMult);
-            }
+            eErr = GDALRasterIO(hSrcBand, GF_Read, 0, nYOff, nXSize, nRows,
+                                anSrc.data(), nXSize, nRows, GDT_Int32, 0, 0);
+            if (eErr != CE_None)
+                break;
         }
 
-        // Write out results.
-        eErr = GDALRasterIO(hProximityBand, GF_Write, 0, iLine, nXSize, 1,
-                            pafProximity, nXSize, 1, GDT_Float32, 0, 0);
+        GDALRunParallel(
+            poJobQueue.get(), nThreads, nXSize,
+            [&sParams, &anDist, &anNearTarget, nYOff,
+             nRows](int, int iXStart, int iXEnd)
+            {
+                ProcessProximityColumnsUp(sParams, anDist.data(), nYOff, nRows,
+                                          anNearTarget.data(), iXStart, iXEnd);
+            });
+
+        GDALRunParallel(
+            poJobQueue.get(), std::min(nThreads, nChunks), nRows,
+            [&sParams, &anSrc, &anDist, &afProximity, &aoEnvelopes,
+             nXSize](int iChunk, int iRowStart, int iRowEnd)
+            {
+                for (int iRow = iRowStart; iRow < iRowEnd; iRow++)
+                {
+                    const size_t nOffset = static_cast<size_t>(iRow) * nXSize;
+                    ProcessProximityRow(sParams, anDist.data() + nOffset,
+                                        anSrc.data() + nOffset,
+                                        afProximity.data() + nOffset,
+                                        aoEnvelopes[iChunk]);
+                }
+            });
 
+        // Write out results.
+        eErr = GDALRasterIO(hProximityBand, GF_Write, 0, nYOff, nXSize, nRows,
+                            afProximity.data(), nXSize, nRows, GDT_Float32, 0,
+                            0);
         if (eErr != CE_None)
             break;
 
-        if (!pfnProgress(0.5 + 0.5 * (nYSize - iLine) /
+        if (!pfnProgress(0.5 + 0.5 * (nYSize - nYOff) /
                                    static_cast<double>(nYSize),
                          "", pProgressArg))
         {
@@ -408,16 +628,9 @@ CPLErr CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
         }
     }
 
-/* -------------------------------------------------------------------- */
-/*      Cleanup                                                         */
-/* -------------------------------------------------------------------- */
-end:
-    CPLFree(panNearX);
-    CPLFree(panNearY);
-    CPLFree(panSrcScanline);
-    CPLFree(pafProximity);
-    CPLFree(panTargetValues);
-
+    /* -------------------------------------------------------------------- */
+    /*      Cleanup                                                         */
+    /* -------------------------------------------------------------------- */
     if (hWorkProximityDS != nullptr)
     {
         CPLString osProxFile = GDALGetDescription(hWorkProximityDS);
@@ -430,146 +643,3 @@ end:
 
     return eErr;
 }
-
-/************************************************************************/
-/*                         SquareDistance()                             */
-/************************************************************************/
-
-static double SquareDistance(double dfX1, double dfX2, double dfY1, double dfY2)
-{
-    const double dfDX = dfX1 - dfX2;
-    const double dfDY = dfY1 - dfY2;
-    return dfDX * dfDX + dfDY * dfDY;
-}
-
-/************************************************************************/
-/*                        ProcessProximityLine()                        */
-/************************************************************************/
-
-static CPLErr ProcessProximityLine(GInt32 *panSrcScanline, int *panNearX,
-                                   int *panNearY, int bForward, int iLine,
-                                   int nXSize, double dfMaxDist,
-                                   float *pafProximity,
-                                   double *pdfSrcNoDataValue, int nTargetValues,
-                                   int *panTargetValues)
-
-{
-    const int iStart = bForward ? 0 : nXSize - 1;
-    const int iEnd = bForward ? nXSize : -1;
-    const int iStep = bForward ? 1 : -1;
-
-    for (int iPixel = iStart; iPixel != iEnd; iPixel += iStep)
-    {
-        bool bIsTarget = false;
-
-        /* --------------------------------------------------------------------
-         */
-        /*      Is the current pixel a target pixel? */
-        /* --------------------------------------------------------------------
-         */
-        if (nTargetValues == 0)
-        {
-            bIsTarget = panSrcScanline[iPixel] != 0;
-        }
-        else
-        {
-            for (int i = 0; i < nTargetValues; i++)
-            {
-                if (panSrcScanline[iPixel] == panTargetValues[i])
-                    bIsTarget = TRUE;
-            }
-        }
-
-        if (bIsTarget)
-        {
-            pafProximity[iPixel] = 0.0;
-            panNearX[iPixel] = iPixel;
-            panNearY[iPixel] = iLine;
-            continue;
-        }
-
-        /* --------------------------------------------------------------------
-         */
-        /*      Are we near(er) to the closest target to the above (below) */
-        /*      pixel? */
-        /* --------------------------------------------------------------------
-         */
-        double dfNearDistSq = std::max(dfMaxDist, static_cast<double>(nXSize)) *
-                              std::max(dfMaxDist, static_cast<double>(nXSize)) *
-                              2.0;
-
-        if (panNearX[iPixel] != -1)
-        {
-            const double dfDistSq = SquareDistance(panNearX[iPixel], iPixel,
-                                                   panNearY[iPixel], iLine);
-
-            if (dfDistSq < dfNearDistSq)
-            {
-                dfNearDistSq = dfDistSq;
-            }
-            else
-            {
-                panNearX[iPixel] = -1;
-                panNearY[iPixel] = -1;
-            }
-        }
-
-        /* --------------------------------------------------------------------
-         */
-        /*      Are we near(er) to the closest target to the left (right) */
-        /*      pixel? */
-        /* --------------------------------------------------------------------
-         */
-        const int iLast = iPixel - iStep;
-
-        if (iPixel != iStart && panNearX[iLast] != -1)
-        {
-            const double dfDistSq =
-                SquareDistance(panNearX[iLast], iPixel, panNearY[iLast], iLine);
-
-            if (dfDistSq < dfNearDistSq)
-            {
-                dfNearDistSq = dfDistSq;
-                panNearX[iPixel] = panNearX[iLast];
-                panNearY[iPixel] = panNearY[iLast];
-            }
-        }
-
-        /* --------------------------------------------------------------------
-         */
-        /*      Are we near(er) to the closest target to the topright */
-        /*      (bottom left) pixel? */
-        /* --------------------------------------------------------------------
-         */
-        const int iTR = iPixel + iStep;
-
-        if (iTR != iEnd && panNearX[iTR] != -1)
-        {
-            const double dfDistSq =
-                SquareDistance(panNearX[iTR], iPixel, panNearY[iTR], iLine);
-
-            if (dfDistSq < dfNearDistSq)
-            {
-                dfNearDistSq = dfDistSq;
-                panNearX[iPixel] = panNearX[iTR];
-                panNearY[iPixel] = panNearY[iTR];
-            }
-        }
-
-        /* --------------------------------------------------------------------
-         */
-        /*      Update our proximity value. */
-        /* --------------------------------------------------------------------
-         */
-        if (panNearX[iPixel] != -1 &&
-            (pdfSrcNoDataValue == nullptr ||
-             panSrcScanline[iPixel] != *pdfSrcNoDataValue) &&
-            dfNearDistSq <= dfMaxDist * dfMaxDist &&
-            (pafProximity[iPixel] < 0 ||
-             dfNearDistSq < static_cast<double>(pafProximity[iPixel]) *
-                                pafProximity[iPixel]))
-            pafProximity[iPixel] = static_cast<float>(sqrt(dfNearDistSq));
-    }
-
-    return CE_None;
-}
@@ -16,11 +16,14 @@
 #include "gdal_alg_priv.h"
 
 #include <climits>
+#include <cmath>
 #include <cstddef>
 #include <cstdlib>
 #include <cstring>
 #include <cfloat>
 #include <limits>
+#include <memory>
+#include <utility>
 #include <vector>
 #include <algorithm>
 
@@ -29,9 +32,11 @@
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_priv.h"
 #include "gdal_priv_templates.hpp"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "ogr_feature.h"
@@ -857,6 +862,251 @@ static CPLErr GDALRasterizeOptions(CSLConstList papszOptions, int *pbAllTouched,
     return CE_None;
 }
 
+/************************************************************************/
+/*                        GDALRasterizeMTContext                        */
+/************************************************************************/
+
+// State of the multi-threaded rasterization of swaths in raster mode
+// (NUM_THREADS option). Each swath is split into horizontal strips of
+// disjoint lines that are scan-converted concurrently. Within a strip,
+// shapes are burnt in their original order, so the result is identical to
+// the single-threaded one, whatever the merge algorithm. Shapes are binned
+// by the range of lines covered by their transformed vertices, so that a
+// strip only visits the shapes that may touch it.
+
+namespace
+{
+struct GDALRasterizeMTContext
+{
+    std::unique_ptr<CPLJobQueue> poJobQueue{};
+    GDALTransformerFunc pfnTransformer = nullptr;
+    // One transformer per thread. The first one is the caller's one.
+    std::vector<void *> apTransformArgs{};
+    // First and last line potentially touched by each shape.
+    std::vector<std::pair<int, int>> anShapeLines{};
+
+    GDALRasterizeMTContext() = default;
+    GDALRasterizeMTContext(const GDALRasterizeMTContext &) = delete;
+    GDALRasterizeMTContext &operator=(const GDALRasterizeMTContext &) = delete;
+
+    ~GDALRasterizeMTContext()
+    {
+        for (size_t i = 1; i < apTransformArgs.size(); ++i)
+            GDALDestroyTransformer(apTransformArgs[i]);
+    }
+
+    int GetThreadCount() const
+    {
+        return static_cast<int>(apTransformArgs.size());
+    }
+};
+}  // namespace
+
+/************************************************************************/
+/*                     GDALRasterizeCreateMTContext()                   */
+/************************************************************************/
+
+// Returns nullptr if rasterization must be done by a single thread, either
+// because NUM_THREADS (or GDAL_NUM_THREADS) is 1, or because the transformer
+// cannot be cloned for each thread.
+static std::unique_ptr<GDALRasterizeMTContext>
+GDALRasterizeCreateMTContext(CSLConstList papszOptions,
+                             GDALTransformerFunc pfnTransformer,
+                             void *pTransformArg)
+{
+    const char *pszNumThreads = CSLFetchNameValue(papszOptions, "NUM_THREADS");
+    if (pszNumThreads == nullptr)
+        pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    const int nThreads =
+        std::max(1, std::min(128, EQUAL(pszNumThreads, "ALL_CPUS")
+                                      ? CPLGetNumCPUs()
+                                      : atoi(pszNumThreads)));
+    if (nThreads == 1)
+        return nullptr;
+
+    // Transformers are generally not thread-safe, so each thread needs its
+    // own. We can only clone the ones that we know to be GDAL transformers.
+    if (pfnTransformer != GDALGenImgProjTransform &&
+        pfnTransformer != GDALApproxTransform &&
+        pfnTransformer != GDALReprojectionTransform &&
+        pfnTransformer != GDALGCPTransform &&
+        pfnTransformer != GDALTPSTransform &&
+        pfnTransformer != GDALRPCTransform &&
+        pfnTransformer != GDALGeoLocTransform)
+    {
+        CPLDebug("GDAL", "Rasterizer: user-provided transformer cannot be "
+                         "cloned. Using a single thread");
+        return nullptr;
+    }
+
+    CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    if (poThreadPool == nullptr)
+        return nullptr;
+
+    auto poCtxt = std::make_unique<GDALRasterizeMTContext>();
+    poCtxt->pfnTransformer = pfnTransformer;
+    poCtxt->apTransformArgs.push_back(pTransformArg);
+    for (int i = 1; i < nThreads; ++i)
+    {
+        void *pClonedArg = GDALCloneTransformer(pTransformArg);
+        if (pClonedArg == nullptr)
+        {
+            CPLDebug("GDAL", "Rasterizer: transformer cannot be cloned. "
+                             "Using a single thread");
+            return nullptr;
+        }
+        poCtxt->apTransformArgs.push_back(pClonedArg);
+    }
+    poCtxt->poJobQueue = poThreadPool->CreateJobQueue();
+    CPLDebug("GDAL", "Rasterizer using %d threads", nThreads);
+    return poCtxt;
+}
+
+/************************************************************************/
+/*                    GDALRasterizeComputeShapeLines()                  */
+/************************************************************************/
+
+// Computes in poCtxt->anShapeLines the first and last line of the raster
+// that each shape may touch, from its vertices transformed in the same way
+// as gv_rasterize_one_shape() does. Shapes that cannot touch any line of
+// [0, nRasterYSize) get an empty range.
+static void GDALRasterizeComputeShapeLines(GDALRasterizeMTContext *poCtxt,
+                                           const OGRGeometry *const *papoShapes,
+                                           int nShapeCount, int nRasterYSize)
+{
+    poCtxt->anShapeLines.resize(nShapeCount);
+
+    const auto ComputeLines = [poCtxt, papoShapes, nRasterYSize](
+                                  void *pTransformArg, int nStart, int nEnd)
+    {
+        std::vector<double> aPointX;
+        std::vector<double> aPointY;
+        std::vector<double> aPointVariant;
+        std::vector<int> aPartSize;
+        std::vector<int> anSuccess;
+        for (int iShape = nStart; iShape < nEnd; ++iShape)
+        {
+            auto &oLines = poCtxt->anShapeLines[iShape];
+            oLines = std::make_pair(1, 0);
+
+            aPointX.clear();
+            aPointY.clear();
+            aPartSize.clear();
+            GDALCollectRingsFromGeometry(papoShapes[iShape], aPointX, aPointY,
+                                         aPointVariant, aPartSize,
+                                         GBV_UserBurnValue);
+            if (aPointX.empty())
+                continue;
+
+            anSuccess.resize(aPointX.size());
+            poCtxt->pfnTransformer(pTransformArg, FALSE,
+                                   static_cast<int>(aPointX.size()),
+                                   aPointX.data(), aPointY.data(), nullptr,
+                                   anSuccess.data());
+
+            double dfMinY = aPointY[0];
+            double dfMaxY = aPointY[0];
+            for (const double dfY : aPointY)
+            {
+                dfMinY = std::min(dfMinY, dfY);
+                dfMaxY = std::max(dfMaxY, dfY);
+            }
+
+            // Be conservative with vertices that could not be transformed,
+            // and keep a margin of one line for lines and touched pixels.
+            if (!std::isfinite(dfMinY) || !std::isfinite(dfMaxY))
+            {
+                oLines = std::make_pair(0, nRasterYSize - 1);
+            }
+            else if (dfMaxY >= -1 && dfMinY < nRasterYSize + 1)
+            {
+                oLines.first = std::max(
+                    0, static_cast<int>(std::floor(std::max(dfMinY, -1.0))) -
+                           1);
+                oLines.second = std::min(
+                    nRasterYSize - 1,
+                    static_cast<int>(std::floor(
+                        std::min(dfMaxY, static_cast<double>(nRasterYSize)))) +
+                        1);
+            }
+        }
+    };
+
+    const int nThreads = poCtxt->GetThreadCount();
+    const int nChunks = std::max(1, std::min(nThreads, nShapeCount));
+    for (int iChunk = 0; iChunk < nChunks; ++iChunk)
+    {
+        const int nStart = static_cast<int>(static_cast<GIntBig>(nShapeCount) *
+                                            iChunk / nChunks);
+        const int nEnd = static_cast<int>(static_cast<GIntBig>(nShapeCount) *
+                                          (iChunk + 1) / nChunks);
+        void *pTransformArg = poCtxt->apTransformArgs[iChunk];
+        poCtxt->poJobQueue->SubmitJob(
+            [&ComputeLines, pTransformArg, nStart, nEnd]()
+            { ComputeLines(pTransformArg, nStart, nEnd); });
+    }
+    poCtxt->poJobQueue->WaitCompletion();
+}
+
+/************************************************************************/
+/*                        GDALRasterizeSwathMT()                        */
+/************************************************************************/
+
+// Burns the shapes into a swath of nYSize lines starting at line nYOff of
+// the raster, stored in pabyChunkBuf as a band-sequential buffer, with the
+// help of poCtxt->anShapeLines computed on the same shapes.
+static void GDALRasterizeSwathMT(
+    GDALRasterizeMTContext *poCtxt, unsigned char *pabyChunkBuf, int nYOff,
+    int nXSize, int nYSize, int nBands, GDALDataType eType, int bAllTouched,
+    const OGRGeometry *const *papoShapes, int nShapeCount,
+    GDALDataType eBurnValueType, const double *padfBurnValues,
+    const int64_t *panBurnValues, GDALBurnValueSrc eBurnValueSrc,
+    GDALRasterMergeAlg eMergeAlg)
+{
+    const int nPixelSpace = GDALGetDataTypeSizeBytes(eType);
+    const GSpacing nLineSpace = static_cast<GSpacing>(nXSize) * nPixelSpace;
+    const GSpacing nBandSpace = nYSize * nLineSpace;
+
+    const auto RasterizeStrip =
+        [=](void *pTransformArg, int nStripYOff, int nStripYSize)
+    {
+        const int nFirstLine = nYOff + nStripYOff;
+        const int nLastLine = nFirstLine + nStripYSize - 1;
+        for (int iShape = 0; iShape < nShapeCount; ++iShape)
+        {
+            const auto &oLines = poCtxt->anShapeLines[iShape];
+            if (oLines.second < nFirstLine || oLines.first > nLastLine)
+                continue;
+            gv_rasterize_one_shape(
+                pabyChunkBuf + nStripYOff * nLineSpace, 0, nFirstLine, nXSize,
+                nStripYSize, nBands, eType, nPixelSpace, nLineSpace,
+                nBandSpace, bAllTouched, papoShapes[iShape], eBurnValueType,
+                padfBurnValues
+                    ? padfBurnValues + static_cast<size_t>(iShape) * nBands
+                    : nullptr,
+                panBurnValues
+                    ? panBurnValues + static_cast<size_t>(iShape) * nBands
+                    : nullptr,
+                eBurnValueSrc, eMergeAlg, poCtxt->pfnTransformer,
+                pTransformArg);
+        }
+    };
+
+    const int nStrips = std::max(1, std::min(poCtxt->GetThreadCount(), nYSize));
+    for (int iStrip = 0; iStrip < nStrips; ++iStrip)
+    {
+        const int nStart =
+            static_cast<int>(static_cast<GIntBig>(nYSize) * iStrip / nStrips);
+        const int nEnd = static_cast<int>(static_cast<GIntBig>(nYSize) *
+                                          (iStrip + 1) / nStrips);
+        void *pTransformArg = poCtxt->apTransformArgs[iStrip];
+        poCtxt->poJobQueue->SubmitJob(
+            [&RasterizeStrip, pTransformArg, nStart, nEnd]()
+            { RasterizeStrip(pTransformArg, nStart, nEnd - nStart); });
+    }
+    poCtxt->poJobQueue->WaitCompletion();
+}
+
 /************************************************************************/
 /*                      GDALRasterizeGeometries()                       */
 /************************************************************************/
@@ -925,6 +1175,11 @@ static CPLErr GDALRasterizeGeometriesInternal(
  * with tiled images to be efficient. The auto mode (the default) will chose
  * the algorithm based on input and output properties.
  * </li>
+ * <li>"NUM_THREADS": (GDAL >= 3.12) Number of worker threads, or ALL_CPUS,
+ * used in OPTIM=RASTER mode. Each chunk is then split into horizontal strips
+ * that are rasterized concurrently, with identical results. Only used with
+ * GDAL transformers, which can be cloned for each thread. Defaults to the
+ * value of the GDAL_NUM_THREADS configuration option, or 1.</li>
  * </ul>
  * @param pfnProgress the progress function to report completion.
  * @param pProgressArg callback data for progress function.
@@ -1200,6 +1455,16 @@ static CPLErr GDALRasterizeGeometriesInternal(
          */
         pfnProgress(0.0, nullptr, pProgressArg);
 
+        auto poMTContext = GDALRasterizeCreateMTContext(
+            papszOptions, pfnTransformer, pTransformArg);
+        const OGRGeometry *const *papoShapes =
+            reinterpret_cast<const OGRGeometry *const *>(pahGeometries);
+        if (poMTContext)
+        {
+            GDALRasterizeComputeShapeLines(poMTContext.get(), papoShapes,
+                                           nGeomCount, poDS->GetRasterYSize());
+        }
+
         for (int iY = 0; iY < poDS->GetRasterYSize() && eErr == CE_None;
              iY += nYChunkSize)
         {
@@ -1214,22 +1479,34 @@ static CPLErr GDALRasterizeGeometriesInternal(
             if (eErr != CE_None)
                 break;
 
-            for (int iShape = 0; iShape < nGeomCount; iShape++)
+            if (poMTContext)
             {
-                gv_rasterize_one_shape(
-                    pabyChunkBuf, 0, iY, poDS->GetRasterXSize(),
-                    nThisYChunkSize, nBandCount, eType, 0, 0, 0, bAllTouched,
-                    OGRGeometry::FromHandle(pahGeometries[iShape]),
-                    eBurnValueType,
-                    padfGeomBurnValues
-                        ? padfGeomBurnValues +
-                              static_cast<size_t>(iShape) * nBandCount
-                        : nullptr,
-                    panGeomBurnValues
-                        ? panGeomBurnValues +
-                              static_cast<size_t>(iShape) * nBandCount
-                        : nullptr,
-                    eBurnValueSource, eMergeAlg, pfnTransformer, pTransformArg);
+                GDALRasterizeSwathMT(
+                    poMTContext.get(), pabyChunkBuf, iY,
+                    poDS->GetRasterXSize(), nThisYChunkSize, nBandCount, eType,
+                    bAllTouched, papoShapes, nGeomCount, eBurnValueType,
+                    padfGeomBurnValues, panGeomBurnValues, eBurnValueSource,
+                    eMergeAlg);
+            }
+            else
+            {
+                for (int iShape = 0; iShape < nGeomCount; iShape++)
+                {
+                    gv_rasterize_one_shape(
+                        pabyChunkBuf, 0, iY, poDS->GetRasterXSize(),
+                        nThisYChunkSize, nBandCount, eType, 0, 0, 0,
+                        bAllTouched, papoShapes[iShape], eBurnValueType,
+                        padfGeomBurnValues
+                            ? padfGeomBurnValues +
+                                  static_cast<size_t>(iShape) * nBandCount
+                            : nullptr,
+                        panGeomBurnValues
+                            ? panGeomBurnValues +
+                                  static_cast<size_t>(iShape) * nBandCount
+                            : nullptr,
+                        eBurnValueSource, eMergeAlg, pfnTransformer,
+                        pTransformArg);
+                }
             }
 
             eErr = poDS->RasterIO(
@@ -1516,6 +1793,12 @@ static CPLErr GDALRasterizeGeometriesInternal(
  * <li>"MERGE_ALG": May be REPLACE (the default) or ADD.  REPLACE results in
  * overwriting of value, while ADD adds the new value to the existing raster,
  * suitable for heatmaps for instance.</li>
+ * <li>"NUM_THREADS": (GDAL >= 3.12) Number of worker threads, or ALL_CPUS.
+ * Each chunk is then split into horizontal strips that are rasterized
+ * concurrently, with identical results, features being read by batches.
+ * Only used with GDAL transformers, which can be cloned for each thread.
+ * Defaults to the value of the GDAL_NUM_THREADS configuration option, or 1.
+ * </li>
  * </ul>
  * @param pfnProgress the progress function to report completion.
  * @param pProgressArg callback data for progress function.
@@ -1733,6 +2016,9 @@ CPLErr GDALRasterizeLayers(GDALDatasetH hDS, int nBandCount, int *panBandList,
         if (padfAttrValues == nullptr)
             eErr = CE_Failure;
 
+        auto poMTContext = GDALRasterizeCreateMTContext(
+            papszOptions, pfnTransformer, pTransformArg);
+
         for (int iY = 0; iY < poDS->GetRasterYSize() && eErr == CE_None;
              iY += nYChunkSize)
         {
@@ -1751,25 +2037,80 @@ CPLErr GDALRasterizeLayers(GDALDatasetH hDS, int nBandCount, int *panBandList,
                     break;
             }
 
-            for (auto &poFeat : poLayer)
+            if (poMTContext)
             {
-                OGRGeometry *poGeom = poFeat->GetGeometryRef();
-
-                if (pszBurnAttribute)
+                // Unlike the range-based loop below, reading features
+                // explicitly does not rewind the layer for each chunk.
+                poLayer->ResetReading();
+
+                // Features are rasterized by batches, so that memory use
+                // does not depend on the number of features.
+                constexpr size_t BATCH_SIZE = 10000;
+                std::vector<OGRFeatureUniquePtr> apoFeatures;
+                std::vector<const OGRGeometry *> apoShapes;
+                std::vector<double> adfBurnValues;
+                bool bEOF = false;
+                while (!bEOF)
                 {
-                    const double dfAttrValue =
-                        poFeat->GetFieldAsDouble(iBurnField);
-                    for (int iBand = 0; iBand < nBandCount; iBand++)
-                        padfAttrValues[iBand] = dfAttrValue;
+                    apoFeatures.clear();
+                    apoShapes.clear();
+                    adfBurnValues.clear();
+                    while (apoFeatures.size() < BATCH_SIZE)
+                    {
+                        OGRFeatureUniquePtr poFeat(poLayer->GetNextFeature());
+                        if (!poFeat)
+                        {
+                            bEOF = true;
+                            break;
+                        }
+                        apoShapes.push_back(poFeat->GetGeometryRef());
+                        for (int iBand = 0; iBand < nBandCount; iBand++)
+                        {
+                            adfBurnValues.push_back(
+                                pszBurnAttribute
+                                    ? poFeat->GetFieldAsDouble(iBurnField)
+                                    : padfBurnValues[iBand]);
+                        }
+                        apoFeatures.push_back(std::move(poFeat));
+                    }
+                    if (apoShapes.empty())
+                        break;
 
-                    padfBurnValues = padfAttrValues;
+                    const int nShapeCount = static_cast<int>(apoShapes.size());
+                    GDALRasterizeComputeShapeLines(
+                        poMTContext.get(), apoShapes.data(), nShapeCount,
+                        poDS->GetRasterYSize());
+                    GDALRasterizeSwathMT(
+                        poMTContext.get(), pabyChunkBuf, iY,
+                        poDS->GetRasterXSize(), nThisYChunkSize, nBandCount,
+                        eType, bAllTouched, apoShapes.data(), nShapeCount,
+                        GDT_Float64, adfBurnValues.data(), nullptr,
+                        eBurnValueSource, eMergeAlg);
                 }
+            }
+            else
+            {
+                for (auto &poFeat : poLayer)
+                {
+                    OGRGeometry *poGeom = poFeat->GetGeometryRef();
+
+                    if (pszBurnAttribute)
+                    {
+                        const double dfAttrValue =
+                            poFeat->GetFieldAsDouble(iBurnField);
+                        for (int iBand = 0; iBand < nBandCount; iBand++)
+                            padfAttrValues[iBand] = dfAttrValue;
+
+                        padfBurnValues = padfAttrValues;
+                    }
 
-                gv_rasterize_one_shape(
-                    pabyChunkBuf, 0, iY, poDS->GetRasterXSize(),
-                    nThisYChunkSize, nBandCount, eType, 0, 0, 0, bAllTouched,
-                    poGeom, GDT_Float64, padfBurnValues, nullptr,
-                    eBurnValueSource, eMergeAlg, pfnTransformer, pTransformArg);
+                    gv_rasterize_one_shape(
+                        pabyChunkBuf, 0, iY, poDS->GetRasterXSize(),
+                        nThisYChunkSize, nBandCount, eType, 0, 0, 0,
+                        bAllTouched, poGeom, GDT_Float64, padfBurnValues,
+                        nullptr, eBurnValueSource, eMergeAlg, pfnTransformer,
+                        pTransformArg);
+                }
             }
 
             // Only write image if not a single chunk is being rendered.
@@ -1793,6 +2134,7 @@ CPLErr GDALRasterizeLayers(GDALDatasetH hDS, int nBandCount, int *panBandList,
         }
 
         VSIFree(padfAttrValues);
+        poMTContext.reset();
 
         if (bNeedToFreeTransformer)
         {
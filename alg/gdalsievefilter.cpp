@@ -17,36 +17,58 @@
 #include <cstring>
 
 #include <algorithm>
-#include <set>
+#include <functional>
+#include <map>
+#include <memory>
+#include <new>
 #include <vector>
 #include <utility>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_progress.h"
+#include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_alg_priv.h"
+#include "gdal_thread_pool.h"
 
 #define MY_MAX_INT 2147483647
 
+
 /*
  * General Plan
  *
- * 1) make a pass with the polygon enumerator to build up the
- *    polygon map array.  Also accumulate polygon size information.
+ * The raster is processed by tiles, so that memory use does not depend on
+ * the number of polygons. Polygons that touch a side shared with another
+ * tile are "boundary" polygons. Their pieces in the different tiles are
+ * joined with a union-find, and they are the only polygons kept in memory
+ * from one tile to the next.
+ *
+ * 1) make a pass over the tiles with the polygon enumerator, collecting
+ *    the size and value of the boundary polygons, and the boundary polygon
+ *    of the pixels along the sides of each tile.
+ *
+ * 2) Merge the boundary polygons across tile sides, and accumulate their
+ *    sizes.
  *
- * 2) Identify the polygons that need to be merged.
+ * 3) Make a second pass over the tiles. For each polygon keep track of its
+ *    largest neighbour, and follow the largest neighbours of the polygons
+ *    smaller than the sieve size until a polygon large enough is found.
+ *    This can only be done within the tile for the other polygons, so the
+ *    largest neighbours of the boundary polygons, or what they resolve to,
+ *    are collected.
  *
- * 3) Make a pass with the polygon enumerator.  For each "to be merged"
- *    polygon keep track of its largest neighbour.
+ * 4) Do the same for the boundary polygons smaller than the sieve size.
  *
- * 4) Fix up remappings that would go to polygons smaller than the seive
- *    size.  Ensure these in term map to the largest neighbour of the
- *    "to be sieved" polygons.
+ * 5) Make a third pass over the tiles, redoing the second one, but this
+ *    time remapping the actual pixel values of all polygons to be merged.
  *
- * 5) Make another pass with the polygon enumerator. This time we remap
- *    the actual pixel values of all polygons to be merged.
+ * The largest neighbour of a polygon is the first neighbour of largest size
+ * met when scanning the raster line by line. This does not depend on the
+ * order in which tiles are processed, so they can be processed by several
+ * threads.
  */
 
 /************************************************************************/
@@ -56,75 +78,713 @@
 /*      band is zero.                                                   */
 /************************************************************************/
 
-static CPLErr GPMaskImageData(GDALRasterBandH hMaskBand, GByte *pabyMaskLine,
-                              int iY, int nXSize, std::int64_t *panImageLine)
+static CPLErr GPMaskImageData(GDALRasterBandH hMaskBand, GByte *pabyMask,
+                              int nXOff, int nYOff, int nXSize, int nYSize,
+                              std::int64_t *panImage)
 
 {
-    const CPLErr eErr = GDALRasterIO(hMaskBand, GF_Read, 0, iY, nXSize, 1,
-                                     pabyMaskLine, nXSize, 1, GDT_Byte, 0, 0);
+    const CPLErr eErr =
+        GDALRasterIO(hMaskBand, GF_Read, nXOff, nYOff, nXSize, nYSize,
+                     pabyMask, nXSize, nYSize, GDT_Byte, 0, 0);
     if (eErr == CE_None)
     {
-        for (int i = 0; i < nXSize; i++)
+        const size_t nPixels = static_cast<size_t>(nXSize) * nYSize;
+        for (size_t i = 0; i < nPixels; i++)
         {
-            if (pabyMaskLine[i] == 0)
-                panImageLine[i] = GP_NODATA_MARKER;
+            if (pabyMask[i] == 0)
+                panImage[i] = GP_NODATA_MARKER;
         }
     }
 
     return eErr;
 }
 
-// TODO: What is "eaches" supposed to be?
+namespace
+{
+
+/************************************************************************/
+/*                           GDALSievePolyRef                           */
+/************************************************************************/
+
+// A polygon seen from a tile: either one of the polygons that only lie in
+// the tile, or a boundary polygon, identified by the root of its pieces.
+struct GDALSievePolyRef
+{
+    int nId = -1;
+    bool bBoundary = false;
+
+    bool operator==(const GDALSievePolyRef &other) const
+    {
+        return nId == other.nId && bBoundary == other.bBoundary;
+    }
+};
+
+/************************************************************************/
+/*                            GDALSieveTarget                           */
+/************************************************************************/
+
+// What the pixels of a polygon smaller than the sieve size become.
+struct GDALSieveTarget
+{
+    enum Kind : GByte
+    {
+        // No neighbour large enough was found.
+        UNCHANGED,
+        // Merged into a polygon of value nValue.
+        MERGED,
+        // Same as the boundary polygon of root nValue.
+        BOUNDARY,
+    };
+
+    Kind eKind = UNCHANGED;
+    std::int64_t nValue = 0;
+};
+
+/************************************************************************/
+/*                          GDALSieveNeighbour                          */
+/************************************************************************/
+
+// Largest neighbour of a polygon found so far. Among neighbours of the same
+// size, the first one met in the order of a line by line scan of the raster,
+// identified by the position of the pair of pixels, is retained.
+template <class T> struct GDALSieveNeighbour
+{
+    int nSize = -1;
+    GIntBig nPairKey = 0;
+    T oNeighbour{};
+
+    bool IsBetter(int nOtherSize, GIntBig nOtherPairKey) const
+    {
+        return nOtherSize > nSize ||
+               (nOtherSize == nSize && nOtherPairKey < nPairKey);
+    }
+
+    void Update(int nOtherSize, GIntBig nOtherPairKey, const T &oOther)
+    {
+        if (IsBetter(nOtherSize, nOtherPairKey))
+        {
+            nSize = nOtherSize;
+            nPairKey = nOtherPairKey;
+            oNeighbour = oOther;
+        }
+    }
+};
+
+/************************************************************************/
+/*                           GDALSieveContext                           */
+/************************************************************************/
+
+// State shared by all the tiles.
+struct GDALSieveContext
+{
+    int nXSize = 0;
+    int nYSize = 0;
+    int nTileSize = 0;
+    int nTilesX = 0;
+    int nTilesY = 0;
+    int nConnectedness = 4;
+    int nSizeThreshold = 0;
+
+    // Boundary polygons, indexed by the global id of their pieces. After
+    // the merge, anBoundaryRoot[] is the root of each piece, and the size
+    // is the one of the whole polygon for the roots.
+    std::vector<GInt32> anBoundaryRoot{};
+    std::vector<int> anBoundarySize{};
+    std::vector<std::int64_t> anBoundaryValue{};
+    std::vector<GDALSieveNeighbour<GDALSieveTarget>> aoBoundaryNeighbour{};
+    std::vector<GDALSieveTarget> aoBoundaryTarget{};
+
+    // Global id of the first boundary polygon of each tile.
+    std::vector<int> anTileBoundaryOffset{};
+
+    // Boundary polygon of the pixels along the sides shared between tiles,
+    // or -1 for nodata pixels: first and last lines of each row of tiles,
+    // first and last columns of each tile.
+    std::vector<std::vector<GInt32>> aanTopLine{};
+    std::vector<std::vector<GInt32>> aanBottomLine{};
+    std::vector<std::vector<GInt32>> aanLeftColumn{};
+    std::vector<std::vector<GInt32>> aanRightColumn{};
+
+    int FindRoot(int nId)
+    {
+        int nRoot = nId;
+        while (anBoundaryRoot[nRoot] != nRoot)
+            nRoot = anBoundaryRoot[nRoot];
+        while (anBoundaryRoot[nId] != nRoot)
+        {
+            const int nNext = anBoundaryRoot[nId];
+            anBoundaryRoot[nId] = nRoot;
+            nId = nNext;
+        }
+        return nRoot;
+    }
+
+    void MergeBoundary(int nId1, int nId2)
+    {
+        if (nId1 < 0 || nId2 < 0 ||
+            anBoundaryValue[nId1] != anBoundaryValue[nId2])
+            return;
+        const int nRoot1 = FindRoot(nId1);
+        const int nRoot2 = FindRoot(nId2);
+        if (nRoot1 == nRoot2)
+            return;
+        anBoundaryRoot[nRoot2] = nRoot1;
+        anBoundarySize[nRoot1] = static_cast<int>(
+            std::min<GIntBig>(MY_MAX_INT, static_cast<GIntBig>(
+                                              anBoundarySize[nRoot1]) +
+                                              anBoundarySize[nRoot2]));
+    }
+
+    // Target of the pixels of a polygon merged into boundary polygon nRoot.
+    GDALSieveTarget GetBoundaryTarget(int nRoot) const
+    {
+        GDALSieveTarget oTarget;
+        oTarget.nValue = anBoundaryValue[nRoot];
+        if (anBoundarySize[nRoot] >= nSizeThreshold)
+        {
+            oTarget.eKind = GDALSieveTarget::MERGED;
+        }
+        else
+        {
+            oTarget.eKind = GDALSieveTarget::BOUNDARY;
+            oTarget.nValue = nRoot;
+        }
+        return oTarget;
+    }
+};
+
+/************************************************************************/
+/*                            GDALSieveTile                             */
+/************************************************************************/
+
+// Buffers and polygons of one tile.
+struct GDALSieveTile
+{
+    int iTile = 0;
+    int iTileX = 0;
+    int iTileY = 0;
+    int nXOff = 0;
+    int nYOff = 0;
+    int nXSize = 0;
+    int nYSize = 0;
+
+    // Source values, and the same with GP_NODATA_MARKER for masked pixels.
+    std::vector<std::int64_t> anValues{};
+    std::vector<std::int64_t> anMaskedValues{};
+    std::vector<GByte> abyMask{};
+
+    // Polygon of each pixel, or -1 for nodata pixels.
+    std::vector<GInt32> anIds{};
+    std::vector<std::int64_t> anPolyValue{};
+    std::vector<int> anPolySize{};
+    // Index among the boundary polygons of the tile, or -1.
+    std::vector<GInt32> anPolyBoundary{};
+    int nBoundaryPolys = 0;
+
+    std::vector<GDALSieveNeighbour<GDALSievePolyRef>> aoNeighbour{};
+    std::map<int, GDALSieveNeighbour<GDALSievePolyRef>> oBoundaryNeighbour{};
+    std::vector<GDALSieveTarget> aoTarget{};
+    std::vector<GByte> abyState{};
+    std::vector<int> anPath{};
+
+    // Largest neighbours of boundary polygons, as targets.
+    std::vector<std::pair<int, GDALSieveNeighbour<GDALSieveTarget>>>
+        aoBoundaryCandidates{};
+
+    bool bChanged = false;
+    int nSieveTargets = 0;
+    int nIsolatedSmall = 0;
+    int nFailedMerges = 0;
+
+    bool Label(const GDALSieveContext &sCtxt);
+    void FindNeighbours(const GDALSieveContext &sCtxt);
+    void ResolveTargets(const GDALSieveContext &sCtxt);
+    void CollectBoundaryCandidates(const GDALSieveContext &sCtxt);
+    void ApplyTargets(const GDALSieveContext &sCtxt);
+
+    GDALSievePolyRef GetRef(const GDALSieveContext &sCtxt, int nPoly) const
+    {
+        GDALSievePolyRef sRef;
+        if (anPolyBoundary[nPoly] >= 0)
+        {
+            sRef.nId =
+                sCtxt.anBoundaryRoot[sCtxt.anTileBoundaryOffset[iTile] +
+                                     anPolyBoundary[nPoly]];
+            sRef.bBoundary = true;
+        }
+        else
+        {
+            sRef.nId = nPoly;
+        }
+        return sRef;
+    }
+
+    int GetSize(const GDALSieveContext &sCtxt,
+                const GDALSievePolyRef &sRef) const
+    {
+        return sRef.bBoundary ? sCtxt.anBoundarySize[sRef.nId]
+                              : anPolySize[sRef.nId];
+    }
+
+    GDALSieveTarget GetTarget(const GDALSieveContext &sCtxt,
+                              const GDALSievePolyRef &sRef) const
+    {
+        if (sRef.bBoundary)
+            return sCtxt.GetBoundaryTarget(sRef.nId);
+        if (anPolySize[sRef.nId] >= sCtxt.nSizeThreshold)
+        {
+            GDALSieveTarget oTarget;
+            oTarget.eKind = GDALSieveTarget::MERGED;
+            oTarget.nValue = anPolyValue[sRef.nId];
+            return oTarget;
+        }
+        return aoTarget[sRef.nId];
+    }
+};
+
+/************************************************************************/
+/*                         GDALSieveTile::Label()                       */
+/*                                                                      */
+/*      Enumerate the polygons of the tile, compute their size, and     */
+/*      find which of them are boundary polygons.                       */
+/************************************************************************/
+
+bool GDALSieveTile::Label(const GDALSieveContext &sCtxt)
+{
+    const std::int64_t *panValues =
+        anMaskedValues.empty() ? anValues.data() : anMaskedValues.data();
+
+    GDALRasterPolygonEnumerator oEnum(sCtxt.nConnectedness);
+    anIds.resize(static_cast<size_t>(nXSize) * nYSize);
+    for (int iY = 0; iY < nYSize; iY++)
+    {
+        const size_t nOffset = static_cast<size_t>(iY) * nXSize;
+        // ProcessLine() does not modify the values.
+        std::int64_t *panThisLineVal =
+            const_cast<std::int64_t *>(panValues + nOffset);
+        const bool bOK =
+            iY == 0 ? oEnum.ProcessLine(nullptr, panThisLineVal, nullptr,
+                                        anIds.data() + nOffset, nXSize)
+                    : oEnum.ProcessLine(panThisLineVal - nXSize,
+                                        panThisLineVal,
+                                        anIds.data() + nOffset - nXSize,
+                                        anIds.data() + nOffset, nXSize);
+        if (!bOK)
+            return false;
+    }
+
+    // Number the final polygons consecutively.
+    std::vector<GInt32> anFinalId(oEnum.nNextPolygonId, -1);
+    anPolyValue.clear();
+    for (int iPoly = 0; iPoly < oEnum.nNextPolygonId; iPoly++)
+    {
+        int nRoot = iPoly;
+        while (oEnum.panPolyIdMap[nRoot] != nRoot)
+            nRoot = oEnum.panPolyIdMap[nRoot];
+        if (anFinalId[nRoot] < 0)
+        {
+            anFinalId[nRoot] = static_cast<GInt32>(anPolyValue.size());
+            anPolyValue.push_back(oEnum.panPolyValue[nRoot]);
+        }
+        anFinalId[iPoly] = anFinalId[nRoot];
+    }
+
+    const int nPolys = static_cast<int>(anPolyValue.size());
+    anPolySize.assign(nPolys, 0);
+    anPolyBoundary.assign(nPolys, -1);
+    for (auto &nId : anIds)
+    {
+        if (nId >= 0)
+        {
+            nId = anFinalId[nId];
+            anPolySize[nId]++;
+        }
+    }
+
+    // Polygons touching a side shared with another tile.
+    const auto MarkBoundary = [this](int iX, int iY)
+    {
+        const GInt32 nId = anIds[static_cast<size_t>(iY) * nXSize + iX];
+        if (nId >= 0)
+            anPolyBoundary[nId] = 0;
+    };
+    for (int iX = 0; iX < nXSize; iX++)
+    {
+        if (iTileY > 0)
+            MarkBoundary(iX, 0);
+        if (iTileY < sCtxt.nTilesY - 1)
+            MarkBoundary(iX, nYSize - 1);
+    }
+    for (int iY = 0; iY < nYSize; iY++)
+    {
+        if (iTileX > 0)
+            MarkBoundary(0, iY);
+        if (iTileX < sCtxt.nTilesX - 1)
+            MarkBoundary(nXSize - 1, iY);
+    }
+    nBoundaryPolys = 0;
+    for (auto &nBoundary : anPolyBoundary)
+    {
+        if (nBoundary == 0)
+            nBoundary = nBoundaryPolys++;
+    }
+
+    return true;
+}
 
 /************************************************************************/
-/*                          CompareNeighbour()                          */
+/*                    GDALSieveTile::FindNeighbours()                   */
 /*                                                                      */
-/*      Compare two neighbouring polygons, and update eaches            */
-/*      "biggest neighbour" if the other is larger than its current     */
-/*      largest neighbour.                                              */
+/*      Compare each pixel of the tile with the pixels above and to     */
+/*      its left, like the original line by line scan, and update the  */
+/*      largest neighbour of both polygons.                             */
+/************************************************************************/
+
+void GDALSieveTile::FindNeighbours(const GDALSieveContext &sCtxt)
+{
+    aoNeighbour.assign(anPolyValue.size(), {});
+    oBoundaryNeighbour.clear();
+
+    // Polygon of a pixel of the tile or just around it, the pixels around
+    // it being on the sides of the neighbouring tiles.
+    const auto GetPoly = [this, &sCtxt](int iX, int iY, GDALSievePolyRef &sRef)
+    {
+        if (iX >= 0 && iX < nXSize && iY >= 0)
+        {
+            const GInt32 nId = anIds[static_cast<size_t>(iY) * nXSize + iX];
+            if (nId < 0)
+                return false;
+            sRef = GetRef(sCtxt, nId);
+            return true;
+        }
+        const int iRasterX = nXOff + iX;
+        if (iRasterX < 0 || iRasterX >= sCtxt.nXSize || nYOff + iY < 0)
+            return false;
+        GInt32 nRoot;
+        if (iY < 0)
+            nRoot = sCtxt.aanBottomLine[iTileY - 1][iRasterX];
+        else if (iX < 0)
+            nRoot = sCtxt.aanRightColumn[iTile - 1][iY];
+        else
+            nRoot = sCtxt.aanLeftColumn[iTile + 1][iY];
+        if (nRoot < 0)
+            return false;
+        sRef.nId = nRoot;
+        sRef.bBoundary = true;
+        return true;
+    };
+
+    const auto Update = [this, &sCtxt](const GDALSievePolyRef &sRef,
+                                       const GDALSievePolyRef &sOther,
+                                       GIntBig nPairKey)
+    {
+        const int nOtherSize = GetSize(sCtxt, sOther);
+        if (sRef.bBoundary)
+            oBoundaryNeighbour[sRef.nId].Update(nOtherSize, nPairKey, sOther);
+        else
+            aoNeighbour[sRef.nId].Update(nOtherSize, nPairKey, sOther);
+    };
+
+    const int anDX[] = {0, -1, 1, -1};
+    const int anDY[] = {-1, -1, -1, 0};
+    for (int iY = 0; iY < nYSize; iY++)
+    {
+        for (int iX = 0; iX < nXSize; iX++)
+        {
+            const GInt32 nId = anIds[static_cast<size_t>(iY) * nXSize + iX];
+            if (nId < 0)
+                continue;
+            const GDALSievePolyRef sRef = GetRef(sCtxt, nId);
+            const GIntBig nPixelKey =
+                (static_cast<GIntBig>(nYOff + iY) * sCtxt.nXSize + nXOff +
+                 iX) *
+                4;
+
+            // Above, above left, above right and left pixels, in the order
+            // of the original scan.
+            for (int k = 0; k < 4; k++)
+            {
+                if (sCtxt.nConnectedness == 4 && (k == 1 || k == 2))
+                    continue;
+                GDALSievePolyRef sOther;
+                if (!GetPoly(iX + anDX[k], iY + anDY[k], sOther) ||
+                    sOther == sRef)
+                    continue;
+                Update(sRef, sOther, nPixelKey + k);
+                Update(sOther, sRef, nPixelKey + k);
+            }
+        }
+    }
+}
+
+/************************************************************************/
+/*                    GDALSieveTile::ResolveTargets()                   */
 /*                                                                      */
-/*      Note that this should end up with each polygon knowing the      */
-/*      id of its largest neighbour.  No attempt is made to             */
-/*      restrict things to small polygons that we will be merging,      */
-/*      nor to exclude assigning "biggest neighbours" that are still    */
-/*      smaller than our sieve threshold.                               */
+/*      Walk through the largest neighbours of the polygons of the      */
+/*      tile smaller than the threshold, until a polygon large enough,  */
+/*      or a boundary polygon, is found.                                */
 /************************************************************************/
 
-static inline void CompareNeighbour(int nPolyId1, int nPolyId2,
-                                    int *panPolyIdMap,
-                                    std::int64_t * /* panPolyValue */,
-                                    const std::vector<int> &anPolySizes,
-                                    std::vector<int> &anBigNeighbour)
+void GDALSieveTile::ResolveTargets(const GDALSieveContext &sCtxt)
+{
+    enum
+    {
+        NOT_VISITED = 0,
+        VISITING = 1,
+        RESOLVED = 2
+    };
+
+    const int nPolys = static_cast<int>(anPolyValue.size());
+    aoTarget.assign(nPolys, {});
+    abyState.assign(nPolys, NOT_VISITED);
+
+    for (int iPoly = 0; iPoly < nPolys; iPoly++)
+    {
+        if (anPolyBoundary[iPoly] >= 0 ||
+            anPolySize[iPoly] >= sCtxt.nSizeThreshold ||
+            abyState[iPoly] == RESOLVED)
+            continue;
+
+        GDALSieveTarget oTarget;
+        int nCur = iPoly;
+        anPath.clear();
+        while (true)
+        {
+            if (abyState[nCur] == RESOLVED)
+            {
+                oTarget = aoTarget[nCur];
+                break;
+            }
+            // Check that we don't cycle on an already visited polygon.
+            if (abyState[nCur] == VISITING)
+                break;
+            abyState[nCur] = VISITING;
+            anPath.push_back(nCur);
 
+            const auto &oNeighbour = aoNeighbour[nCur];
+            if (oNeighbour.nSize < 0)
+                break;
+            if (oNeighbour.oNeighbour.bBoundary ||
+                oNeighbour.nSize >= sCtxt.nSizeThreshold)
+            {
+                oTarget = GetTarget(sCtxt, oNeighbour.oNeighbour);
+                break;
+            }
+            nCur = oNeighbour.oNeighbour.nId;
+        }
+
+        // Map the whole intermediate chain to it.
+        for (const int nPoly : anPath)
+        {
+            aoTarget[nPoly] = oTarget;
+            abyState[nPoly] = RESOLVED;
+        }
+    }
+}
+
+/************************************************************************/
+/*              GDALSieveTile::CollectBoundaryCandidates()              */
+/************************************************************************/
+
+void GDALSieveTile::CollectBoundaryCandidates(const GDALSieveContext &sCtxt)
+{
+    aoBoundaryCandidates.clear();
+    for (const auto &[nRoot, oNeighbour] : oBoundaryNeighbour)
+    {
+        GDALSieveNeighbour<GDALSieveTarget> oCandidate;
+        oCandidate.nSize = oNeighbour.nSize;
+        oCandidate.nPairKey = oNeighbour.nPairKey;
+        oCandidate.oNeighbour = GetTarget(sCtxt, oNeighbour.oNeighbour);
+        aoBoundaryCandidates.emplace_back(nRoot, oCandidate);
+    }
+}
+
+/************************************************************************/
+/*                     GDALSieveTile::ApplyTargets()                    */
+/************************************************************************/
+
+void GDALSieveTile::ApplyTargets(const GDALSieveContext &sCtxt)
 {
-    // Nodata polygon do not need neighbours, and cannot be neighbours
-    // to valid polygons.
-    if (nPolyId1 < 0 || nPolyId2 < 0)
-        return;
-
-    // Make sure we are working with the final merged polygon ids.
-    nPolyId1 = panPolyIdMap[nPolyId1];
-    nPolyId2 = panPolyIdMap[nPolyId2];
-
-    if (nPolyId1 == nPolyId2)
-        return;
-
-    // Nodata polygon do not need neighbours, and cannot be neighbours
-    // to valid polygons.
-    // Should no longer happen with r28826 optimization.
-    // if( panPolyValue[nPolyId1] == GP_NODATA_MARKER
-    //    || panPolyValue[nPolyId2] == GP_NODATA_MARKER )
-    //    return;
-
-    if (anBigNeighbour[nPolyId1] == -1 ||
-        anPolySizes[anBigNeighbour[nPolyId1]] < anPolySizes[nPolyId2])
-        anBigNeighbour[nPolyId1] = nPolyId2;
-
-    if (anBigNeighbour[nPolyId2] == -1 ||
-        anPolySizes[anBigNeighbour[nPolyId2]] < anPolySizes[nPolyId1])
-        anBigNeighbour[nPolyId2] = nPolyId1;
+    // Final target of each polygon of the tile.
+    const int nPolys = static_cast<int>(anPolyValue.size());
+    nSieveTargets = 0;
+    nIsolatedSmall = 0;
+    nFailedMerges = 0;
+    for (int iPoly = 0; iPoly < nPolys; iPoly++)
+    {
+        auto &oTarget = aoTarget[iPoly];
+        if (anPolyBoundary[iPoly] >= 0)
+        {
+            const int nRoot = GetRef(sCtxt, iPoly).nId;
+            oTarget = sCtxt.aoBoundaryTarget[nRoot];
+            continue;
+        }
+        if (anPolySize[iPoly] >= sCtxt.nSizeThreshold)
+            continue;
+        if (oTarget.eKind == GDALSieveTarget::BOUNDARY)
+            oTarget = sCtxt.aoBoundaryTarget[oTarget.nValue];
+
+        nSieveTargets++;
+        if (aoNeighbour[iPoly].nSize < 0)
+            nIsolatedSmall++;
+        else if (oTarget.eKind != GDALSieveTarget::MERGED)
+            nFailedMerges++;
+    }
+
+    bChanged = false;
+    const size_t nPixels = anIds.size();
+    for (size_t i = 0; i < nPixels; i++)
+    {
+        const GInt32 nId = anIds[i];
+        if (nId >= 0 && aoTarget[nId].eKind == GDALSieveTarget::MERGED)
+        {
+            anValues[i] = aoTarget[nId].nValue;
+            bChanged = true;
+        }
+    }
 }
 
+/************************************************************************/
+/*                          GDALSieveTileSize()                         */
+/************************************************************************/
+
+// Size of the square tiles. When possible, this is a multiple of the block
+// size of the source band.
+static int GDALSieveTileSize(GDALRasterBandH hSrcBand)
+{
+    const char *pszTileSize =
+        CPLGetConfigOption("GDAL_SIEVE_TILE_SIZE", nullptr);
+    if (pszTileSize)
+        return std::max(1, atoi(pszTileSize));
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    GDALGetBlockSize(hSrcBand, &nBlockXSize, &nBlockYSize);
+    constexpr int TILE_SIZE = 1024;
+    const int nBlockSize = std::max(nBlockXSize, nBlockYSize);
+    if (nBlockXSize == nBlockYSize && nBlockSize > 1 && nBlockSize < TILE_SIZE)
+        return TILE_SIZE / nBlockSize * nBlockSize;
+    return TILE_SIZE;
+}
+
+/************************************************************************/
+/*                         GDALSieveProcessTiles()                      */
+/*                                                                      */
+/*      Read the tiles by batches on the calling thread, run            */
+/*      pfnProcess() on the tiles of each batch with the worker         */
+/*      threads, and then pfnFinish() on each tile of the batch, in     */
+/*      order, on the calling thread.                                   */
+/************************************************************************/
+
+static CPLErr GDALSieveProcessTiles(
+    const GDALSieveContext &sCtxt, GDALRasterBandH hSrcBand,
+    GDALRasterBandH hMaskBand, std::vector<GDALSieveTile> &aoTiles,
+    CPLJobQueue *poJobQueue,
+    const std::function<bool(GDALSieveTile &)> &pfnProcess,
+    const std::function<CPLErr(GDALSieveTile &)> &pfnFinish,
+    double dfProgressStart, double dfProgressEnd, GDALProgressFunc pfnProgress,
+    void *pProgressArg)
+{
+    const int nTiles = sCtxt.nTilesX * sCtxt.nTilesY;
+    const int nBatchSize = static_cast<int>(aoTiles.size());
+    CPLErr eErr = CE_None;
+    for (int iFirstTile = 0; eErr == CE_None && iFirstTile < nTiles;
+         iFirstTile += nBatchSize)
+    {
+        const int nBatchTiles = std::min(nBatchSize, nTiles - iFirstTile);
+        for (int i = 0; eErr == CE_None && i < nBatchTiles; i++)
+        {
+            auto &oTile = aoTiles[i];
+            oTile.iTile = iFirstTile + i;
+            oTile.iTileX = oTile.iTile % sCtxt.nTilesX;
+            oTile.iTileY = oTile.iTile / sCtxt.nTilesX;
+            oTile.nXOff = oTile.iTileX * sCtxt.nTileSize;
+            oTile.nYOff = oTile.iTileY * sCtxt.nTileSize;
+            oTile.nXSize =
+                std::min(sCtxt.nTileSize, sCtxt.nXSize - oTile.nXOff);
+            oTile.nYSize =
+                std::min(sCtxt.nTileSize, sCtxt.nYSize - oTile.nYOff);
+            const size_t nPixels =
+                static_cast<size_t>(oTile.nXSize) * oTile.nYSize;
+            try
+            {
+                oTile.anValues.resize(nPixels);
+                if (hMaskBand)
+                {
+                    oTile.abyMask.resize(nPixels);
+                    oTile.anMaskedValues.resize(nPixels);
+                }
+            }
+            catch (const std::bad_alloc &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Cannot allocate tile buffers");
+                eErr = CE_Failure;
+                break;
+            }
+
+            eErr = GDALRasterIO(hSrcBand, GF_Read, oTile.nXOff, oTile.nYOff,
+                                oTile.nXSize, oTile.nYSize,
+                                oTile.anValues.data(), oTile.nXSize,
+                                oTile.nYSize, GDT_Int64, 0, 0);
+            if (eErr == CE_None && hMaskBand)
+            {
+                oTile.anMaskedValues = oTile.anValues;
+                eErr = GPMaskImageData(hMaskBand, oTile.abyMask.data(),
+                                       oTile.nXOff, oTile.nYOff, oTile.nXSize,
+                                       oTile.nYSize,
+                                       oTile.anMaskedValues.data());
+            }
+        }
+        if (eErr != CE_None)
+            break;
+
+        std::vector<int> abOK(nBatchTiles, FALSE);
+        // One job per tile
+        GDALRunParallel(
+            poJobQueue, nBatchTiles, nBatchTiles,
+            [&aoTiles, &abOK, &pfnProcess](int, int iStart, int iEnd)
+            {
+                for (int i = iStart; i < iEnd; i++)
+                {
+                    try
+                    {
+                        abOK[i] = pfnProcess(aoTiles[i]);
+                    }
+                    catch (const std::bad_alloc &)
+                    {
+                        abOK[i] = FALSE;
+                    }
+                }
+            });
+
+        for (int i = 0; eErr == CE_None && i < nBatchTiles; i++)
+        {
+            if (!abOK[i])
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Cannot allocate polygons of tile %d",
+                         aoTiles[i].iTile);
+                eErr = CE_Failure;
+                break;
+            }
+            eErr = pfnFinish(aoTiles[i]);
+        }
+
+        if (eErr == CE_None &&
+            !pfnProgress(dfProgressStart +
+                             (dfProgressEnd - dfProgressStart) *
+                                 (iFirstTile + nBatchTiles) / nTiles,
+                         "", pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+        }
+    }
+    return eErr;
+}
+
+}  // namespace
+
 /************************************************************************/
 /*                          GDALSieveFilter()                           */
 /************************************************************************/
@@ -148,13 +808,14 @@ static inline void CompareNeighbour(int nPolyId1, int nPolyId2,
  * as the threshold will not be altered.  Polygons surrounded by nodata areas
  * will therefore not be altered.
  *
- * The algorithm makes three passes over the input file to enumerate the
- * polygons and collect limited information about them.  Memory use is
- * proportional to the number of polygons (roughly 24 bytes per polygon), but
- * is not directly related to the size of the raster.  So very large raster
- * files can be processed effectively if there aren't too many polygons.  But
- * extremely noisy rasters with many one pixel polygons will end up being
- * expensive (in memory) to process.
+ * The algorithm makes three passes over the input file, by square tiles, to
+ * enumerate the polygons and collect limited information about them.  Only
+ * the polygons crossing the sides of the tiles are kept in memory between
+ * tiles (roughly 40 bytes per polygon), in addition to the ids of the pixels
+ * along the sides of the tiles.  So memory use does not depend on the total
+ * number of polygons, and very large and noisy raster files can be processed
+ * effectively.  Tiles can be processed in parallel with the NUM_THREADS
+ * option.
  *
  * @param hSrcBand the source raster band to be processed.
  * @param hMaskBand an optional mask band.  All pixels in the mask band with a
@@ -166,8 +827,14 @@ static inline void CompareNeighbour(int nPolyId1, int nPolyId2,
  * @param nConnectedness either 4 indicating that diagonal pixels are not
  * considered directly adjacent for polygon membership purposes or 8
  * indicating they are.
- * @param papszOptions algorithm options in name=value list form.  None
- * currently supported.
+ * @param papszOptions algorithm options in name=value list form.
+ * Supported options:
+ * <ul>
+ * <li>NUM_THREADS=number|ALL_CPUS: (GDAL >= 3.12) Number of worker threads
+ * used to process tiles of the raster concurrently. Defaults to the value of
+ * the GDAL_NUM_THREADS configuration option, or 1. Reading and writing of
+ * the raster are still done by the calling thread.</li>
+ * </ul>
  * @param pfnProgress callback for reporting algorithm progress matching the
  * GDALProgressFunc() semantics.  May be NULL.
  * @param pProgressArg callback argument passed to pfnProgress.
@@ -178,8 +845,7 @@ static inline void CompareNeighbour(int nPolyId1, int nPolyId2,
 CPLErr CPL_STDCALL GDALSieveFilter(GDALRasterBandH hSrcBand,
                                    GDALRasterBandH hMaskBand,
                                    GDALRasterBandH hDstBand, int nSizeThreshold,
-                                   int nConnectedness,
-                                   CPL_UNUSED char **papszOptions,
+                                   int nConnectedness, char **papszOptions,
                                    GDALProgressFunc pfnProgress,
                                    void *pProgressArg)
 {
@@ -189,173 +855,195 @@ CPLErr CPL_STDCALL GDALSieveFilter(GDALRasterBandH hSrcBand,
     if (pfnProgress == nullptr)
         pfnProgress = GDALDummyProgress;
 
-    /* -------------------------------------------------------------------- */
-    /*      Allocate working buffers.                                       */
-    /* -------------------------------------------------------------------- */
-    int nXSize = GDALGetRasterBandXSize(hSrcBand);
-    int nYSize = GDALGetRasterBandYSize(hSrcBand);
-    auto panLastLineValKeeper = std::unique_ptr<std::int64_t, VSIFreeReleaser>(
-        static_cast<std::int64_t *>(
-            VSI_MALLOC2_VERBOSE(sizeof(std::int64_t), nXSize)));
-    auto panThisLineValKeeper = std::unique_ptr<std::int64_t, VSIFreeReleaser>(
-        static_cast<std::int64_t *>(
-            VSI_MALLOC2_VERBOSE(sizeof(std::int64_t), nXSize)));
-    auto panLastLineIdKeeper = std::unique_ptr<GInt32, VSIFreeReleaser>(
-        static_cast<GInt32 *>(VSI_MALLOC2_VERBOSE(sizeof(GInt32), nXSize)));
-    auto panThisLineIdKeeper = std::unique_ptr<GInt32, VSIFreeReleaser>(
-        static_cast<GInt32 *>(VSI_MALLOC2_VERBOSE(sizeof(GInt32), nXSize)));
-    auto panThisLineWriteValKeeper =
-        std::unique_ptr<std::int64_t, VSIFreeReleaser>(
-            static_cast<std::int64_t *>(
-                VSI_MALLOC2_VERBOSE(sizeof(std::int64_t), nXSize)));
-    auto pabyMaskLineKeeper = std::unique_ptr<GByte, VSIFreeReleaser>(
-        hMaskBand != nullptr ? static_cast<GByte *>(VSI_MALLOC_VERBOSE(nXSize))
-                             : nullptr);
-
-    auto panLastLineVal = panLastLineValKeeper.get();
-    auto panThisLineVal = panThisLineValKeeper.get();
-    auto panLastLineId = panLastLineIdKeeper.get();
-    auto panThisLineId = panThisLineIdKeeper.get();
-    auto panThisLineWriteVal = panThisLineWriteValKeeper.get();
-    auto pabyMaskLine = pabyMaskLineKeeper.get();
-
-    if (panLastLineVal == nullptr || panThisLineVal == nullptr ||
-        panLastLineId == nullptr || panThisLineId == nullptr ||
-        panThisLineWriteVal == nullptr ||
-        (hMaskBand != nullptr && pabyMaskLine == nullptr))
+    GDALSieveContext sCtxt;
+    sCtxt.nXSize = GDALGetRasterBandXSize(hSrcBand);
+    sCtxt.nYSize = GDALGetRasterBandYSize(hSrcBand);
+    sCtxt.nConnectedness = nConnectedness;
+    sCtxt.nSizeThreshold = nSizeThreshold;
+    sCtxt.nTileSize = GDALSieveTileSize(hSrcBand);
+    sCtxt.nTilesX = sCtxt.nXSize / sCtxt.nTileSize +
+                    (sCtxt.nXSize % sCtxt.nTileSize != 0);
+    sCtxt.nTilesY = sCtxt.nYSize / sCtxt.nTileSize +
+                    (sCtxt.nYSize % sCtxt.nTileSize != 0);
+    const int nTiles = sCtxt.nTilesX * sCtxt.nTilesY;
+    if (nTiles == 0)
     {
-        return CE_Failure;
+        pfnProgress(1.0, "", pProgressArg);
+        return CE_None;
     }
 
     /* -------------------------------------------------------------------- */
-    /*      The first pass over the raster is only used to build up the     */
-    /*      polygon id map so we will know in advance what polygons are     */
-    /*      what on the second pass.                                        */
+    /*      Setup the worker threads, which process one tile each.          */
     /* -------------------------------------------------------------------- */
-    GDALRasterPolygonEnumerator oFirstEnum(nConnectedness);
-    std::vector<int> anPolySizes;
-
-    CPLErr eErr = CE_None;
-    for (int iY = 0; eErr == CE_None && iY < nYSize; iY++)
+    const char *pszThreads = CSLFetchNameValueDef(
+        papszOptions, "NUM_THREADS",
+        CPLGetConfigOption("GDAL_NUM_THREADS", "1"));
+    const int nThreads = std::min(
+        nTiles, std::max(1, std::min(128, EQUAL(pszThreads, "ALL_CPUS")
+                                              ? CPLGetNumCPUs()
+                                              : atoi(pszThreads))));
+    std::unique_ptr<CPLJobQueue> poJobQueue;
+    if (nThreads > 1)
     {
-        eErr = GDALRasterIO(hSrcBand, GF_Read, 0, iY, nXSize, 1, panThisLineVal,
-                            nXSize, 1, GDT_Int64, 0, 0);
-
-        if (eErr == CE_None && hMaskBand != nullptr)
-            eErr = GPMaskImageData(hMaskBand, pabyMaskLine, iY, nXSize,
-                                   panThisLineVal);
-        if (eErr != CE_None)
-            break;
-
-        if (iY == 0)
-            eErr = oFirstEnum.ProcessLine(nullptr, panThisLineVal, nullptr,
-                                          panThisLineId, nXSize)
-                       ? CE_None
-                       : CE_Failure;
-        else
-            eErr = oFirstEnum.ProcessLine(panLastLineVal, panThisLineVal,
-                                          panLastLineId, panThisLineId, nXSize)
-                       ? CE_None
-                       : CE_Failure;
-        if (eErr != CE_None)
-            break;
-
-        /* --------------------------------------------------------------------
-         */
-        /*      Accumulate polygon sizes. */
-        /* --------------------------------------------------------------------
-         */
-        if (oFirstEnum.nNextPolygonId > static_cast<int>(anPolySizes.size()))
-            anPolySizes.resize(oFirstEnum.nNextPolygonId);
-
-        for (int iX = 0; iX < nXSize; iX++)
-        {
-            const int iPoly = panThisLineId[iX];
+        CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+        if (poThreadPool)
+            poJobQueue = poThreadPool->CreateJobQueue();
+    }
 
-            if (iPoly >= 0 && anPolySizes[iPoly] < MY_MAX_INT)
-                anPolySizes[iPoly] += 1;
-        }
+    std::vector<GDALSieveTile> aoTiles;
+    try
+    {
+        aoTiles.resize(nThreads);
+        sCtxt.anTileBoundaryOffset.resize(nTiles);
+        sCtxt.aanTopLine.resize(sCtxt.nTilesY);
+        sCtxt.aanBottomLine.resize(sCtxt.nTilesY);
+        sCtxt.aanLeftColumn.resize(nTiles);
+        sCtxt.aanRightColumn.resize(nTiles);
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "%s: Out of memory",
+                 __FUNCTION__);
+        return CE_Failure;
+    }
 
-        /* --------------------------------------------------------------------
-         */
-        /*      swap this/last lines. */
-        /* --------------------------------------------------------------------
-         */
-        std::swap(panLastLineVal, panThisLineVal);
-        std::swap(panLastLineId, panThisLineId);
-
-        /* --------------------------------------------------------------------
-         */
-        /*      Report progress, and support interrupts. */
-        /* --------------------------------------------------------------------
-         */
-        if (!pfnProgress(0.25 * ((iY + 1) / static_cast<double>(nYSize)), "",
-                         pProgressArg))
+    /* ==================================================================== */
+    /*      First pass ... enumerate the polygons of each tile, and         */
+    /*      collect the boundary polygons.                                  */
+    /* ==================================================================== */
+    CPLErr eErr = GDALSieveProcessTiles(
+        sCtxt, hSrcBand, hMaskBand, aoTiles, poJobQueue.get(),
+        [&sCtxt](GDALSieveTile &oTile) { return oTile.Label(sCtxt); },
+        [&sCtxt](GDALSieveTile &oTile)
         {
-            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-            eErr = CE_Failure;
-        }
-    }
+            const int nOffset = static_cast<int>(sCtxt.anBoundarySize.size());
+            if (oTile.nBoundaryPolys > MY_MAX_INT - nOffset)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Too many polygons crossing tile boundaries");
+                return CE_Failure;
+            }
+            sCtxt.anTileBoundaryOffset[oTile.iTile] = nOffset;
+            try
+            {
+                const int nPolys = static_cast<int>(oTile.anPolyValue.size());
+                for (int iPoly = 0; iPoly < nPolys; iPoly++)
+                {
+                    if (oTile.anPolyBoundary[iPoly] < 0)
+                        continue;
+                    sCtxt.anBoundaryRoot.push_back(
+                        nOffset + oTile.anPolyBoundary[iPoly]);
+                    sCtxt.anBoundarySize.push_back(oTile.anPolySize[iPoly]);
+                    sCtxt.anBoundaryValue.push_back(oTile.anPolyValue[iPoly]);
+                }
 
-    /* -------------------------------------------------------------------- */
-    /*      Make a pass through the maps, ensuring every polygon id         */
-    /*      points to the final id it should use, not an intermediate       */
-    /*      value.                                                          */
-    /* -------------------------------------------------------------------- */
-    if (eErr == CE_None)
-        oFirstEnum.CompleteMerges();
+                // Global id of the boundary polygon of a pixel.
+                const auto GetId = [&oTile, nOffset](int iX, int iY)
+                {
+                    const GInt32 nId =
+                        oTile.anIds[static_cast<size_t>(iY) * oTile.nXSize +
+                                    iX];
+                    return nId < 0 ? -1 : nOffset + oTile.anPolyBoundary[nId];
+                };
+                const auto FillLine = [&sCtxt, &oTile, &GetId](
+                                          std::vector<GInt32> &anLine, int iY)
+                {
+                    anLine.resize(sCtxt.nXSize);
+                    for (int iX = 0; iX < oTile.nXSize; iX++)
+                        anLine[oTile.nXOff + iX] = GetId(iX, iY);
+                };
+                const auto FillColumn = [&oTile, &GetId](
+                                            std::vector<GInt32> &anColumn,
+                                            int iX)
+                {
+                    anColumn.resize(oTile.nYSize);
+                    for (int iY = 0; iY < oTile.nYSize; iY++)
+                        anColumn[iY] = GetId(iX, iY);
+                };
+                if (oTile.iTileY > 0)
+                    FillLine(sCtxt.aanTopLine[oTile.iTileY], 0);
+                if (oTile.iTileY < sCtxt.nTilesY - 1)
+                    FillLine(sCtxt.aanBottomLine[oTile.iTileY],
+                             oTile.nYSize - 1);
+                if (oTile.iTileX > 0)
+                    FillColumn(sCtxt.aanLeftColumn[oTile.iTile], 0);
+                if (oTile.iTileX < sCtxt.nTilesX - 1)
+                    FillColumn(sCtxt.aanRightColumn[oTile.iTile],
+                               oTile.nXSize - 1);
+            }
+            catch (const std::bad_alloc &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Cannot allocate boundary polygons");
+                return CE_Failure;
+            }
+            return CE_None;
+        },
+        0.0, 0.25, pfnProgress, pProgressArg);
+    if (eErr != CE_None)
+        return eErr;
 
     /* -------------------------------------------------------------------- */
-    /*      Check if there are polygons                                     */
+    /*      Merge the boundary polygons across the tile sides, and          */
+    /*      accumulate their sizes.                                         */
     /* -------------------------------------------------------------------- */
-    if (!oFirstEnum.panPolyIdMap || !oFirstEnum.panPolyValue)
+    const bool b8Connected = nConnectedness == 8;
+    for (int iTileY = 0; iTileY + 1 < sCtxt.nTilesY; iTileY++)
     {
-        // Can happen if all pixels are masked
-        if (hSrcBand == hDstBand)
+        const auto &anBottom = sCtxt.aanBottomLine[iTileY];
+        const auto &anTop = sCtxt.aanTopLine[iTileY + 1];
+        for (int iX = 0; iX < sCtxt.nXSize; iX++)
         {
-            pfnProgress(1.0, "", pProgressArg);
-            return CE_None;
+            sCtxt.MergeBoundary(anBottom[iX], anTop[iX]);
+            if (b8Connected && iX > 0)
+                sCtxt.MergeBoundary(anBottom[iX], anTop[iX - 1]);
+            if (b8Connected && iX + 1 < sCtxt.nXSize)
+                sCtxt.MergeBoundary(anBottom[iX], anTop[iX + 1]);
         }
-        else
+    }
+    for (int iTile = 0; iTile < nTiles; iTile++)
+    {
+        if (iTile % sCtxt.nTilesX == sCtxt.nTilesX - 1)
+            continue;
+        const auto &anRight = sCtxt.aanRightColumn[iTile];
+        const auto &anLeft = sCtxt.aanLeftColumn[iTile + 1];
+        const int nHeight = static_cast<int>(anRight.size());
+        for (int iY = 0; iY < nHeight; iY++)
         {
-            return GDALRasterBandCopyWholeRaster(hSrcBand, hDstBand, nullptr,
-                                                 pfnProgress, pProgressArg);
+            sCtxt.MergeBoundary(anRight[iY], anLeft[iY]);
+            if (b8Connected && iY > 0)
+                sCtxt.MergeBoundary(anRight[iY], anLeft[iY - 1]);
+            if (b8Connected && iY + 1 < nHeight)
+                sCtxt.MergeBoundary(anRight[iY], anLeft[iY + 1]);
         }
     }
 
-    /* -------------------------------------------------------------------- */
-    /*      Push the sizes of merged polygon fragments into the             */
-    /*      merged polygon id's count.                                      */
-    /* -------------------------------------------------------------------- */
-    for (int iPoly = 0; iPoly < oFirstEnum.nNextPolygonId; iPoly++)
+    const int nBoundaryPolys = static_cast<int>(sCtxt.anBoundaryRoot.size());
+    for (int iPoly = 0; iPoly < nBoundaryPolys; iPoly++)
+        sCtxt.FindRoot(iPoly);
+    const auto ReplaceByRoots = [&sCtxt](std::vector<GInt32> &anIds)
     {
-        if (oFirstEnum.panPolyIdMap[iPoly] != iPoly)
+        for (auto &nId : anIds)
         {
-            GIntBig nSize = anPolySizes[oFirstEnum.panPolyIdMap[iPoly]];
-
-            nSize += anPolySizes[iPoly];
-
-            if (nSize > MY_MAX_INT)
-                nSize = MY_MAX_INT;
-
-            anPolySizes[oFirstEnum.panPolyIdMap[iPoly]] =
-                static_cast<int>(nSize);
-            anPolySizes[iPoly] = 0;
+            if (nId >= 0)
+                nId = sCtxt.anBoundaryRoot[nId];
         }
-    }
+    };
+    for (auto &anLine : sCtxt.aanBottomLine)
+        ReplaceByRoots(anLine);
+    for (auto &anColumn : sCtxt.aanLeftColumn)
+        ReplaceByRoots(anColumn);
+    for (auto &anColumn : sCtxt.aanRightColumn)
+        ReplaceByRoots(anColumn);
+    // Only needed for the merge.
+    sCtxt.aanTopLine.clear();
 
-    /* -------------------------------------------------------------------- */
-    /*      We will use a new enumerator for the second pass primarily      */
-    /*      so we can preserve the first pass map.                          */
-    /* -------------------------------------------------------------------- */
-    GDALRasterPolygonEnumerator oSecondEnum(nConnectedness);
-
-    std::vector<int> anBigNeighbour;
     try
     {
-        anBigNeighbour.resize(anPolySizes.size(), -1);
+        sCtxt.aoBoundaryNeighbour.resize(nBoundaryPolys);
+        sCtxt.aoBoundaryTarget.resize(nBoundaryPolys);
     }
-    catch (const std::exception &)
+    catch (const std::bad_alloc &)
     {
         CPLError(CE_Failure, CPLE_OutOfMemory, "%s: Out of memory",
                  __FUNCTION__);
@@ -364,276 +1052,128 @@ CPLErr CPL_STDCALL GDALSieveFilter(GDALRasterBandH hSrcBand,
 
     /* ==================================================================== */
     /*      Second pass ... identify the largest neighbour for each         */
-    /*      polygon.                                                        */
+    /*      boundary polygon.                                               */
     /* ==================================================================== */
-    for (int iY = 0; eErr == CE_None && iY < nYSize; iY++)
-    {
-        /* --------------------------------------------------------------------
-         */
-        /*      Read the image data. */
-        /* --------------------------------------------------------------------
-         */
-        eErr = GDALRasterIO(hSrcBand, GF_Read, 0, iY, nXSize, 1, panThisLineVal,
-                            nXSize, 1, GDT_Int64, 0, 0);
-
-        if (eErr == CE_None && hMaskBand != nullptr)
-            eErr = GPMaskImageData(hMaskBand, pabyMaskLine, iY, nXSize,
-                                   panThisLineVal);
-
-        if (eErr != CE_None)
-            continue;
-
-        /* --------------------------------------------------------------------
-         */
-        /*      Determine what polygon the various pixels belong to (redoing */
-        /*      the same thing done in the first pass above). */
-        /* --------------------------------------------------------------------
-         */
-        if (iY == 0)
-            eErr = oSecondEnum.ProcessLine(nullptr, panThisLineVal, nullptr,
-                                           panThisLineId, nXSize)
-                       ? CE_None
-                       : CE_Failure;
-        else
-            eErr = oSecondEnum.ProcessLine(panLastLineVal, panThisLineVal,
-                                           panLastLineId, panThisLineId, nXSize)
-                       ? CE_None
-                       : CE_Failure;
-
-        if (eErr != CE_None)
-            continue;
-
-        /* --------------------------------------------------------------------
-         */
-        /*      Check our neighbours, and update our biggest neighbour map */
-        /*      as appropriate. */
-        /* --------------------------------------------------------------------
-         */
-        for (int iX = 0; iX < nXSize; iX++)
+    eErr = GDALSieveProcessTiles(
+        sCtxt, hSrcBand, hMaskBand, aoTiles, poJobQueue.get(),
+        [&sCtxt](GDALSieveTile &oTile)
         {
-            if (iY > 0)
+            if (!oTile.Label(sCtxt))
+                return false;
+            oTile.FindNeighbours(sCtxt);
+            oTile.ResolveTargets(sCtxt);
+            oTile.CollectBoundaryCandidates(sCtxt);
+            return true;
+        },
+        [&sCtxt](GDALSieveTile &oTile)
+        {
+            for (const auto &[nRoot, oCandidate] : oTile.aoBoundaryCandidates)
             {
-                CompareNeighbour(panThisLineId[iX], panLastLineId[iX],
-                                 oFirstEnum.panPolyIdMap,
-                                 oFirstEnum.panPolyValue, anPolySizes,
-                                 anBigNeighbour);
-
-                if (iX > 0 && nConnectedness == 8)
-                    CompareNeighbour(panThisLineId[iX], panLastLineId[iX - 1],
-                                     oFirstEnum.panPolyIdMap,
-                                     oFirstEnum.panPolyValue, anPolySizes,
-                                     anBigNeighbour);
-
-                if (iX < nXSize - 1 && nConnectedness == 8)
-                    CompareNeighbour(panThisLineId[iX], panLastLineId[iX + 1],
-                                     oFirstEnum.panPolyIdMap,
-                                     oFirstEnum.panPolyValue, anPolySizes,
-                                     anBigNeighbour);
+                sCtxt.aoBoundaryNeighbour[nRoot].Update(
+                    oCandidate.nSize, oCandidate.nPairKey,
+                    oCandidate.oNeighbour);
             }
-
-            if (iX > 0)
-                CompareNeighbour(panThisLineId[iX], panThisLineId[iX - 1],
-                                 oFirstEnum.panPolyIdMap,
-                                 oFirstEnum.panPolyValue, anPolySizes,
-                                 anBigNeighbour);
-
-            // We don't need to compare to next pixel or next line
-            // since they will be compared to us.
-        }
-
-        /* --------------------------------------------------------------------
-         */
-        /*      Swap pixel value, and polygon id lines to be ready for the */
-        /*      next line. */
-        /* --------------------------------------------------------------------
-         */
-        std::swap(panLastLineVal, panThisLineVal);
-        std::swap(panLastLineId, panThisLineId);
-
-        /* --------------------------------------------------------------------
-         */
-        /*      Report progress, and support interrupts. */
-        /* --------------------------------------------------------------------
-         */
-        if (!pfnProgress(0.25 + 0.25 * ((iY + 1) / static_cast<double>(nYSize)),
-                         "", pProgressArg))
-        {
-            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-            eErr = CE_Failure;
-        }
-    }
+            return CE_None;
+        },
+        0.25, 0.5, pfnProgress, pProgressArg);
+    if (eErr != CE_None)
+        return eErr;
 
     /* -------------------------------------------------------------------- */
-    /*      If our biggest neighbour is still smaller than the              */
-    /*      threshold, then try tracking to that polygons biggest           */
-    /*      neighbour, and so forth.                                        */
+    /*      If the biggest neighbour of a boundary polygon is still         */
+    /*      smaller than the threshold, then try tracking to that           */
+    /*      polygons biggest neighbour, and so forth.                       */
     /* -------------------------------------------------------------------- */
     int nFailedMerges = 0;
     int nIsolatedSmall = 0;
     int nSieveTargets = 0;
-
-    for (int iPoly = 0; iPoly < static_cast<int>(anPolySizes.size()); iPoly++)
     {
-        if (oFirstEnum.panPolyIdMap[iPoly] != iPoly)
-            continue;
-
-        // Ignore nodata polygons.
-        if (oFirstEnum.panPolyValue[iPoly] == GP_NODATA_MARKER)
-            continue;
-
-        // Don't try to merge polygons larger than the threshold.
-        if (anPolySizes[iPoly] >= nSizeThreshold)
+        std::vector<GByte> abyResolved(nBoundaryPolys, FALSE);
+        std::vector<GByte> abyVisiting(nBoundaryPolys, FALSE);
+        std::vector<int> anPath;
+        for (int iPoly = 0; iPoly < nBoundaryPolys; iPoly++)
         {
-            anBigNeighbour[iPoly] = -1;
-            continue;
-        }
-
-        nSieveTargets++;
-
-        // if we have no neighbours but we are small, what shall we do?
-        if (anBigNeighbour[iPoly] == -1)
-        {
-            nIsolatedSmall++;
-            continue;
-        }
+            if (sCtxt.anBoundaryRoot[iPoly] != iPoly ||
+                sCtxt.anBoundarySize[iPoly] >= nSizeThreshold)
+                continue;
 
-        std::set<int> oSetVisitedPoly;
-        oSetVisitedPoly.insert(iPoly);
+            nSieveTargets++;
 
-        // Walk through our neighbours until we find a polygon large enough.
-        int iFinalId = iPoly;
-        bool bFoundBigEnoughPoly = false;
-        while (true)
-        {
-            iFinalId = anBigNeighbour[iFinalId];
-            if (iFinalId < 0)
+            GDALSieveTarget oTarget;
+            int nCur = iPoly;
+            anPath.clear();
+            while (true)
             {
-                break;
+                if (abyResolved[nCur])
+                {
+                    oTarget = sCtxt.aoBoundaryTarget[nCur];
+                    break;
+                }
+                // Check that we don't cycle on an already visited polygon.
+                if (abyVisiting[nCur])
+                    break;
+                abyVisiting[nCur] = TRUE;
+                anPath.push_back(nCur);
+
+                const auto &oNeighbour = sCtxt.aoBoundaryNeighbour[nCur];
+                if (oNeighbour.nSize < 0)
+                    break;
+                if (oNeighbour.oNeighbour.eKind != GDALSieveTarget::BOUNDARY)
+                {
+                    oTarget = oNeighbour.oNeighbour;
+                    break;
+                }
+                nCur = static_cast<int>(oNeighbour.oNeighbour.nValue);
             }
-            // If the biggest neighbour is larger than the threshold
-            // then we are golden.
-            if (anPolySizes[iFinalId] >= nSizeThreshold)
+
+            // Map the whole intermediate chain to it.
+            for (const int nPoly : anPath)
             {
-                bFoundBigEnoughPoly = true;
-                break;
+                sCtxt.aoBoundaryTarget[nPoly] = oTarget;
+                abyResolved[nPoly] = TRUE;
             }
-            // Check that we don't cycle on an already visited polygon.
-            if (oSetVisitedPoly.find(iFinalId) != oSetVisitedPoly.end())
-                break;
-            oSetVisitedPoly.insert(iFinalId);
-        }
 
-        if (!bFoundBigEnoughPoly)
-        {
-            nFailedMerges++;
-            anBigNeighbour[iPoly] = -1;
-            continue;
-        }
-
-        // Map the whole intermediate chain to it.
-        int iPolyCur = iPoly;
-        while (anBigNeighbour[iPolyCur] != iFinalId)
-        {
-            int iNextPoly = anBigNeighbour[iPolyCur];
-            anBigNeighbour[iPolyCur] = iFinalId;
-            iPolyCur = iNextPoly;
+            if (sCtxt.aoBoundaryNeighbour[iPoly].nSize < 0)
+                nIsolatedSmall++;
+            else if (oTarget.eKind != GDALSieveTarget::MERGED)
+                nFailedMerges++;
         }
     }
 
-    CPLDebug("GDALSieveFilter",
-             "Small Polygons: %d, Isolated: %d, Unmergable: %d", nSieveTargets,
-             nIsolatedSmall, nFailedMerges);
-
     /* ==================================================================== */
     /*      Make a third pass over the image, actually applying the         */
-    /*      merges.  We reuse the second enumerator but preserve the        */
-    /*      "final maps" from the first.                                    */
+    /*      merges.                                                         */
     /* ==================================================================== */
-    oSecondEnum.Clear();
-
-    for (int iY = 0; eErr == CE_None && iY < nYSize; iY++)
-    {
-        /* --------------------------------------------------------------------
-         */
-        /*      Read the image data. */
-        /* --------------------------------------------------------------------
-         */
-        eErr = GDALRasterIO(hSrcBand, GF_Read, 0, iY, nXSize, 1, panThisLineVal,
-                            nXSize, 1, GDT_Int64, 0, 0);
-
-        memcpy(panThisLineWriteVal, panThisLineVal,
-               sizeof(panThisLineVal[0]) * nXSize);
-
-        if (eErr == CE_None && hMaskBand != nullptr)
-            eErr = GPMaskImageData(hMaskBand, pabyMaskLine, iY, nXSize,
-                                   panThisLineVal);
-
-        if (eErr != CE_None)
-            continue;
-
-        /* --------------------------------------------------------------------
-         */
-        /*      Determine what polygon the various pixels belong to (redoing */
-        /*      the same thing done in the first pass above). */
-        /* --------------------------------------------------------------------
-         */
-        if (iY == 0)
-            oSecondEnum.ProcessLine(nullptr, panThisLineVal, nullptr,
-                                    panThisLineId, nXSize);
-        else
-            oSecondEnum.ProcessLine(panLastLineVal, panThisLineVal,
-                                    panLastLineId, panThisLineId, nXSize);
-
-        /* --------------------------------------------------------------------
-         */
-        /*      Reprocess the actual pixel values according to the polygon */
-        /*      merging, and write out this line of image data. */
-        /* --------------------------------------------------------------------
-         */
-        for (int iX = 0; iX < nXSize; iX++)
+    eErr = GDALSieveProcessTiles(
+        sCtxt, hSrcBand, hMaskBand, aoTiles, poJobQueue.get(),
+        [&sCtxt](GDALSieveTile &oTile)
         {
-            int iThisPoly = panThisLineId[iX];
-            if (iThisPoly >= 0)
-            {
-                iThisPoly = oFirstEnum.panPolyIdMap[iThisPoly];
-
-                if (anBigNeighbour[iThisPoly] != -1)
-                {
-                    panThisLineWriteVal[iX] =
-                        oFirstEnum.panPolyValue[anBigNeighbour[iThisPoly]];
-                }
-            }
-        }
-
-        /* --------------------------------------------------------------------
-         */
-        /*      Write the update data out. */
-        /* --------------------------------------------------------------------
-         */
-        eErr = GDALRasterIO(hDstBand, GF_Write, 0, iY, nXSize, 1,
-                            panThisLineWriteVal, nXSize, 1, GDT_Int64, 0, 0);
-
-        /* --------------------------------------------------------------------
-         */
-        /*      Swap pixel value, and polygon id lines to be ready for the */
-        /*      next line. */
-        /* --------------------------------------------------------------------
-         */
-        std::swap(panLastLineVal, panThisLineVal);
-        std::swap(panLastLineId, panThisLineId);
-
-        /* --------------------------------------------------------------------
-         */
-        /*      Report progress, and support interrupts. */
-        /* --------------------------------------------------------------------
-         */
-        if (eErr == CE_None &&
-            !pfnProgress(0.5 + 0.5 * ((iY + 1) / static_cast<double>(nYSize)),
-                         "", pProgressArg))
+            if (!oTile.Label(sCtxt))
+                return false;
+            oTile.FindNeighbours(sCtxt);
+            oTile.ResolveTargets(sCtxt);
+            oTile.ApplyTargets(sCtxt);
+            return true;
+        },
+        [&](GDALSieveTile &oTile)
         {
-            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-            eErr = CE_Failure;
-        }
+            nSieveTargets += oTile.nSieveTargets;
+            nIsolatedSmall += oTile.nIsolatedSmall;
+            nFailedMerges += oTile.nFailedMerges;
+            if (!oTile.bChanged && hSrcBand == hDstBand)
+                return CE_None;
+            return GDALRasterIO(hDstBand, GF_Write, oTile.nXOff, oTile.nYOff,
+                                oTile.nXSize, oTile.nYSize,
+                                oTile.anValues.data(), oTile.nXSize,
+                                oTile.nYSize, GDT_Int64, 0, 0);
+        },
+        0.5, 1.0, pfnProgress, pProgressArg);
+
+    if (eErr == CE_None)
+    {
+        CPLDebug("GDALSieveFilter",
+                 "Small Polygons: %d, Isolated: %d, Unmergable: %d",
+                 nSieveTargets, nIsolatedSmall, nFailedMerges);
     }
 
     return eErr;
@@ -25,8 +25,12 @@
 #include <cstring>
 
 #include <algorithm>
+#include <atomic>
 #include <limits>
+#include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -35,6 +39,7 @@
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_vsi_virtual.h"
 #include "gdal.h"
 #include "gdal_priv.h"
 #include "ogr_core.h"
@@ -55,6 +60,28 @@ static void *GDALDeserializeReprojectionTransformer(CPLXMLNode *psTree);
 static CPLXMLNode *GDALSerializeGenImgProjTransformer(void *pTransformArg);
 static void *GDALDeserializeGenImgProjTransformer(CPLXMLNode *psTree);
 
+static int GDALGenImgProjTransformInternal(GDALGenImgProjTransformInfo *psInfo,
+                                           int bDstToSrc, int nPointCount,
+                                           double *padfX, double *padfY,
+                                           double *padfZ, int *panSuccess);
+static int GDALGenImgProjTransformWithGrid(GDALGenImgProjTransformInfo *psInfo,
+                                           int nPointCount, double *padfX,
+                                           double *padfY, double *padfZ,
+                                           int *panSuccess);
+static GDALGenImgProjTransformGrid *
+GDALGenImgProjTransformGridCreate(GDALGenImgProjTransformInfo *psInfo,
+                                  int nDstXSize, int nDstYSize,
+                                  const char *pszFilename,
+                                  CSLConstList papszOptions);
+static bool
+GDALGenImgProjTransformGridCheckOptions(CSLConstList papszOptions);
+static bool
+GDALGenImgProjTransformGridEnsure(GDALGenImgProjTransformInfo *psInfo);
+static void
+GDALGenImgProjTransformGridReference(GDALGenImgProjTransformGrid *poGrid);
+static void
+GDALGenImgProjTransformGridRelease(GDALGenImgProjTransformGrid *poGrid);
+
 static void *GDALCreateApproxTransformer2(GDALTransformerFunc pfnRawTransformer,
                                           void *pRawTransformerArg,
                                           double dfMaxErrorForward,
@@ -1284,10 +1311,32 @@ static void *GDALCreateSimilarGenImgProjTransformer(void *hTransformArg,
     GDALGenImgProjTransformInfo *psClonedInfo =
         GDALCreateGenImgProjTransformerInternal();
 
+    // The transformation grid is only valid for the original source
+    // pixel/line coordinate space. Build it before cloning if it is still
+    // pending, so that it is computed, and written in its cache file, once
+    // for all clones.
+    const bool bSameSrcSpace = dfRatioX == 1.0 && dfRatioY == 1.0;
+    if (bSameSrcSpace)
+        GDALGenImgProjTransformGridEnsure(psInfo);
+
     memcpy(psClonedInfo, psInfo, sizeof(GDALGenImgProjTransformInfo));
 
     psClonedInfo->bCheckWithInvertPROJ = GetCurrentCheckWithInvertPROJ();
 
+    if (bSameSrcSpace)
+    {
+        if (psClonedInfo->poTransformGrid)
+            GDALGenImgProjTransformGridReference(
+                psClonedInfo->poTransformGrid);
+        psClonedInfo->papszTransformGridOptions =
+            CSLDuplicate(psInfo->papszTransformGridOptions);
+    }
+    else
+    {
+        psClonedInfo->poTransformGrid = nullptr;
+        psClonedInfo->papszTransformGridOptions = nullptr;
+    }
+
     if (psClonedInfo->sSrcParams.pTransformArg)
         psClonedInfo->sSrcParams.pTransformArg = GDALCreateSimilarTransformer(
             psInfo->sSrcParams.pTransformArg, dfRatioX, dfRatioY);
@@ -1925,6 +1974,11 @@ const char *GDALGetGenImgProjTranformerOptionList(void)
            "backmap. The default is NO, that is to use in-memory arrays, "
            "unless the number of pixels of the geolocation array is greater "
            "than 16 megapixels.' default='NO'/>"
+           "<Option name='GEOLOC_NUM_THREADS' type='string' "
+           "description='"
+           "Number of threads used to build the backmap of geolocation array "
+           "transformers, or ALL_CPUS. Only used when the backmap is stored "
+           "in memory.' default='1'/>"
            "<Option name='GEOLOC_ARRAY' alias='SRC_GEOLOC_ARRAY' type='string' "
            "description='"
            "Name of a GDAL dataset containing a geolocation array and "
@@ -1954,6 +2008,23 @@ const char *GDALGetGenImgProjTranformerOptionList(void)
            "set.'/>"
            "<Option name='NUM_THREADS' type='string' "
            "description='Number of threads to use'/>"
+           "<Option name='TRANSFORM_GRID_CACHE' type='string' "
+           "description='"
+           "Name of a file where a grid of source pixel/line coordinates, "
+           "computed on a regular lattice of target pixel/line coordinates, "
+           "is stored, and from which it is read back if it has been computed "
+           "with the same transformation parameters. Or MEMORY to only keep "
+           "it in memory. The grid is used to interpolate target to source "
+           "transformations.'/>"
+           "<Option name='TRANSFORM_GRID_STEP' type='int' min='1' "
+           "description='"
+           "Spacing, in target pixels, of the nodes of the transformation "
+           "grid.' default='16'/>"
+           "<Option name='TRANSFORM_GRID_ERROR_THRESHOLD' type='float' "
+           "description='"
+           "Maximum error, in source pixels, allowed when interpolating in a "
+           "cell of the transformation grid. Cells for which it is exceeded "
+           "use the exact transformation.' default='0.125'/>"
            "</OptionList>";
 }
 
@@ -2132,6 +2203,12 @@ const char *GDALGetGenImgProjTranformerOptionList(void)
  * the backmap. The default is NO, that is to use in-memory arrays, unless the
  * number of pixels of the geolocation array is greater than 16 megapixels.
  * </li>
+ * <li> GEOLOC_NUM_THREADS=number|ALL_CPUS.
+ * (GDAL &gt;= 3.12) Number of threads used to build the backmap of
+ * geolocation array transformers, when it is stored in memory. Defaults to
+ * 1. The result may marginally differ from the one obtained with a single
+ * thread.
+ * </li>
  * <li>
  * GEOLOC_ARRAY/SRC_GEOLOC_ARRAY=filename. (GDAL &gt;= 3.5.2) Name of a GDAL
  * dataset containing a geolocation array and associated metadata. This is an
@@ -2157,6 +2234,20 @@ const char *GDALGetGenImgProjTranformerOptionList(void)
  * SRC_GEOLOC_ARRAY description for details, assumptions, and defaults. If this
  * option is set, DST_METHOD=GEOLOC_ARRAY will be assumed if not set.
  * </li>
+ * <li>TRANSFORM_GRID_CACHE=filename|MEMORY. (GDAL &gt;= 3.12)
+ * Target to source transformations are computed by
+ * bilinear interpolation in a grid of source pixel/line coordinates,
+ * evaluated with the exact transformation every TRANSFORM_GRID_STEP
+ * (default 16) target pixels. Cells of the grid where the interpolation error
+ * exceeds TRANSFORM_GRID_ERROR_THRESHOLD source pixels (default 0.125),
+ * checked at the middle of their edges and at their center, use the exact
+ * transformation. The grid is saved in the specified file, and read back from
+ * it by subsequent transformers created with the same parameters and target
+ * dataset dimensions, which avoids any coordinate reprojection when warping
+ * repeatedly onto the same target grid. With MEMORY, the grid is only kept in
+ * memory. If hDstDS is NULL, the grid is only built once the target
+ * dimensions are known, as gdalwarp does when it creates its output dataset.
+ * </li>
  * </ul>
  *
  * The use case for the *_APPROX_ERROR_* options is when defining an approximate
@@ -2741,6 +2832,39 @@ void *GDALCreateGenImgProjTransformer2(GDALDatasetH hSrcDS, GDALDatasetH hDstDS,
         }
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Handle optional transformation grid.                            */
+    /* -------------------------------------------------------------------- */
+    if (CSLFetchNameValue(papszOptions, "TRANSFORM_GRID_CACHE"))
+    {
+        if (!GDALGenImgProjTransformGridCheckOptions(papszOptions))
+        {
+            GDALDestroyGenImgProjTransformer(psInfo);
+            return nullptr;
+        }
+        for (const char *pszKey :
+             {"TRANSFORM_GRID_CACHE", "TRANSFORM_GRID_STEP",
+              "TRANSFORM_GRID_ERROR_THRESHOLD"})
+        {
+            if (const char *pszValue = CSLFetchNameValue(papszOptions, pszKey))
+                psInfo->papszTransformGridOptions = CSLSetNameValue(
+                    psInfo->papszTransformGridOptions, pszKey, pszValue);
+        }
+
+        // Without a target dataset, the grid is built once its dimensions
+        // are set with GDALSetGenImgProjTransformerDstSize().
+        if (hDstDS != nullptr)
+        {
+            psInfo->nDstXSize = GDALGetRasterXSize(hDstDS);
+            psInfo->nDstYSize = GDALGetRasterYSize(hDstDS);
+            if (!GDALGenImgProjTransformGridEnsure(psInfo))
+            {
+                GDALDestroyGenImgProjTransformer(psInfo);
+                return nullptr;
+            }
+        }
+    }
+
     return psInfo;
 }
 
@@ -2975,6 +3099,34 @@ void GDALSetGenImgProjTransformerDstGeoTransform(void *hTransformArg,
     {
         CPLError(CE_Failure, CPLE_AppDefined, "Cannot invert geotransform");
     }
+
+    // The transformation grid was computed for the previous geotransform.
+    // It is rebuilt on the next destination to source transformation.
+    GDALGenImgProjTransformGridRelease(psInfo->poTransformGrid);
+    psInfo->poTransformGrid = nullptr;
+}
+
+/************************************************************************/
+/*                GDALSetGenImgProjTransformerDstSize()                 */
+/************************************************************************/
+
+// Sets the dimensions of the target dataset, when it was not available
+// at the creation of the transformer, so that the transformation grid
+// requested with TRANSFORM_GRID_CACHE can be built.
+void GDALSetGenImgProjTransformerDstSize(void *hTransformArg, int nXSize,
+                                         int nYSize)
+{
+    VALIDATE_POINTER0(hTransformArg, "GDALSetGenImgProjTransformerDstSize");
+
+    GDALGenImgProjTransformInfo *psInfo =
+        static_cast<GDALGenImgProjTransformInfo *>(hTransformArg);
+
+    if (psInfo->nDstXSize == nXSize && psInfo->nDstYSize == nYSize)
+        return;
+    psInfo->nDstXSize = nXSize;
+    psInfo->nDstYSize = nYSize;
+    GDALGenImgProjTransformGridRelease(psInfo->poTransformGrid);
+    psInfo->poTransformGrid = nullptr;
 }
 
 /************************************************************************/
@@ -3008,6 +3160,9 @@ void GDALDestroyGenImgProjTransformer(void *hTransformArg)
     if (psInfo->pReprojectArg != nullptr)
         GDALDestroyTransformer(psInfo->pReprojectArg);
 
+    GDALGenImgProjTransformGridRelease(psInfo->poTransformGrid);
+    CSLDestroy(psInfo->papszTransformGridOptions);
+
     CPLFree(psInfo);
 }
 
@@ -3040,6 +3195,25 @@ int GDALGenImgProjTransform(void *pTransformArgIn, int bDstToSrc,
     countGDALGenImgProjTransform += nPointCount;
 #endif
 
+    if (bDstToSrc && GDALGenImgProjTransformGridEnsure(psInfo) &&
+        psInfo->poTransformGrid != nullptr)
+        return GDALGenImgProjTransformWithGrid(psInfo, nPointCount, padfX,
+                                               padfY, padfZ, panSuccess);
+
+    return GDALGenImgProjTransformInternal(psInfo, bDstToSrc, nPointCount,
+                                           padfX, padfY, padfZ, panSuccess);
+}
+
+/************************************************************************/
+/*                  GDALGenImgProjTransformInternal()                   */
+/************************************************************************/
+
+// Exact transformation, without using the transformation grid.
+static int GDALGenImgProjTransformInternal(GDALGenImgProjTransformInfo *psInfo,
+                                           int bDstToSrc, int nPointCount,
+                                           double *padfX, double *padfY,
+                                           double *padfZ, int *panSuccess)
+{
     for (int i = 0; i < nPointCount; i++)
     {
         panSuccess[i] = (padfX[i] != HUGE_VAL && padfY[i] != HUGE_VAL);
@@ -3131,6 +3305,536 @@ int GDALGenImgProjTransform(void *pTransformArgIn, int bDstToSrc,
     return ret;
 }
 
+/************************************************************************/
+/* ==================================================================== */
+/*                     GDALGenImgProjTransformGrid                      */
+/* ==================================================================== */
+/************************************************************************/
+
+// Grid of source pixel/line coordinates computed at the nodes of a regular
+// lattice of destination pixel/line coordinates, with a spacing of nStep
+// destination pixels. Destination to source transformations of points
+// falling in cells whose bilinear interpolation has been checked to be
+// accurate enough are done by interpolating into that grid, instead of
+// going through the potentially costly (PROJ based) exact transformation.
+struct GDALGenImgProjTransformGrid
+{
+    std::atomic<int> nRefCount{1};
+
+    int nStep = 0;
+    int nXNodes = 0;
+    int nYNodes = 0;
+
+    // Source X, Y coordinates, and Z offset, at each node.
+    std::vector<double> adfX{};
+    std::vector<double> adfY{};
+    std::vector<double> adfZ{};
+
+    // Whether each of the (nXNodes - 1) * (nYNodes - 1) cells can be
+    // interpolated.
+    std::vector<GByte> abyCellValid{};
+
+    // Statistics on the use of the grid, reported in debug mode when it is
+    // released.
+    std::atomic<GIntBig> nInterpolatedCount{0};
+    std::atomic<GIntBig> nExactCount{0};
+};
+
+static constexpr const char GRID_CACHE_MAGIC[] = "GDALTGRD";
+static constexpr int GRID_CACHE_MAGIC_SIZE = 8;
+
+/************************************************************************/
+/*                GDALGenImgProjTransformGridReference()                */
+/************************************************************************/
+
+static void
+GDALGenImgProjTransformGridReference(GDALGenImgProjTransformGrid *poGrid)
+{
+    ++poGrid->nRefCount;
+}
+
+/************************************************************************/
+/*                 GDALGenImgProjTransformGridRelease()                 */
+/************************************************************************/
+
+static void
+GDALGenImgProjTransformGridRelease(GDALGenImgProjTransformGrid *poGrid)
+{
+    if (poGrid != nullptr && --poGrid->nRefCount == 0)
+    {
+        CPLDebug("WARP",
+                 "Transformation grid: " CPL_FRMT_GIB
+                 " points interpolated, " CPL_FRMT_GIB
+                 " points transformed exactly",
+                 static_cast<GIntBig>(poGrid->nInterpolatedCount),
+                 static_cast<GIntBig>(poGrid->nExactCount));
+        delete poGrid;
+    }
+}
+
+/************************************************************************/
+/*                GDALGenImgProjTransformGridSignature()                */
+/************************************************************************/
+
+// Returns a string that identifies all the parameters the content of the
+// grid depends on, so that a cached grid built for another transformation
+// is not reused.
+static std::string
+GDALGenImgProjTransformGridSignature(GDALGenImgProjTransformInfo *psInfo,
+                                     int nDstXSize, int nDstYSize, int nStep,
+                                     double dfErrorThreshold)
+{
+    CPLXMLNode *psTree = GDALSerializeGenImgProjTransformer(psInfo);
+    char *pszXML = CPLSerializeXMLTree(psTree);
+    CPLDestroyXMLNode(psTree);
+    std::string osSignature(pszXML ? pszXML : "");
+    CPLFree(pszXML);
+    osSignature += CPLSPrintf("DstSize=%d,%d Step=%d ErrorThreshold=%.17g",
+                              nDstXSize, nDstYSize, nStep, dfErrorThreshold);
+    return osSignature;
+}
+
+/************************************************************************/
+/*                  GDALGenImgProjTransformGridRead()                   */
+/************************************************************************/
+
+static bool GDALGenImgProjTransformGridRead(GDALGenImgProjTransformGrid *poGrid,
+                                            const char *pszFilename,
+                                            const std::string &osSignature)
+{
+    VSIVirtualHandleUniquePtr fp(VSIFOpenL(pszFilename, "rb"));
+    if (!fp)
+        return false;
+
+    char abyMagic[GRID_CACHE_MAGIC_SIZE] = {};
+    GUInt32 nSignatureSize = 0;
+    if (fp->Read(abyMagic, 1, GRID_CACHE_MAGIC_SIZE) != GRID_CACHE_MAGIC_SIZE ||
+        memcmp(abyMagic, GRID_CACHE_MAGIC, GRID_CACHE_MAGIC_SIZE) != 0 ||
+        fp->Read(&nSignatureSize, sizeof(nSignatureSize), 1) != 1)
+    {
+        return false;
+    }
+    CPL_LSBPTR32(&nSignatureSize);
+    if (nSignatureSize != osSignature.size())
+        return false;
+    std::string osFileSignature;
+    osFileSignature.resize(nSignatureSize);
+    if (fp->Read(&osFileSignature[0], 1, nSignatureSize) != nSignatureSize ||
+        osFileSignature != osSignature)
+    {
+        return false;
+    }
+
+    // The grid dimensions are implied by the signature.
+    const size_t nNodes =
+        static_cast<size_t>(poGrid->nXNodes) * poGrid->nYNodes;
+    const size_t nCells = static_cast<size_t>(poGrid->nXNodes - 1) *
+                          (poGrid->nYNodes - 1);
+    try
+    {
+        poGrid->adfX.resize(nNodes);
+        poGrid->adfY.resize(nNodes);
+        poGrid->adfZ.resize(nNodes);
+        poGrid->abyCellValid.resize(nCells);
+    }
+    catch (const std::exception &)
+    {
+        return false;
+    }
+    for (auto *padfValues : {&poGrid->adfX, &poGrid->adfY, &poGrid->adfZ})
+    {
+        if (fp->Read(padfValues->data(), sizeof(double), nNodes) != nNodes)
+            return false;
+#ifdef CPL_MSB
+        for (double &dfVal : *padfValues)
+            CPL_LSBPTR64(&dfVal);
+#endif
+    }
+    return fp->Read(poGrid->abyCellValid.data(), 1, nCells) == nCells;
+}
+
+/************************************************************************/
+/*                  GDALGenImgProjTransformGridWrite()                  */
+/************************************************************************/
+
+static bool
+GDALGenImgProjTransformGridWrite(const GDALGenImgProjTransformGrid *poGrid,
+                                 const char *pszFilename,
+                                 const std::string &osSignature)
+{
+    VSIVirtualHandleUniquePtr fp(VSIFOpenL(pszFilename, "wb"));
+    if (!fp)
+        return false;
+
+    bool bOK = fp->Write(GRID_CACHE_MAGIC, 1, GRID_CACHE_MAGIC_SIZE) ==
+               GRID_CACHE_MAGIC_SIZE;
+    GUInt32 nSignatureSize = static_cast<GUInt32>(osSignature.size());
+    CPL_LSBPTR32(&nSignatureSize);
+    bOK = bOK && fp->Write(&nSignatureSize, sizeof(nSignatureSize), 1) == 1;
+    bOK = bOK && fp->Write(osSignature.data(), 1, osSignature.size()) ==
+                     osSignature.size();
+    for (const auto *padfValues : {&poGrid->adfX, &poGrid->adfY, &poGrid->adfZ})
+    {
+#ifdef CPL_MSB
+        std::vector<double> adfLSB(*padfValues);
+        for (double &dfVal : adfLSB)
+            CPL_LSBPTR64(&dfVal);
+        padfValues = &adfLSB;
+#endif
+        bOK = bOK && fp->Write(padfValues->data(), sizeof(double),
+                               padfValues->size()) == padfValues->size();
+    }
+    bOK = bOK && fp->Write(poGrid->abyCellValid.data(), 1,
+                           poGrid->abyCellValid.size()) ==
+                     poGrid->abyCellValid.size();
+    return fp->Close() == 0 && bOK;
+}
+
+/************************************************************************/
+/*                 GDALGenImgProjTransformGridCompute()                 */
+/************************************************************************/
+
+static bool
+GDALGenImgProjTransformGridCompute(GDALGenImgProjTransformInfo *psInfo,
+                                   GDALGenImgProjTransformGrid *poGrid,
+                                   double dfErrorThreshold)
+{
+    const int nXNodes = poGrid->nXNodes;
+    const int nYNodes = poGrid->nYNodes;
+    const double dfStep = poGrid->nStep;
+    const size_t nNodes = static_cast<size_t>(nXNodes) * nYNodes;
+
+    std::vector<int> abNodeSuccess;
+    // Points at the middle of horizontal edges, vertical edges and cells.
+    std::vector<double> adfX, adfY, adfZ;
+    std::vector<int> abSuccess;
+    try
+    {
+        poGrid->adfX.resize(nNodes);
+        poGrid->adfY.resize(nNodes);
+        poGrid->adfZ.resize(nNodes);
+        poGrid->abyCellValid.resize(static_cast<size_t>(nXNodes - 1) *
+                                    (nYNodes - 1));
+        abNodeSuccess.resize(nNodes);
+        adfX.resize(2 * static_cast<size_t>(nXNodes));
+        adfY.resize(adfX.size());
+        adfZ.resize(adfX.size());
+        abSuccess.resize(adfX.size());
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate transformation grid");
+        return false;
+    }
+
+    // Exact transformation of the nodes, line by line.
+    for (int j = 0; j < nYNodes; ++j)
+    {
+        const size_t nOffset = static_cast<size_t>(j) * nXNodes;
+        for (int i = 0; i < nXNodes; ++i)
+        {
+            poGrid->adfX[nOffset + i] = i * dfStep;
+            poGrid->adfY[nOffset + i] = j * dfStep;
+        }
+        GDALGenImgProjTransformInternal(
+            psInfo, TRUE, nXNodes, poGrid->adfX.data() + nOffset,
+            poGrid->adfY.data() + nOffset, poGrid->adfZ.data() + nOffset,
+            abNodeSuccess.data() + nOffset);
+    }
+
+    const auto IsCloseEnough = [dfErrorThreshold](double dfX, double dfY,
+                                                  double dfXRef, double dfYRef)
+    {
+        return std::fabs(dfX - dfXRef) <= dfErrorThreshold &&
+               std::fabs(dfY - dfYRef) <= dfErrorThreshold;
+    };
+
+    // For each line of cells, check the interpolated value against the
+    // exact one at the middle of the top edges (they are the bottom edges
+    // of the previous line of cells), of the left edges, and of the cells.
+    std::vector<GByte> abyTopEdgeOK(nXNodes - 1);
+    std::vector<GByte> abyBottomEdgeOK(nXNodes - 1);
+    const auto CheckHorizontalEdges = [&](int j, std::vector<GByte> &abyOK)
+    {
+        const size_t nOffset = static_cast<size_t>(j) * nXNodes;
+        for (int i = 0; i + 1 < nXNodes; ++i)
+        {
+            adfX[i] = (i + 0.5) * dfStep;
+            adfY[i] = j * dfStep;
+            adfZ[i] = 0;
+        }
+        GDALGenImgProjTransformInternal(psInfo, TRUE, nXNodes - 1, adfX.data(),
+                                        adfY.data(), adfZ.data(),
+                                        abSuccess.data());
+        for (int i = 0; i + 1 < nXNodes; ++i)
+        {
+            const size_t k = nOffset + i;
+            abyOK[i] =
+                abSuccess[i] && abNodeSuccess[k] && abNodeSuccess[k + 1] &&
+                IsCloseEnough(0.5 * (poGrid->adfX[k] + poGrid->adfX[k + 1]),
+                              0.5 * (poGrid->adfY[k] + poGrid->adfY[k + 1]),
+                              adfX[i], adfY[i]);
+        }
+    };
+
+    CheckHorizontalEdges(0, abyTopEdgeOK);
+    for (int j = 0; j + 1 < nYNodes; ++j)
+    {
+        CheckHorizontalEdges(j + 1, abyBottomEdgeOK);
+
+        // Middle of the vertical edges in the first nXNodes points, and
+        // center of the cells in the next nXNodes - 1 ones.
+        const int nPoints = 2 * nXNodes - 1;
+        for (int i = 0; i < nXNodes; ++i)
+        {
+            adfX[i] = i * dfStep;
+            adfY[i] = (j + 0.5) * dfStep;
+            adfZ[i] = 0;
+        }
+        for (int i = 0; i + 1 < nXNodes; ++i)
+        {
+            adfX[nXNodes + i] = (i + 0.5) * dfStep;
+            adfY[nXNodes + i] = (j + 0.5) * dfStep;
+            adfZ[nXNodes + i] = 0;
+        }
+        GDALGenImgProjTransformInternal(psInfo, TRUE, nPoints, adfX.data(),
+                                        adfY.data(), adfZ.data(),
+                                        abSuccess.data());
+
+        const size_t nOffset = static_cast<size_t>(j) * nXNodes;
+        const auto IsVerticalEdgeOK = [&](int i)
+        {
+            const size_t k = nOffset + i;
+            return abSuccess[i] &&
+                   IsCloseEnough(
+                       0.5 * (poGrid->adfX[k] + poGrid->adfX[k + nXNodes]),
+                       0.5 * (poGrid->adfY[k] + poGrid->adfY[k + nXNodes]),
+                       adfX[i], adfY[i]);
+        };
+        bool bLeftEdgeOK = IsVerticalEdgeOK(0);
+        for (int i = 0; i + 1 < nXNodes; ++i)
+        {
+            const bool bRightEdgeOK = IsVerticalEdgeOK(i + 1);
+            const size_t k = nOffset + i;
+            const int iCenter = nXNodes + i;
+            const bool bCenterOK =
+                abSuccess[iCenter] &&
+                IsCloseEnough(0.25 * (poGrid->adfX[k] + poGrid->adfX[k + 1] +
+                                      poGrid->adfX[k + nXNodes] +
+                                      poGrid->adfX[k + nXNodes + 1]),
+                              0.25 * (poGrid->adfY[k] + poGrid->adfY[k + 1] +
+                                      poGrid->adfY[k + nXNodes] +
+                                      poGrid->adfY[k + nXNodes + 1]),
+                              adfX[iCenter], adfY[iCenter]);
+            poGrid->abyCellValid[static_cast<size_t>(j) * (nXNodes - 1) + i] =
+                abyTopEdgeOK[i] && abyBottomEdgeOK[i] && bLeftEdgeOK &&
+                bRightEdgeOK && bCenterOK;
+            bLeftEdgeOK = bRightEdgeOK;
+        }
+
+        std::swap(abyTopEdgeOK, abyBottomEdgeOK);
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*              GDALGenImgProjTransformGridCheckOptions()               */
+/************************************************************************/
+
+static bool GDALGenImgProjTransformGridCheckOptions(CSLConstList papszOptions)
+{
+    const int nStep =
+        atoi(CSLFetchNameValueDef(papszOptions, "TRANSFORM_GRID_STEP", "16"));
+    const double dfErrorThreshold = CPLAtof(CSLFetchNameValueDef(
+        papszOptions, "TRANSFORM_GRID_ERROR_THRESHOLD", "0.125"));
+    if (nStep < 1 || !(dfErrorThreshold >= 0))
+    {
+        CPLError(CE_Failure, CPLE_IllegalArg,
+                 "Invalid value for TRANSFORM_GRID_STEP or "
+                 "TRANSFORM_GRID_ERROR_THRESHOLD");
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                 GDALGenImgProjTransformGridEnsure()                  */
+/************************************************************************/
+
+// Builds the transformation grid if it has been requested, is not available
+// yet, and the dimensions of the target dataset are known. Returns false if
+// building it failed, in which case it is not attempted again.
+static bool
+GDALGenImgProjTransformGridEnsure(GDALGenImgProjTransformInfo *psInfo)
+{
+    if (psInfo->poTransformGrid != nullptr ||
+        psInfo->papszTransformGridOptions == nullptr ||
+        psInfo->nDstXSize <= 0 || psInfo->nDstYSize <= 0)
+    {
+        return true;
+    }
+
+    psInfo->poTransformGrid = GDALGenImgProjTransformGridCreate(
+        psInfo, psInfo->nDstXSize, psInfo->nDstYSize,
+        CSLFetchNameValue(psInfo->papszTransformGridOptions,
+                          "TRANSFORM_GRID_CACHE"),
+        psInfo->papszTransformGridOptions);
+    if (psInfo->poTransformGrid == nullptr)
+    {
+        CSLDestroy(psInfo->papszTransformGridOptions);
+        psInfo->papszTransformGridOptions = nullptr;
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                 GDALGenImgProjTransformGridCreate()                  */
+/************************************************************************/
+
+// Builds, or loads from pszFilename if it contains a grid computed with the
+// same parameters, the transformation grid of psInfo.
+static GDALGenImgProjTransformGrid *
+GDALGenImgProjTransformGridCreate(GDALGenImgProjTransformInfo *psInfo,
+                                  int nDstXSize, int nDstYSize,
+                                  const char *pszFilename,
+                                  CSLConstList papszOptions)
+{
+    if (!GDALGenImgProjTransformGridCheckOptions(papszOptions))
+        return nullptr;
+    const int nStep =
+        atoi(CSLFetchNameValueDef(papszOptions, "TRANSFORM_GRID_STEP", "16"));
+    const double dfErrorThreshold = CPLAtof(CSLFetchNameValueDef(
+        papszOptions, "TRANSFORM_GRID_ERROR_THRESHOLD", "0.125"));
+
+    auto poGrid = std::make_unique<GDALGenImgProjTransformGrid>();
+    poGrid->nStep = nStep;
+    poGrid->nXNodes = DIV_ROUND_UP(nDstXSize, nStep) + 1;
+    poGrid->nYNodes = DIV_ROUND_UP(nDstYSize, nStep) + 1;
+
+    const bool bUseFile = !EQUAL(pszFilename, "MEMORY");
+    const std::string osSignature =
+        bUseFile ? GDALGenImgProjTransformGridSignature(
+                       psInfo, nDstXSize, nDstYSize, nStep, dfErrorThreshold)
+                 : std::string();
+    if (bUseFile &&
+        GDALGenImgProjTransformGridRead(poGrid.get(), pszFilename, osSignature))
+    {
+        CPLDebug("WARP", "Transformation grid read from %s", pszFilename);
+        return poGrid.release();
+    }
+
+    if (!GDALGenImgProjTransformGridCompute(psInfo, poGrid.get(),
+                                            dfErrorThreshold))
+    {
+        return nullptr;
+    }
+
+    if (bUseFile &&
+        !GDALGenImgProjTransformGridWrite(poGrid.get(), pszFilename,
+                                          osSignature))
+    {
+        CPLError(CE_Warning, CPLE_FileIO,
+                 "Cannot write transformation grid to %s", pszFilename);
+        VSIUnlink(pszFilename);
+    }
+
+    return poGrid.release();
+}
+
+/************************************************************************/
+/*                  GDALGenImgProjTransformWithGrid()                   */
+/************************************************************************/
+
+// Destination to source transformation, by interpolation into the
+// transformation grid for points that fall into valid cells, and with
+// the exact transformation for the other ones.
+static int GDALGenImgProjTransformWithGrid(GDALGenImgProjTransformInfo *psInfo,
+                                           int nPointCount, double *padfX,
+                                           double *padfY, double *padfZ,
+                                           int *panSuccess)
+{
+    GDALGenImgProjTransformGrid *poGrid = psInfo->poTransformGrid;
+    const int nXNodes = poGrid->nXNodes;
+    const int nYNodes = poGrid->nYNodes;
+    const double dfInvStep = 1.0 / poGrid->nStep;
+    const double dfMaxX = nXNodes - 1;
+    const double dfMaxY = nYNodes - 1;
+    const double *padfGridX = poGrid->adfX.data();
+    const double *padfGridY = poGrid->adfY.data();
+    const double *padfGridZ = poGrid->adfZ.data();
+    const GByte *pabyCellValid = poGrid->abyCellValid.data();
+
+    std::vector<int> anExactIdx;
+    for (int i = 0; i < nPointCount; i++)
+    {
+        const double dfX = padfX[i] * dfInvStep;
+        const double dfY = padfY[i] * dfInvStep;
+        // Also rejects NaN and HUGE_VAL.
+        if (!(dfX >= 0 && dfX <= dfMaxX && dfY >= 0 && dfY <= dfMaxY))
+        {
+            anExactIdx.push_back(i);
+            continue;
+        }
+        const int iX = std::min(static_cast<int>(dfX), nXNodes - 2);
+        const int iY = std::min(static_cast<int>(dfY), nYNodes - 2);
+        if (!pabyCellValid[static_cast<size_t>(iY) * (nXNodes - 1) + iX])
+        {
+            anExactIdx.push_back(i);
+            continue;
+        }
+
+        const double dfFracX = dfX - iX;
+        const double dfFracY = dfY - iY;
+        const size_t k = static_cast<size_t>(iY) * nXNodes + iX;
+        const auto Interpolate = [k, nXNodes, dfFracX, dfFracY](const double *v)
+        {
+            const double dfTop = v[k] + dfFracX * (v[k + 1] - v[k]);
+            const double dfBottom =
+                v[k + nXNodes] +
+                dfFracX * (v[k + nXNodes + 1] - v[k + nXNodes]);
+            return dfTop + dfFracY * (dfBottom - dfTop);
+        };
+        padfX[i] = Interpolate(padfGridX);
+        padfY[i] = Interpolate(padfGridY);
+        if (padfZ)
+            padfZ[i] += Interpolate(padfGridZ);
+        panSuccess[i] = TRUE;
+    }
+
+    const int nExact = static_cast<int>(anExactIdx.size());
+    poGrid->nInterpolatedCount += nPointCount - nExact;
+    poGrid->nExactCount += nExact;
+    if (anExactIdx.empty())
+        return TRUE;
+
+    std::vector<double> adfX(nExact), adfY(nExact), adfZ;
+    std::vector<int> abSuccess(nExact);
+    if (padfZ)
+        adfZ.resize(nExact);
+    for (int i = 0; i < nExact; i++)
+    {
+        adfX[i] = padfX[anExactIdx[i]];
+        adfY[i] = padfY[anExactIdx[i]];
+        if (padfZ)
+            adfZ[i] = padfZ[anExactIdx[i]];
+    }
+    const int ret = GDALGenImgProjTransformInternal(
+        psInfo, TRUE, nExact, adfX.data(), adfY.data(),
+        padfZ ? adfZ.data() : nullptr, abSuccess.data());
+    for (int i = 0; i < nExact; i++)
+    {
+        padfX[anExactIdx[i]] = adfX[i];
+        padfY[anExactIdx[i]] = adfY[i];
+        if (padfZ)
+            padfZ[anExactIdx[i]] = adfZ[i];
+        panSuccess[anExactIdx[i]] = abSuccess[i];
+    }
+    return ret;
+}
+
 /************************************************************************/
 /*              GDALTransformLonLatToDestGenImgProjTransformer()        */
 /************************************************************************/
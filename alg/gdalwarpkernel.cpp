@@ -2278,6 +2278,29 @@ static bool GWKGetPixelValueReal(const GDALWarpKernel *poWK, int iBand,
     return *pdfDensity != 0.0;
 }
 
+/************************************************************************/
+/*                        GWKAreMaskBitsAllSet()                        */
+/************************************************************************/
+
+// Returns whether the nCount bits of panMask starting at iOffset are all set.
+static bool GWKAreMaskBitsAllSet(const GUInt32 *panMask, GPtrDiff_t iOffset,
+                                 int nCount)
+{
+    while (nCount > 0)
+    {
+        const GUInt32 nWord = panMask[iOffset >> 5];
+        const int iBit = static_cast<int>(iOffset & 31);
+        const int nBitsInWord = std::min(32 - iBit, nCount);
+        const GUInt32 nWanted =
+            nBitsInWord == 32 ? ~0U : ((1U << nBitsInWord) - 1U) << iBit;
+        if ((nWord & nWanted) != nWanted)
+            return false;
+        iOffset += nBitsInWord;
+        nCount -= nBitsInWord;
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                          GWKGetPixelRow()                            */
 /************************************************************************/
@@ -2303,7 +2326,11 @@ static bool GWKGetPixelRow(const GDALWarpKernel *poWK, int iBand,
             padfDensity[i + 1] = 1.0;
         }
 
-        if (poWK->panUnifiedSrcValid != nullptr)
+        // Rows that are entirely valid, which is the most frequent case,
+        // are detected a mask word at a time.
+        if (poWK->panUnifiedSrcValid != nullptr &&
+            !GWKAreMaskBitsAllSet(poWK->panUnifiedSrcValid, iSrcOffset,
+                                  nSrcLen))
         {
             for (int i = 0; i < nSrcLen; i += 2)
             {
@@ -2326,7 +2353,9 @@ static bool GWKGetPixelRow(const GDALWarpKernel *poWK, int iBand,
         }
 
         if (poWK->papanBandSrcValid != nullptr &&
-            poWK->papanBandSrcValid[iBand] != nullptr)
+            poWK->papanBandSrcValid[iBand] != nullptr &&
+            !GWKAreMaskBitsAllSet(poWK->papanBandSrcValid[iBand], iSrcOffset,
+                                  nSrcLen))
         {
             for (int i = 0; i < nSrcLen; i += 2)
             {
@@ -3887,6 +3916,67 @@ static bool GWKResample(const GDALWarpKernel *poWK, int iBand, double dfSrcX,
     return true;
 }
 
+/************************************************************************/
+/*                      GWKLanczosComputeWeights()                      */
+/************************************************************************/
+
+// Computes padfWeightsShifted[i] = GWKLanczosSinc(i - dfDelta) for i in
+// [iMin, iMax], as used when the scale is not lower than 1.
+static void GWKLanczosComputeWeights(int iMin, int iMax, double dfDelta,
+                                     double *padfWeightsShifted)
+{
+    // Optimisation of GWKLanczosSinc(i - dfDelta) based on the
+    // following trigonometric formulas.
+
+    // TODO(schwehr): Move this somewhere where it can be rendered at
+    // LaTeX.
+    // clang-format off
+    // sin(M_PI * (dfBase + k)) = sin(M_PI * dfBase) * cos(M_PI * k) +
+    //                            cos(M_PI * dfBase) * sin(M_PI * k)
+    // sin(M_PI * (dfBase + k)) = dfSinPIBase * cos(M_PI * k) + dfCosPIBase * sin(M_PI * k)
+    // sin(M_PI * (dfBase + k)) = dfSinPIBase * cos(M_PI * k)
+    // sin(M_PI * (dfBase + k)) = dfSinPIBase * (((k % 2) == 0) ? 1 : -1)
+
+    // sin(M_PI / dfR * (dfBase + k)) = sin(M_PI / dfR * dfBase) * cos(M_PI / dfR * k) +
+    //                                  cos(M_PI / dfR * dfBase) * sin(M_PI / dfR * k)
+    // sin(M_PI / dfR * (dfBase + k)) = dfSinPIBaseOverR * cos(M_PI / dfR * k) + dfCosPIBaseOverR * sin(M_PI / dfR * k)
+    // clang-format on
+
+    const double dfSinPIDeltaOver3 = sin((-M_PI / 3.0) * dfDelta);
+    const double dfSin2PIDeltaOver3 = dfSinPIDeltaOver3 * dfSinPIDeltaOver3;
+    // Ok to use sqrt(1-sin^2) since M_PI / 3 * dfDelta < PI/2.
+    const double dfCosPIDeltaOver3 = sqrt(1.0 - dfSin2PIDeltaOver3);
+    const double dfSinPIDelta =
+        (3.0 - 4 * dfSin2PIDeltaOver3) * dfSinPIDeltaOver3;
+    const double dfInvPI2Over3 = 3.0 / (M_PI * M_PI);
+    const double dfInvPI2Over3xSinPIDelta = dfInvPI2Over3 * dfSinPIDelta;
+    const double dfInvPI2Over3xSinPIDeltaxm0d5SinPIDeltaOver3 =
+        -0.5 * dfInvPI2Over3xSinPIDelta * dfSinPIDeltaOver3;
+    const double dfSinPIOver3 = 0.8660254037844386;
+    const double dfInvPI2Over3xSinPIDeltaxSinPIOver3xCosPIDeltaOver3 =
+        dfSinPIOver3 * dfInvPI2Over3xSinPIDelta * dfCosPIDeltaOver3;
+    const double padfCst[] = {
+        dfInvPI2Over3xSinPIDelta * dfSinPIDeltaOver3,
+        dfInvPI2Over3xSinPIDeltaxm0d5SinPIDeltaOver3 -
+            dfInvPI2Over3xSinPIDeltaxSinPIOver3xCosPIDeltaOver3,
+        dfInvPI2Over3xSinPIDeltaxm0d5SinPIDeltaOver3 +
+            dfInvPI2Over3xSinPIDeltaxSinPIOver3xCosPIDeltaOver3};
+
+    for (int i = iMin; i <= iMax; ++i)
+    {
+        const double dfX = i - dfDelta;
+        if (dfX == 0.0)
+            padfWeightsShifted[i] = 1.0;
+        else
+            padfWeightsShifted[i] = padfCst[(i + 3) % 3] / (dfX * dfX);
+#if DEBUG_VERBOSE
+            // TODO(schwehr): AlmostEqual.
+            // CPLAssert(fabs(padfWeightsX[i-poWK->nFiltInitX] -
+            //               GWKLanczosSinc(dfX, 3.0)) < 1e-10);
+#endif
+    }
+}
+
 /************************************************************************/
 /*                      GWKResampleOptimizedLanczos()                   */
 /************************************************************************/
@@ -4035,58 +4125,8 @@ static bool GWKResampleOptimizedLanczos(const GDALWarpKernel *poWK, int iBand,
         if (iSrcX != psWrkStruct->iLastSrcX ||
             dfDeltaX != psWrkStruct->dfLastDeltaX)
         {
-            // Optimisation of GWKLanczosSinc(i - dfDeltaX) based on the
-            // following trigonometric formulas.
-
-            // TODO(schwehr): Move this somewhere where it can be rendered at
-            // LaTeX.
-            // clang-format off
-            // sin(M_PI * (dfBase + k)) = sin(M_PI * dfBase) * cos(M_PI * k) +
-            //                            cos(M_PI * dfBase) * sin(M_PI * k)
-            // sin(M_PI * (dfBase + k)) = dfSinPIBase * cos(M_PI * k) + dfCosPIBase * sin(M_PI * k)
-            // sin(M_PI * (dfBase + k)) = dfSinPIBase * cos(M_PI * k)
-            // sin(M_PI * (dfBase + k)) = dfSinPIBase * (((k % 2) == 0) ? 1 : -1)
-
-            // sin(M_PI / dfR * (dfBase + k)) = sin(M_PI / dfR * dfBase) * cos(M_PI / dfR * k) +
-            //                                  cos(M_PI / dfR * dfBase) * sin(M_PI / dfR * k)
-            // sin(M_PI / dfR * (dfBase + k)) = dfSinPIBaseOverR * cos(M_PI / dfR * k) + dfCosPIBaseOverR * sin(M_PI / dfR * k)
-            // clang-format on
-
-            const double dfSinPIDeltaXOver3 = sin((-M_PI / 3.0) * dfDeltaX);
-            const double dfSin2PIDeltaXOver3 =
-                dfSinPIDeltaXOver3 * dfSinPIDeltaXOver3;
-            // Ok to use sqrt(1-sin^2) since M_PI / 3 * dfDeltaX < PI/2.
-            const double dfCosPIDeltaXOver3 = sqrt(1.0 - dfSin2PIDeltaXOver3);
-            const double dfSinPIDeltaX =
-                (3.0 - 4 * dfSin2PIDeltaXOver3) * dfSinPIDeltaXOver3;
-            const double dfInvPI2Over3 = 3.0 / (M_PI * M_PI);
-            const double dfInvPI2Over3xSinPIDeltaX =
-                dfInvPI2Over3 * dfSinPIDeltaX;
-            const double dfInvPI2Over3xSinPIDeltaXxm0d5SinPIDeltaXOver3 =
-                -0.5 * dfInvPI2Over3xSinPIDeltaX * dfSinPIDeltaXOver3;
-            const double dfSinPIOver3 = 0.8660254037844386;
-            const double dfInvPI2Over3xSinPIDeltaXxSinPIOver3xCosPIDeltaXOver3 =
-                dfSinPIOver3 * dfInvPI2Over3xSinPIDeltaX * dfCosPIDeltaXOver3;
-            const double padfCst[] = {
-                dfInvPI2Over3xSinPIDeltaX * dfSinPIDeltaXOver3,
-                dfInvPI2Over3xSinPIDeltaXxm0d5SinPIDeltaXOver3 -
-                    dfInvPI2Over3xSinPIDeltaXxSinPIOver3xCosPIDeltaXOver3,
-                dfInvPI2Over3xSinPIDeltaXxm0d5SinPIDeltaXOver3 +
-                    dfInvPI2Over3xSinPIDeltaXxSinPIOver3xCosPIDeltaXOver3};
-
-            for (int i = iMin; i <= iMax; ++i)
-            {
-                const double dfX = i - dfDeltaX;
-                if (dfX == 0.0)
-                    padfWeightsXShifted[i] = 1.0;
-                else
-                    padfWeightsXShifted[i] = padfCst[(i + 3) % 3] / (dfX * dfX);
-#if DEBUG_VERBOSE
-                    // TODO(schwehr): AlmostEqual.
-                    // CPLAssert(fabs(padfWeightsX[i-poWK->nFiltInitX] -
-                    //               GWKLanczosSinc(dfX, 3.0)) < 1e-10);
-#endif
-            }
+            GWKLanczosComputeWeights(iMin, iMax, dfDeltaX,
+                                     padfWeightsXShifted);
 
             psWrkStruct->iLastSrcX = iSrcX;
             psWrkStruct->dfLastDeltaX = dfDeltaX;
@@ -4169,41 +4209,8 @@ static bool GWKResampleOptimizedLanczos(const GDALWarpKernel *poWK, int iBand,
         if (iSrcY != psWrkStruct->iLastSrcY ||
             dfDeltaY != psWrkStruct->dfLastDeltaY)
         {
-            const double dfSinPIDeltaYOver3 = sin((-M_PI / 3.0) * dfDeltaY);
-            const double dfSin2PIDeltaYOver3 =
-                dfSinPIDeltaYOver3 * dfSinPIDeltaYOver3;
-            // Ok to use sqrt(1-sin^2) since M_PI / 3 * dfDeltaY < PI/2.
-            const double dfCosPIDeltaYOver3 = sqrt(1.0 - dfSin2PIDeltaYOver3);
-            const double dfSinPIDeltaY =
-                (3.0 - 4.0 * dfSin2PIDeltaYOver3) * dfSinPIDeltaYOver3;
-            const double dfInvPI2Over3 = 3.0 / (M_PI * M_PI);
-            const double dfInvPI2Over3xSinPIDeltaY =
-                dfInvPI2Over3 * dfSinPIDeltaY;
-            const double dfInvPI2Over3xSinPIDeltaYxm0d5SinPIDeltaYOver3 =
-                -0.5 * dfInvPI2Over3xSinPIDeltaY * dfSinPIDeltaYOver3;
-            const double dfSinPIOver3 = 0.8660254037844386;
-            const double dfInvPI2Over3xSinPIDeltaYxSinPIOver3xCosPIDeltaYOver3 =
-                dfSinPIOver3 * dfInvPI2Over3xSinPIDeltaY * dfCosPIDeltaYOver3;
-            const double padfCst[] = {
-                dfInvPI2Over3xSinPIDeltaY * dfSinPIDeltaYOver3,
-                dfInvPI2Over3xSinPIDeltaYxm0d5SinPIDeltaYOver3 -
-                    dfInvPI2Over3xSinPIDeltaYxSinPIOver3xCosPIDeltaYOver3,
-                dfInvPI2Over3xSinPIDeltaYxm0d5SinPIDeltaYOver3 +
-                    dfInvPI2Over3xSinPIDeltaYxSinPIOver3xCosPIDeltaYOver3};
-
-            for (int j = jMin; j <= jMax; ++j)
-            {
-                const double dfY = j - dfDeltaY;
-                if (dfY == 0.0)
-                    padfWeightsYShifted[j] = 1.0;
-                else
-                    padfWeightsYShifted[j] = padfCst[(j + 3) % 3] / (dfY * dfY);
-#if DEBUG_VERBOSE
-                    // TODO(schwehr): AlmostEqual.
-                    // CPLAssert(fabs(padfWeightsYShifted[j] -
-                    //               GWKLanczosSinc(dfY, 3.0)) < 1e-10);
-#endif
-            }
+            GWKLanczosComputeWeights(jMin, jMax, dfDeltaY,
+                                     padfWeightsYShifted);
 
             psWrkStruct->iLastSrcY = iSrcY;
             psWrkStruct->dfLastDeltaY = dfDeltaY;
@@ -5498,6 +5505,474 @@ static CPLErr GWKGeneralCase(GDALWarpKernel *poWK)
     return GWKRun(poWK, "GWKGeneralCase", GWKGeneralCaseThread);
 }
 
+/************************************************************************/
+/*                        GWKIsSrcWindowValid()                         */
+/************************************************************************/
+
+// Returns whether the nXCount x nYCount source pixels, whose top left corner
+// is at iSrcOffset, are all valid in the unified and band validity masks.
+static bool GWKIsSrcWindowValid(const GDALWarpKernel *poWK, int iBand,
+                                GPtrDiff_t iSrcOffset, int nXCount,
+                                int nYCount)
+{
+    const GUInt32 *panBandSrcValid = poWK->papanBandSrcValid
+                                         ? poWK->papanBandSrcValid[iBand]
+                                         : nullptr;
+    for (int j = 0; j < nYCount; ++j, iSrcOffset += poWK->nSrcXSize)
+    {
+        if (poWK->panUnifiedSrcValid != nullptr &&
+            !GWKAreMaskBitsAllSet(poWK->panUnifiedSrcValid, iSrcOffset,
+                                  nXCount))
+            return false;
+        if (panBandSrcValid != nullptr &&
+            !GWKAreMaskBitsAllSet(panBandSrcValid, iSrcOffset, nXCount))
+            return false;
+    }
+    return true;
+}
+
+#ifdef USE_SSE2
+
+/************************************************************************/
+/*                           GWKSrcMaskLanes                            */
+/************************************************************************/
+
+// Up to 4 target pixels resampled together, each SIMD lane processing one
+// of them. Unused lanes are copies of the first one.
+template <class T> struct GWKSrcMaskLanes
+{
+    // Source pixel whose center is at the top left of, or at, the source
+    // coordinate, i.e. floor(dfSrcX - 0.5), floor(dfSrcY - 0.5).
+    const T *apSrc[4];
+    int anSrcX[4];
+    int anSrcY[4];
+    // Source coordinates, relative to the source window.
+    double adfSrcX[4];
+    double adfSrcY[4];
+};
+
+/************************************************************************/
+/*                            GWKGather4()                              */
+/************************************************************************/
+
+// Loads, for each lane, the source value at nOffset from its apSrc[].
+template <class T>
+static CPL_INLINE XMMReg4Double GWKGather4(const GWKSrcMaskLanes<T> &oLanes,
+                                           GPtrDiff_t nOffset)
+{
+    const double adfValues[4] = {static_cast<double>(oLanes.apSrc[0][nOffset]),
+                                 static_cast<double>(oLanes.apSrc[1][nOffset]),
+                                 static_cast<double>(oLanes.apSrc[2][nOffset]),
+                                 static_cast<double>(oLanes.apSrc[3][nOffset])};
+    return XMMReg4Double::Load4Val(adfValues);
+}
+
+/************************************************************************/
+/*                     GWKBilinearSrcMask4LanesT()                      */
+/************************************************************************/
+
+// Same result as GWKBilinearResample4Sample() on each lane, whose 2x2 source
+// window is known to be inside the source image and fully valid. The
+// operations are done in the same order, so results are bit-identical.
+template <class T>
+static void GWKBilinearSrcMask4LanesT(const GWKSrcMaskLanes<T> &oLanes,
+                                      int nSrcXSize, double *padfDensity,
+                                      double *padfReal)
+{
+    double adfRatioX[4];
+    double adfRatioY[4];
+    for (int k = 0; k < 4; ++k)
+    {
+        adfRatioX[k] = 1.5 - (oLanes.adfSrcX[k] - oLanes.anSrcX[k]);
+        adfRatioY[k] = 1.5 - (oLanes.adfSrcY[k] - oLanes.anSrcY[k]);
+    }
+    const auto one = XMMReg4Double::Set1(1.0);
+    const auto ratioX = XMMReg4Double::Load4Val(adfRatioX);
+    const auto ratioY = XMMReg4Double::Load4Val(adfRatioY);
+    const auto mult1 = ratioX * ratioY;
+    const auto mult2 = (one - ratioX) * ratioY;
+    const auto mult3 = ratioX * (one - ratioY);
+    const auto mult4 = (one - ratioX) * (one - ratioY);
+
+    auto accDivisor = XMMReg4Double::Zero();
+    auto accReal = XMMReg4Double::Zero();
+    accDivisor += mult1;
+    accReal += GWKGather4(oLanes, 0) * mult1;
+    accDivisor += mult2;
+    accReal += GWKGather4(oLanes, 1) * mult2;
+    accDivisor += mult3;
+    accReal += GWKGather4(oLanes, nSrcXSize) * mult3;
+    accDivisor += mult4;
+    accReal += GWKGather4(oLanes, nSrcXSize + 1) * mult4;
+
+    double adfDivisor[4];
+    accDivisor.Store4Val(adfDivisor);
+    accReal.Store4Val(padfReal);
+    for (int k = 0; k < 4; ++k)
+    {
+        // All densities are 1.
+        if (adfDivisor[k] == 1.0)
+        {
+            padfDensity[k] = adfDivisor[k];
+        }
+        else if (adfDivisor[k] < 0.00001)
+        {
+            padfReal[k] = 0.0;
+            padfDensity[k] = 0.0;
+        }
+        else
+        {
+            padfDensity[k] = adfDivisor[k] / adfDivisor[k];
+            padfReal[k] /= adfDivisor[k];
+        }
+    }
+}
+
+/************************************************************************/
+/*                       GWKCubicSrcMask4LanesT()                       */
+/************************************************************************/
+
+// Same result as GWKCubicResample4Sample() on each lane, whose 4x4 source
+// window is known to be inside the source image and fully valid.
+template <class T>
+static void GWKCubicSrcMask4LanesT(const GWKSrcMaskLanes<T> &oLanes,
+                                   int nSrcXSize, double *padfDensity,
+                                   double *padfReal)
+{
+    double adfDeltaX[4];
+    double adfDeltaY[4];
+    for (int k = 0; k < 4; ++k)
+    {
+        adfDeltaX[k] = oLanes.adfSrcX[k] - 0.5 - oLanes.anSrcX[k];
+        adfDeltaY[k] = oLanes.adfSrcY[k] - 0.5 - oLanes.anSrcY[k];
+    }
+
+    // Same as GWKCubicComputeWeights()
+    const auto ComputeWeights =
+        [](const XMMReg4Double &x, XMMReg4Double coeffs[4])
+    {
+        const auto halfX = XMMReg4Double::Set1(0.5) * x;
+        const auto threeX = XMMReg4Double::Set1(3.0) * x;
+        const auto halfX2 = halfX * x;
+
+        coeffs[0] = halfX * (XMMReg4Double::Set1(-1.0) +
+                             x * (XMMReg4Double::Set1(2.0) - x));
+        coeffs[1] = XMMReg4Double::Set1(1.0) +
+                    halfX2 * (XMMReg4Double::Set1(-5.0) + threeX);
+        coeffs[2] = halfX * (XMMReg4Double::Set1(1.0) +
+                             x * (XMMReg4Double::Set1(4.0) - threeX));
+        coeffs[3] = halfX2 * (XMMReg4Double::Set1(-1.0) + x);
+    };
+
+    XMMReg4Double coeffsX[4];
+    ComputeWeights(XMMReg4Double::Load4Val(adfDeltaX), coeffsX);
+    XMMReg4Double coeffsY[4];
+    ComputeWeights(XMMReg4Double::Load4Val(adfDeltaY), coeffsY);
+
+    // All densities are 1, so the horizontal convolution of the density
+    // is the same for the 4 rows.
+    const auto one = XMMReg4Double::Set1(1.0);
+    const auto rowDens = coeffsX[0] * one + coeffsX[1] * one +
+                         coeffsX[2] * one + coeffsX[3] * one;
+
+    XMMReg4Double valueReal[4];
+    GPtrDiff_t nOffset = -nSrcXSize - 1;
+    for (int i = 0; i < 4; ++i, nOffset += nSrcXSize)
+    {
+        valueReal[i] = coeffsX[0] * GWKGather4(oLanes, nOffset) +
+                       coeffsX[1] * GWKGather4(oLanes, nOffset + 1) +
+                       coeffsX[2] * GWKGather4(oLanes, nOffset + 2) +
+                       coeffsX[3] * GWKGather4(oLanes, nOffset + 3);
+    }
+
+    (coeffsY[0] * rowDens + coeffsY[1] * rowDens + coeffsY[2] * rowDens +
+     coeffsY[3] * rowDens)
+        .Store4Val(padfDensity);
+    (coeffsY[0] * valueReal[0] + coeffsY[1] * valueReal[1] +
+     coeffsY[2] * valueReal[2] + coeffsY[3] * valueReal[3])
+        .Store4Val(padfReal);
+}
+
+/************************************************************************/
+/*                      GWKLanczosSrcMask4LanesT()                      */
+/************************************************************************/
+
+// Same result as GWKResampleOptimizedLanczos() on each lane, for scales not
+// lower than 1, with validity masks and without density, whose 7x7 source
+// window is known to be inside the source image and fully valid. The taps
+// that GWKResampleOptimizedLanczos() skips (the first row and column of the
+// window when the source coordinate is not on a pixel center) are given
+// zero weights and values, which does not change the sums.
+template <class T>
+static void GWKLanczosSrcMask4LanesT(const GWKSrcMaskLanes<T> &oLanes,
+                                     int nSrcXSize, double *padfDensity,
+                                     double *padfReal)
+{
+    constexpr int RADIUS = 3;
+    constexpr int SIZE = 2 * RADIUS + 1;
+    double adfWeightsX[SIZE][4];
+    double adfWeightsY[SIZE][4];
+    int anFirstX[4];
+    int anFirstY[4];
+    const auto ComputeWeights =
+        [](double dfDelta, double adfWeights[SIZE][4], int k, int &nFirst)
+    {
+        // Same window as in GWKResampleOptimizedLanczos()
+        int iMin = -RADIUS;
+        int iMax = RADIUS;
+        while (iMin - dfDelta < -3.0)
+            iMin++;
+        while (iMax - dfDelta > 3.0)
+            iMax--;
+        double adfWeightsShifted[SIZE] = {};
+        GWKLanczosComputeWeights(iMin, iMax, dfDelta,
+                                 adfWeightsShifted + RADIUS);
+        for (int i = 0; i < SIZE; ++i)
+            adfWeights[i][k] = adfWeightsShifted[i];
+        nFirst = iMin + RADIUS;
+    };
+    double adfDeltaX[4];
+    double adfDeltaY[4];
+    for (int k = 0; k < 4; ++k)
+    {
+        adfDeltaX[k] = oLanes.adfSrcX[k] - 0.5 - oLanes.anSrcX[k];
+        adfDeltaY[k] = oLanes.adfSrcY[k] - 0.5 - oLanes.anSrcY[k];
+        // Neighbouring target pixels frequently share the same source
+        // row, or column, offset.
+        if (k > 0 && adfDeltaX[k] == adfDeltaX[k - 1])
+        {
+            for (int i = 0; i < SIZE; ++i)
+                adfWeightsX[i][k] = adfWeightsX[i][k - 1];
+            anFirstX[k] = anFirstX[k - 1];
+        }
+        else
+        {
+            ComputeWeights(adfDeltaX[k], adfWeightsX, k, anFirstX[k]);
+        }
+        if (k > 0 && adfDeltaY[k] == adfDeltaY[k - 1])
+        {
+            for (int i = 0; i < SIZE; ++i)
+                adfWeightsY[i][k] = adfWeightsY[i][k - 1];
+            anFirstY[k] = anFirstY[k - 1];
+        }
+        else
+        {
+            ComputeWeights(adfDeltaY[k], adfWeightsY, k, anFirstY[k]);
+        }
+    }
+
+    // The first row and column of the window are only used by lanes whose
+    // source coordinate is on a pixel center.
+    const int iStart = *std::min_element(anFirstX, anFirstX + 4);
+    const int jStart = *std::min_element(anFirstY, anFirstY + 4);
+
+    XMMReg4Double weightsX[SIZE];
+    for (int i = iStart; i < SIZE; ++i)
+        weightsX[i] = XMMReg4Double::Load4Val(adfWeightsX[i]);
+
+    auto accReal = XMMReg4Double::Zero();
+    auto accWeight = XMMReg4Double::Zero();
+    for (int j = jStart; j < SIZE; ++j)
+    {
+        const auto weightY = XMMReg4Double::Load4Val(adfWeightsY[j]);
+        const GPtrDiff_t nRowOffset =
+            static_cast<GPtrDiff_t>(j - RADIUS) * nSrcXSize - RADIUS;
+        for (int i = iStart; i < SIZE; ++i)
+        {
+            double adfValues[4];
+            for (int k = 0; k < 4; ++k)
+            {
+                adfValues[k] =
+                    (i < anFirstX[k] || j < anFirstY[k])
+                        ? 0.0
+                        : static_cast<double>(oLanes.apSrc[k][nRowOffset + i]);
+            }
+            const auto weight = weightY * weightsX[i];
+            accReal += XMMReg4Double::Load4Val(adfValues) * weight;
+            accWeight += weight;
+        }
+    }
+
+    double adfWeight[4];
+    accWeight.Store4Val(adfWeight);
+    accReal.Store4Val(padfReal);
+    for (int k = 0; k < 4; ++k)
+    {
+        // All densities are 1, so the accumulated density is the
+        // accumulated weight.
+        const double dfWeight = adfWeight[k];
+        if (dfWeight < 0.000001)
+        {
+            padfReal[k] = 0.0;
+            padfDensity[k] = 0.0;
+        }
+        else if (dfWeight < 0.99999 || dfWeight > 1.00001)
+        {
+            const double dfInvAcc = 1.0 / dfWeight;
+            padfReal[k] *= dfInvAcc;
+            padfDensity[k] = dfWeight * dfInvAcc;
+        }
+        else
+        {
+            padfDensity[k] = dfWeight;
+        }
+    }
+}
+
+/************************************************************************/
+/*                       GWKResampleSrcMaskRowT()                       */
+/************************************************************************/
+
+// Resamples the pixels of a target row, for a band, with pfnLanes, for the
+// pixels whose source window, of WINDOW_SIZE x WINDOW_SIZE pixels starting
+// WINDOW_BEFORE pixels before the pixel at the top left of the source
+// coordinate, is inside the source image and fully valid. padfDensity[] is
+// set to -1 for the other ones, which must be resampled with the general
+// functions.
+template <class T, int WINDOW_BEFORE, int WINDOW_SIZE,
+          void (*pfnLanes)(const GWKSrcMaskLanes<T> &, int, double *,
+                           double *)>
+static void GWKResampleSrcMaskRowT(const GDALWarpKernel *poWK, int iBand,
+                                   int nDstXSize, const double *padfX,
+                                   const double *padfY, const int *pabSuccess,
+                                   double *padfDensity, double *padfReal)
+{
+    const int nSrcXSize = poWK->nSrcXSize;
+    const int nSrcYSize = poWK->nSrcYSize;
+    const T *pSrcBand =
+        reinterpret_cast<const T *>(poWK->papabySrcImage[iBand]);
+
+    GWKSrcMaskLanes<T> oLanes;
+    int anDstX[4];
+    int nLanes = 0;
+    double adfLaneDensity[4];
+    double adfLaneReal[4];
+
+    const auto Flush = [&]()
+    {
+        for (int k = nLanes; k < 4; ++k)
+        {
+            oLanes.apSrc[k] = oLanes.apSrc[0];
+            oLanes.anSrcX[k] = oLanes.anSrcX[0];
+            oLanes.anSrcY[k] = oLanes.anSrcY[0];
+            oLanes.adfSrcX[k] = oLanes.adfSrcX[0];
+            oLanes.adfSrcY[k] = oLanes.adfSrcY[0];
+        }
+        pfnLanes(oLanes, nSrcXSize, adfLaneDensity, adfLaneReal);
+        for (int k = 0; k < nLanes; ++k)
+        {
+            padfDensity[anDstX[k]] = adfLaneDensity[k];
+            padfReal[anDstX[k]] = adfLaneReal[k];
+        }
+        nLanes = 0;
+    };
+
+    for (int iDstX = 0; iDstX < nDstXSize; ++iDstX)
+    {
+        padfDensity[iDstX] = -1.0;
+        if (!pabSuccess[iDstX])
+            continue;
+        const double dfSrcX = padfX[iDstX] - poWK->nSrcXOff;
+        const double dfSrcY = padfY[iDstX] - poWK->nSrcYOff;
+        // Also rejects NaN
+        if (!(dfSrcX >= 0 && dfSrcX < nSrcXSize && dfSrcY >= 0 &&
+              dfSrcY < nSrcYSize))
+            continue;
+        const int iSrcX = static_cast<int>(floor(dfSrcX - 0.5));
+        const int iSrcY = static_cast<int>(floor(dfSrcY - 0.5));
+        if (iSrcX - WINDOW_BEFORE < 0 ||
+            iSrcX - WINDOW_BEFORE + WINDOW_SIZE > nSrcXSize ||
+            iSrcY - WINDOW_BEFORE < 0 ||
+            iSrcY - WINDOW_BEFORE + WINDOW_SIZE > nSrcYSize)
+            continue;
+        const GPtrDiff_t iSrcOffset =
+            iSrcX + static_cast<GPtrDiff_t>(iSrcY) * nSrcXSize;
+        if (!GWKIsSrcWindowValid(
+                poWK, iBand,
+                iSrcOffset - static_cast<GPtrDiff_t>(WINDOW_BEFORE) *
+                                 (nSrcXSize + 1),
+                WINDOW_SIZE, WINDOW_SIZE))
+            continue;
+
+        oLanes.apSrc[nLanes] = pSrcBand + iSrcOffset;
+        oLanes.anSrcX[nLanes] = iSrcX;
+        oLanes.anSrcY[nLanes] = iSrcY;
+        oLanes.adfSrcX[nLanes] = dfSrcX;
+        oLanes.adfSrcY[nLanes] = dfSrcY;
+        anDstX[nLanes] = iDstX;
+        if (++nLanes == 4)
+            Flush();
+    }
+    if (nLanes > 0)
+        Flush();
+}
+
+/************************************************************************/
+/*                      GWKGetResampleSrcMaskRow()                      */
+/************************************************************************/
+
+typedef void (*GWKResampleSrcMaskRowFunc)(const GDALWarpKernel *, int, int,
+                                          const double *, const double *,
+                                          const int *, double *, double *);
+
+template <class T>
+static GWKResampleSrcMaskRowFunc
+GWKGetResampleSrcMaskRowT(GDALResampleAlg eResample)
+{
+    switch (eResample)
+    {
+        case GRA_Bilinear:
+            return GWKResampleSrcMaskRowT<T, 0, 2,
+                                          GWKBilinearSrcMask4LanesT<T>>;
+        case GRA_Cubic:
+            return GWKResampleSrcMaskRowT<T, 1, 4, GWKCubicSrcMask4LanesT<T>>;
+        case GRA_Lanczos:
+            return GWKResampleSrcMaskRowT<T, 3, 7,
+                                          GWKLanczosSrcMask4LanesT<T>>;
+        default:
+            break;
+    }
+    return nullptr;
+}
+
+// Returns the function resampling whole target rows of sources without
+// density, typically with validity masks derived from nodata values, with
+// SIMD, if available for the resampling method and data type.
+static GWKResampleSrcMaskRowFunc
+GWKGetResampleSrcMaskRow(const GDALWarpKernel *poWK, bool bUse4SamplesFormula)
+{
+    if (poWK->pafUnifiedSrcDensity != nullptr)
+        return nullptr;
+    if ((poWK->eResample == GRA_Bilinear || poWK->eResample == GRA_Cubic) &&
+        !bUse4SamplesFormula)
+        return nullptr;
+    // GWKResampleOptimizedLanczos() only handles the taps one by one
+    // when there are validity masks, and computes its weights differently
+    // for scales lower than 1.
+    if (poWK->eResample == GRA_Lanczos &&
+        (poWK->dfXScale < 1.0 || poWK->dfYScale < 1.0 ||
+         (poWK->panUnifiedSrcValid == nullptr &&
+          poWK->papanBandSrcValid == nullptr)))
+        return nullptr;
+
+    switch (poWK->eWorkingDataType)
+    {
+        case GDT_Byte:
+            return GWKGetResampleSrcMaskRowT<GByte>(poWK->eResample);
+        case GDT_Int16:
+            return GWKGetResampleSrcMaskRowT<GInt16>(poWK->eResample);
+        case GDT_UInt16:
+            return GWKGetResampleSrcMaskRowT<GUInt16>(poWK->eResample);
+        case GDT_Float32:
+            return GWKGetResampleSrcMaskRowT<float>(poWK->eResample);
+        default:
+            break;
+    }
+    return nullptr;
+}
+
+#endif  // USE_SSE2
+
 /************************************************************************/
 /*                            GWKRealCase()                             */
 /*                                                                      */
@@ -5553,6 +6028,22 @@ static void GWKRealCaseThread(void *pData)
                                    poWK->papanBandSrcValid == nullptr &&
                                    poWK->pafUnifiedSrcDensity != nullptr;
 
+#ifdef USE_SSE2
+    // When the source has no density, typically when only validity masks
+    // derived from nodata values are present, resample whole rows with SIMD
+    // for the most common data types and methods. Pixels whose source
+    // window is not fully valid are left to the general functions.
+    const GWKResampleSrcMaskRowFunc pfnResampleSrcMaskRow =
+        GWKGetResampleSrcMaskRow(poWK, bUse4SamplesFormula);
+    std::vector<double> adfRowDensity;
+    std::vector<double> adfRowReal;
+    if (pfnResampleSrcMaskRow)
+    {
+        adfRowDensity.resize(static_cast<size_t>(nDstXSize) * poWK->nBands);
+        adfRowReal.resize(static_cast<size_t>(nDstXSize) * poWK->nBands);
+    }
+#endif
+
     const bool bOneSourceCornerFailsToReproject =
         GWKOneSourceCornerFailsToReproject(psJob);
 
@@ -5592,6 +6083,20 @@ static void GWKRealCaseThread(void *pData)
                 0.5 + poWK->nDstXOff, iDstY + 0.5 + poWK->nDstYOff);
         }
 
+#ifdef USE_SSE2
+        if (pfnResampleSrcMaskRow)
+        {
+            for (int iBand = 0; iBand < poWK->nBands; iBand++)
+            {
+                const size_t nOffset = static_cast<size_t>(iBand) * nDstXSize;
+                pfnResampleSrcMaskRow(
+                    poWK, iBand, nDstXSize, padfX, padfY, pabSuccess,
+                    adfRowDensity.data() + nOffset,
+                    adfRowReal.data() + nOffset);
+            }
+        }
+#endif
+
         /* ====================================================================
          */
         /*      Loop over pixels in output scanline. */
@@ -5669,8 +6174,18 @@ static void GWKRealCaseThread(void *pData)
                 /*      Collect the source value. */
                 /* --------------------------------------------------------------------
                  */
-                if (poWK->eResample == GRA_NearestNeighbour || nSrcXSize == 1 ||
-                    nSrcYSize == 1)
+#ifdef USE_SSE2
+                const size_t nRowOffset =
+                    static_cast<size_t>(iBand) * nDstXSize + iDstX;
+                if (pfnResampleSrcMaskRow && adfRowDensity[nRowOffset] >= 0)
+                {
+                    dfBandDensity = adfRowDensity[nRowOffset];
+                    dfValueReal = adfRowReal[nRowOffset];
+                }
+                else
+#endif
+                    if (poWK->eResample == GRA_NearestNeighbour ||
+                        nSrcXSize == 1 || nSrcYSize == 1)
                 {
                     // FALSE is returned if dfBandDensity == 0, which is
                     // checked below.
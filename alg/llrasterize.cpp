@@ -25,6 +25,28 @@
 
 #include "gdal_alg.h"
 
+/************************************************************************/
+/*                      llGetFirstLineAtOrAfter()                       */
+/************************************************************************/
+
+// Returns the first line y of [nMinY, nMaxY] whose center y + 0.5 is
+// greater or equal to dfY, or nMaxY + 1 if there is none. The comparisons
+// are the ones of the per-scanline intersection test, so that the result is
+// exact, whatever the rounding of dfY - 0.5.
+static int llGetFirstLineAtOrAfter(double dfY, int nMinY, int nMaxY)
+{
+    if (!(dfY > nMinY + 0.5))
+        return nMinY;
+    if (dfY > nMaxY + 0.5)
+        return nMaxY + 1;
+    int y = static_cast<int>(std::ceil(dfY - 0.5));
+    while (y > nMinY && (y - 1) + 0.5 >= dfY)
+        --y;
+    while (y <= nMaxY && y + 0.5 < dfY)
+        ++y;
+    return y;
+}
+
 /************************************************************************/
 /*                       dllImageFilledPolygon()                        */
 /*                                                                      */
@@ -43,6 +65,12 @@
 /*      the nodes are placed in the center of the pixels in which       */
 /*      case, due to numerical inaccuracies, it's hard to predict       */
 /*      if the pixel will be considered inside or outside the shape.    */
+/*                                                                      */
+/*      Edges are bucketed by the first scanline they cross, and only   */
+/*      the edges of the active edge table are intersected with each    */
+/*      scanline, so that the cost is proportional to the number of     */
+/*      edges plus the number of intersections, and not to their        */
+/*      product.                                                        */
 /************************************************************************/
 
 /*
@@ -55,6 +83,17 @@
  * the GDAL MIT license (pulled from the OpenEV distribution).
  */
 
+namespace
+{
+struct llEdge
+{
+    int ind1;    // index of the first point of the edge
+    int ind2;    // index of the second point of the edge
+    int yEnd;    // first scanline after the ones crossed by the edge
+    bool bHorizontal;
+};
+}  // namespace
+
 void GDALdllImageFilledPolygon(int nRasterXSize, int nRasterYSize,
                                int nPartCount, const int *panPartSize,
                                const double *padfX, const double *padfY,
@@ -98,19 +137,23 @@ void GDALdllImageFilledPolygon(int nRasterXSize, int nRasterYSize,
     if (maxy >= nRasterYSize)
         maxy = nRasterYSize - 1;
 
+    if (miny > maxy)
+        return;
+
     int minx = 0;
     const int maxx = nRasterXSize - 1;
 
-    // Fix in 1.3: count a vertex only once.
-    for (int y = miny; y <= maxy; y++)
+    /* -------------------------------------------------------------------- */
+    /*      Build the edge table: edges are sorted by the first scanline    */
+    /*      they cross, and then by their index.                            */
+    /* -------------------------------------------------------------------- */
+    std::vector<llEdge> asEdges;
+    asEdges.reserve(n);
+    std::vector<int> anFirstLine;
+    anFirstLine.reserve(n);
     {
         int partoffset = 0;
-
-        const double dy = y + 0.5;  // Center height of line.
-
         int part = 0;
-        int ints = 0;
-        int ints2 = 0;
 
         for (int i = 0; i < n; i++)
         {
@@ -120,41 +163,106 @@ void GDALdllImageFilledPolygon(int nRasterXSize, int nRasterYSize,
                 part++;
             }
 
-            int ind1 = 0;
-            int ind2 = 0;
+            llEdge sEdge;
             if (i == partoffset)
             {
-                ind1 = partoffset + panPartSize[part] - 1;
-                ind2 = partoffset;
+                sEdge.ind1 = partoffset + panPartSize[part] - 1;
+                sEdge.ind2 = partoffset;
             }
             else
             {
-                ind1 = i - 1;
-                ind2 = i;
+                sEdge.ind1 = i - 1;
+                sEdge.ind2 = i;
             }
 
-            double dy1 = padfY[ind1];
-            double dy2 = padfY[ind2];
-
-            if ((dy1 < dy && dy2 < dy) || (dy1 > dy && dy2 > dy))
-                continue;
-
-            double dx1 = 0.0;
-            double dx2 = 0.0;
-            if (dy1 < dy2)
+            const double dy1 = padfY[sEdge.ind1];
+            const double dy2 = padfY[sEdge.ind2];
+            int yStart;
+            if (dy1 < dy2 || dy1 > dy2)
             {
-                dx1 = padfX[ind1];
-                dx2 = padfX[ind2];
+                // Crosses the scanlines whose center is in [dy1, dy2[
+                sEdge.bHorizontal = false;
+                yStart = llGetFirstLineAtOrAfter(std::min(dy1, dy2), miny,
+                                                 maxy);
+                sEdge.yEnd =
+                    llGetFirstLineAtOrAfter(std::max(dy1, dy2), miny, maxy);
             }
-            else if (dy1 > dy2)
+            else if (dy1 == dy2)
             {
-                std::swap(dy1, dy2);
-                dx2 = padfX[ind1];
-                dx1 = padfX[ind2];
+                // Only considered on the scanline whose center is dy1, if any
+                sEdge.bHorizontal = true;
+                yStart = llGetFirstLineAtOrAfter(dy1, miny, maxy);
+                sEdge.yEnd =
+                    (yStart <= maxy && yStart + 0.5 == dy1) ? yStart + 1
+                                                            : yStart;
             }
-            else  // if( fabs(dy1-dy2) < 1.e-6 )
+            else
             {
+                // NaN coordinates: considered as horizontal on all scanlines
+                sEdge.bHorizontal = true;
+                yStart = miny;
+                sEdge.yEnd = maxy + 1;
+            }
 
+            if (yStart < sEdge.yEnd)
+            {
+                asEdges.push_back(sEdge);
+                anFirstLine.push_back(yStart);
+            }
+        }
+    }
+
+    std::vector<int> anEdgeOrder(asEdges.size());
+    for (int i = 0; i < static_cast<int>(anEdgeOrder.size()); i++)
+        anEdgeOrder[i] = i;
+    std::stable_sort(anEdgeOrder.begin(), anEdgeOrder.end(),
+                     [&anFirstLine](int a, int b)
+                     { return anFirstLine[a] < anFirstLine[b]; });
+
+    /* -------------------------------------------------------------------- */
+    /*      Scan lines, maintaining the active edge table.                  */
+    /* -------------------------------------------------------------------- */
+    std::vector<int> anActiveEdges;
+    size_t iNextEdge = 0;
+
+    // Fix in 1.3: count a vertex only once.
+    for (int y = miny; y <= maxy; y++)
+    {
+        const double dy = y + 0.5;  // Center height of line.
+
+        // Remove edges that no longer cross this line, and add the ones that
+        // start crossing it, while keeping edges sorted by their index.
+        anActiveEdges.erase(
+            std::remove_if(anActiveEdges.begin(), anActiveEdges.end(),
+                           [&asEdges, y](int iEdge)
+                           { return asEdges[iEdge].yEnd <= y; }),
+            anActiveEdges.end());
+        const size_t nPrevActiveEdges = anActiveEdges.size();
+        while (iNextEdge < anEdgeOrder.size() &&
+               anFirstLine[anEdgeOrder[iNextEdge]] == y)
+        {
+            anActiveEdges.push_back(anEdgeOrder[iNextEdge]);
+            ++iNextEdge;
+        }
+        if (nPrevActiveEdges != 0 &&
+            nPrevActiveEdges != anActiveEdges.size())
+        {
+            std::inplace_merge(anActiveEdges.begin(),
+                               anActiveEdges.begin() + nPrevActiveEdges,
+                               anActiveEdges.end());
+        }
+
+        int ints = 0;
+        int ints2 = 0;
+
+        for (const int iEdge : anActiveEdges)
+        {
+            const llEdge &sEdge = asEdges[iEdge];
+            const int ind1 = sEdge.ind1;
+            const int ind2 = sEdge.ind2;
+
+            if (sEdge.bHorizontal)
+            {
                 // AE: DO NOT skip bottom horizontal segments
                 // -Fill them separately-
                 if (padfX[ind1] > padfX[ind2])
@@ -185,13 +293,29 @@ void GDALdllImageFilledPolygon(int nRasterXSize, int nRasterYSize,
                 continue;
             }
 
-            if (dy < dy2 && dy >= dy1)
+            double dy1 = padfY[ind1];
+            double dy2 = padfY[ind2];
+            double dx1 = 0.0;
+            double dx2 = 0.0;
+            if (dy1 < dy2)
             {
-                const double intersect =
-                    (dy - dy1) * (dx2 - dx1) / (dy2 - dy1) + dx1;
-
-                polyInts[ints++] = static_cast<int>(floor(intersect + 0.5));
+                dx1 = padfX[ind1];
+                dx2 = padfX[ind2];
             }
+            else
+            {
+                std::swap(dy1, dy2);
+                dx2 = padfX[ind1];
+                dx1 = padfX[ind2];
+            }
+
+            // The intersection is computed as in a per-scanline
+            // implementation, rather than incrementally, to keep results
+            // identical.
+            const double intersect =
+                (dy - dy1) * (dx2 - dx1) / (dy2 - dy1) + dx1;
+
+            polyInts[ints++] = static_cast<int>(floor(intersect + 0.5));
         }
 
         std::sort(polyInts.begin(), polyInts.begin() + ints);
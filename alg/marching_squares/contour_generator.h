@@ -54,6 +54,20 @@ class ContourGenerator
         return CE_None;
     }
 
+    // Start at line lineIdx instead of the first line of the raster, so that
+    // horizontal strips of the raster can be processed by different
+    // generators. previousLine is the line before lineIdx, or nullptr for the
+    // first line.
+    void startAtLine(size_t lineIdx, const double *previousLine)
+    {
+        lineIdx_ = lineIdx;
+        if (previousLine != nullptr)
+            std::copy(previousLine, previousLine + width_,
+                      previousLine_.begin());
+        else
+            std::fill(previousLine_.begin(), previousLine_.end(), NaN);
+    }
+
   private:
     size_t width_;
     size_t height_;
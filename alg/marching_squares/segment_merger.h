@@ -45,7 +45,7 @@ template <typename LineWriter, typename LevelGenerator> struct SegmentMerger
 
     ~SegmentMerger()
     {
-        if (polygonize)
+        if (polygonize && !partial_)
         {
             for (auto it = lines_.begin(); it != lines_.end(); ++it)
             {
@@ -150,6 +150,16 @@ template <typename LineWriter, typename LevelGenerator> struct SegmentMerger
         m_anSkipLevels = anSkipLevels;
     }
 
+    /**
+     * @brief setPartial tells that segments are only added for a part of
+     *        the raster, so that unclosed rings are expected when polygonize
+     *        option is set.
+     */
+    void setPartial(bool partial)
+    {
+        partial_ = partial;
+    }
+
     const bool polygonize;
 
   private:
@@ -161,6 +171,8 @@ template <typename LineWriter, typename LevelGenerator> struct SegmentMerger
     // Store 0-indexed levels to skip when polygonize option is set
     std::vector<int> m_anSkipLevels;
 
+    bool partial_ = false;
+
     void addSegment_(int levelIdx, const Point &start, const Point &end)
     {
 
@@ -19,9 +19,12 @@
 #include <string.h>
 
 #include <algorithm>
+#include <deque>
+#include <future>
 #include <limits>
 #include <map>
 #include <memory>
+#include <set>
 #include <utility>
 #include <vector>
 
@@ -34,6 +37,7 @@
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "gdal_thread_pool.h"
 
 #include "polygonize_polygonizer.h"
 
@@ -48,15 +52,18 @@ using namespace gdal::polygonizer;
 
 template <class DataType>
 static CPLErr GPMaskImageData(GDALRasterBandH hMaskBand, GByte *pabyMaskLine,
-                              int iY, int nXSize, DataType *panImageLine)
+                              int iY, int nXSize, int nLines,
+                              DataType *panImageLine)
 
 {
-    const CPLErr eErr = GDALRasterIO(hMaskBand, GF_Read, 0, iY, nXSize, 1,
-                                     pabyMaskLine, nXSize, 1, GDT_Byte, 0, 0);
+    const CPLErr eErr =
+        GDALRasterIO(hMaskBand, GF_Read, 0, iY, nXSize, nLines, pabyMaskLine,
+                     nXSize, nLines, GDT_Byte, 0, 0);
     if (eErr != CE_None)
         return eErr;
 
-    for (int i = 0; i < nXSize; i++)
+    const size_t nPixels = static_cast<size_t>(nXSize) * nLines;
+    for (size_t i = 0; i < nPixels; i++)
     {
         if (pabyMaskLine[i] == 0)
             panImageLine[i] = GP_NODATA_MARKER;
@@ -65,6 +72,821 @@ static CPLErr GPMaskImageData(GDALRasterBandH hMaskBand, GByte *pabyMaskLine,
     return CE_None;
 }
 
+/************************************************************************/
+/*                         GPGetNumThreads()                            */
+/************************************************************************/
+
+// Number of threads from the NUM_THREADS option. Not defaulting to
+// GDAL_NUM_THREADS, since the order of the output features depends on it.
+static int GPGetNumThreads(CSLConstList papszOptions)
+{
+    const char *pszNumThreads =
+        CSLFetchNameValueDef(papszOptions, "NUM_THREADS", "1");
+    return std::max(1, std::min(128, EQUAL(pszNumThreads, "ALL_CPUS")
+                                         ? CPLGetNumCPUs()
+                                         : atoi(pszNumThreads)));
+}
+
+/************************************************************************/
+/*                         GPRingsToPolygon()                           */
+/************************************************************************/
+
+// Builds a georeferenced polygon from rings in pixel coordinates, in the
+// same way as OGRPolygonWriter::receive().
+static std::unique_ptr<OGRPolygon>
+GPRingsToPolygon(const std::vector<Arc> &aoRings,
+                 const double *padfGeoTransform)
+{
+    const double *gt = padfGeoTransform;
+    auto poPolygon = std::make_unique<OGRPolygon>();
+    for (const auto &oRing : aoRings)
+    {
+        auto poRing = std::make_unique<OGRLinearRing>();
+        poRing->setNumPoints(static_cast<int>(oRing.size()),
+                             /* bZeroizeNewContent = */ false);
+        int iPoint = 0;
+        for (const Point &oPixel : oRing)
+        {
+            poRing->setPoint(iPoint,
+                             gt[0] + oPixel[1] * gt[1] + oPixel[0] * gt[2],
+                             gt[3] + oPixel[1] * gt[4] + oPixel[0] * gt[5]);
+            ++iPoint;
+        }
+        poRing->closeRings();
+        poPolygon->addRingDirectly(poRing.release());
+    }
+    return poPolygon;
+}
+
+namespace
+{
+
+/************************************************************************/
+/*                           GPSeamPolygon                              */
+/************************************************************************/
+
+// Polygon of a strip that touches the seam line with the previous or next
+// strip, and may have to be stitched with polygons of that strip.
+// Rings are in pixel coordinates of the whole raster.
+template <class DataType> struct GPSeamPolygon
+{
+    DataType nValue{};
+    std::vector<Arc> aoRings{};
+    // Row index of the seam line with the previous strip, or -1
+    GIntBig nTopSeamRow = -1;
+    // Row index of the seam line with the next strip, or -1
+    GIntBig nBottomSeamRow = -1;
+};
+
+/************************************************************************/
+/*                           GPStripResult                              */
+/************************************************************************/
+
+// Result of the polygonization of a strip by a worker thread.
+template <class DataType> struct GPStripResult
+{
+    bool bOK = true;
+    // Polygons that do not touch a seam line, and are thus complete
+    std::vector<std::pair<std::unique_ptr<OGRPolygon>, DataType>>
+        aoCompletePolygons{};
+    std::vector<GPSeamPolygon<DataType>> aoSeamPolygons{};
+    // Pixel values (after masking) of the first and last lines of the
+    // strip, and index in aoSeamPolygons of the polygon they belong to
+    // (or -1 for masked pixels).
+    std::vector<DataType> anFirstLineVal{};
+    std::vector<DataType> anLastLineVal{};
+    std::vector<int> anFirstLineOwner{};
+    std::vector<int> anLastLineOwner{};
+};
+
+/************************************************************************/
+/*                        GPStripPolygonCollector                       */
+/************************************************************************/
+
+// Receives the polygons of a strip, and stores them, either as complete
+// georeferenced polygons or as seam polygons.
+template <class DataType>
+class GPStripPolygonCollector final : public PolygonReceiver<DataType>
+{
+    GPStripResult<DataType> &m_oResult;
+    const double *m_padfGeoTransform;
+    const IndexType m_nRowOffset;
+    const IndexType m_nRows;
+    const bool m_bHasPreviousStrip;
+    const bool m_bHasNextStrip;
+
+  public:
+    GPStripPolygonCollector(GPStripResult<DataType> &oResult,
+                            const double *padfGeoTransform,
+                            IndexType nRowOffset, IndexType nRows,
+                            bool bHasPreviousStrip, bool bHasNextStrip)
+        : m_oResult(oResult), m_padfGeoTransform(padfGeoTransform),
+          m_nRowOffset(nRowOffset), m_nRows(nRows),
+          m_bHasPreviousStrip(bHasPreviousStrip),
+          m_bHasNextStrip(bHasNextStrip)
+    {
+    }
+
+    void receive(RPolygon *poPolygon, DataType nPolygonCellValue) override;
+
+    CPL_DISALLOW_COPY_ASSIGN(GPStripPolygonCollector)
+};
+
+template <class DataType>
+void GPStripPolygonCollector<DataType>::receive(RPolygon *poPolygon,
+                                                DataType nPolygonCellValue)
+{
+    // Same ring construction as OGRPolygonWriter::receive()
+    std::vector<Arc> aoRings;
+    std::vector<bool> oAccessedArc(poPolygon->oArcs.size(), false);
+    bool bTouchesTop = false;
+    bool bTouchesBottom = false;
+    for (size_t iFirstArcIndex = 0; iFirstArcIndex < oAccessedArc.size();
+         ++iFirstArcIndex)
+    {
+        if (oAccessedArc[iFirstArcIndex])
+            continue;
+        Arc oRing;
+        size_t iArcIndex = iFirstArcIndex;
+        do
+        {
+            oAccessedArc[iArcIndex] = true;
+            const auto &oArc = poPolygon->oArcs[iArcIndex];
+            const size_t nArcPointCount = oArc.poArc->size();
+            for (size_t i = 0; i < nArcPointCount; ++i)
+            {
+                Point oPixel = (*oArc.poArc)[oArc.bFollowRighthand
+                                                 ? i
+                                                 : (nArcPointCount - i - 1)];
+                if (oPixel[0] == 0)
+                    bTouchesTop = true;
+                else if (oPixel[0] == m_nRows)
+                    bTouchesBottom = true;
+                oPixel[0] += m_nRowOffset;
+                oRing.push_back(oPixel);
+            }
+            iArcIndex = oArc.nConnection;
+        } while (iArcIndex != iFirstArcIndex);
+        aoRings.push_back(std::move(oRing));
+    }
+    bTouchesTop = bTouchesTop && m_bHasPreviousStrip;
+    bTouchesBottom = bTouchesBottom && m_bHasNextStrip;
+
+    if (!bTouchesTop && !bTouchesBottom)
+    {
+        m_oResult.aoCompletePolygons.emplace_back(
+            GPRingsToPolygon(aoRings, m_padfGeoTransform), nPolygonCellValue);
+        return;
+    }
+
+    // Record which pixels of the first and last lines belong to this
+    // polygon: those are the ones whose top (resp. bottom) edge is part
+    // of its boundary.
+    const int nSeamPolygonIdx =
+        static_cast<int>(m_oResult.aoSeamPolygons.size());
+    const auto MarkOwner = [nSeamPolygonIdx](const Point &oStart,
+                                             const Point &oEnd, IndexType nRow,
+                                             std::vector<int> &anOwner)
+    {
+        if (oStart[0] == nRow && oEnd[0] == nRow)
+        {
+            const IndexType nMinCol = std::min(oStart[1], oEnd[1]);
+            const IndexType nMaxCol = std::max(oStart[1], oEnd[1]);
+            for (IndexType iCol = nMinCol; iCol < nMaxCol; ++iCol)
+                anOwner[iCol] = nSeamPolygonIdx;
+        }
+    };
+    for (const auto &oRing : aoRings)
+    {
+        for (size_t i = 0; i < oRing.size(); ++i)
+        {
+            const Point &oStart = oRing[i];
+            const Point &oEnd = oRing[(i + 1) % oRing.size()];
+            if (bTouchesTop)
+                MarkOwner(oStart, oEnd, m_nRowOffset,
+                          m_oResult.anFirstLineOwner);
+            if (bTouchesBottom)
+                MarkOwner(oStart, oEnd, m_nRowOffset + m_nRows,
+                          m_oResult.anLastLineOwner);
+        }
+    }
+
+    GPSeamPolygon<DataType> oSeamPolygon;
+    oSeamPolygon.nValue = nPolygonCellValue;
+    oSeamPolygon.aoRings = std::move(aoRings);
+    if (bTouchesTop)
+        oSeamPolygon.nTopSeamRow = m_nRowOffset;
+    if (bTouchesBottom)
+        oSeamPolygon.nBottomSeamRow = m_nRowOffset + m_nRows;
+    m_oResult.aoSeamPolygons.push_back(std::move(oSeamPolygon));
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                         GPPolygonizeStrip()                          */
+/************************************************************************/
+
+// Polygonizes in memory the nRows x nXSize pixel values of panVal, which
+// have already been masked, as GDALPolygonizeT() does for a whole band.
+template <class DataType, class EqualityTest>
+static bool GPPolygonizeStrip(DataType *panVal, int nXSize, int nRows,
+                              int nConnectedness,
+                              PolygonReceiver<DataType> *poReceiver)
+{
+    try
+    {
+        const size_t nXSizeT = static_cast<size_t>(nXSize);
+        std::vector<GInt32> anLastLineId(nXSize);
+        std::vector<GInt32> anThisLineId(nXSize);
+
+        GDALRasterPolygonEnumeratorT<DataType, EqualityTest> oFirstEnum(
+            nConnectedness);
+        for (int iY = 0; iY < nRows; iY++)
+        {
+            DataType *panThisLineVal = panVal + iY * nXSizeT;
+            if (!oFirstEnum.ProcessLine(
+                    iY == 0 ? nullptr : panThisLineVal - nXSizeT,
+                    panThisLineVal, iY == 0 ? nullptr : anLastLineId.data(),
+                    anThisLineId.data(), nXSize))
+            {
+                return false;
+            }
+            std::swap(anLastLineId, anThisLineId);
+        }
+        oFirstEnum.CompleteMerges();
+
+        GDALRasterPolygonEnumeratorT<DataType, EqualityTest> oSecondEnum(
+            nConnectedness);
+        Polygonizer<GInt32, DataType> oPolygonizer{-1, poReceiver};
+        std::vector<TwoArm> aoLastLineArm(nXSize + 2);
+        std::vector<TwoArm> aoThisLineArm(nXSize + 2);
+        for (auto &oArm : aoLastLineArm)
+            oArm.poPolyInside = oPolygonizer.getTheOuterPolygon();
+        std::vector<GInt32> anFinalId(nXSize);
+
+        for (int iY = 0; iY < nRows + 1; iY++)
+        {
+            const DataType *panLastLineVal =
+                iY == 0 ? panVal : panVal + (iY - 1) * nXSizeT;
+            if (iY == nRows)
+            {
+                std::fill(anFinalId.begin(), anFinalId.end(),
+                          decltype(oPolygonizer)::THE_OUTER_POLYGON_ID);
+            }
+            else
+            {
+                DataType *panThisLineVal = panVal + iY * nXSizeT;
+                if (!oSecondEnum.ProcessLine(
+                        iY == 0 ? nullptr : panThisLineVal - nXSizeT,
+                        panThisLineVal, iY == 0 ? nullptr : anLastLineId.data(),
+                        anThisLineId.data(), nXSize))
+                {
+                    return false;
+                }
+                for (int iX = 0; iX < nXSize; iX++)
+                {
+                    anFinalId[iX] =
+                        anThisLineId[iX] == -1
+                            ? -1
+                            : oFirstEnum.panPolyIdMap[anThisLineId[iX]];
+                }
+                std::swap(anLastLineId, anThisLineId);
+            }
+
+            if (!oPolygonizer.processLine(
+                    anFinalId.data(), panLastLineVal, aoThisLineArm.data(),
+                    aoLastLineArm.data(), iY, nXSize))
+            {
+                return false;
+            }
+            std::swap(aoThisLineArm, aoLastLineArm);
+        }
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory in GPPolygonizeStrip()");
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                        GPStitchSeamPolygons()                        */
+/************************************************************************/
+
+// Builds the polygon made of seam polygons of successive strips that belong
+// to the same connected component. This is done by stitching their boundary
+// arcs: the unit segments of the seam lines shared by two of them cancel
+// out, and the remaining directed segments are linked back into rings.
+// Returns the rings, with the same conventions as the ones of the
+// Polygonizer: the exterior ring comes first, and the area of each ring is
+// on the right-hand side of its edges, when going from its top left vertex.
+template <class DataType>
+static bool GPStitchSeamPolygons(
+    const std::vector<const GPSeamPolygon<DataType> *> &apoParts,
+    std::vector<Arc> &aoRings)
+{
+    struct Edge
+    {
+        GIntBig nX0, nY0, nX1, nY1;
+    };
+
+    const auto RingDoubleArea = [](const Arc &oRing)
+    {
+        GIntBig nArea = 0;
+        for (size_t i = 0; i < oRing.size(); ++i)
+        {
+            const Point &oA = oRing[i];
+            const Point &oB = oRing[(i + 1) % oRing.size()];
+            nArea += static_cast<GIntBig>(oA[1]) * oB[0] -
+                     static_cast<GIntBig>(oB[1]) * oA[0];
+        }
+        return nArea;
+    };
+
+    // Collect the edges of all parts, with rings oriented so that their
+    // area is on the left-hand side of the edges, in the (column, row)
+    // frame. Horizontal edges on seam lines are split into unit segments.
+    std::vector<Edge> asEdges;
+    std::vector<Edge> asSeamSegments;
+    std::map<std::pair<GIntBig, GIntBig>, int> oMapSeamSegmentCount;
+    for (const auto *poPart : apoParts)
+    {
+        size_t iExteriorRing = 0;
+        GIntBig nMaxAbsArea = -1;
+        std::vector<GIntBig> anAreas;
+        for (size_t iRing = 0; iRing < poPart->aoRings.size(); ++iRing)
+        {
+            anAreas.push_back(RingDoubleArea(poPart->aoRings[iRing]));
+            if (std::abs(anAreas.back()) > nMaxAbsArea)
+            {
+                nMaxAbsArea = std::abs(anAreas.back());
+                iExteriorRing = iRing;
+            }
+        }
+
+        for (size_t iRing = 0; iRing < poPart->aoRings.size(); ++iRing)
+        {
+            const Arc &oRing = poPart->aoRings[iRing];
+            const bool bReverse = iRing == iExteriorRing ? anAreas[iRing] < 0
+                                                         : anAreas[iRing] > 0;
+            const size_t nPoints = oRing.size();
+            for (size_t i = 0; i < nPoints; ++i)
+            {
+                const Point &oA = oRing[bReverse ? nPoints - 1 - i : i];
+                const Point &oB =
+                    oRing[bReverse ? (2 * nPoints - 2 - i) % nPoints
+                                   : (i + 1) % nPoints];
+                const Edge sEdge{oA[1], oA[0], oB[1], oB[0]};
+                if (sEdge.nX0 == sEdge.nX1 && sEdge.nY0 == sEdge.nY1)
+                    continue;
+                if (sEdge.nX0 != sEdge.nX1 && sEdge.nY0 != sEdge.nY1)
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "GPStitchSeamPolygons(): unexpected edge");
+                    return false;
+                }
+                if (sEdge.nY0 == sEdge.nY1 &&
+                    (sEdge.nY0 == poPart->nTopSeamRow ||
+                     sEdge.nY0 == poPart->nBottomSeamRow))
+                {
+                    const GIntBig nStep = sEdge.nX1 > sEdge.nX0 ? 1 : -1;
+                    for (GIntBig nX = sEdge.nX0; nX != sEdge.nX1; nX += nStep)
+                    {
+                        asSeamSegments.push_back(
+                            Edge{nX, sEdge.nY0, nX + nStep, sEdge.nY0});
+                        ++oMapSeamSegmentCount[std::make_pair(
+                            sEdge.nY0, std::min(nX, nX + nStep))];
+                    }
+                }
+                else
+                {
+                    asEdges.push_back(sEdge);
+                }
+            }
+        }
+    }
+
+    // Segments of a seam line shared by the parts on both sides of it are
+    // not on the boundary of their union.
+    for (const Edge &sSegment : asSeamSegments)
+    {
+        if (oMapSeamSegmentCount[std::make_pair(
+                sSegment.nY0, std::min(sSegment.nX0, sSegment.nX1))] == 1)
+        {
+            asEdges.push_back(sSegment);
+        }
+    }
+
+    // Index edges by their start vertex
+    std::sort(asEdges.begin(), asEdges.end(),
+              [](const Edge &a, const Edge &b)
+              {
+                  return a.nY0 < b.nY0 || (a.nY0 == b.nY0 && a.nX0 < b.nX0);
+              });
+
+    // Returns the index of the edge following iEdge in its ring. At a
+    // vertex shared by two pixels of the polygon that only touch by their
+    // corner, the two pixels are joined through it, as the Polygonizer
+    // does: the ring turns right, keeping the area on the left-hand side.
+    const auto GetNextEdge = [&asEdges](size_t iEdge) -> size_t
+    {
+        const Edge &sEdge = asEdges[iEdge];
+        const auto oIter = std::lower_bound(
+            asEdges.begin(), asEdges.end(), sEdge,
+            [](const Edge &a, const Edge &b)
+            { return a.nY0 < b.nY1 || (a.nY0 == b.nY1 && a.nX0 < b.nX1); });
+        size_t iNext = asEdges.size();
+        for (auto oCandidate = oIter;
+             oCandidate != asEdges.end() && oCandidate->nY0 == sEdge.nY1 &&
+             oCandidate->nX0 == sEdge.nX1;
+             ++oCandidate)
+        {
+            const GIntBig nCross =
+                (sEdge.nX1 - sEdge.nX0) * (oCandidate->nY1 - oCandidate->nY0) -
+                (sEdge.nY1 - sEdge.nY0) * (oCandidate->nX1 - oCandidate->nX0);
+            if (iNext == asEdges.size() || nCross < 0)
+                iNext = static_cast<size_t>(oCandidate - asEdges.begin());
+        }
+        return iNext;
+    };
+
+    std::vector<bool> abUsed(asEdges.size());
+    std::vector<std::pair<GIntBig, Arc>> aoRingsWithArea;
+    for (size_t iFirstEdge = 0; iFirstEdge < asEdges.size(); ++iFirstEdge)
+    {
+        if (abUsed[iFirstEdge])
+            continue;
+        Arc oRing;
+        size_t iEdge = iFirstEdge;
+        do
+        {
+            if (iEdge == asEdges.size() || abUsed[iEdge])
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "GPStitchSeamPolygons(): cannot close ring");
+                return false;
+            }
+            abUsed[iEdge] = true;
+            oRing.push_back(Point{static_cast<IndexType>(asEdges[iEdge].nY0),
+                                  static_cast<IndexType>(asEdges[iEdge].nX0)});
+            iEdge = GetNextEdge(iEdge);
+        } while (iEdge != iFirstEdge);
+
+        // Remove the vertices in the middle of straight lines, such as the
+        // ones of unit seam segments.
+        Arc oSimplifiedRing;
+        const size_t nPoints = oRing.size();
+        size_t iTopLeft = 0;
+        for (size_t i = 0; i < nPoints; ++i)
+        {
+            const Point &oPrev = oRing[(i + nPoints - 1) % nPoints];
+            const Point &oCur = oRing[i];
+            const Point &oNext = oRing[(i + 1) % nPoints];
+            if ((oPrev[0] == oCur[0] && oCur[0] == oNext[0]) ||
+                (oPrev[1] == oCur[1] && oCur[1] == oNext[1]))
+            {
+                continue;
+            }
+            if (!oSimplifiedRing.empty() &&
+                (oCur[0] < oSimplifiedRing[iTopLeft][0] ||
+                 (oCur[0] == oSimplifiedRing[iTopLeft][0] &&
+                  oCur[1] < oSimplifiedRing[iTopLeft][1])))
+            {
+                iTopLeft = oSimplifiedRing.size();
+            }
+            oSimplifiedRing.push_back(oCur);
+        }
+
+        // Reverse the ring, so that its area is on its right-hand side, and
+        // start it from its top left vertex.
+        Arc oFinalRing;
+        oFinalRing.reserve(oSimplifiedRing.size());
+        for (size_t i = 0; i < oSimplifiedRing.size(); ++i)
+        {
+            oFinalRing.push_back(
+                oSimplifiedRing[(iTopLeft + oSimplifiedRing.size() - i) %
+                                oSimplifiedRing.size()]);
+        }
+        const GIntBig nArea = RingDoubleArea(oRing);
+        aoRingsWithArea.emplace_back(nArea, std::move(oFinalRing));
+    }
+
+    // The exterior ring is the one with the largest positive area (area on
+    // the left-hand side before reversal).
+    size_t iExteriorRing = aoRingsWithArea.size();
+    for (size_t i = 0; i < aoRingsWithArea.size(); ++i)
+    {
+        if (aoRingsWithArea[i].first > 0 &&
+            (iExteriorRing == aoRingsWithArea.size() ||
+             aoRingsWithArea[i].first > aoRingsWithArea[iExteriorRing].first))
+        {
+            iExteriorRing = i;
+        }
+    }
+    if (iExteriorRing == aoRingsWithArea.size())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "GPStitchSeamPolygons(): no exterior ring");
+        return false;
+    }
+    aoRings.clear();
+    aoRings.push_back(std::move(aoRingsWithArea[iExteriorRing].second));
+    for (size_t i = 0; i < aoRingsWithArea.size(); ++i)
+    {
+        if (i != iExteriorRing)
+            aoRings.push_back(std::move(aoRingsWithArea[i].second));
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                    GDALPolygonizeMultiThreadedT()                    */
+/************************************************************************/
+
+// Polygonizes strips of nRowsPerStrip rows in parallel. Source pixels are
+// read, and features are written, on the calling thread, since drivers are
+// not thread-safe. Polygons that do not touch the seam line between two
+// strips are written as soon as their strip is processed. The others are
+// kept, and linked with the polygons of the next strip that they are
+// connected to, until the connected component they belong to does not
+// extend further. Its parts are then stitched into a single polygon.
+template <class DataType, class EqualityTest>
+static CPLErr GDALPolygonizeMultiThreadedT(
+    GDALRasterBandH hSrcBand, GDALRasterBandH hMaskBand, OGRLayerH hOutLayer,
+    int iPixValField, int nConnectedness, const double *padfGeoTransform,
+    int nThreads, int nRowsPerStrip, GDALProgressFunc pfnProgress,
+    void *pProgressArg, GDALDataType eDT)
+{
+    CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    if (!poThreadPool)
+        return CE_Failure;
+    auto poJobQueue = poThreadPool->CreateJobQueue();
+
+    const int nXSize = GDALGetRasterBandXSize(hSrcBand);
+    const int nYSize = GDALGetRasterBandYSize(hSrcBand);
+    const int nStrips = DIV_ROUND_UP(nYSize, nRowsPerStrip);
+
+    OGRLayer *poOutLayer = OGRLayer::FromHandle(hOutLayer);
+    OGRFeature oFeature(poOutLayer->GetLayerDefn());
+    const auto WritePolygon =
+        [poOutLayer, &oFeature, iPixValField](
+            std::unique_ptr<OGRPolygon> poPolygon, DataType nValue)
+    {
+        oFeature.SetFID(OGRNullFID);
+        oFeature.SetGeometryDirectly(poPolygon.release());
+        if (iPixValField >= 0)
+            oFeature.SetField(iPixValField, static_cast<double>(nValue));
+        return poOutLayer->CreateFeature(&oFeature) == OGRERR_NONE;
+    };
+
+    // Seam polygons not yet written, indexed by a global id, and union-find
+    // structure of the connected components they belong to.
+    std::map<int, GPSeamPolygon<DataType>> oMapPendingSeamPolygons;
+    std::map<int, int> oMapParent;
+    const auto FindRoot = [&oMapParent](int nId)
+    {
+        int nRoot = nId;
+        while (oMapParent[nRoot] != nRoot)
+            nRoot = oMapParent[nRoot];
+        while (oMapParent[nId] != nRoot)
+        {
+            const int nNext = oMapParent[nId];
+            oMapParent[nId] = nRoot;
+            nId = nNext;
+        }
+        return nRoot;
+    };
+    int nNextSeamPolygonId = 0;
+
+    // Last line of the previously processed strip
+    std::vector<DataType> anPrevLastLineVal;
+    std::vector<int> anPrevLastLineOwner;
+    int nPrevFirstSeamPolygonId = 0;
+
+    EqualityTest eq;
+    CPLErr eErr = CE_None;
+
+    const auto ProcessStripResult = [&](GPStripResult<DataType> &oResult,
+                                        int iStrip)
+    {
+        for (auto &oPolygonAndValue : oResult.aoCompletePolygons)
+        {
+            if (!WritePolygon(std::move(oPolygonAndValue.first),
+                              oPolygonAndValue.second))
+                return false;
+        }
+        oResult.aoCompletePolygons.clear();
+
+        const int nFirstSeamPolygonId = nNextSeamPolygonId;
+        for (auto &oSeamPolygon : oResult.aoSeamPolygons)
+        {
+            oMapParent[nNextSeamPolygonId] = nNextSeamPolygonId;
+            oMapPendingSeamPolygons[nNextSeamPolygonId] =
+                std::move(oSeamPolygon);
+            ++nNextSeamPolygonId;
+        }
+
+        // Link the polygons of the first line of this strip with the ones
+        // of the last line of the previous strip they are connected to.
+        if (iStrip > 0)
+        {
+            for (int iX = 0; iX < nXSize; ++iX)
+            {
+                const int iOwner = oResult.anFirstLineOwner[iX];
+                if (iOwner < 0)
+                    continue;
+                for (int iPrevX = std::max(0, iX - 1);
+                     iPrevX <= std::min(nXSize - 1, iX + 1); ++iPrevX)
+                {
+                    if (iPrevX != iX && nConnectedness != 8)
+                        continue;
+                    const int iPrevOwner = anPrevLastLineOwner[iPrevX];
+                    if (iPrevOwner >= 0 &&
+                        eq(anPrevLastLineVal[iPrevX],
+                           oResult.anFirstLineVal[iX]))
+                    {
+                        const int nRoot1 =
+                            FindRoot(nPrevFirstSeamPolygonId + iPrevOwner);
+                        const int nRoot2 =
+                            FindRoot(nFirstSeamPolygonId + iOwner);
+                        if (nRoot1 != nRoot2)
+                            oMapParent[std::max(nRoot1, nRoot2)] =
+                                std::min(nRoot1, nRoot2);
+                    }
+                }
+            }
+        }
+
+        // Connected components that touch the last line of this strip may
+        // still extend to the next one.
+        std::set<int> oSetOpenRoots;
+        if (iStrip + 1 < nStrips)
+        {
+            for (int iX = 0; iX < nXSize; ++iX)
+            {
+                const int iOwner = oResult.anLastLineOwner[iX];
+                if (iOwner >= 0)
+                    oSetOpenRoots.insert(
+                        FindRoot(nFirstSeamPolygonId + iOwner));
+            }
+        }
+
+        // Stitch and write the other ones.
+        std::map<int, std::vector<int>> oMapComponents;
+        for (const auto &oIter : oMapPendingSeamPolygons)
+        {
+            const int nRoot = FindRoot(oIter.first);
+            if (oSetOpenRoots.find(nRoot) == oSetOpenRoots.end())
+                oMapComponents[nRoot].push_back(oIter.first);
+        }
+        for (const auto &oComponent : oMapComponents)
+        {
+            const auto &oFirstPart =
+                oMapPendingSeamPolygons[oComponent.second.front()];
+            std::unique_ptr<OGRPolygon> poPolygon;
+            if (oComponent.second.size() == 1)
+            {
+                poPolygon =
+                    GPRingsToPolygon(oFirstPart.aoRings, padfGeoTransform);
+            }
+            else
+            {
+                std::vector<const GPSeamPolygon<DataType> *> apoParts;
+                for (int nId : oComponent.second)
+                    apoParts.push_back(&oMapPendingSeamPolygons[nId]);
+                std::vector<Arc> aoRings;
+                if (!GPStitchSeamPolygons(apoParts, aoRings))
+                    return false;
+                poPolygon = GPRingsToPolygon(aoRings, padfGeoTransform);
+            }
+            if (!WritePolygon(std::move(poPolygon), oFirstPart.nValue))
+                return false;
+            for (int nId : oComponent.second)
+            {
+                oMapPendingSeamPolygons.erase(nId);
+                oMapParent.erase(nId);
+            }
+        }
+
+        anPrevLastLineVal = std::move(oResult.anLastLineVal);
+        anPrevLastLineOwner = std::move(oResult.anLastLineOwner);
+        nPrevFirstSeamPolygonId = nFirstSeamPolygonId;
+        return true;
+    };
+
+    struct PendingStrip
+    {
+        std::unique_ptr<GPStripResult<DataType>> poResult{};
+        int iStrip = 0;
+        std::future<void> oFuture{};
+    };
+
+    std::deque<PendingStrip> aoPending;
+
+    const auto ProcessOldestStrip = [&]()
+    {
+        PendingStrip &oPending = aoPending.front();
+        oPending.oFuture.wait();
+        if (eErr == CE_None && !oPending.poResult->bOK)
+            eErr = CE_Failure;
+        if (eErr == CE_None &&
+            !ProcessStripResult(*(oPending.poResult), oPending.iStrip))
+            eErr = CE_Failure;
+        if (eErr == CE_None &&
+            !pfnProgress(static_cast<double>(oPending.iStrip + 1) / nStrips,
+                         "", pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+        }
+        aoPending.pop_front();
+    };
+
+    std::vector<GByte> abyMask;
+    for (int iStrip = 0; iStrip < nStrips && eErr == CE_None; ++iStrip)
+    {
+        const int nYOff = iStrip * nRowsPerStrip;
+        const int nRows = std::min(nRowsPerStrip, nYSize - nYOff);
+        const size_t nPixels = static_cast<size_t>(nXSize) * nRows;
+
+        PendingStrip oPending;
+        oPending.iStrip = iStrip;
+        std::shared_ptr<std::vector<DataType>> panVal;
+        try
+        {
+            oPending.poResult = std::make_unique<GPStripResult<DataType>>();
+            panVal = std::make_shared<std::vector<DataType>>(nPixels);
+            if (hMaskBand)
+                abyMask.resize(nPixels);
+            oPending.poResult->anFirstLineOwner.resize(nXSize, -1);
+            oPending.poResult->anLastLineOwner.resize(nXSize, -1);
+        }
+        catch (const std::bad_alloc &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Out of memory in GDALPolygonize()");
+            eErr = CE_Failure;
+            break;
+        }
+
+        eErr = GDALRasterIO(hSrcBand, GF_Read, 0, nYOff, nXSize, nRows,
+                            panVal->data(), nXSize, nRows, eDT, 0, 0);
+        if (eErr == CE_None && hMaskBand != nullptr)
+            eErr = GPMaskImageData(hMaskBand, abyMask.data(), nYOff, nXSize,
+                                   nRows, panVal->data());
+        if (eErr != CE_None)
+            break;
+
+        GPStripResult<DataType> *poResult = oPending.poResult.get();
+        auto poPromise = std::make_shared<std::promise<void>>();
+        oPending.oFuture = poPromise->get_future();
+        poJobQueue->SubmitJob(
+            [poResult, poPromise, panVal, padfGeoTransform, nXSize, nYOff,
+             nRows, nConnectedness, iStrip, nStrips]()
+            {
+                try
+                {
+                    poResult->anFirstLineVal.assign(panVal->begin(),
+                                                    panVal->begin() + nXSize);
+                    poResult->anLastLineVal.assign(panVal->end() - nXSize,
+                                                   panVal->end());
+                    GPStripPolygonCollector<DataType> oCollector(
+                        *poResult, padfGeoTransform,
+                        static_cast<IndexType>(nYOff),
+                        static_cast<IndexType>(nRows), iStrip > 0,
+                        iStrip + 1 < nStrips);
+                    poResult->bOK = GPPolygonizeStrip<DataType, EqualityTest>(
+                        panVal->data(), nXSize, nRows, nConnectedness,
+                        &oCollector);
+                }
+                catch (const std::bad_alloc &)
+                {
+                    CPLError(CE_Failure, CPLE_OutOfMemory,
+                             "Out of memory in GDALPolygonize()");
+                    poResult->bOK = false;
+                }
+                // Free the strip pixel values as soon as possible
+                panVal->clear();
+                panVal->shrink_to_fit();
+                poPromise->set_value();
+            });
+        aoPending.push_back(std::move(oPending));
+
+        if (static_cast<int>(aoPending.size()) > nThreads)
+            ProcessOldestStrip();
+    }
+
+    // In case of error, the remaining strips are still waited for, but
+    // their polygons are not written.
+    while (!aoPending.empty())
+        ProcessOldestStrip();
+
+    return eErr;
+}
+
 /************************************************************************/
 /*                           GDALPolygonizeT()                          */
 /************************************************************************/
@@ -166,6 +988,26 @@ static CPLErr GDALPolygonizeT(GDALRasterBandH hSrcBand,
         adfGeoTransform[5] = 1;
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Multi-threaded processing by strips.                            */
+    /* -------------------------------------------------------------------- */
+    const int nThreads = GPGetNumThreads(papszOptions);
+    // Strips of about 4 million pixels
+    const int nRowsPerStrip = GDALGetRowsPerStrip(
+        hSrcBand, nXSize, 4 * 1024 * 1024, "GDAL_POLYGONIZE_ROWS_PER_STRIP");
+    if (nThreads > 1 && nRowsPerStrip < nYSize)
+    {
+        CPLFree(panThisLineId);
+        CPLFree(panLastLineId);
+        CPLFree(panThisLineVal);
+        CPLFree(panLastLineVal);
+        CPLFree(pabyMaskLine);
+        return GDALPolygonizeMultiThreadedT<DataType, EqualityTest>(
+            hSrcBand, hMaskBand, hOutLayer, iPixValField, nConnectedness,
+            adfGeoTransform, nThreads, nRowsPerStrip, pfnProgress, pProgressArg,
+            eDT);
+    }
+
     /* -------------------------------------------------------------------- */
     /*      The first pass over the raster is only used to build up the     */
     /*      polygon id map so we will know in advance what polygons are     */
@@ -182,7 +1024,7 @@ static CPLErr GDALPolygonizeT(GDALRasterBandH hSrcBand,
                             nXSize, 1, eDT, 0, 0);
 
         if (eErr == CE_None && hMaskBand != nullptr)
-            eErr = GPMaskImageData(hMaskBand, pabyMaskLine, iY, nXSize,
+            eErr = GPMaskImageData(hMaskBand, pabyMaskLine, iY, nXSize, 1,
                                    panThisLineVal);
 
         if (eErr != CE_None)
@@ -270,7 +1112,7 @@ static CPLErr GDALPolygonizeT(GDALRasterBandH hSrcBand,
             eErr = GDALRasterIO(hSrcBand, GF_Read, 0, iY, nXSize, 1,
                                 panThisLineVal, nXSize, 1, eDT, 0, 0);
             if (eErr == CE_None && hMaskBand != nullptr)
-                eErr = GPMaskImageData(hMaskBand, pabyMaskLine, iY, nXSize,
+                eErr = GPMaskImageData(hMaskBand, pabyMaskLine, iY, nXSize, 1,
                                        panThisLineVal);
         }
 
@@ -489,6 +1331,11 @@ GBool GDALFloatEquals(float A, float B)
  * <li>DATASET_FOR_GEOREF=dataset_name: Name of a dataset from which to read
  * the geotransform. This useful if hSrcBand has no related dataset, which is
  * typical for mask bands.</li>
+ * <li>NUM_THREADS=number|ALL_CPUS: (GDAL >= 3.12) Number of worker threads
+ * used to polygonize horizontal strips of the raster concurrently. Defaults
+ * to 1. Reading of the raster and writing of the features are still done by
+ * the calling thread. When several threads are used, the order in which
+ * features are written differs from the single-threaded case.</li>
  * </ul>
  * @param pfnProgress callback for reporting algorithm progress matching the
  * GDALProgressFunc() semantics.  May be NULL.
@@ -563,6 +1410,11 @@ CPLErr CPL_STDCALL GDALPolygonize(GDALRasterBandH hSrcBand,
  * <li>DATASET_FOR_GEOREF=dataset_name: Name of a dataset from which to read
  * the geotransform. This useful if hSrcBand has no related dataset, which is
  * typical for mask bands.</li>
+ * <li>NUM_THREADS=number|ALL_CPUS: (GDAL >= 3.12) Number of worker threads
+ * used to polygonize horizontal strips of the raster concurrently. Defaults
+ * to 1. Reading of the raster and writing of the features are still done by
+ * the calling thread. When several threads are used, the order in which
+ * features are written differs from the single-threaded case.</li>
  * </ul>
  * @param pfnProgress callback for reporting algorithm progress matching the
  * GDALProgressFunc() semantics.  May be NULL.
@@ -14,21 +14,30 @@
 
 #include "cpl_port.h"
 #include "gdal_alg.h"
+#include "gdal_alg_priv.h"
 
 #include <cmath>
+#include <cstdlib>
 #include <cstring>
 
 #include <algorithm>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <new>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 
 /************************************************************************/
 /*                           GDALFilterLine()                           */
@@ -344,182 +353,340 @@ inline void QUAD_CHECK(double &dfQuadDist, float &fQuadValue, int target_x,
     }
 }
 
+namespace
+{
+
 /************************************************************************/
-/*                           GDALFillNodata()                           */
+/*                         GDALFillNodataParams                         */
 /************************************************************************/
 
-/**
- * Fill selected raster regions by interpolation from the edges.
- *
- * This algorithm will interpolate values for all designated
- * nodata pixels (marked by zeros in hMaskBand). For each pixel
- * a four direction conic search is done to find values to interpolate
- * from (using inverse distance weighting by default). Once all values are
- * interpolated, zero or more smoothing iterations (3x3 average
- * filters on interpolated pixels) are applied to smooth out
- * artifacts.
- *
- * This algorithm is generally suitable for interpolating missing
- * regions of fairly continuously varying rasters (such as elevation
- * models for instance). It is also suitable for filling small holes
- * and cracks in more irregularly varying images (like airphotos). It
- * is generally not so great for interpolating a raster from sparse
- * point data - see the algorithms defined in gdal_grid.h for that case.
- *
- * @param hTargetBand the raster band to be modified in place.
- * @param hMaskBand a mask band indicating pixels to be interpolated
- * (zero valued). If hMaskBand is set to NULL, this method will internally use
- * the mask band returned by GDALGetMaskBand(hTargetBand).
- * @param dfMaxSearchDist the maximum number of pixels to search in all
- * directions to find values to interpolate from.
- * @param bDeprecatedOption unused argument, should be zero.
- * @param nSmoothingIterations the number of 3x3 smoothing filter passes to
- * run (0 or more).
- * @param papszOptions additional name=value options in a string list.
- * <ul>
- * <li>TEMP_FILE_DRIVER=gdal_driver_name. For example MEM.</li>
- * <li>NODATA=value (starting with GDAL 2.4).
- * Source pixels at that value will be ignored by the interpolator. Warning:
- * currently this will not be honored by smoothing passes.</li>
- * <li>INTERPOLATION=INV_DIST/NEAREST (GDAL >= 3.9). By default, pixels are
- * interpolated using an inverse distance weighting (INV_DIST). It is also
- * possible to choose a nearest neighbour (NEAREST) strategy.</li>
- * </ul>
- * @param pfnProgress the progress function to report completion.
- * @param pProgressArg callback data for progress function.
- *
- * @return CE_None on success or CE_Failure if something goes wrong.
- */
-
-CPLErr CPL_STDCALL GDALFillNodata(GDALRasterBandH hTargetBand,
-                                  GDALRasterBandH hMaskBand,
-                                  double dfMaxSearchDist,
-                                  CPL_UNUSED int bDeprecatedOption,
-                                  int nSmoothingIterations, char **papszOptions,
-                                  GDALProgressFunc pfnProgress,
-                                  void *pProgressArg)
+// Parameters of the interpolation, shared by all the lines.
+struct GDALFillNodataParams
+{
+    double dfMaxSearchDist = 0.0;
+    int nMaxSearchDist = 0;
+    bool bNearest = false;
+    bool bHasNoData = false;
+    float fNoData = 0.0f;
+    // Special "y" value identifying columns without a candidate pixel.
+    GUInt32 nNoDataVal = 0;
+};
 
+enum Quadrants
 {
-    VALIDATE_POINTER1(hTargetBand, "GDALFillNodata", CE_Failure);
+    QUAD_TOP_LEFT = 0,
+    QUAD_BOTTOM_LEFT = 1,
+    QUAD_TOP_RIGHT = 2,
+    QUAD_BOTTOM_RIGHT = 3,
+};
 
-    const int nXSize = GDALGetRasterBandXSize(hTargetBand);
-    const int nYSize = GDALGetRasterBandYSize(hTargetBand);
+constexpr int QUAD_COUNT = 4;
 
-    if (dfMaxSearchDist == 0.0)
-        dfMaxSearchDist = std::max(nXSize, nYSize) + 1;
+// Size of the strips held in memory
+constexpr int FILLNODATA_PIXELS_PER_STRIP = 4 * 1024 * 1024;
 
-    const int nMaxSearchDist = static_cast<int>(floor(dfMaxSearchDist));
+/************************************************************************/
+/*                      GDALFillNodataQuadrantIndex                     */
+/************************************************************************/
 
-    const char *pszInterpolation =
-        CSLFetchNameValueDef(papszOptions, "INTERPOLATION", "INV_DIST");
-    const bool bNearest = EQUAL(pszInterpolation, "NEAREST");
-    if (!EQUAL(pszInterpolation, "INV_DIST") &&
-        !EQUAL(pszInterpolation, "NEAREST"))
+// Squared distance from each pixel of a line to the nearest candidate pixel
+// of each quadrant, computed in linear time for the whole line from the
+// lower envelopes of the candidates of the columns on each side.
+class GDALFillNodataQuadrantIndex
+{
+  public:
+    void Reserve(int nXSize)
     {
-        CPLError(CE_Failure, CPLE_NotSupported,
-                 "Unsupported interpolation method: %s", pszInterpolation);
-        return CE_Failure;
+        m_oEnvelope.Reserve(nXSize);
+        for (auto &adfMinDistSq : m_aadfMinDistSq)
+            adfMinDistSq.resize(nXSize);
     }
 
-    // Special "x" pixel values identifying pixels as special.
-    GDALDataType eType = GDT_UInt16;
-    GUInt32 nNoDataVal = 65535;
-
-    if (nXSize > 65533 || nYSize > 65533)
+    void Build(GUInt32 nNoDataVal, int iY, int nXSize,
+               const GUInt32 *panTopDownY, const GUInt32 *panBottomUpY)
     {
-        eType = GDT_UInt32;
-        nNoDataVal = 4000002;
+        BuildQuadrant(QUAD_TOP_LEFT, true, nNoDataVal, iY, nXSize,
+                      panTopDownY);
+        BuildQuadrant(QUAD_BOTTOM_LEFT, true, nNoDataVal, iY, nXSize,
+                      panBottomUpY);
+        BuildQuadrant(QUAD_TOP_RIGHT, false, nNoDataVal, iY, nXSize,
+                      panTopDownY);
+        BuildQuadrant(QUAD_BOTTOM_RIGHT, false, nNoDataVal, iY, nXSize,
+                      panBottomUpY);
     }
 
-    /* -------------------------------------------------------------------- */
-    /*      Determine format driver for temp work files.                    */
-    /* -------------------------------------------------------------------- */
-    CPLString osTmpFileDriver =
-        CSLFetchNameValueDef(papszOptions, "TEMP_FILE_DRIVER", "GTiff");
-    GDALDriverH hDriver = GDALGetDriverByName(osTmpFileDriver.c_str());
-
-    if (hDriver == nullptr)
+    double GetMinDistSq(int iQuad, int iX) const
     {
-        CPLError(CE_Failure, CPLE_AppDefined,
-                 "TEMP_FILE_DRIVER=%s driver is not registered",
-                 osTmpFileDriver.c_str());
-        return CE_Failure;
+        return m_aadfMinDistSq[iQuad][iX];
     }
 
-    if (GDALGetMetadataItem(hDriver, GDAL_DCAP_CREATE, nullptr) == nullptr)
-    {
-        CPLError(CE_Failure, CPLE_AppDefined,
-                 "TEMP_FILE_DRIVER=%s driver is incapable of creating "
-                 "temp work files",
-                 osTmpFileDriver.c_str());
-        return CE_Failure;
-    }
+  private:
+    GDALParabolaLowerEnvelope m_oEnvelope{};
+    std::vector<double> m_aadfMinDistSq[QUAD_COUNT]{};
 
-    CPLStringList aosWorkFileOptions;
-    if (osTmpFileDriver == "GTiff")
+    // Left quadrants include the column of the pixel, right quadrants do
+    // not, except for the last column, as in the exhaustive search. Columns
+    // are numbered from the side of the quadrant, so that the envelope
+    // always receives them in increasing order.
+    void BuildQuadrant(int iQuad, bool bLeft, GUInt32 nNoDataVal, int iY,
+                       int nXSize, const GUInt32 *panY)
     {
-        aosWorkFileOptions.SetNameValue("COMPRESS", "LZW");
-        aosWorkFileOptions.SetNameValue("BIGTIFF", "IF_SAFER");
+        double *padfMinDistSq = m_aadfMinDistSq[iQuad].data();
+        m_oEnvelope.Reset();
+        for (int i = 0; i < nXSize; i++)
+        {
+            const int iX = bLeft ? i : nXSize - 1 - i;
+            if (!bLeft && i > 0)
+                padfMinDistSq[iX] = m_oEnvelope.GetMin(i);
+            if (panY[iX] != nNoDataVal)
+            {
+                const double dfDY =
+                    static_cast<double>(panY[iX]) - static_cast<double>(iY);
+                m_oEnvelope.Add(i, dfDY * dfDY);
+            }
+            if (bLeft || i == 0)
+                padfMinDistSq[iX] = m_oEnvelope.GetMin(i);
+        }
     }
+};
 
-    const CPLString osTmpFile = CPLGenerateTempFilenameSafe("");
+}  // namespace
 
-    std::unique_ptr<GDALDataset> poTmpMaskDS;
-    if (hMaskBand == nullptr)
-    {
-        hMaskBand = GDALGetMaskBand(hTargetBand);
-    }
-    else if (nSmoothingIterations > 0 &&
-             hMaskBand != GDALGetMaskBand(hTargetBand))
+/************************************************************************/
+/*                         GDALFillNodataLine()                         */
+/*                                                                      */
+/*      Interpolate the nodata pixels of one line, from the nearest     */
+/*      candidates found above (top-down pass) and below (bottom-up     */
+/*      pass of the next line) in each column.                          */
+/************************************************************************/
+
+static void
+GDALFillNodataLine(const GDALFillNodataParams &sParams, int iY, int nXSize,
+                   const GUInt32 *panTopDownY, const float *pafTopDownValue,
+                   const GUInt32 *panBottomUpY, const float *pafBottomUpValue,
+                   GByte *pabyMask, float *pafScanline, GByte *pabyFiltMask,
+                   GDALFillNodataQuadrantIndex *poIndex)
+{
+    const double dfMaxSearchDist = sParams.dfMaxSearchDist;
+    const int nMaxSearchDist = sParams.nMaxSearchDist;
+    const GUInt32 nNoDataVal = sParams.nNoDataVal;
+    const bool bHasNoData = sParams.bHasNoData;
+    const float fNoData = sParams.fNoData;
+
+    if (poIndex)
+        poIndex->Build(nNoDataVal, iY, nXSize, panTopDownY, panBottomUpY);
+    const GUInt32 *const apanQuadY[QUAD_COUNT] = {panTopDownY, panBottomUpY,
+                                                  panTopDownY, panBottomUpY};
+    const float *const apafQuadValue[QUAD_COUNT] = {
+        pafTopDownValue, pafBottomUpValue, pafTopDownValue, pafBottomUpValue};
+
+    memset(pabyFiltMask, 0, nXSize);
+    for (int iX = 0; iX < nXSize; iX++)
     {
-        // If doing smoothing operations and the user provided its own
-        // mask band, we must make a copy of it to be able to update it
-        // when we fill pixels during the initial pass.
-        const CPLString osMaskTmpFile = osTmpFile + "fill_mask_work.tif";
-        poTmpMaskDS.reset(GDALDataset::FromHandle(
-            GDALCreate(hDriver, osMaskTmpFile, nXSize, nYSize, 1, GDT_Byte,
-                       aosWorkFileOptions.List())));
-        if (poTmpMaskDS == nullptr)
+        int nThisMaxSearchDist = nMaxSearchDist;
+
+        // If this was a valid target - no change.
+        if (pabyMask[iX])
+            continue;
+
+        double adfQuadDist[QUAD_COUNT] = {};
+        float afQuadValue[QUAD_COUNT] = {};
+
+        for (int iQuad = 0; iQuad < QUAD_COUNT; iQuad++)
         {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Could not create poTmpMaskDS work file. Check driver "
-                     "capabilities.");
-            return CE_Failure;
+            adfQuadDist[iQuad] = dfMaxSearchDist + 1.0;
+            afQuadValue[iQuad] = 0.0;
         }
-        poTmpMaskDS->MarkSuppressOnClose();
-        auto hTmpMaskBand =
-            GDALRasterBand::ToHandle(poTmpMaskDS->GetRasterBand(1));
-        if (GDALRasterBandCopyWholeRaster(hMaskBand, hTmpMaskBand, nullptr,
-                                          nullptr, nullptr) != CE_None)
+
+        if (poIndex)
         {
-            return CE_Failure;
+            // Only step through the columns that may hold the nearest
+            // candidates of each quadrant, in the same order as the
+            // exhaustive search below, so that ties are resolved in the same
+            // way.
+            const int nLastCheckStep = nMaxSearchDist & ~0x3;
+            double dfMaxDistAtLastCheck = 0.0;
+            for (int iQuad = 0; iQuad < QUAD_COUNT; iQuad++)
+            {
+                const bool bLeft =
+                    iQuad == QUAD_TOP_LEFT || iQuad == QUAD_BOTTOM_LEFT;
+                const double dfMinDistSq = poIndex->GetMinDistSq(iQuad, iX);
+                double dfDistAtLastCheck = adfQuadDist[iQuad];
+                if (dfMinDistSq < adfQuadDist[iQuad] * adfQuadDist[iQuad])
+                {
+                    const int nLastStep = static_cast<int>(std::min(
+                        static_cast<double>(nMaxSearchDist),
+                        std::floor(std::sqrt(dfMinDistSq))));
+                    for (int iStep = bLeft ? 0 : 1; iStep <= nLastStep;
+                         iStep++)
+                    {
+                        const int iTargetX =
+                            bLeft ? std::max(0, iX - iStep)
+                                  : std::min(nXSize - 1, iX + iStep);
+                        QUAD_CHECK(adfQuadDist[iQuad], afQuadValue[iQuad],
+                                   iTargetX, apanQuadY[iQuad][iTargetX], iX,
+                                   iY, apafQuadValue[iQuad][iTargetX],
+                                   nNoDataVal);
+                        if (iStep <= nLastCheckStep)
+                            dfDistAtLastCheck = adfQuadDist[iQuad];
+                        if (iTargetX == (bLeft ? 0 : nXSize - 1))
+                            break;
+                    }
+                }
+                dfMaxDistAtLastCheck =
+                    std::max(dfMaxDistAtLastCheck, dfDistAtLastCheck);
+            }
+
+            // When it recomputes its maximum distance, the exhaustive search
+            // may extend it by one step.
+            if (nLastCheckStep > 0 &&
+                static_cast<int>(floor(dfMaxDistAtLastCheck)) > nMaxSearchDist)
+            {
+                const int iLeftX = std::max(0, iX - nMaxSearchDist - 1);
+                const int iRightX =
+                    std::min(nXSize - 1, iX + nMaxSearchDist + 1);
+                for (int iQuad = 0; iQuad < QUAD_COUNT; iQuad++)
+                {
+                    const int iTargetX =
+                        iQuad == QUAD_TOP_LEFT || iQuad == QUAD_BOTTOM_LEFT
+                            ? iLeftX
+                            : iRightX;
+                    QUAD_CHECK(adfQuadDist[iQuad], afQuadValue[iQuad],
+                               iTargetX, apanQuadY[iQuad][iTargetX], iX, iY,
+                               apafQuadValue[iQuad][iTargetX], nNoDataVal);
+                }
+            }
         }
-        hMaskBand = hTmpMaskBand;
-    }
+        else
+        {
+            // Step left and right by one pixel searching for the closest
+            // target value for each quadrant.
+            for (int iStep = 0; iStep <= nThisMaxSearchDist; iStep++)
+            {
+                const int iLeftX = std::max(0, iX - iStep);
+                const int iRightX = std::min(nXSize - 1, iX + iStep);
 
-    // If there are smoothing iterations, reserve 10% of the progress for them.
-    const double dfProgressRatio = nSmoothingIterations > 0 ? 0.9 : 1.0;
+                // Top left includes current line.
+                QUAD_CHECK(adfQuadDist[QUAD_TOP_LEFT],
+                           afQuadValue[QUAD_TOP_LEFT], iLeftX,
+                           panTopDownY[iLeftX], iX, iY, pafTopDownValue[iLeftX],
+                           nNoDataVal);
 
-    const char *pszNoData = CSLFetchNameValue(papszOptions, "NODATA");
-    bool bHasNoData = false;
-    float fNoData = 0.0f;
-    if (pszNoData)
-    {
-        bHasNoData = true;
-        fNoData = static_cast<float>(CPLAtof(pszNoData));
-    }
+                // Bottom left.
+                QUAD_CHECK(adfQuadDist[QUAD_BOTTOM_LEFT],
+                           afQuadValue[QUAD_BOTTOM_LEFT], iLeftX,
+                           panBottomUpY[iLeftX], iX, iY,
+                           pafBottomUpValue[iLeftX], nNoDataVal);
 
-    /* -------------------------------------------------------------------- */
-    /*      Initialize progress counter.                                    */
-    /* -------------------------------------------------------------------- */
-    if (pfnProgress == nullptr)
-        pfnProgress = GDALDummyProgress;
+                // Top right and bottom right do no include center pixel.
+                if (iStep == 0)
+                    continue;
 
-    if (!pfnProgress(0.0, "Filling...", pProgressArg))
-    {
-        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-        return CE_Failure;
+                // Top right includes current line.
+                QUAD_CHECK(adfQuadDist[QUAD_TOP_RIGHT],
+                           afQuadValue[QUAD_TOP_RIGHT], iRightX,
+                           panTopDownY[iRightX], iX, iY,
+                           pafTopDownValue[iRightX], nNoDataVal);
+
+                // Bottom right.
+                QUAD_CHECK(adfQuadDist[QUAD_BOTTOM_RIGHT],
+                           afQuadValue[QUAD_BOTTOM_RIGHT], iRightX,
+                           panBottomUpY[iRightX], iX, iY,
+                           pafBottomUpValue[iRightX], nNoDataVal);
+
+                // Every four steps, recompute maximum distance.
+                if ((iStep & 0x3) == 0)
+                    nThisMaxSearchDist = static_cast<int>(floor(
+                        std::max(std::max(adfQuadDist[0], adfQuadDist[1]),
+                                 std::max(adfQuadDist[2], adfQuadDist[3]))));
+            }
+        }
+
+        bool bHasSrcValues = false;
+        if (sParams.bNearest)
+        {
+            double dfNearestDist = dfMaxSearchDist + 1;
+            float fNearestValue = 0.0f;
+
+            for (int iQuad = 0; iQuad < QUAD_COUNT; iQuad++)
+            {
+                if (adfQuadDist[iQuad] < dfNearestDist)
+                {
+                    bHasSrcValues = true;
+                    if (!bHasNoData || afQuadValue[iQuad] != fNoData)
+                    {
+                        fNearestValue = afQuadValue[iQuad];
+                        dfNearestDist = adfQuadDist[iQuad];
+                    }
+                }
+            }
+
+            if (bHasSrcValues)
+            {
+                pabyFiltMask[iX] = 255;
+                if (dfNearestDist <= dfMaxSearchDist)
+                {
+                    pabyMask[iX] = 255;
+                    pafScanline[iX] = fNearestValue;
+                }
+                else
+                    pafScanline[iX] = fNoData;
+            }
+        }
+        else
+        {
+            double dfWeightSum = 0.0;
+            double dfValueSum = 0.0;
+
+            for (int iQuad = 0; iQuad < QUAD_COUNT; iQuad++)
+            {
+                if (adfQuadDist[iQuad] <= dfMaxSearchDist)
+                {
+                    bHasSrcValues = true;
+                    if (!bHasNoData || afQuadValue[iQuad] != fNoData)
+                    {
+                        const double dfWeight = 1.0 / adfQuadDist[iQuad];
+                        dfWeightSum += dfWeight;
+                        dfValueSum += afQuadValue[iQuad] * dfWeight;
+                    }
+                }
+            }
+
+            if (bHasSrcValues)
+            {
+                pabyFiltMask[iX] = 255;
+                if (dfWeightSum > 0.0)
+                {
+                    pabyMask[iX] = 255;
+                    pafScanline[iX] =
+                        static_cast<float>(dfValueSum / dfWeightSum);
+                }
+                else
+                    pafScanline[iX] = fNoData;
+            }
+        }
     }
+}
+
+/************************************************************************/
+/*                        GDALFillNodataByLines()                       */
+/*                                                                      */
+/*      Interpolation passes over the whole raster, one line at a       */
+/*      time, keeping the result of the top-down pass in work files.    */
+/************************************************************************/
+
+static CPLErr GDALFillNodataByLines(
+    const GDALFillNodataParams &sParams, GDALRasterBandH hTargetBand,
+    GDALRasterBandH hMaskBand, bool bUpdateMask, GDALRasterBandH hFiltMaskBand,
+    GDALDriverH hDriver, const CPLString &osTmpFile,
+    CSLConstList papszWorkFileOptions, bool bQuadrantIndex,
+    double dfProgressRatio, GDALProgressFunc pfnProgress, void *pProgressArg)
+{
+    const int nXSize = GDALGetRasterBandXSize(hTargetBand);
+    const int nYSize = GDALGetRasterBandYSize(hTargetBand);
+    const double dfMaxSearchDist = sParams.dfMaxSearchDist;
+    const GUInt32 nNoDataVal = sParams.nNoDataVal;
+    const GDALDataType eType = nNoDataVal == 65535 ? GDT_UInt16 : GDT_UInt32;
 
     /* -------------------------------------------------------------------- */
     /*      Create a work file to hold the Y "last value" indices.          */
@@ -528,7 +695,7 @@ CPLErr CPL_STDCALL GDALFillNodata(GDALRasterBandH hTargetBand,
 
     auto poYDS = std::unique_ptr<GDALDataset>(GDALDataset::FromHandle(
         GDALCreate(hDriver, osYTmpFile, nXSize, nYSize, 1, eType,
-                   aosWorkFileOptions.List())));
+                   const_cast<char **>(papszWorkFileOptions))));
 
     if (poYDS == nullptr)
     {
@@ -548,10 +715,10 @@ CPLErr CPL_STDCALL GDALFillNodata(GDALRasterBandH hTargetBand,
     /* -------------------------------------------------------------------- */
     const CPLString osValTmpFile = osTmpFile + "fill_val_work.tif";
 
-    auto poValDS =
-        std::unique_ptr<GDALDataset>(GDALDataset::FromHandle(GDALCreate(
-            hDriver, osValTmpFile, nXSize, nYSize, 1,
-            GDALGetRasterDataType(hTargetBand), aosWorkFileOptions.List())));
+    auto poValDS = std::unique_ptr<GDALDataset>(GDALDataset::FromHandle(
+        GDALCreate(hDriver, osValTmpFile, nXSize, nYSize, 1,
+                   GDALGetRasterDataType(hTargetBand),
+                   const_cast<char **>(papszWorkFileOptions))));
 
     if (poValDS == nullptr)
     {
@@ -566,28 +733,7 @@ CPLErr CPL_STDCALL GDALFillNodata(GDALRasterBandH hTargetBand,
         GDALRasterBand::FromHandle(poValDS->GetRasterBand(1));
 
     /* -------------------------------------------------------------------- */
-    /*      Create a mask file to make it clear what pixels can be filtered */
-    /*      on the filtering pass.                                          */
-    /* -------------------------------------------------------------------- */
-    const CPLString osFiltMaskTmpFile = osTmpFile + "fill_filtmask_work.tif";
-
-    auto poFiltMaskDS = std::unique_ptr<GDALDataset>(GDALDataset::FromHandle(
-        GDALCreate(hDriver, osFiltMaskTmpFile, nXSize, nYSize, 1, GDT_Byte,
-                   aosWorkFileOptions.List())));
-
-    if (poFiltMaskDS == nullptr)
-    {
-        CPLError(CE_Failure, CPLE_AppDefined,
-                 "Could not create mask work file. Check driver capabilities.");
-        return CE_Failure;
-    }
-    poFiltMaskDS->MarkSuppressOnClose();
-
-    GDALRasterBandH hFiltMaskBand =
-        GDALRasterBand::FromHandle(poFiltMaskDS->GetRasterBand(1));
-
-    /* -------------------------------------------------------------------- */
-    /*      Allocate buffers for last scanline and this scanline.           */
+    /*      Allocate buffers for last scanline and this scanline.           */
     /* -------------------------------------------------------------------- */
 
     GUInt32 *panLastY =
@@ -607,6 +753,8 @@ CPLErr CPL_STDCALL GDALFillNodata(GDALRasterBandH hTargetBand,
     GByte *pabyMask = static_cast<GByte *>(VSI_CALLOC_VERBOSE(nXSize, 1));
     GByte *pabyFiltMask = static_cast<GByte *>(VSI_CALLOC_VERBOSE(nXSize, 1));
 
+    std::unique_ptr<GDALFillNodataQuadrantIndex> poIndex;
+
     CPLErr eErr = CE_None;
 
     if (panLastY == nullptr || panThisY == nullptr || panTopDownY == nullptr ||
@@ -618,6 +766,22 @@ CPLErr CPL_STDCALL GDALFillNodata(GDALRasterBandH hTargetBand,
         goto end;
     }
 
+    if (bQuadrantIndex)
+    {
+        try
+        {
+            poIndex = std::make_unique<GDALFillNodataQuadrantIndex>();
+            poIndex->Reserve(nXSize);
+        }
+        catch (const std::bad_alloc &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate quadrant search index");
+            eErr = CE_Failure;
+            goto end;
+        }
+    }
+
     for (int iX = 0; iX < nXSize; iX++)
     {
         panLastY[iX] = nNoDataVal;
@@ -780,191 +944,735 @@ CPLErr CPL_STDCALL GDALFillNodata(GDALRasterBandH hTargetBand,
         /*      Attempt to interpolate any pixels that are nodata. */
         /* --------------------------------------------------------------------
          */
-        memset(pabyFiltMask, 0, nXSize);
-        for (int iX = 0; iX < nXSize; iX++)
+        GDALFillNodataLine(sParams, iY, nXSize, panTopDownY, pafTopDownValue,
+                           panLastY, pafLastValue, pabyMask, pafScanline,
+                           pabyFiltMask, poIndex.get());
+
+        /* --------------------------------------------------------------------
+         */
+        /*      Write out the updated data and mask information. */
+        /* --------------------------------------------------------------------
+         */
+        eErr = GDALRasterIO(hTargetBand, GF_Write, 0, iY, nXSize, 1,
+                            pafScanline, nXSize, 1, GDT_Float32, 0, 0);
+
+        if (eErr != CE_None)
+            break;
+
+        if (bUpdateMask)
         {
-            int nThisMaxSearchDist = nMaxSearchDist;
+            // Update (copy of) mask band when it has been provided by the
+            // user
+            eErr = GDALRasterIO(hMaskBand, GF_Write, 0, iY, nXSize, 1, pabyMask,
+                                nXSize, 1, GDT_Byte, 0, 0);
 
-            // If this was a valid target - no change.
-            if (pabyMask[iX])
-                continue;
+            if (eErr != CE_None)
+                break;
+        }
 
-            enum Quadrants
-            {
-                QUAD_TOP_LEFT = 0,
-                QUAD_BOTTOM_LEFT = 1,
-                QUAD_TOP_RIGHT = 2,
-                QUAD_BOTTOM_RIGHT = 3,
-            };
+        if (hFiltMaskBand)
+        {
+            eErr = GDALRasterIO(hFiltMaskBand, GF_Write, 0, iY, nXSize, 1,
+                                pabyFiltMask, nXSize, 1, GDT_Byte, 0, 0);
 
-            constexpr int QUAD_COUNT = 4;
-            double adfQuadDist[QUAD_COUNT] = {};
-            float afQuadValue[QUAD_COUNT] = {};
+            if (eErr != CE_None)
+                break;
+        }
 
-            for (int iQuad = 0; iQuad < QUAD_COUNT; iQuad++)
-            {
-                adfQuadDist[iQuad] = dfMaxSearchDist + 1.0;
-                afQuadValue[iQuad] = 0.0;
-            }
+        /* --------------------------------------------------------------------
+         */
+        /*      Flip this/last buffers. */
+        /* --------------------------------------------------------------------
+         */
+        std::swap(pafThisValue, pafLastValue);
+        std::swap(panThisY, panLastY);
 
-            // Step left and right by one pixel searching for the closest
-            // target value for each quadrant.
-            for (int iStep = 0; iStep <= nThisMaxSearchDist; iStep++)
-            {
-                const int iLeftX = std::max(0, iX - iStep);
-                const int iRightX = std::min(nXSize - 1, iX + iStep);
+        /* --------------------------------------------------------------------
+         */
+        /*      report progress. */
+        /* --------------------------------------------------------------------
+         */
+        if (!pfnProgress(
+                dfProgressRatio *
+                    (0.5 + 0.5 * (nYSize - iY) / static_cast<double>(nYSize)),
+                "Filling...", pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+        }
+    }
 
-                // Top left includes current line.
-                QUAD_CHECK(adfQuadDist[QUAD_TOP_LEFT],
-                           afQuadValue[QUAD_TOP_LEFT], iLeftX,
-                           panTopDownY[iLeftX], iX, iY, pafTopDownValue[iLeftX],
-                           nNoDataVal);
+/* -------------------------------------------------------------------- */
+/*      Free working buffers.                                           */
+/* -------------------------------------------------------------------- */
+end:
+    CPLFree(panLastY);
+    CPLFree(panThisY);
+    CPLFree(panTopDownY);
+    CPLFree(pafLastValue);
+    CPLFree(pafThisValue);
+    CPLFree(pafTopDownValue);
+    CPLFree(pafScanline);
+    CPLFree(pabyMask);
+    CPLFree(pabyFiltMask);
 
-                // Bottom left.
-                QUAD_CHECK(adfQuadDist[QUAD_BOTTOM_LEFT],
-                           afQuadValue[QUAD_BOTTOM_LEFT], iLeftX,
-                           panLastY[iLeftX], iX, iY, pafLastValue[iLeftX],
-                           nNoDataVal);
+    return eErr;
+}
 
-                // Top right and bottom right do no include center pixel.
-                if (iStep == 0)
-                    continue;
+/************************************************************************/
+/*                       GDALFillNodataByStrips()                       */
+/*                                                                      */
+/*      Interpolation passes by strips of full lines held in memory,    */
+/*      whose columns and lines are processed by worker threads.        */
+/*      The result of the top-down pass of the last line of a strip     */
+/*      is carried to the next strip, and the bottom-up pass of a       */
+/*      strip is started from the nMaxSearchDist + 1 lines below it,    */
+/*      which are read with the strip, since no candidate pixel can be  */
+/*      further away.                                                   */
+/************************************************************************/
 
-                // Top right includes current line.
-                QUAD_CHECK(adfQuadDist[QUAD_TOP_RIGHT],
-                           afQuadValue[QUAD_TOP_RIGHT], iRightX,
-                           panTopDownY[iRightX], iX, iY,
-                           pafTopDownValue[iRightX], nNoDataVal);
+static CPLErr GDALFillNodataByStrips(
+    const GDALFillNodataParams &sParams, GDALRasterBandH hTargetBand,
+    GDALRasterBandH hMaskBand, bool bUpdateMask, GDALRasterBandH hFiltMaskBand,
+    bool bQuadrantIndex, CPLJobQueue *poJobQueue, int nThreads,
+    double dfProgressRatio, GDALProgressFunc pfnProgress, void *pProgressArg)
+{
+    const int nXSize = GDALGetRasterBandXSize(hTargetBand);
+    const int nYSize = GDALGetRasterBandYSize(hTargetBand);
+    const double dfMaxSearchDist = sParams.dfMaxSearchDist;
+    const GUInt32 nNoDataVal = sParams.nNoDataVal;
+    const int nRowsPerStrip = std::max(
+        1, std::min(nYSize,
+                    GDALGetRowsPerStrip(hTargetBand, nXSize,
+                                        FILLNODATA_PIXELS_PER_STRIP,
+                                        "GDAL_FILLNODATA_ROWS_PER_STRIP")));
+    // A line is interpolated from the bottom-up pass of the next line.
+    const int nHalo = std::min(sParams.nMaxSearchDist, nYSize - 1) + 1;
+    const int nChunks = std::max(1, std::min(nThreads, nRowsPerStrip));
+
+    std::vector<GByte> abyMask;
+    std::vector<float> afScanline;
+    std::vector<GByte> abyFiltMask;
+    std::vector<GUInt32> anTopDownY;
+    std::vector<float> afTopDownValue;
+    std::vector<GUInt32> anBottomUpY;
+    std::vector<float> afBottomUpValue;
+    std::vector<GUInt32> anLastY;
+    std::vector<float> afLastValue;
+    std::vector<GUInt32> anNextY;
+    std::vector<float> afNextValue;
+    std::vector<GDALFillNodataQuadrantIndex> aoIndex;
+    try
+    {
+        const size_t nStripSize = static_cast<size_t>(nXSize) * nRowsPerStrip;
+        const size_t nWindowSize =
+            static_cast<size_t>(nXSize) *
+            std::min(static_cast<GIntBig>(nYSize),
+                     static_cast<GIntBig>(nRowsPerStrip) + nHalo);
+        abyMask.resize(nWindowSize);
+        afScanline.resize(nWindowSize);
+        abyFiltMask.resize(nStripSize);
+        anTopDownY.resize(nStripSize);
+        afTopDownValue.resize(nStripSize);
+        anBottomUpY.resize(nStripSize);
+        afBottomUpValue.resize(nStripSize);
+        anLastY.resize(nXSize, nNoDataVal);
+        afLastValue.resize(nXSize);
+        anNextY.resize(nXSize);
+        afNextValue.resize(nXSize);
+        if (bQuadrantIndex)
+        {
+            aoIndex.resize(nChunks);
+            for (auto &oIndex : aoIndex)
+                oIndex.Reserve(nXSize);
+        }
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate strip buffers of %d lines",
+                 nRowsPerStrip + nHalo);
+        return CE_Failure;
+    }
 
-                // Bottom right.
-                QUAD_CHECK(adfQuadDist[QUAD_BOTTOM_RIGHT],
-                           afQuadValue[QUAD_BOTTOM_RIGHT], iRightX,
-                           panLastY[iRightX], iX, iY, pafLastValue[iRightX],
-                           nNoDataVal);
+    CPLErr eErr = CE_None;
+    for (int nYOff = 0; eErr == CE_None && nYOff < nYSize;
+         nYOff += nRowsPerStrip)
+    {
+        const int nRows = std::min(nRowsPerStrip, nYSize - nYOff);
+        const int nWindowRows = std::min(nRows + nHalo, nYSize - nYOff);
 
-                // Every four steps, recompute maximum distance.
-                if ((iStep & 0x3) == 0)
-                    nThisMaxSearchDist = static_cast<int>(floor(
-                        std::max(std::max(adfQuadDist[0], adfQuadDist[1]),
-                                 std::max(adfQuadDist[2], adfQuadDist[3]))));
-            }
+        // Read data and mask for the strip and the lines below it.
+        eErr = GDALRasterIO(hMaskBand, GF_Read, 0, nYOff, nXSize, nWindowRows,
+                            abyMask.data(), nXSize, nWindowRows, GDT_Byte, 0,
+                            0);
+        if (eErr != CE_None)
+            break;
 
-            bool bHasSrcValues = false;
-            if (bNearest)
-            {
-                double dfNearestDist = dfMaxSearchDist + 1;
-                float fNearestValue = 0.0f;
+        eErr = GDALRasterIO(hTargetBand, GF_Read, 0, nYOff, nXSize,
+                            nWindowRows, afScanline.data(), nXSize,
+                            nWindowRows, GDT_Float32, 0, 0);
+        if (eErr != CE_None)
+            break;
 
-                for (int iQuad = 0; iQuad < QUAD_COUNT; iQuad++)
+        // Figure out the most recent pixel above and below each pixel of the
+        // strip. The result of the bottom-up pass is stored for the next line,
+        // which is the one used to interpolate a line.
+        GDALRunParallel(
+            poJobQueue, nThreads, nXSize,
+            [&](int, int iXStart, int iXEnd)
+            {
+                for (int iRow = 0; iRow < nRows; iRow++)
                 {
-                    if (adfQuadDist[iQuad] < dfNearestDist)
+                    const int iY = nYOff + iRow;
+                    const size_t nOffset = static_cast<size_t>(iRow) * nXSize;
+                    for (int iX = iXStart; iX < iXEnd; iX++)
                     {
-                        bHasSrcValues = true;
-                        if (!bHasNoData || afQuadValue[iQuad] != fNoData)
+                        if (abyMask[nOffset + iX])
+                        {
+                            afLastValue[iX] = afScanline[nOffset + iX];
+                            anLastY[iX] = iY;
+                        }
+                        else if (!(iY <= dfMaxSearchDist + anLastY[iX]))
                         {
-                            fNearestValue = afQuadValue[iQuad];
-                            dfNearestDist = adfQuadDist[iQuad];
+                            anLastY[iX] = nNoDataVal;
                         }
+                        anTopDownY[nOffset + iX] = anLastY[iX];
+                        afTopDownValue[nOffset + iX] = afLastValue[iX];
                     }
                 }
 
-                if (bHasSrcValues)
+                for (int iX = iXStart; iX < iXEnd; iX++)
                 {
-                    pabyFiltMask[iX] = 255;
-                    if (dfNearestDist <= dfMaxSearchDist)
-                    {
-                        pabyMask[iX] = 255;
-                        pafScanline[iX] = fNearestValue;
-                    }
-                    else
-                        pafScanline[iX] = fNoData;
+                    anNextY[iX] = nNoDataVal;
+                    anBottomUpY[static_cast<size_t>(nRows - 1) * nXSize + iX] =
+                        nNoDataVal;
                 }
-            }
-            else
-            {
-                double dfWeightSum = 0.0;
-                double dfValueSum = 0.0;
-
-                for (int iQuad = 0; iQuad < QUAD_COUNT; iQuad++)
+                for (int iRow = nWindowRows - 1; iRow >= 1; iRow--)
                 {
-                    if (adfQuadDist[iQuad] <= dfMaxSearchDist)
+                    const int iY = nYOff + iRow;
+                    const size_t nOffset = static_cast<size_t>(iRow) * nXSize;
+                    for (int iX = iXStart; iX < iXEnd; iX++)
                     {
-                        bHasSrcValues = true;
-                        if (!bHasNoData || afQuadValue[iQuad] != fNoData)
+                        if (abyMask[nOffset + iX])
                         {
-                            const double dfWeight = 1.0 / adfQuadDist[iQuad];
-                            dfWeightSum += dfWeight;
-                            dfValueSum += afQuadValue[iQuad] * dfWeight;
+                            afNextValue[iX] = afScanline[nOffset + iX];
+                            anNextY[iX] = iY;
+                        }
+                        else if (!(anNextY[iX] - iY <= dfMaxSearchDist))
+                        {
+                            anNextY[iX] = nNoDataVal;
                         }
                     }
-                }
-
-                if (bHasSrcValues)
-                {
-                    pabyFiltMask[iX] = 255;
-                    if (dfWeightSum > 0.0)
+                    if (iRow <= nRows)
                     {
-                        pabyMask[iX] = 255;
-                        pafScanline[iX] =
-                            static_cast<float>(dfValueSum / dfWeightSum);
+                        std::copy(anNextY.begin() + iXStart,
+                                  anNextY.begin() + iXEnd,
+                                  anBottomUpY.begin() + (nOffset - nXSize) +
+                                      iXStart);
+                        std::copy(afNextValue.begin() + iXStart,
+                                  afNextValue.begin() + iXEnd,
+                                  afBottomUpValue.begin() +
+                                      (nOffset - nXSize) + iXStart);
                     }
-                    else
-                        pafScanline[iX] = fNoData;
                 }
-            }
-        }
+            });
 
-        /* --------------------------------------------------------------------
-         */
-        /*      Write out the updated data and mask information. */
-        /* --------------------------------------------------------------------
-         */
-        eErr = GDALRasterIO(hTargetBand, GF_Write, 0, iY, nXSize, 1,
-                            pafScanline, nXSize, 1, GDT_Float32, 0, 0);
+        // Attempt to interpolate any pixels that are nodata.
+        GDALRunParallel(
+            poJobQueue, nChunks, nRows,
+            [&](int iChunk, int iRowStart, int iRowEnd)
+            {
+                for (int iRow = iRowStart; iRow < iRowEnd; iRow++)
+                {
+                    const size_t nOffset = static_cast<size_t>(iRow) * nXSize;
+                    GDALFillNodataLine(
+                        sParams, nYOff + iRow, nXSize,
+                        anTopDownY.data() + nOffset,
+                        afTopDownValue.data() + nOffset,
+                        anBottomUpY.data() + nOffset,
+                        afBottomUpValue.data() + nOffset,
+                        abyMask.data() + nOffset, afScanline.data() + nOffset,
+                        abyFiltMask.data() + nOffset,
+                        bQuadrantIndex ? &aoIndex[iChunk] : nullptr);
+                }
+            });
 
+        // Write out the updated data and mask information.
+        eErr = GDALRasterIO(hTargetBand, GF_Write, 0, nYOff, nXSize, nRows,
+                            afScanline.data(), nXSize, nRows, GDT_Float32, 0,
+                            0);
         if (eErr != CE_None)
             break;
 
-        if (poTmpMaskDS != nullptr)
+        if (bUpdateMask)
         {
-            // Update (copy of) mask band when it has been provided by the
-            // user
-            eErr = GDALRasterIO(hMaskBand, GF_Write, 0, iY, nXSize, 1, pabyMask,
-                                nXSize, 1, GDT_Byte, 0, 0);
+            eErr = GDALRasterIO(hMaskBand, GF_Write, 0, nYOff, nXSize, nRows,
+                                abyMask.data(), nXSize, nRows, GDT_Byte, 0, 0);
+            if (eErr != CE_None)
+                break;
+        }
 
+        if (hFiltMaskBand)
+        {
+            eErr = GDALRasterIO(hFiltMaskBand, GF_Write, 0, nYOff, nXSize,
+                                nRows, abyFiltMask.data(), nXSize, nRows,
+                                GDT_Byte, 0, 0);
             if (eErr != CE_None)
                 break;
         }
 
-        eErr = GDALRasterIO(hFiltMaskBand, GF_Write, 0, iY, nXSize, 1,
-                            pabyFiltMask, nXSize, 1, GDT_Byte, 0, 0);
+        if (!pfnProgress(dfProgressRatio * (nYOff + nRows) /
+                             static_cast<double>(nYSize),
+                         "Filling...", pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+        }
+    }
+
+    return eErr;
+}
+
+/************************************************************************/
+/*                      GDALMultiFilterByStrips()                       */
+/*                                                                      */
+/*      Same as GDALMultiFilter(), but processing strips of lines       */
+/*      held in memory, whose lines are filtered by worker threads.     */
+/*      Each strip is read with the nIterations lines above and below   */
+/*      it that contribute to its result. The lines above have already  */
+/*      been written, so their values before filtering are kept from    */
+/*      the previous strip.                                             */
+/************************************************************************/
+
+static CPLErr GDALMultiFilterByStrips(GDALRasterBandH hTargetBand,
+                                      GDALRasterBandH hTargetMaskBand,
+                                      GDALRasterBandH hFiltMaskBand,
+                                      int nIterations, CPLJobQueue *poJobQueue,
+                                      int nThreads,
+                                      GDALProgressFunc pfnProgress,
+                                      void *pProgressArg)
+{
+    const int nXSize = GDALGetRasterBandXSize(hTargetBand);
+    const int nYSize = GDALGetRasterBandYSize(hTargetBand);
+    const int nRowsPerStrip = std::max(
+        1, std::min(nYSize,
+                    std::max(nIterations,
+                             GDALGetRowsPerStrip(
+                                 hTargetBand, nXSize,
+                                 FILLNODATA_PIXELS_PER_STRIP,
+                                 "GDAL_FILLNODATA_ROWS_PER_STRIP"))));
+    const int nHalo = std::min(nIterations, nYSize);
+
+    std::vector<float> afThisPass;
+    std::vector<float> afNextPass;
+    std::vector<GByte> abyTMask;
+    std::vector<GByte> abyFMask;
+    std::vector<float> afSavedValues;
+    std::vector<GByte> abySavedTMask;
+    std::vector<GByte> abySavedFMask;
+    try
+    {
+        const size_t nWindowSize =
+            static_cast<size_t>(nXSize) *
+            std::min(static_cast<GIntBig>(nYSize),
+                     static_cast<GIntBig>(nRowsPerStrip) + 2 * nHalo);
+        const size_t nSavedSize = static_cast<size_t>(nXSize) * nHalo;
+        afThisPass.resize(nWindowSize);
+        afNextPass.resize(nWindowSize);
+        abyTMask.resize(nWindowSize);
+        abyFMask.resize(nWindowSize);
+        afSavedValues.resize(nSavedSize);
+        abySavedTMask.resize(nSavedSize);
+        abySavedFMask.resize(nSavedSize);
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate strip buffers of %d lines",
+                 nRowsPerStrip + 2 * nHalo);
+        return CE_Failure;
+    }
 
+    CPLErr eErr = CE_None;
+    for (int nYOff = 0; eErr == CE_None && nYOff < nYSize;
+         nYOff += nRowsPerStrip)
+    {
+        const int nRows = std::min(nRowsPerStrip, nYSize - nYOff);
+        const int nAbove = std::min(nHalo, nYOff);
+        const int nBelow = std::min(nHalo, nYSize - nYOff - nRows);
+        const int nWindowRows = nAbove + nRows + nBelow;
+        const size_t nAboveSize = static_cast<size_t>(nAbove) * nXSize;
+
+        // Restore the lines above the strip, and read the others.
+        const size_t nSavedOffset = afSavedValues.size() - nAboveSize;
+        std::copy(afSavedValues.begin() + nSavedOffset, afSavedValues.end(),
+                  afThisPass.begin());
+        std::copy(abySavedTMask.begin() + nSavedOffset, abySavedTMask.end(),
+                  abyTMask.begin());
+        std::copy(abySavedFMask.begin() + nSavedOffset, abySavedFMask.end(),
+                  abyFMask.begin());
+
+        const int nReadRows = nRows + nBelow;
+        eErr = GDALRasterIO(hTargetBand, GF_Read, 0, nYOff, nXSize, nReadRows,
+                            afThisPass.data() + nAboveSize, nXSize, nReadRows,
+                            GDT_Float32, 0, 0);
+        if (eErr == CE_None)
+            eErr = GDALRasterIO(hTargetMaskBand, GF_Read, 0, nYOff, nXSize,
+                                nReadRows, abyTMask.data() + nAboveSize,
+                                nXSize, nReadRows, GDT_Byte, 0, 0);
+        if (eErr == CE_None)
+            eErr = GDALRasterIO(hFiltMaskBand, GF_Read, 0, nYOff, nXSize,
+                                nReadRows, abyFMask.data() + nAboveSize,
+                                nXSize, nReadRows, GDT_Byte, 0, 0);
         if (eErr != CE_None)
             break;
 
-        /* --------------------------------------------------------------------
-         */
-        /*      Flip this/last buffers. */
-        /* --------------------------------------------------------------------
-         */
-        std::swap(pafThisValue, pafLastValue);
-        std::swap(panThisY, panLastY);
+        // Keep the last lines of the strip for the next one.
+        if (nBelow > 0)
+        {
+            const size_t nOffset =
+                static_cast<size_t>(nAbove + nRows - nHalo) * nXSize;
+            const size_t nSavedSize = afSavedValues.size();
+            std::copy(afThisPass.begin() + nOffset,
+                      afThisPass.begin() + nOffset + nSavedSize,
+                      afSavedValues.begin());
+            std::copy(abyTMask.begin() + nOffset,
+                      abyTMask.begin() + nOffset + nSavedSize,
+                      abySavedTMask.begin());
+            std::copy(abyFMask.begin() + nOffset,
+                      abyFMask.begin() + nOffset + nSavedSize,
+                      abySavedFMask.begin());
+        }
 
-        /* --------------------------------------------------------------------
-         */
-        /*      report progress. */
-        /* --------------------------------------------------------------------
-         */
-        if (!pfnProgress(
-                dfProgressRatio *
-                    (0.5 + 0.5 * (nYSize - iY) / static_cast<double>(nYSize)),
-                "Filling...", pProgressArg))
+        // Run the iterations. The first and last lines of the raster are never
+        // filtered, and the first and last lines of the window only provide
+        // values to the others.
+        for (int iIter = 0; iIter < nIterations; iIter++)
+        {
+            GDALRunParallel(
+                poJobQueue, nThreads, nWindowRows,
+                [&](int, int iRowStart, int iRowEnd)
+                {
+                    for (int iRow = iRowStart; iRow < iRowEnd; iRow++)
+                    {
+                        const int iY = nYOff - nAbove + iRow;
+                        const size_t nOffset =
+                            static_cast<size_t>(iRow) * nXSize;
+                        if (iRow == 0 || iRow == nWindowRows - 1 || iY == 0 ||
+                            iY == nYSize - 1)
+                        {
+                            std::copy(afThisPass.begin() + nOffset,
+                                      afThisPass.begin() + nOffset + nXSize,
+                                      afNextPass.begin() + nOffset);
+                            continue;
+                        }
+                        GDALFilterLine(afThisPass.data() + nOffset - nXSize,
+                                       afThisPass.data() + nOffset,
+                                       afThisPass.data() + nOffset + nXSize,
+                                       afNextPass.data() + nOffset,
+                                       abyTMask.data() + nOffset - nXSize,
+                                       abyTMask.data() + nOffset,
+                                       abyTMask.data() + nOffset + nXSize,
+                                       abyFMask.data() + nOffset, nXSize);
+                    }
+                });
+            std::swap(afThisPass, afNextPass);
+        }
+
+        eErr = GDALRasterIO(hTargetBand, GF_Write, 0, nYOff, nXSize, nRows,
+                            afThisPass.data() + nAboveSize, nXSize, nRows,
+                            GDT_Float32, 0, 0);
+        if (eErr != CE_None)
+            break;
+
+        if (!pfnProgress((nYOff + nRows) / static_cast<double>(nYSize),
+                         "Smoothing Filter...", pProgressArg))
         {
             CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
             eErr = CE_Failure;
         }
     }
 
+    return eErr;
+}
+
+/************************************************************************/
+/*                           GDALFillNodata()                           */
+/************************************************************************/
+
+/**
+ * Fill selected raster regions by interpolation from the edges.
+ *
+ * This algorithm will interpolate values for all designated
+ * nodata pixels (marked by zeros in hMaskBand). For each pixel
+ * a four direction conic search is done to find values to interpolate
+ * from (using inverse distance weighting by default). Once all values are
+ * interpolated, zero or more smoothing iterations (3x3 average
+ * filters on interpolated pixels) are applied to smooth out
+ * artifacts.
+ *
+ * This algorithm is generally suitable for interpolating missing
+ * regions of fairly continuously varying rasters (such as elevation
+ * models for instance). It is also suitable for filling small holes
+ * and cracks in more irregularly varying images (like airphotos). It
+ * is generally not so great for interpolating a raster from sparse
+ * point data - see the algorithms defined in gdal_grid.h for that case.
+ *
+ * Starting with GDAL 3.12, when dfMaxSearchDist is small enough relatively to
+ * the raster width, the raster is processed by strips of lines held in memory
+ * (with the dfMaxSearchDist lines below them), instead of using temporary
+ * work files. Strips can be processed by several threads.
+ *
+ * @param hTargetBand the raster band to be modified in place.
+ * @param hMaskBand a mask band indicating pixels to be interpolated
+ * (zero valued). If hMaskBand is set to NULL, this method will internally use
+ * the mask band returned by GDALGetMaskBand(hTargetBand).
+ * @param dfMaxSearchDist the maximum number of pixels to search in all
+ * directions to find values to interpolate from.
+ * @param bDeprecatedOption unused argument, should be zero.
+ * @param nSmoothingIterations the number of 3x3 smoothing filter passes to
+ * run (0 or more).
+ * @param papszOptions additional name=value options in a string list.
+ * <ul>
+ * <li>TEMP_FILE_DRIVER=gdal_driver_name. For example MEM.</li>
+ * <li>NODATA=value (starting with GDAL 2.4).
+ * Source pixels at that value will be ignored by the interpolator. Warning:
+ * currently this will not be honored by smoothing passes.</li>
+ * <li>INTERPOLATION=INV_DIST/NEAREST (GDAL >= 3.9). By default, pixels are
+ * interpolated using an inverse distance weighting (INV_DIST). It is also
+ * possible to choose a nearest neighbour (NEAREST) strategy.</li>
+ * <li>NUM_THREADS=number|ALL_CPUS (GDAL >= 3.12). Number of worker threads
+ * used to process the columns and the lines of the strips held in memory.
+ * Defaults to the value of the GDAL_NUM_THREADS configuration option, or 1.
+ * Reading and writing are done by the calling thread.</li>
+ * <li>QUADRANT_SEARCH=SCAN/INDEX (GDAL >= 3.12). By default (SCAN), the
+ * nearest candidate pixel of each quadrant is searched by stepping through
+ * the columns around each pixel to fill, which is slow for large
+ * MAX_DISTANCE values. With INDEX, an index of the candidates of each line
+ * is built first, so that only the columns that may hold the nearest
+ * candidates are visited. Results are identical.</li>
+ * </ul>
+ * @param pfnProgress the progress function to report completion.
+ * @param pProgressArg callback data for progress function.
+ *
+ * @return CE_None on success or CE_Failure if something goes wrong.
+ */
+
+CPLErr CPL_STDCALL GDALFillNodata(GDALRasterBandH hTargetBand,
+                                  GDALRasterBandH hMaskBand,
+                                  double dfMaxSearchDist,
+                                  CPL_UNUSED int bDeprecatedOption,
+                                  int nSmoothingIterations, char **papszOptions,
+                                  GDALProgressFunc pfnProgress,
+                                  void *pProgressArg)
+
+{
+    VALIDATE_POINTER1(hTargetBand, "GDALFillNodata", CE_Failure);
+
+    const int nXSize = GDALGetRasterBandXSize(hTargetBand);
+    const int nYSize = GDALGetRasterBandYSize(hTargetBand);
+
+    if (dfMaxSearchDist == 0.0)
+        dfMaxSearchDist = std::max(nXSize, nYSize) + 1;
+
+    const int nMaxSearchDist = static_cast<int>(floor(dfMaxSearchDist));
+
+    const char *pszInterpolation =
+        CSLFetchNameValueDef(papszOptions, "INTERPOLATION", "INV_DIST");
+    const bool bNearest = EQUAL(pszInterpolation, "NEAREST");
+    if (!EQUAL(pszInterpolation, "INV_DIST") &&
+        !EQUAL(pszInterpolation, "NEAREST"))
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Unsupported interpolation method: %s", pszInterpolation);
+        return CE_Failure;
+    }
+
+    const char *pszQuadrantSearch =
+        CSLFetchNameValueDef(papszOptions, "QUADRANT_SEARCH", "SCAN");
+    const bool bQuadrantIndex = EQUAL(pszQuadrantSearch, "INDEX");
+    if (!EQUAL(pszQuadrantSearch, "SCAN") && !bQuadrantIndex)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Unsupported quadrant search method: %s", pszQuadrantSearch);
+        return CE_Failure;
+    }
+
+    GDALFillNodataParams sParams;
+    sParams.dfMaxSearchDist = dfMaxSearchDist;
+    sParams.nMaxSearchDist = nMaxSearchDist;
+    sParams.bNearest = bNearest;
+
+    // Special "x" pixel values identifying pixels as special.
+    sParams.nNoDataVal = 65535;
+
+    if (nXSize > 65533 || nYSize > 65533)
+    {
+        sParams.nNoDataVal = 4000002;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Determine format driver for temp work files.                    */
+    /* -------------------------------------------------------------------- */
+    CPLString osTmpFileDriver =
+        CSLFetchNameValueDef(papszOptions, "TEMP_FILE_DRIVER", "GTiff");
+    GDALDriverH hDriver = GDALGetDriverByName(osTmpFileDriver.c_str());
+
+    if (hDriver == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "TEMP_FILE_DRIVER=%s driver is not registered",
+                 osTmpFileDriver.c_str());
+        return CE_Failure;
+    }
+
+    if (GDALGetMetadataItem(hDriver, GDAL_DCAP_CREATE, nullptr) == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "TEMP_FILE_DRIVER=%s driver is incapable of creating "
+                 "temp work files",
+                 osTmpFileDriver.c_str());
+        return CE_Failure;
+    }
+
+    CPLStringList aosWorkFileOptions;
+    if (osTmpFileDriver == "GTiff")
+    {
+        aosWorkFileOptions.SetNameValue("COMPRESS", "LZW");
+        aosWorkFileOptions.SetNameValue("BIGTIFF", "IF_SAFER");
+    }
+
+    const CPLString osTmpFile = CPLGenerateTempFilenameSafe("");
+
+    std::unique_ptr<GDALDataset> poTmpMaskDS;
+    if (hMaskBand == nullptr)
+    {
+        hMaskBand = GDALGetMaskBand(hTargetBand);
+    }
+    else if (nSmoothingIterations > 0 &&
+             hMaskBand != GDALGetMaskBand(hTargetBand))
+    {
+        // If doing smoothing operations and the user provided its own
+        // mask band, we must make a copy of it to be able to update it
+        // when we fill pixels during the initial pass.
+        const CPLString osMaskTmpFile = osTmpFile + "fill_mask_work.tif";
+        poTmpMaskDS.reset(GDALDataset::FromHandle(
+            GDALCreate(hDriver, osMaskTmpFile, nXSize, nYSize, 1, GDT_Byte,
+                       aosWorkFileOptions.List())));
+        if (poTmpMaskDS == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Could not create poTmpMaskDS work file. Check driver "
+                     "capabilities.");
+            return CE_Failure;
+        }
+        poTmpMaskDS->MarkSuppressOnClose();
+        auto hTmpMaskBand =
+            GDALRasterBand::ToHandle(poTmpMaskDS->GetRasterBand(1));
+        if (GDALRasterBandCopyWholeRaster(hMaskBand, hTmpMaskBand, nullptr,
+                                          nullptr, nullptr) != CE_None)
+        {
+            return CE_Failure;
+        }
+        hMaskBand = hTmpMaskBand;
+    }
+
+    // If there are smoothing iterations, reserve 10% of the progress for them.
+    const double dfProgressRatio = nSmoothingIterations > 0 ? 0.9 : 1.0;
+
+    const char *pszNoData = CSLFetchNameValue(papszOptions, "NODATA");
+    if (pszNoData)
+    {
+        sParams.bHasNoData = true;
+        sParams.fNoData = static_cast<float>(CPLAtof(pszNoData));
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      How many threads?                                               */
+    /* -------------------------------------------------------------------- */
+    const char *pszNumThreads = CSLFetchNameValue(papszOptions, "NUM_THREADS");
+    if (pszNumThreads == nullptr)
+        pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    const int nThreads =
+        std::max(1, std::min(128, EQUAL(pszNumThreads, "ALL_CPUS")
+                                      ? CPLGetNumCPUs()
+                                      : atoi(pszNumThreads)));
+    std::unique_ptr<CPLJobQueue> poJobQueue;
+    if (nThreads > 1)
+    {
+        CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+        if (poThreadPool)
+            poJobQueue = poThreadPool->CreateJobQueue();
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Initialize progress counter.                                    */
+    /* -------------------------------------------------------------------- */
+    if (pfnProgress == nullptr)
+        pfnProgress = GDALDummyProgress;
+
+    if (!pfnProgress(0.0, "Filling...", pProgressArg))
+    {
+        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+        return CE_Failure;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Create a mask file to make it clear what pixels can be filtered */
+    /*      on the filtering pass.                                          */
+    /* -------------------------------------------------------------------- */
+    std::unique_ptr<GDALDataset> poFiltMaskDS;
+    GDALRasterBandH hFiltMaskBand = nullptr;
+    if (nSmoothingIterations > 0)
+    {
+        const CPLString osFiltMaskTmpFile =
+            osTmpFile + "fill_filtmask_work.tif";
+
+        poFiltMaskDS.reset(GDALDataset::FromHandle(
+            GDALCreate(hDriver, osFiltMaskTmpFile, nXSize, nYSize, 1,
+                       GDT_Byte, aosWorkFileOptions.List())));
+
+        if (poFiltMaskDS == nullptr)
+        {
+            CPLError(
+                CE_Failure, CPLE_AppDefined,
+                "Could not create mask work file. Check driver capabilities.");
+            return CE_Failure;
+        }
+        poFiltMaskDS->MarkSuppressOnClose();
+
+        hFiltMaskBand =
+            GDALRasterBand::FromHandle(poFiltMaskDS->GetRasterBand(1));
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Process by strips in memory, unless the lines below a strip     */
+    /*      that must be read with it would take too much memory.           */
+    /* -------------------------------------------------------------------- */
+    constexpr GIntBig MAX_STRIP_HALO_PIXELS = 16 * 1024 * 1024;
+    const GIntBig nStripHaloPixels =
+        static_cast<GIntBig>(std::min(nMaxSearchDist, nYSize - 1) + 1) * nXSize;
+    const bool bByStrips = CPLTestBool(CPLGetConfigOption(
+        "GDAL_FILLNODATA_USE_STRIPS",
+        nStripHaloPixels <= MAX_STRIP_HALO_PIXELS ? "YES" : "NO"));
+
+    CPLErr eErr;
+    if (bByStrips)
+    {
+        eErr = GDALFillNodataByStrips(
+            sParams, hTargetBand, hMaskBand, poTmpMaskDS != nullptr,
+            hFiltMaskBand, bQuadrantIndex, poJobQueue.get(), nThreads,
+            dfProgressRatio, pfnProgress, pProgressArg);
+    }
+    else
+    {
+        eErr = GDALFillNodataByLines(
+            sParams, hTargetBand, hMaskBand, poTmpMaskDS != nullptr,
+            hFiltMaskBand, hDriver, osTmpFile, aosWorkFileOptions.List(),
+            bQuadrantIndex, dfProgressRatio, pfnProgress, pProgressArg);
+    }
+
     /* ==================================================================== */
     /*      Now we will do iterative average filters over the               */
     /*      interpolated values to smooth things out and make linear        */
@@ -983,26 +1691,22 @@ CPLErr CPL_STDCALL GDALFillNodata(GDALRasterBandH hTargetBand,
         void *pScaledProgress = GDALCreateScaledProgress(
             dfProgressRatio, 1.0, pfnProgress, pProgressArg);
 
-        eErr = GDALMultiFilter(hTargetBand, hMaskBand, hFiltMaskBand,
-                               nSmoothingIterations, GDALScaledProgress,
-                               pScaledProgress);
+        if (bByStrips || nThreads > 1)
+        {
+            eErr = GDALMultiFilterByStrips(
+                hTargetBand, hMaskBand, hFiltMaskBand, nSmoothingIterations,
+                poJobQueue.get(), nThreads, GDALScaledProgress,
+                pScaledProgress);
+        }
+        else
+        {
+            eErr = GDALMultiFilter(hTargetBand, hMaskBand, hFiltMaskBand,
+                                   nSmoothingIterations, GDALScaledProgress,
+                                   pScaledProgress);
+        }
 
         GDALDestroyScaledProgress(pScaledProgress);
     }
 
-/* -------------------------------------------------------------------- */
-/*      Close and clean up temporary files. Free working buffers        */
-/* -------------------------------------------------------------------- */
-end:
-    CPLFree(panLastY);
-    CPLFree(panThisY);
-    CPLFree(panTopDownY);
-    CPLFree(pafLastValue);
-    CPLFree(pafThisValue);
-    CPLFree(pafTopDownValue);
-    CPLFree(pafScanline);
-    CPLFree(pabyMask);
-    CPLFree(pabyFiltMask);
-
     return eErr;
 }
@@ -74,6 +74,7 @@ GDALRasterContourAlgorithm::GDALRasterContourAlgorithm()
            _("Group n features per transaction (default 100 000)"),
            &m_groupTransactions)
         .SetMinValueIncluded(0);
+    AddNumThreadsArg(&m_numThreads, &m_numThreadsStr);
     AddOverwriteArg(&m_overwrite);
 }
 
@@ -213,6 +214,9 @@ bool GDALRasterContourAlgorithm::RunImpl(GDALProgressFunc pfnProgress,
 
     if (eErr == CE_None)
     {
+        papszStringOptions =
+            CSLSetNameValue(papszStringOptions, "NUM_THREADS",
+                            CPLSPrintf("%d", m_numThreads));
         eErr = GDALContourGenerateEx(hBand, hLayer, papszStringOptions,
                                      pfnProgress, pProgressData);
     }
@@ -65,6 +65,10 @@ class GDALRasterContourAlgorithm final : public GDALAlgorithm
     bool m_polygonize = false;    // -p
     int m_groupTransactions = 0;  // gt <n>
     bool m_overwrite = false;     // -overwrite
+    int m_numThreads = 1;
+
+    // Work variables
+    std::string m_numThreadsStr{"1"};
 };
 
 //! @endcond
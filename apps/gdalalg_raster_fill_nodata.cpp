@@ -65,6 +65,8 @@ GDALRasterFillNodataAlgorithm::GDALRasterFillNodataAlgorithm(
            &m_strategy)
         .SetDefault(m_strategy)
         .SetChoices("invdist", "nearest");
+
+    AddNumThreadsArg(&m_numThreads, &m_numThreadsStr);
 }
 
 /************************************************************************/
@@ -110,6 +112,7 @@ bool GDALRasterFillNodataAlgorithm::RunStep(
     else
         aosFillOptions.AddNameValue("INTERPOLATION",
                                     "INV_DIST");  // default strategy
+    aosFillOptions.AddString(CPLSPrintf("NUM_THREADS=%d", m_numThreads));
 
     pScaledData.reset(
         GDALCreateScaledProgress(0.5, 1.0, pfnProgress, pProgressData));
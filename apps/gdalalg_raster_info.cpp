@@ -55,6 +55,13 @@ GDALRasterInfoAlgorithm::GDALRasterInfoAlgorithm(bool openForMixedRasterVector)
         .SetCategory(GAAC_ADVANCED);
     AddArg("checksum", 0, _("Compute pixel checksum"), &m_checksum)
         .SetCategory(GAAC_ADVANCED);
+    AddArg("hash", 0, _("Compute a hash of the pixel values of the dataset"),
+           &m_hash)
+        .SetChoices("XXH64", "SHA256")
+        .SetCategory(GAAC_ADVANCED);
+    AddNumThreadsArg(&m_numThreads, &m_numThreadsStr,
+                     _("Number of jobs (or ALL_CPUS) to compute the hash"))
+        .SetCategory(GAAC_ADVANCED);
     AddArg("list-mdd", 0,
            _("List all metadata domains available for the dataset"), &m_listMDD)
         .AddAlias("list-metadata-domains")
@@ -123,6 +130,16 @@ bool GDALRasterInfoAlgorithm::RunImpl(GDALProgressFunc, void *)
         aosOptions.AddString("-nonodata");
     if (m_checksum)
         aosOptions.AddString("-checksum");
+    if (!m_hash.empty())
+    {
+        aosOptions.AddString("-hash");
+        aosOptions.AddString(m_hash.c_str());
+        if (GetArg("num-threads")->IsExplicitlySet())
+        {
+            aosOptions.AddString("-num_threads");
+            aosOptions.AddString(CPLSPrintf("%d", m_numThreads));
+        }
+    }
     if (m_listMDD)
         aosOptions.AddString("-listmdd");
     if (!m_mdd.empty())
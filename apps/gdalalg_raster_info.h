@@ -61,6 +61,9 @@ class GDALRasterInfoAlgorithm final : public GDALAlgorithm
     bool m_noMask = false;
     bool m_noNodata = false;
     bool m_checksum = false;
+    std::string m_hash{};
+    int m_numThreads = 0;
+    std::string m_numThreadsStr{};
     bool m_listMDD = false;
     bool m_stdout = false;
     std::string m_mdd{};
@@ -55,6 +55,7 @@ GDALRasterProximityAlgorithm::GDALRasterProximityAlgorithm(bool standaloneStep)
            _("Specify a nodata value to use for pixels that are beyond the "
              "maximum distance"),
            &m_noDataValue);
+    AddNumThreadsArg(&m_numThreads, &m_numThreadsStr);
 }
 
 /************************************************************************/
@@ -114,6 +115,8 @@ bool GDALRasterProximityAlgorithm::RunStep(
         dstBand->SetNoDataValue(m_noDataValue);
     }
 
+    proximityOptions.AddString(CPLSPrintf("NUM_THREADS=%d", m_numThreads));
+
     // Always set this to YES. Note that this was NOT the
     // default behavior in the python implementation of the utility.
     proximityOptions.AddString("USE_INPUT_NODATA=YES");
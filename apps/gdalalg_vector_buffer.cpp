@@ -54,6 +54,7 @@ GDALVectorBufferAlgorithm::GDALVectorBufferAlgorithm(bool standaloneStep)
            &m_opts.m_side)
         .SetChoices("both", "left", "right")
         .SetDefault(m_opts.m_side);
+    AddNumThreadsArg(&m_opts.m_numThreads, &m_opts.m_numThreadsStr);
 }
 
 #ifdef HAVE_GEOS
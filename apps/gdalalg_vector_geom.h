@@ -77,6 +77,9 @@ class GDALVectorGeomAbstractAlgorithm /* non final */
     {
         std::string m_activeLayer{};
         std::string m_geomField{};
+        // Only set by algorithms that call AddNumThreadsArg()
+        int m_numThreads = 1;
+        std::string m_numThreadsStr{"ALL_CPUS"};
     };
 
     virtual std::unique_ptr<OGRLayerWithTranslateFeature>
@@ -161,6 +164,7 @@ class GDALVectorGeomOneToOneAlgorithmLayer /* non final */
             else
                 m_iGeomIdx = INT_MAX;
         }
+        SetNumThreads(m_opts.m_numThreads);
     }
 
     bool IsSelectedGeomField(int idx) const
@@ -104,6 +104,8 @@ GDALVectorLayerAlgebraAlgorithm::GDALVectorLayerAlgebraAlgorithm()
            &m_allMethodFields)
         .SetCategory(GAAC_ADVANCED)
         .SetMutualExclusionGroup("method-field");
+
+    AddNumThreadsArg(&m_numThreads, &m_numThreadsStr);
 }
 
 /************************************************************************/
@@ -383,6 +385,12 @@ bool GDALVectorLayerAlgebraAlgorithm::RunImpl(GDALProgressFunc pfnProgress,
         aosOptions.SetNameValue("PROMOTE_TO_MULTI", "YES");
     }
 
+    // Load the method layer (and the input layer for union and
+    // sym-difference) in memory with a spatial index, rather than relying on
+    // the spatial filtering capabilities of their drivers.
+    aosOptions.SetNameValue("USE_IN_MEMORY_INDEX", "YES");
+    aosOptions.SetNameValue("NUM_THREADS", CPLSPrintf("%d", m_numThreads));
+
     const std::map<std::string, decltype(&OGRLayer::Union)>
         mapOperationToMethod = {
             {"union", &OGRLayer::Union},
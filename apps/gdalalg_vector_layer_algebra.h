@@ -66,6 +66,11 @@ class GDALVectorLayerAlgebraAlgorithm final : public GDALAlgorithm
     bool m_noMethodFields = false;
     bool m_allMethodFields = false;
 
+    int m_numThreads = 0;
+
+    // Work variables
+    std::string m_numThreadsStr{"ALL_CPUS"};
+
     bool RunImpl(GDALProgressFunc pfnProgress, void *pProgressData) override;
 };
 
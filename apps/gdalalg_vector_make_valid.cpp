@@ -41,6 +41,7 @@ GDALVectorMakeValidAlgorithm::GDALVectorMakeValidAlgorithm(bool standaloneStep)
     AddArg("keep-lower-dim", 0,
            _("Keep components of lower dimension after MakeValid()"),
            &m_opts.m_keepLowerDim);
+    AddNumThreadsArg(&m_opts.m_numThreads, &m_opts.m_numThreadsStr);
 }
 
 #ifdef HAVE_GEOS
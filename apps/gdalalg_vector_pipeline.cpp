@@ -34,8 +34,11 @@
 
 #include "cpl_conv.h"
 #include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 
 //! @cond Doxygen_Suppress
@@ -819,21 +822,162 @@ OGRFeature *GDALVectorPipelineOutputLayer::GetNextRawFeature()
     }
     m_pendingFeatures.clear();
     m_idxInPendingFeatures = 0;
-    while (true)
+    if (m_nNumThreads > 1)
     {
-        auto poSrcFeature =
-            std::unique_ptr<OGRFeature>(m_srcLayer.GetNextFeature());
-        if (!poSrcFeature)
-            return nullptr;
-        TranslateFeature(std::move(poSrcFeature), m_pendingFeatures);
-        if (!m_pendingFeatures.empty())
-            break;
+        while (m_pendingFeatures.empty())
+        {
+            if (!TranslateNextBatch())
+                return nullptr;
+        }
+    }
+    else
+    {
+        while (true)
+        {
+            auto poSrcFeature = GetNextSrcFeature();
+            if (!poSrcFeature)
+                return nullptr;
+            TranslateFeature(std::move(poSrcFeature), m_pendingFeatures);
+            if (!m_pendingFeatures.empty())
+                break;
+        }
     }
     OGRFeature *poFeature = m_pendingFeatures[0].release();
     m_idxInPendingFeatures = 1;
     return poFeature;
 }
 
+/************************************************************************/
+/*          GDALVectorPipelineOutputLayer::GetNextFeatureInto()         */
+/************************************************************************/
+
+bool GDALVectorPipelineOutputLayer::GetNextFeatureInto(OGRFeature &oFeature)
+{
+    if (oFeature.GetDefnRef() != GetLayerDefn())
+        return OGRLayer::GetNextFeatureInto(oFeature);
+
+    while (true)
+    {
+        auto poFeature = std::unique_ptr<OGRFeature>(GetNextRawFeature());
+        if (!poFeature)
+            return false;
+
+        const bool bMatch =
+            (m_poFilterGeom == nullptr ||
+             FilterGeometry(poFeature->GetGeometryRef())) &&
+            (m_poAttrQuery == nullptr ||
+             m_poAttrQuery->Evaluate(poFeature.get()));
+        if (bMatch)
+            oFeature.Swap(*poFeature);
+
+        // When the output layer shares the definition of the source layer,
+        // the feature object that held the output feature (and now holds the
+        // previous content of oFeature) can be used to read a source feature.
+        if (poFeature->GetDefnRef() == m_srcLayer.GetLayerDefn())
+            m_srcFeaturesToReuse.push_back(std::move(poFeature));
+
+        if (bMatch)
+            return true;
+    }
+}
+
+/************************************************************************/
+/*          GDALVectorPipelineOutputLayer::GetNextSrcFeature()          */
+/************************************************************************/
+
+/** Read the next source feature with OGRLayer::GetNextFeatureInto(), into
+ * a recycled feature object when one is available.
+ */
+std::unique_ptr<OGRFeature> GDALVectorPipelineOutputLayer::GetNextSrcFeature()
+{
+    std::unique_ptr<OGRFeature> poSrcFeature;
+    if (m_srcFeaturesToReuse.empty())
+    {
+        poSrcFeature = std::make_unique<OGRFeature>(m_srcLayer.GetLayerDefn());
+    }
+    else
+    {
+        poSrcFeature = std::move(m_srcFeaturesToReuse.back());
+        m_srcFeaturesToReuse.pop_back();
+    }
+    if (!m_srcLayer.GetNextFeatureInto(*poSrcFeature))
+    {
+        m_srcFeaturesToReuse.push_back(std::move(poSrcFeature));
+        return nullptr;
+    }
+    return poSrcFeature;
+}
+
+/************************************************************************/
+/*          GDALVectorPipelineOutputLayer::TranslateNextBatch()         */
+/************************************************************************/
+
+/** Read a batch of source features, translate them with several threads,
+ * and append the results to m_pendingFeatures in source order.
+ * Returns false once the source layer is exhausted.
+ */
+bool GDALVectorPipelineOutputLayer::TranslateNextBatch()
+{
+    // Bounds the number of features held in memory at once, while giving
+    // each thread enough work to amortize the synchronization.
+    constexpr size_t FEATURES_PER_THREAD = 64;
+    const size_t nMaxBatchSize =
+        static_cast<size_t>(m_nNumThreads) * FEATURES_PER_THREAD;
+
+    std::vector<std::unique_ptr<OGRFeature>> apoSrcFeatures;
+    apoSrcFeatures.reserve(nMaxBatchSize);
+    while (apoSrcFeatures.size() < nMaxBatchSize)
+    {
+        auto poSrcFeature = GetNextSrcFeature();
+        if (!poSrcFeature)
+            break;
+        apoSrcFeatures.push_back(std::move(poSrcFeature));
+    }
+    if (apoSrcFeatures.empty())
+        return false;
+
+    const size_t nBatchSize = apoSrcFeatures.size();
+    std::vector<std::vector<std::unique_ptr<OGRFeature>>> aapoOutFeatures(
+        nBatchSize);
+    std::atomic<size_t> nextIdx{0};
+    // Each job grabs the next untranslated feature until none is left, which
+    // balances the load when translation costs vary a lot between features.
+    const auto TranslateJob =
+        [this, &apoSrcFeatures, &aapoOutFeatures, &nextIdx, nBatchSize]()
+    {
+        for (size_t i = nextIdx++; i < nBatchSize; i = nextIdx++)
+        {
+            TranslateFeature(std::move(apoSrcFeatures[i]), aapoOutFeatures[i]);
+        }
+    };
+
+    const int nJobs = static_cast<int>(
+        std::min(static_cast<size_t>(m_nNumThreads), nBatchSize));
+    CPLWorkerThreadPool *poThreadPool =
+        nJobs > 1 ? GDALGetGlobalThreadPool(m_nNumThreads) : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    if (poJobQueue)
+    {
+        for (int i = 1; i < nJobs; ++i)
+        {
+            if (!poJobQueue->SubmitJob(TranslateJob))
+                break;
+        }
+    }
+    // The calling thread takes its share of the work, and completes it
+    // on its own if no job could be submitted.
+    TranslateJob();
+    if (poJobQueue)
+        poJobQueue->WaitCompletion();
+
+    for (auto &apoOutFeatures : aapoOutFeatures)
+    {
+        for (auto &poOutFeature : apoOutFeatures)
+            m_pendingFeatures.push_back(std::move(poOutFeature));
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                 GDALVectorPipelineOutputDataset                      */
 /************************************************************************/
@@ -968,6 +1112,26 @@ OGRFeatureDefn *GDALVectorPipelinePassthroughLayer::GetLayerDefn()
     return m_srcLayer.GetLayerDefn();
 }
 
+/************************************************************************/
+/*         GDALVectorPipelinePassthroughLayer::GetNextFeatureInto()     */
+/************************************************************************/
+
+bool GDALVectorPipelinePassthroughLayer::GetNextFeatureInto(
+    OGRFeature &oFeature)
+{
+    // Forward to the source layer, so that it can recycle oFeature
+    while (m_srcLayer.GetNextFeatureInto(oFeature))
+    {
+        if ((m_poFilterGeom == nullptr ||
+             FilterGeometry(oFeature.GetGeometryRef())) &&
+            (m_poAttrQuery == nullptr || m_poAttrQuery->Evaluate(&oFeature)))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 /************************************************************************/
 /*                 GDALVectorNonStreamingAlgorithmDataset()             */
 /************************************************************************/
@@ -222,13 +222,33 @@ class GDALVectorPipelineOutputLayer /* non final */
 
     OGRLayer &m_srcLayer;
 
+    /** Set the number of threads that GetNextRawFeature() may use to
+     * translate batches of source features. Only to be called by subclasses
+     * whose TranslateFeature() can be called concurrently on different
+     * features, and whose output does not depend on the order of the calls.
+     * Output features are still returned in source order.
+     */
+    void SetNumThreads(int nNumThreads)
+    {
+        m_nNumThreads = nNumThreads;
+    }
+
   public:
     void ResetReading() override;
     OGRFeature *GetNextRawFeature();
+    bool GetNextFeatureInto(OGRFeature &oFeature) override;
 
   private:
     std::vector<std::unique_ptr<OGRFeature>> m_pendingFeatures{};
     size_t m_idxInPendingFeatures = 0;
+    int m_nNumThreads = 1;
+
+    /** Feature objects, using the source layer definition, given back by
+     * GetNextFeatureInto() and recycled by GetNextSrcFeature() */
+    std::vector<std::unique_ptr<OGRFeature>> m_srcFeaturesToReuse{};
+
+    std::unique_ptr<OGRFeature> GetNextSrcFeature();
+    bool TranslateNextBatch();
 };
 
 /************************************************************************/
@@ -249,6 +269,8 @@ class GDALVectorPipelinePassthroughLayer /* non final */
 
     OGRFeatureDefn *GetLayerDefn() override;
 
+    bool GetNextFeatureInto(OGRFeature &oFeature) override;
+
     int TestCapability(const char *pszCap) override
     {
         return m_srcLayer.TestCapability(pszCap);
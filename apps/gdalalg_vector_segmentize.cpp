@@ -35,6 +35,7 @@ GDALVectorSegmentizeAlgorithm::GDALVectorSegmentizeAlgorithm(
         .SetPositional()
         .SetRequired()
         .SetMinValueExcluded(0);
+    AddNumThreadsArg(&m_opts.m_numThreads, &m_opts.m_numThreadsStr);
 }
 
 namespace
@@ -34,6 +34,7 @@ GDALVectorSimplifyAlgorithm::GDALVectorSimplifyAlgorithm(bool standaloneStep)
         .SetPositional()
         .SetRequired()
         .SetMinValueIncluded(0);
+    AddNumThreadsArg(&m_opts.m_numThreads, &m_opts.m_numThreadsStr);
 }
 
 #ifdef HAVE_GEOS
@@ -97,7 +97,12 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <deque>
+#include <functional>
+#include <future>
 #include <limits>
+#include <memory>
+#include <vector>
 
 #include "cpl_error.h"
 #include "cpl_float.h"
@@ -107,6 +112,7 @@
 #include "cpl_vsi_virtual.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 
 #if defined(__x86_64__) || defined(_M_X64)
 #define HAVE_16_SSE_REG
@@ -310,6 +316,367 @@ GInt32 INTERPOL(GInt32 a, GInt32 b, int bSrcHasNoData, GInt32 fSrcNoDataValue)
     return nVal;
 }
 
+/************************************************************************/
+/*                      GDALDEMGetNumThreads()                          */
+/************************************************************************/
+
+// Number of threads from the NUM_THREADS creation option, or, if not
+// specified, from the GDAL_NUM_THREADS configuration option.
+static int GDALDEMGetNumThreads(CSLConstList papszCreationOptions)
+{
+    const char *pszNumThreads =
+        CSLFetchNameValue(papszCreationOptions, "NUM_THREADS");
+    if (pszNumThreads == nullptr)
+        pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    return std::max(1, std::min(128, EQUAL(pszNumThreads, "ALL_CPUS")
+                                         ? CPLGetNumCPUs()
+                                         : atoi(pszNumThreads)));
+}
+
+/************************************************************************/
+/*                     GDALDEMGetRowsPerChunk()                         */
+/************************************************************************/
+
+// Number of output rows processed by a job of
+// GDALDEMProcessChunksMultiThreaded(), so that a chunk is about 1 million
+// pixels. When possible, this is a multiple of the block height of the
+// output band, so that chunks write whole rows of blocks.
+static int GDALDEMGetRowsPerChunk(GDALRasterBandH hDstBand, int nXSize)
+{
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    GDALGetBlockSize(hDstBand, &nBlockXSize, &nBlockYSize);
+    constexpr int PIXELS_PER_CHUNK = 1024 * 1024;
+    int nRows = std::max(1, PIXELS_PER_CHUNK / std::max(1, nXSize));
+    if (nBlockYSize > 1)
+    {
+        if (nRows >= nBlockYSize)
+            nRows = nRows / nBlockYSize * nBlockYSize;
+        else if (nBlockYSize <= 4 * nRows)
+            nRows = nBlockYSize;
+    }
+    return nRows;
+}
+
+/************************************************************************/
+/*                 GDALDEMProcessChunksMultiThreaded()                  */
+/************************************************************************/
+
+// Processes the nYSize output rows by chunks of nRowsPerChunk rows.
+// pfnRead() reads the source data of a chunk and pfnWrite() writes its
+// result, both on the calling thread, since drivers are not thread-safe.
+// pfnCompute() computes a chunk on a worker thread of the global thread pool.
+// Chunks are written in order, with at most nThreads of them in flight.
+template <class Chunk>
+static CPLErr GDALDEMProcessChunksMultiThreaded(
+    int nYSize, int nRowsPerChunk, int nThreads,
+    const std::function<bool(int nYOff, int nRows, Chunk &)> &pfnRead,
+    const std::function<void(Chunk &)> &pfnCompute,
+    const std::function<bool(const Chunk &)> &pfnWrite,
+    GDALProgressFunc pfnProgress, void *pProgressData)
+{
+    CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    if (!poThreadPool)
+        return CE_Failure;
+    auto poJobQueue = poThreadPool->CreateJobQueue();
+
+    struct PendingChunk
+    {
+        std::unique_ptr<Chunk> poChunk{};
+        int nYEnd = 0;
+        std::future<void> oFuture{};
+    };
+
+    std::deque<PendingChunk> aoPending;
+    CPLErr eErr = CE_None;
+
+    const auto WriteOldestChunk = [&]()
+    {
+        PendingChunk &oPending = aoPending.front();
+        oPending.oFuture.wait();
+        if (eErr == CE_None && !pfnWrite(*(oPending.poChunk)))
+            eErr = CE_Failure;
+        if (eErr == CE_None &&
+            !pfnProgress(static_cast<double>(oPending.nYEnd) / nYSize,
+                         nullptr, pProgressData))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+        }
+        aoPending.pop_front();
+    };
+
+    for (int nYOff = 0; nYOff < nYSize && eErr == CE_None;
+         nYOff += nRowsPerChunk)
+    {
+        const int nRows = std::min(nRowsPerChunk, nYSize - nYOff);
+        PendingChunk oPending;
+        oPending.poChunk = std::make_unique<Chunk>();
+        oPending.nYEnd = nYOff + nRows;
+        if (!pfnRead(nYOff, nRows, *(oPending.poChunk)))
+        {
+            eErr = CE_Failure;
+            break;
+        }
+
+        auto poPromise = std::make_shared<std::promise<void>>();
+        oPending.oFuture = poPromise->get_future();
+        Chunk *poChunk = oPending.poChunk.get();
+        poJobQueue->SubmitJob(
+            [poChunk, poPromise, &pfnCompute]()
+            {
+                pfnCompute(*poChunk);
+                poPromise->set_value();
+            });
+        aoPending.push_back(std::move(oPending));
+
+        if (static_cast<int>(aoPending.size()) > nThreads)
+            WriteOldestChunk();
+    }
+
+    // In case of error, the remaining chunks are still waited for, but not
+    // written.
+    while (!aoPending.empty())
+        WriteOldestChunk();
+
+    return eErr;
+}
+
+/************************************************************************/
+/*                  GDALGeneric3x3ProcessingContext                     */
+/************************************************************************/
+
+// Parameters of GDALGeneric3x3Processing(), shared (read-only) by the
+// threads computing lines.
+template <class T> struct GDALGeneric3x3ProcessingContext
+{
+    typename GDALGeneric3x3ProcessingAlg<T>::type pfnAlg = nullptr;
+    typename GDALGeneric3x3ProcessingAlg_multisample<T>::type
+        pfnAlg_multisample = nullptr;
+    const AlgorithmParameters *pData = nullptr;
+    bool bComputeAtEdges = false;
+    int nXSize = 0;
+    int nYSize = 0;
+    bool bSrcHasNoData = false;
+    T fSrcNoDataValue = 0;
+    bool bIsSrcNoDataNan = false;
+    float fDstNoDataValue = 0;
+
+    bool LineHasNoData(const T *pafLine) const;
+
+    void ProcessLine(int iLine, const T *pafLine1, const T *pafLine2,
+                     const T *pafLine3, bool bOneOfThreeLinesHasNoData,
+                     float *pafOutputBuf) const;
+};
+
+/************************************************************************/
+/*                           LineHasNoData()                            */
+/************************************************************************/
+
+template <class T>
+bool GDALGeneric3x3ProcessingContext<T>::LineHasNoData(const T *pafLine) const
+{
+    if (!bSrcHasNoData)
+        return false;
+    if constexpr (std::numeric_limits<T>::is_integer)
+    {
+        int iX = 0;
+        for (; iX + 3 < nXSize; iX += 4)
+        {
+            if (pafLine[iX] == fSrcNoDataValue ||
+                pafLine[iX + 1] == fSrcNoDataValue ||
+                pafLine[iX + 2] == fSrcNoDataValue ||
+                pafLine[iX + 3] == fSrcNoDataValue)
+            {
+                return true;
+            }
+        }
+        for (; iX < nXSize; iX++)
+        {
+            if (pafLine[iX] == fSrcNoDataValue)
+                return true;
+        }
+    }
+    else
+    {
+        int iX = 0;
+        for (; iX + 3 < nXSize; iX += 4)
+        {
+            if (pafLine[iX] == fSrcNoDataValue || std::isnan(pafLine[iX]) ||
+                pafLine[iX + 1] == fSrcNoDataValue ||
+                std::isnan(pafLine[iX + 1]) ||
+                pafLine[iX + 2] == fSrcNoDataValue ||
+                std::isnan(pafLine[iX + 2]) ||
+                pafLine[iX + 3] == fSrcNoDataValue ||
+                std::isnan(pafLine[iX + 3]))
+            {
+                return true;
+            }
+        }
+        for (; iX < nXSize; iX++)
+        {
+            if (pafLine[iX] == fSrcNoDataValue || std::isnan(pafLine[iX]))
+                return true;
+        }
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                            ProcessLine()                             */
+/************************************************************************/
+
+// Computes the output line iLine.
+// For the first line, pafLine1 and pafLine2 are the source lines 0 and 1.
+// For the last line, pafLine1 and pafLine2 are the source lines nYSize - 2 and
+// nYSize - 1. Otherwise, pafLine1, pafLine2 and pafLine3 are the source lines
+// iLine - 1, iLine and iLine + 1.
+template <class T>
+void GDALGeneric3x3ProcessingContext<T>::ProcessLine(
+    int iLine, const T *pafLine1, const T *pafLine2, const T *pafLine3,
+    bool bOneOfThreeLinesHasNoData, float *pafOutputBuf) const
+{
+    // Move a 3x3 pafWindow over each cell
+    // (where the cell in question is #4)
+    //
+    //      0 1 2
+    //      3 4 5
+    //      6 7 8
+
+    if (iLine == 0 || iLine == nYSize - 1)
+    {
+        if (!(bComputeAtEdges && nXSize >= 2 && nYSize >= 2))
+        {
+            // Exclude the edges
+            for (int j = 0; j < nXSize; j++)
+            {
+                pafOutputBuf[j] = fDstNoDataValue;
+            }
+            return;
+        }
+
+        for (int j = 0; j < nXSize; j++)
+        {
+            int jmin = (j == 0) ? j : j - 1;
+            int jmax = (j == nXSize - 1) ? j : j + 1;
+
+            if (iLine == 0)
+            {
+                T afWin[9] = {INTERPOL(pafLine1[jmin], pafLine2[jmin],
+                                       bSrcHasNoData, fSrcNoDataValue),
+                              INTERPOL(pafLine1[j], pafLine2[j], bSrcHasNoData,
+                                       fSrcNoDataValue),
+                              INTERPOL(pafLine1[jmax], pafLine2[jmax],
+                                       bSrcHasNoData, fSrcNoDataValue),
+                              pafLine1[jmin],
+                              pafLine1[j],
+                              pafLine1[jmax],
+                              pafLine2[jmin],
+                              pafLine2[j],
+                              pafLine2[jmax]};
+                pafOutputBuf[j] =
+                    ComputeVal(bSrcHasNoData, fSrcNoDataValue, bIsSrcNoDataNan,
+                               afWin, fDstNoDataValue, pfnAlg, pData,
+                               bComputeAtEdges);
+            }
+            else
+            {
+                T afWin[9] = {
+                    pafLine1[jmin],
+                    pafLine1[j],
+                    pafLine1[jmax],
+                    pafLine2[jmin],
+                    pafLine2[j],
+                    pafLine2[jmax],
+                    INTERPOL(pafLine2[jmin], pafLine1[jmin], bSrcHasNoData,
+                             fSrcNoDataValue),
+                    INTERPOL(pafLine2[j], pafLine1[j], bSrcHasNoData,
+                             fSrcNoDataValue),
+                    INTERPOL(pafLine2[jmax], pafLine1[jmax], bSrcHasNoData,
+                             fSrcNoDataValue),
+                };
+                pafOutputBuf[j] =
+                    ComputeVal(bSrcHasNoData, fSrcNoDataValue, bIsSrcNoDataNan,
+                               afWin, fDstNoDataValue, pfnAlg, pData,
+                               bComputeAtEdges);
+            }
+        }
+        return;
+    }
+
+    if (bComputeAtEdges && nXSize >= 2)
+    {
+        int j = 0;
+        T afWin[9] = {INTERPOL(pafLine1[j], pafLine1[j + 1], bSrcHasNoData,
+                               fSrcNoDataValue),
+                      pafLine1[j],
+                      pafLine1[j + 1],
+                      INTERPOL(pafLine2[j], pafLine2[j + 1], bSrcHasNoData,
+                               fSrcNoDataValue),
+                      pafLine2[j],
+                      pafLine2[j + 1],
+                      INTERPOL(pafLine3[j], pafLine3[j + 1], bSrcHasNoData,
+                               fSrcNoDataValue),
+                      pafLine3[j],
+                      pafLine3[j + 1]};
+
+        pafOutputBuf[j] = ComputeVal(
+            bOneOfThreeLinesHasNoData, fSrcNoDataValue, bIsSrcNoDataNan, afWin,
+            fDstNoDataValue, pfnAlg, pData, bComputeAtEdges);
+    }
+    else
+    {
+        // Exclude the edges
+        pafOutputBuf[0] = fDstNoDataValue;
+    }
+
+    int j = 1;
+    if (pfnAlg_multisample && !bOneOfThreeLinesHasNoData)
+    {
+        j = pfnAlg_multisample(pafLine1, pafLine2, pafLine3, nXSize, pData,
+                               pafOutputBuf);
+    }
+
+    for (; j < nXSize - 1; j++)
+    {
+        T afWin[9] = {pafLine1[j - 1], pafLine1[j], pafLine1[j + 1],
+                      pafLine2[j - 1], pafLine2[j], pafLine2[j + 1],
+                      pafLine3[j - 1], pafLine3[j], pafLine3[j + 1]};
+
+        pafOutputBuf[j] = ComputeVal(
+            bOneOfThreeLinesHasNoData, fSrcNoDataValue, bIsSrcNoDataNan, afWin,
+            fDstNoDataValue, pfnAlg, pData, bComputeAtEdges);
+    }
+
+    if (bComputeAtEdges && nXSize >= 2)
+    {
+        j = nXSize - 1;
+
+        T afWin[9] = {pafLine1[j - 1],
+                      pafLine1[j],
+                      INTERPOL(pafLine1[j], pafLine1[j - 1], bSrcHasNoData,
+                               fSrcNoDataValue),
+                      pafLine2[j - 1],
+                      pafLine2[j],
+                      INTERPOL(pafLine2[j], pafLine2[j - 1], bSrcHasNoData,
+                               fSrcNoDataValue),
+                      pafLine3[j - 1],
+                      pafLine3[j],
+                      INTERPOL(pafLine3[j], pafLine3[j - 1], bSrcHasNoData,
+                               fSrcNoDataValue)};
+
+        pafOutputBuf[j] = ComputeVal(
+            bOneOfThreeLinesHasNoData, fSrcNoDataValue, bIsSrcNoDataNan, afWin,
+            fDstNoDataValue, pfnAlg, pData, bComputeAtEdges);
+    }
+    else
+    {
+        // Exclude the edges
+        if (nXSize > 1)
+            pafOutputBuf[nXSize - 1] = fDstNoDataValue;
+    }
+}
+
 /************************************************************************/
 /*                  GDALGeneric3x3Processing()                          */
 /************************************************************************/
@@ -321,7 +688,7 @@ static CPLErr GDALGeneric3x3Processing(
     typename GDALGeneric3x3ProcessingAlg_multisample<T>::type
         pfnAlg_multisample,
     std::unique_ptr<AlgorithmParameters> pData, bool bComputeAtEdges,
-    GDALProgressFunc pfnProgress, void *pProgressData)
+    int nThreads, GDALProgressFunc pfnProgress, void *pProgressData)
 {
     if (pfnProgress == nullptr)
         pfnProgress = GDALDummyProgress;
@@ -338,26 +705,19 @@ static CPLErr GDALGeneric3x3Processing(
     const int nXSize = GDALGetRasterBandXSize(hSrcBand);
     const int nYSize = GDALGetRasterBandYSize(hSrcBand);
 
-    // 1 line destination buffer.
-    float *pafOutputBuf =
-        static_cast<float *>(VSI_MALLOC2_VERBOSE(sizeof(float), nXSize));
-    // 3 line rotating source buffer.
-    T *pafThreeLineWin =
-        static_cast<T *>(VSI_MALLOC2_VERBOSE(3 * sizeof(T), nXSize));
-    if (pafOutputBuf == nullptr || pafThreeLineWin == nullptr)
-    {
-        VSIFree(pafOutputBuf);
-        VSIFree(pafThreeLineWin);
-        return CE_Failure;
-    }
+    GDALGeneric3x3ProcessingContext<T> sCtxt;
+    sCtxt.pfnAlg = pfnAlg;
+    sCtxt.pfnAlg_multisample = pfnAlg_multisample;
+    sCtxt.pData = pData.get();
+    sCtxt.bComputeAtEdges = bComputeAtEdges;
+    sCtxt.nXSize = nXSize;
+    sCtxt.nYSize = nYSize;
 
     GDALDataType eReadDT;
     int bSrcHasNoData = FALSE;
     const double dfNoDataValue =
         GDALGetRasterNoDataValue(hSrcBand, &bSrcHasNoData);
 
-    bool bIsSrcNoDataNan = false;
-    T fSrcNoDataValue = 0;
     if constexpr (std::numeric_limits<T>::is_integer)
     {
         eReadDT = GDT_Int32;
@@ -376,7 +736,8 @@ static CPLErr GDALGeneric3x3Processing(
             if (fabs(dfNoDataValue - floor(dfNoDataValue + 0.5)) < 1e-2 &&
                 dfNoDataValue >= nMinVal && dfNoDataValue <= nMaxVal)
             {
-                fSrcNoDataValue = static_cast<T>(floor(dfNoDataValue + 0.5));
+                sCtxt.fSrcNoDataValue =
+                    static_cast<T>(floor(dfNoDataValue + 0.5));
             }
             else
             {
@@ -387,32 +748,144 @@ static CPLErr GDALGeneric3x3Processing(
     else
     {
         eReadDT = GDT_Float32;
-        fSrcNoDataValue = static_cast<T>(dfNoDataValue);
-        bIsSrcNoDataNan = bSrcHasNoData && std::isnan(dfNoDataValue);
+        sCtxt.fSrcNoDataValue = static_cast<T>(dfNoDataValue);
+        sCtxt.bIsSrcNoDataNan = bSrcHasNoData && std::isnan(dfNoDataValue);
     }
+    sCtxt.bSrcHasNoData = CPL_TO_BOOL(bSrcHasNoData);
 
     int bDstHasNoData = FALSE;
-    float fDstNoDataValue =
+    sCtxt.fDstNoDataValue =
         static_cast<float>(GDALGetRasterNoDataValue(hDstBand, &bDstHasNoData));
     if (!bDstHasNoData)
-        fDstNoDataValue = 0.0;
+        sCtxt.fDstNoDataValue = 0.0;
+
+    /* -------------------------------------------------------------------- */
+    /*      Multi-threaded processing, by chunks of lines with a one line   */
+    /*      halo above and below.                                           */
+    /* -------------------------------------------------------------------- */
+    const int nRowsPerChunk = GDALDEMGetRowsPerChunk(hDstBand, nXSize);
+    if (nThreads > 1 && nYSize > nRowsPerChunk)
+    {
+        struct Chunk
+        {
+            int nYOff = 0;
+            int nRows = 0;
+            int nSrcYOff = 0;
+            std::vector<T> aSrc{};
+            std::vector<float> afDst{};
+        };
+
+        const std::function<bool(int, int, Chunk &)> pfnRead =
+            [&](int nYOff, int nRows, Chunk &oChunk)
+        {
+            oChunk.nYOff = nYOff;
+            oChunk.nRows = nRows;
+            oChunk.nSrcYOff = std::max(0, nYOff - 1);
+            const int nSrcRows =
+                std::min(nYSize, nYOff + nRows + 1) - oChunk.nSrcYOff;
+            try
+            {
+                oChunk.aSrc.resize(static_cast<size_t>(nSrcRows) * nXSize);
+                oChunk.afDst.resize(static_cast<size_t>(nRows) * nXSize);
+            }
+            catch (const std::bad_alloc &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Cannot allocate chunk buffers");
+                return false;
+            }
+            return GDALRasterIO(hSrcBand, GF_Read, 0, oChunk.nSrcYOff, nXSize,
+                                nSrcRows, oChunk.aSrc.data(), nXSize, nSrcRows,
+                                eReadDT, 0, 0) == CE_None;
+        };
+
+        const std::function<void(Chunk &)> pfnCompute =
+            [&sCtxt, nXSize, nYSize](Chunk &oChunk)
+        {
+            const auto GetSrcLine = [&oChunk, nXSize](int iLine)
+            {
+                return oChunk.aSrc.data() +
+                       static_cast<size_t>(iLine - oChunk.nSrcYOff) * nXSize;
+            };
+
+            // Whether each source line has nodata values
+            const int nSrcRows =
+                static_cast<int>(oChunk.aSrc.size() / nXSize);
+            std::vector<bool> abLineHasNoData(nSrcRows);
+            for (int i = 0; i < nSrcRows; ++i)
+            {
+                abLineHasNoData[i] =
+                    sCtxt.LineHasNoData(GetSrcLine(oChunk.nSrcYOff + i));
+            }
+
+            for (int i = oChunk.nYOff; i < oChunk.nYOff + oChunk.nRows; ++i)
+            {
+                float *pafOutputBuf =
+                    oChunk.afDst.data() +
+                    static_cast<size_t>(i - oChunk.nYOff) * nXSize;
+                if (i == 0)
+                {
+                    sCtxt.ProcessLine(i, GetSrcLine(0),
+                                      GetSrcLine(std::min(1, nYSize - 1)),
+                                      nullptr, false, pafOutputBuf);
+                }
+                else if (i == nYSize - 1)
+                {
+                    sCtxt.ProcessLine(i, GetSrcLine(i - 1), GetSrcLine(i),
+                                      nullptr, false, pafOutputBuf);
+                }
+                else
+                {
+                    const int iSrc = i - 1 - oChunk.nSrcYOff;
+                    sCtxt.ProcessLine(i, GetSrcLine(i - 1), GetSrcLine(i),
+                                      GetSrcLine(i + 1),
+                                      abLineHasNoData[iSrc] ||
+                                          abLineHasNoData[iSrc + 1] ||
+                                          abLineHasNoData[iSrc + 2],
+                                      pafOutputBuf);
+                }
+            }
+        };
+
+        const std::function<bool(const Chunk &)> pfnWrite =
+            [hDstBand, nXSize](const Chunk &oChunk)
+        {
+            return GDALRasterIO(hDstBand, GF_Write, 0, oChunk.nYOff, nXSize,
+                                oChunk.nRows,
+                                const_cast<float *>(oChunk.afDst.data()),
+                                nXSize, oChunk.nRows, GDT_Float32, 0,
+                                0) == CE_None;
+        };
+
+        const CPLErr eErr = GDALDEMProcessChunksMultiThreaded<Chunk>(
+            nYSize, nRowsPerChunk, nThreads, pfnRead, pfnCompute, pfnWrite,
+            pfnProgress, pProgressData);
+        if (eErr == CE_None)
+            pfnProgress(1.0, nullptr, pProgressData);
+        return eErr;
+    }
+
+    // 1 line destination buffer.
+    float *pafOutputBuf =
+        static_cast<float *>(VSI_MALLOC2_VERBOSE(sizeof(float), nXSize));
+    // 3 line rotating source buffer.
+    T *pafThreeLineWin =
+        static_cast<T *>(VSI_MALLOC2_VERBOSE(3 * sizeof(T), nXSize));
+    if (pafOutputBuf == nullptr || pafThreeLineWin == nullptr)
+    {
+        VSIFree(pafOutputBuf);
+        VSIFree(pafThreeLineWin);
+        return CE_Failure;
+    }
 
     int nLine1Off = 0;
     int nLine2Off = nXSize;
     int nLine3Off = 2 * nXSize;
 
-    // Move a 3x3 pafWindow over each cell
-    // (where the cell in question is #4)
-    //
-    //      0 1 2
-    //      3 4 5
-    //      6 7 8
-
     /* Preload the first 2 lines */
 
-    bool abLineHasNoDataValue[3] = {CPL_TO_BOOL(bSrcHasNoData),
-                                    CPL_TO_BOOL(bSrcHasNoData),
-                                    CPL_TO_BOOL(bSrcHasNoData)};
+    bool abLineHasNoDataValue[3] = {sCtxt.bSrcHasNoData, sCtxt.bSrcHasNoData,
+                                    sCtxt.bSrcHasNoData};
 
     for (int i = 0; i < 2 && i < nYSize; i++)
     {
@@ -425,78 +898,20 @@ static CPLErr GDALGeneric3x3Processing(
 
             return CE_Failure;
         }
-        if (bSrcHasNoData)
-        {
-            abLineHasNoDataValue[i] = false;
-            if constexpr (std::numeric_limits<T>::is_integer)
-            {
-                for (int iX = 0; iX < nXSize; iX++)
-                {
-                    if (pafThreeLineWin[i * nXSize + iX] == fSrcNoDataValue)
-                    {
-                        abLineHasNoDataValue[i] = true;
-                        break;
-                    }
-                }
-            }
-            else
-            {
-                for (int iX = 0; iX < nXSize; iX++)
-                {
-                    if (pafThreeLineWin[i * nXSize + iX] == fSrcNoDataValue ||
-                        std::isnan(pafThreeLineWin[i * nXSize + iX]))
-                    {
-                        abLineHasNoDataValue[i] = true;
-                        break;
-                    }
-                }
-            }
-        }
+        abLineHasNoDataValue[i] =
+            sCtxt.LineHasNoData(pafThreeLineWin + i * nXSize);
     }
 
-    CPLErr eErr = CE_None;
-    if (bComputeAtEdges && nXSize >= 2 && nYSize >= 2)
-    {
-        for (int j = 0; j < nXSize; j++)
-        {
-            int jmin = (j == 0) ? j : j - 1;
-            int jmax = (j == nXSize - 1) ? j : j + 1;
-
-            T afWin[9] = {
-                INTERPOL(pafThreeLineWin[jmin], pafThreeLineWin[nXSize + jmin],
-                         bSrcHasNoData, fSrcNoDataValue),
-                INTERPOL(pafThreeLineWin[j], pafThreeLineWin[nXSize + j],
-                         bSrcHasNoData, fSrcNoDataValue),
-                INTERPOL(pafThreeLineWin[jmax], pafThreeLineWin[nXSize + jmax],
-                         bSrcHasNoData, fSrcNoDataValue),
-                pafThreeLineWin[jmin],
-                pafThreeLineWin[j],
-                pafThreeLineWin[jmax],
-                pafThreeLineWin[nXSize + jmin],
-                pafThreeLineWin[nXSize + j],
-                pafThreeLineWin[nXSize + jmax]};
-            pafOutputBuf[j] = ComputeVal(
-                CPL_TO_BOOL(bSrcHasNoData), fSrcNoDataValue, bIsSrcNoDataNan,
-                afWin, fDstNoDataValue, pfnAlg, pData.get(), bComputeAtEdges);
-        }
-        eErr = GDALRasterIO(hDstBand, GF_Write, 0, 0, nXSize, 1, pafOutputBuf,
-                            nXSize, 1, GDT_Float32, 0, 0);
-    }
-    else
+    sCtxt.ProcessLine(0, pafThreeLineWin, pafThreeLineWin + nXSize, nullptr,
+                      false, pafOutputBuf);
+    CPLErr eErr = GDALRasterIO(hDstBand, GF_Write, 0, 0, nXSize, 1,
+                               pafOutputBuf, nXSize, 1, GDT_Float32, 0, 0);
+    if (eErr == CE_None && nYSize > 1 &&
+        !(bComputeAtEdges && nXSize >= 2 && nYSize >= 2))
     {
-        // Exclude the edges
-        for (int j = 0; j < nXSize; j++)
-        {
-            pafOutputBuf[j] = fDstNoDataValue;
-        }
-        eErr = GDALRasterIO(hDstBand, GF_Write, 0, 0, nXSize, 1, pafOutputBuf,
-                            nXSize, 1, GDT_Float32, 0, 0);
-
-        if (eErr == CE_None && nYSize > 1)
-        {
-            eErr = GDALRasterIO(hDstBand, GF_Write, 0, nYSize - 1, nXSize, 1,
-                                pafOutputBuf, nXSize, 1, GDT_Float32, 0, 0);
-        }
+        // Exclude the edges: pafOutputBuf is filled with the nodata value
+        eErr = GDALRasterIO(hDstBand, GF_Write, 0, nYSize - 1, nXSize, 1,
+                            pafOutputBuf, nXSize, 1, GDT_Float32, 0, 0);
     }
     if (eErr != CE_None)
     {
@@ -523,170 +938,21 @@ static CPLErr GDALGeneric3x3Processing(
 
         // In case none of the 3 lines have nodata values, then no need to
         // check it in ComputeVal()
-        bool bOneOfThreeLinesHasNoData = CPL_TO_BOOL(bSrcHasNoData);
-        if (bSrcHasNoData)
-        {
-            if constexpr (std::numeric_limits<T>::is_integer)
-            {
-                bool bLastLineHasNoDataValue = false;
-                int iX = 0;
-                for (; iX + 3 < nXSize; iX += 4)
-                {
-                    if (pafThreeLineWin[nLine3Off + iX] == fSrcNoDataValue ||
-                        pafThreeLineWin[nLine3Off + iX + 1] ==
-                            fSrcNoDataValue ||
-                        pafThreeLineWin[nLine3Off + iX + 2] ==
-                            fSrcNoDataValue ||
-                        pafThreeLineWin[nLine3Off + iX + 3] == fSrcNoDataValue)
-                    {
-                        bLastLineHasNoDataValue = true;
-                        break;
-                    }
-                }
-                if (!bLastLineHasNoDataValue)
-                {
-                    for (; iX < nXSize; iX++)
-                    {
-                        if (pafThreeLineWin[nLine3Off + iX] == fSrcNoDataValue)
-                        {
-                            bLastLineHasNoDataValue = true;
-                        }
-                    }
-                }
-                abLineHasNoDataValue[nLine3Off / nXSize] =
-                    bLastLineHasNoDataValue;
-
-                bOneOfThreeLinesHasNoData = abLineHasNoDataValue[0] ||
-                                            abLineHasNoDataValue[1] ||
-                                            abLineHasNoDataValue[2];
-            }
-            else
-            {
-                bool bLastLineHasNoDataValue = false;
-                int iX = 0;
-                for (; iX + 3 < nXSize; iX += 4)
-                {
-                    if (pafThreeLineWin[nLine3Off + iX] == fSrcNoDataValue ||
-                        std::isnan(pafThreeLineWin[nLine3Off + iX]) ||
-                        pafThreeLineWin[nLine3Off + iX + 1] ==
-                            fSrcNoDataValue ||
-                        std::isnan(pafThreeLineWin[nLine3Off + iX + 1]) ||
-                        pafThreeLineWin[nLine3Off + iX + 2] ==
-                            fSrcNoDataValue ||
-                        std::isnan(pafThreeLineWin[nLine3Off + iX + 2]) ||
-                        pafThreeLineWin[nLine3Off + iX + 3] ==
-                            fSrcNoDataValue ||
-                        std::isnan(pafThreeLineWin[nLine3Off + iX + 3]))
-                    {
-                        bLastLineHasNoDataValue = true;
-                        break;
-                    }
-                }
-                if (!bLastLineHasNoDataValue)
-                {
-                    for (; iX < nXSize; iX++)
-                    {
-                        if (pafThreeLineWin[nLine3Off + iX] ==
-                                fSrcNoDataValue ||
-                            std::isnan(pafThreeLineWin[nLine3Off + iX]))
-                        {
-                            bLastLineHasNoDataValue = true;
-                        }
-                    }
-                }
-                abLineHasNoDataValue[nLine3Off / nXSize] =
-                    bLastLineHasNoDataValue;
-
-                bOneOfThreeLinesHasNoData = abLineHasNoDataValue[0] ||
-                                            abLineHasNoDataValue[1] ||
-                                            abLineHasNoDataValue[2];
-            }
-        }
-
-        if (bComputeAtEdges && nXSize >= 2)
+        bool bOneOfThreeLinesHasNoData = sCtxt.bSrcHasNoData;
+        if (sCtxt.bSrcHasNoData)
         {
-            int j = 0;
-            T afWin[9] = {INTERPOL(pafThreeLineWin[nLine1Off + j],
-                                   pafThreeLineWin[nLine1Off + j + 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine1Off + j],
-                          pafThreeLineWin[nLine1Off + j + 1],
-                          INTERPOL(pafThreeLineWin[nLine2Off + j],
-                                   pafThreeLineWin[nLine2Off + j + 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine2Off + j],
-                          pafThreeLineWin[nLine2Off + j + 1],
-                          INTERPOL(pafThreeLineWin[nLine3Off + j],
-                                   pafThreeLineWin[nLine3Off + j + 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine3Off + j],
-                          pafThreeLineWin[nLine3Off + j + 1]};
-
-            pafOutputBuf[j] = ComputeVal(
-                bOneOfThreeLinesHasNoData, fSrcNoDataValue, bIsSrcNoDataNan,
-                afWin, fDstNoDataValue, pfnAlg, pData.get(), bComputeAtEdges);
-        }
-        else
-        {
-            // Exclude the edges
-            pafOutputBuf[0] = fDstNoDataValue;
-        }
-
-        int j = 1;
-        if (pfnAlg_multisample && !bOneOfThreeLinesHasNoData)
-        {
-            j = pfnAlg_multisample(
-                pafThreeLineWin + nLine1Off, pafThreeLineWin + nLine2Off,
-                pafThreeLineWin + nLine3Off, nXSize, pData.get(), pafOutputBuf);
-        }
+            abLineHasNoDataValue[nLine3Off / nXSize] =
+                sCtxt.LineHasNoData(pafThreeLineWin + nLine3Off);
 
-        for (; j < nXSize - 1; j++)
-        {
-            T afWin[9] = {pafThreeLineWin[nLine1Off + j - 1],
-                          pafThreeLineWin[nLine1Off + j],
-                          pafThreeLineWin[nLine1Off + j + 1],
-                          pafThreeLineWin[nLine2Off + j - 1],
-                          pafThreeLineWin[nLine2Off + j],
-                          pafThreeLineWin[nLine2Off + j + 1],
-                          pafThreeLineWin[nLine3Off + j - 1],
-                          pafThreeLineWin[nLine3Off + j],
-                          pafThreeLineWin[nLine3Off + j + 1]};
-
-            pafOutputBuf[j] = ComputeVal(
-                bOneOfThreeLinesHasNoData, fSrcNoDataValue, bIsSrcNoDataNan,
-                afWin, fDstNoDataValue, pfnAlg, pData.get(), bComputeAtEdges);
+            bOneOfThreeLinesHasNoData = abLineHasNoDataValue[0] ||
+                                        abLineHasNoDataValue[1] ||
+                                        abLineHasNoDataValue[2];
         }
 
-        if (bComputeAtEdges && nXSize >= 2)
-        {
-            j = nXSize - 1;
-
-            T afWin[9] = {pafThreeLineWin[nLine1Off + j - 1],
-                          pafThreeLineWin[nLine1Off + j],
-                          INTERPOL(pafThreeLineWin[nLine1Off + j],
-                                   pafThreeLineWin[nLine1Off + j - 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine2Off + j - 1],
-                          pafThreeLineWin[nLine2Off + j],
-                          INTERPOL(pafThreeLineWin[nLine2Off + j],
-                                   pafThreeLineWin[nLine2Off + j - 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine3Off + j - 1],
-                          pafThreeLineWin[nLine3Off + j],
-                          INTERPOL(pafThreeLineWin[nLine3Off + j],
-                                   pafThreeLineWin[nLine3Off + j - 1],
-                                   bSrcHasNoData, fSrcNoDataValue)};
-
-            pafOutputBuf[j] = ComputeVal(
-                bOneOfThreeLinesHasNoData, fSrcNoDataValue, bIsSrcNoDataNan,
-                afWin, fDstNoDataValue, pfnAlg, pData.get(), bComputeAtEdges);
-        }
-        else
-        {
-            // Exclude the edges
-            if (nXSize > 1)
-                pafOutputBuf[nXSize - 1] = fDstNoDataValue;
-        }
+        sCtxt.ProcessLine(i, pafThreeLineWin + nLine1Off,
+                          pafThreeLineWin + nLine2Off,
+                          pafThreeLineWin + nLine3Off,
+                          bOneOfThreeLinesHasNoData, pafOutputBuf);
 
         /* -----------------------------------------
          * Write Line to Raster
@@ -720,33 +986,9 @@ static CPLErr GDALGeneric3x3Processing(
 
     if (bComputeAtEdges && nXSize >= 2 && nYSize >= 2)
     {
-        for (int j = 0; j < nXSize; j++)
-        {
-            int jmin = (j == 0) ? j : j - 1;
-            int jmax = (j == nXSize - 1) ? j : j + 1;
-
-            T afWin[9] = {
-                pafThreeLineWin[nLine1Off + jmin],
-                pafThreeLineWin[nLine1Off + j],
-                pafThreeLineWin[nLine1Off + jmax],
-                pafThreeLineWin[nLine2Off + jmin],
-                pafThreeLineWin[nLine2Off + j],
-                pafThreeLineWin[nLine2Off + jmax],
-                INTERPOL(pafThreeLineWin[nLine2Off + jmin],
-                         pafThreeLineWin[nLine1Off + jmin], bSrcHasNoData,
-                         fSrcNoDataValue),
-                INTERPOL(pafThreeLineWin[nLine2Off + j],
-                         pafThreeLineWin[nLine1Off + j], bSrcHasNoData,
-                         fSrcNoDataValue),
-                INTERPOL(pafThreeLineWin[nLine2Off + jmax],
-                         pafThreeLineWin[nLine1Off + jmax], bSrcHasNoData,
-                         fSrcNoDataValue),
-            };
-
-            pafOutputBuf[j] = ComputeVal(
-                CPL_TO_BOOL(bSrcHasNoData), fSrcNoDataValue, bIsSrcNoDataNan,
-                afWin, fDstNoDataValue, pfnAlg, pData.get(), bComputeAtEdges);
-        }
+        sCtxt.ProcessLine(i, pafThreeLineWin + nLine1Off,
+                          pafThreeLineWin + nLine2Off, nullptr, false,
+                          pafOutputBuf);
         eErr = GDALRasterIO(hDstBand, GF_Write, 0, i, nXSize, 1, pafOutputBuf,
                             nXSize, 1, GDT_Float32, 0, 0);
         if (eErr != CE_None)
@@ -2029,7 +2271,7 @@ static CPLErr
 GDALColorRelief(GDALRasterBandH hSrcBand, GDALRasterBandH hDstBand1,
                 GDALRasterBandH hDstBand2, GDALRasterBandH hDstBand3,
                 GDALRasterBandH hDstBand4, const char *pszColorFilename,
-                ColorSelectionMode eColorSelectionMode,
+                ColorSelectionMode eColorSelectionMode, int nThreads,
                 GDALProgressFunc pfnProgress, void *pProgressData)
 {
     if (hSrcBand == nullptr || hDstBand1 == nullptr || hDstBand2 == nullptr ||
@@ -2060,6 +2302,135 @@ GDALColorRelief(GDALRasterBandH hSrcBand, GDALRasterBandH hDstBand1,
     const int nXSize = GDALGetRasterBandXSize(hSrcBand);
     const int nYSize = GDALGetRasterBandYSize(hSrcBand);
 
+    // Computes nCount pixels from either panSourceBuf or pafSourceBuf
+    const auto ComputeColors =
+        [&asColorAssociation, &pabyPrecomputed, nIndexOffset,
+         eColorSelectionMode](const int *panSourceBuf,
+                              const float *pafSourceBuf, size_t nCount,
+                              GByte *pabyDestBuf1, GByte *pabyDestBuf2,
+                              GByte *pabyDestBuf3, GByte *pabyDestBuf4)
+    {
+        if (pabyPrecomputed)
+        {
+            const auto pabyPrecomputedRaw = pabyPrecomputed.get();
+            for (size_t j = 0; j < nCount; j++)
+            {
+                int nIndex = panSourceBuf[j] + nIndexOffset;
+                pabyDestBuf1[j] = pabyPrecomputedRaw[4 * nIndex];
+                pabyDestBuf2[j] = pabyPrecomputedRaw[4 * nIndex + 1];
+                pabyDestBuf3[j] = pabyPrecomputedRaw[4 * nIndex + 2];
+                pabyDestBuf4[j] = pabyPrecomputedRaw[4 * nIndex + 3];
+            }
+        }
+        else
+        {
+            int nR = 0;
+            int nG = 0;
+            int nB = 0;
+            int nA = 0;
+            for (size_t j = 0; j < nCount; j++)
+            {
+                GDALColorReliefGetRGBA(asColorAssociation, pafSourceBuf[j],
+                                       eColorSelectionMode, &nR, &nG, &nB, &nA);
+                pabyDestBuf1[j] = static_cast<GByte>(nR);
+                pabyDestBuf2[j] = static_cast<GByte>(nG);
+                pabyDestBuf3[j] = static_cast<GByte>(nB);
+                pabyDestBuf4[j] = static_cast<GByte>(nA);
+            }
+        }
+    };
+
+    /* -------------------------------------------------------------------- */
+    /*      Multi-threaded processing, by chunks of lines.                  */
+    /* -------------------------------------------------------------------- */
+    const int nRowsPerChunk = GDALDEMGetRowsPerChunk(hDstBand1, nXSize);
+    if (nThreads > 1 && nYSize > nRowsPerChunk)
+    {
+        if (!pfnProgress(0.0, nullptr, pProgressData))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            return CE_Failure;
+        }
+
+        struct Chunk
+        {
+            int nYOff = 0;
+            int nRows = 0;
+            std::vector<int> anSrc{};
+            std::vector<float> afSrc{};
+            std::vector<GByte> abyDst{};
+        };
+
+        const std::function<bool(int, int, Chunk &)> pfnRead =
+            [&pabyPrecomputed, hSrcBand, nXSize](int nYOff, int nRows,
+                                                 Chunk &oChunk)
+        {
+            oChunk.nYOff = nYOff;
+            oChunk.nRows = nRows;
+            const size_t nPixels = static_cast<size_t>(nRows) * nXSize;
+            try
+            {
+                if (pabyPrecomputed)
+                    oChunk.anSrc.resize(nPixels);
+                else
+                    oChunk.afSrc.resize(nPixels);
+                oChunk.abyDst.resize(4 * nPixels);
+            }
+            catch (const std::bad_alloc &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Cannot allocate chunk buffers");
+                return false;
+            }
+            void *pSrc = pabyPrecomputed
+                             ? static_cast<void *>(oChunk.anSrc.data())
+                             : static_cast<void *>(oChunk.afSrc.data());
+            return GDALRasterIO(hSrcBand, GF_Read, 0, nYOff, nXSize, nRows,
+                                pSrc, nXSize, nRows,
+                                pabyPrecomputed ? GDT_Int32 : GDT_Float32, 0,
+                                0) == CE_None;
+        };
+
+        const std::function<void(Chunk &)> pfnCompute =
+            [&ComputeColors](Chunk &oChunk)
+        {
+            const size_t nPixels = oChunk.abyDst.size() / 4;
+            GByte *pabyDst = oChunk.abyDst.data();
+            ComputeColors(oChunk.anSrc.data(), oChunk.afSrc.data(), nPixels,
+                          pabyDst, pabyDst + nPixels, pabyDst + 2 * nPixels,
+                          pabyDst + 3 * nPixels);
+        };
+
+        const GDALRasterBandH ahDstBands[] = {hDstBand1, hDstBand2, hDstBand3,
+                                              hDstBand4};
+        const std::function<bool(const Chunk &)> pfnWrite =
+            [&ahDstBands, nXSize](const Chunk &oChunk)
+        {
+            const size_t nPixels = oChunk.abyDst.size() / 4;
+            for (int iBand = 0; iBand < 4; ++iBand)
+            {
+                if (ahDstBands[iBand] &&
+                    GDALRasterIO(ahDstBands[iBand], GF_Write, 0, oChunk.nYOff,
+                                 nXSize, oChunk.nRows,
+                                 const_cast<GByte *>(oChunk.abyDst.data()) +
+                                     iBand * nPixels,
+                                 nXSize, oChunk.nRows, GDT_Byte, 0,
+                                 0) != CE_None)
+                {
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        const CPLErr eErr = GDALDEMProcessChunksMultiThreaded<Chunk>(
+            nYSize, nRowsPerChunk, nThreads, pfnRead, pfnCompute, pfnWrite,
+            pfnProgress, pProgressData);
+        if (eErr == CE_None)
+            pfnProgress(1.0, nullptr, pProgressData);
+        return eErr;
+    }
+
     std::unique_ptr<float, VSIFreeReleaser> pafSourceBuf;
     std::unique_ptr<int, VSIFreeReleaser> panSourceBuf;
     if (pabyPrecomputed)
@@ -2088,11 +2459,6 @@ GDALColorRelief(GDALRasterBandH hSrcBand, GDALRasterBandH hDstBand1,
         return CE_Failure;
     }
 
-    int nR = 0;
-    int nG = 0;
-    int nB = 0;
-    int nA = 0;
-
     for (int i = 0; i < nYSize; i++)
     {
         /* Read source buffer */
@@ -2106,32 +2472,8 @@ GDALColorRelief(GDALRasterBandH hSrcBand, GDALRasterBandH hDstBand1,
             return eErr;
         }
 
-        if (pabyPrecomputed)
-        {
-            const auto pabyPrecomputedRaw = pabyPrecomputed.get();
-            const auto panSourceBufRaw = panSourceBuf.get();
-            for (int j = 0; j < nXSize; j++)
-            {
-                int nIndex = panSourceBufRaw[j] + nIndexOffset;
-                pabyDestBuf1[j] = pabyPrecomputedRaw[4 * nIndex];
-                pabyDestBuf2[j] = pabyPrecomputedRaw[4 * nIndex + 1];
-                pabyDestBuf3[j] = pabyPrecomputedRaw[4 * nIndex + 2];
-                pabyDestBuf4[j] = pabyPrecomputedRaw[4 * nIndex + 3];
-            }
-        }
-        else
-        {
-            const auto pafSourceBufRaw = pafSourceBuf.get();
-            for (int j = 0; j < nXSize; j++)
-            {
-                GDALColorReliefGetRGBA(asColorAssociation, pafSourceBufRaw[j],
-                                       eColorSelectionMode, &nR, &nG, &nB, &nA);
-                pabyDestBuf1[j] = static_cast<GByte>(nR);
-                pabyDestBuf2[j] = static_cast<GByte>(nG);
-                pabyDestBuf3[j] = static_cast<GByte>(nB);
-                pabyDestBuf4[j] = static_cast<GByte>(nA);
-            }
-        }
+        ComputeColors(panSourceBuf.get(), pafSourceBuf.get(), nXSize,
+                      pabyDestBuf1, pabyDestBuf2, pabyDestBuf3, pabyDestBuf4);
 
         /* -----------------------------------------
          * Write Line to Raster
@@ -4042,6 +4384,56 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
 
     const GDALDataType eSrcDT = GDALGetRasterDataType(hSrcBand);
 
+    const int nThreads =
+        GDALDEMGetNumThreads(psOptions->aosCreationOptions.List());
+    const int nDstBands =
+        eUtilityMode == COLOR_RELIEF ? ((psOptions->bAddAlpha) ? 4 : 3) : 1;
+
+    // Computes the output into the bands of hDstDataset
+    const auto Process = [&](GDALDatasetH hDstDataset,
+                             GDALProgressFunc pfnProgressIn,
+                             void *pProgressDataIn)
+    {
+        GDALSetGeoTransform(hDstDataset, adfGeoTransform);
+        GDALSetProjection(hDstDataset, GDALGetProjectionRef(hSrcDataset));
+
+        CPLErr eErr;
+        if (eUtilityMode == COLOR_RELIEF)
+        {
+            eErr = GDALColorRelief(
+                hSrcBand, GDALGetRasterBand(hDstDataset, 1),
+                GDALGetRasterBand(hDstDataset, 2),
+                GDALGetRasterBand(hDstDataset, 3),
+                psOptions->bAddAlpha ? GDALGetRasterBand(hDstDataset, 4)
+                                     : nullptr,
+                pszColorFilename, psOptions->eColorSelectionMode, nThreads,
+                pfnProgressIn, pProgressDataIn);
+        }
+        else
+        {
+            GDALRasterBandH hDstBand = GDALGetRasterBand(hDstDataset, 1);
+            if (bDstHasNoData)
+                GDALSetRasterNoDataValue(hDstBand, dfDstNoDataValue);
+
+            if (eSrcDT == GDT_Byte || eSrcDT == GDT_Int16 ||
+                eSrcDT == GDT_UInt16)
+            {
+                eErr = GDALGeneric3x3Processing<GInt32>(
+                    hSrcBand, hDstBand, pfnAlgInt32, pfnAlgInt32_multisample,
+                    std::move(pData), psOptions->bComputeAtEdges, nThreads,
+                    pfnProgressIn, pProgressDataIn);
+            }
+            else
+            {
+                eErr = GDALGeneric3x3Processing<float>(
+                    hSrcBand, hDstBand, pfnAlgFloat, pfnAlgFloat_multisample,
+                    std::move(pData), psOptions->bComputeAtEdges, nThreads,
+                    pfnProgressIn, pProgressDataIn);
+            }
+        }
+        return eErr;
+    };
+
     if (hDriver == nullptr ||
         (GDALGetMetadataItem(hDriver, GDAL_DCAP_RASTER, nullptr) != nullptr &&
          ((bForceUseIntermediateDataset ||
@@ -4050,6 +4442,69 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
           GDALGetMetadataItem(hDriver, GDAL_DCAP_CREATECOPY, nullptr) !=
               nullptr)))
     {
+        if (hDriver && nThreads > 1)
+        {
+            // The output is computed by chunks on several threads into a
+            // temporary uncompressed dataset, in memory if it is small
+            // enough, that is then copied to the output with CreateCopy().
+            // The writes of the output dataset are thus still sequential.
+            const double dfTmpSize = static_cast<double>(nXSize) * nYSize *
+                                     nDstBands *
+                                     GDALGetDataTypeSizeBytes(eDstDataType);
+            const bool bTmpInMemory =
+                dfTmpSize <
+                static_cast<double>(CPLGetUsablePhysicalRAM()) / 10;
+            GDALDriverH hTmpDriver =
+                GDALGetDriverByName(bTmpInMemory ? "MEM" : "GTiff");
+            const std::string osTmpFilename =
+                bTmpInMemory ? std::string()
+                             : CPLGenerateTempFilenameSafe("gdaldem") + ".tif";
+            CPLStringList aosTmpOptions;
+            if (!bTmpInMemory)
+            {
+                aosTmpOptions.SetNameValue("TILED", "YES");
+                aosTmpOptions.SetNameValue("BIGTIFF", "IF_SAFER");
+            }
+            GDALDatasetH hTmpDS =
+                hTmpDriver ? GDALCreate(hTmpDriver, osTmpFilename.c_str(),
+                                        nXSize, nYSize, nDstBands,
+                                        eDstDataType, aosTmpOptions.List())
+                           : nullptr;
+            if (hTmpDS)
+            {
+                CPLDebug("GDALDEM",
+                         "Computing on %d threads into a temporary %s "
+                         "dataset before CreateCopy()",
+                         nThreads, bTmpInMemory ? "in-memory" : "GTiff");
+                void *pScaledProgress = GDALCreateScaledProgress(
+                    0.0, 0.5, pfnProgress, pProgressData);
+                const CPLErr eErr =
+                    Process(hTmpDS, pScaledProgress ? GDALScaledProgress
+                                                    : GDALDummyProgress,
+                            pScaledProgress);
+                GDALDestroyScaledProgress(pScaledProgress);
+
+                GDALDatasetH hOutDS = nullptr;
+                if (eErr == CE_None)
+                {
+                    pScaledProgress = GDALCreateScaledProgress(
+                        0.5, 1.0, pfnProgress, pProgressData);
+                    hOutDS = GDALCreateCopy(
+                        hDriver, pszDest, hTmpDS, TRUE,
+                        psOptions->aosCreationOptions.List(),
+                        pScaledProgress ? GDALScaledProgress
+                                        : GDALDummyProgress,
+                        pScaledProgress);
+                    GDALDestroyScaledProgress(pScaledProgress);
+                }
+
+                GDALClose(hTmpDS);
+                if (!bTmpInMemory)
+                    VSIUnlink(osTmpFilename.c_str());
+                return hOutDS;
+            }
+        }
+
         GDALDatasetH hIntermediateDataset = nullptr;
 
         if (eUtilityMode == COLOR_RELIEF)
@@ -4108,9 +4563,6 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
         return hOutDS;
     }
 
-    const int nDstBands =
-        eUtilityMode == COLOR_RELIEF ? ((psOptions->bAddAlpha) ? 4 : 3) : 1;
-
     GDALDatasetH hDstDataset =
         GDALCreate(hDriver, pszDest, nXSize, nYSize, nDstBands, eDstDataType,
                    psOptions->aosCreationOptions.List());
@@ -4122,41 +4574,7 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
         return nullptr;
     }
 
-    GDALRasterBandH hDstBand = GDALGetRasterBand(hDstDataset, 1);
-
-    GDALSetGeoTransform(hDstDataset, adfGeoTransform);
-    GDALSetProjection(hDstDataset, GDALGetProjectionRef(hSrcDataset));
-
-    if (eUtilityMode == COLOR_RELIEF)
-    {
-        GDALColorRelief(hSrcBand, GDALGetRasterBand(hDstDataset, 1),
-                        GDALGetRasterBand(hDstDataset, 2),
-                        GDALGetRasterBand(hDstDataset, 3),
-                        psOptions->bAddAlpha ? GDALGetRasterBand(hDstDataset, 4)
-                                             : nullptr,
-                        pszColorFilename, psOptions->eColorSelectionMode,
-                        pfnProgress, pProgressData);
-    }
-    else
-    {
-        if (bDstHasNoData)
-            GDALSetRasterNoDataValue(hDstBand, dfDstNoDataValue);
-
-        if (eSrcDT == GDT_Byte || eSrcDT == GDT_Int16 || eSrcDT == GDT_UInt16)
-        {
-            GDALGeneric3x3Processing<GInt32>(
-                hSrcBand, hDstBand, pfnAlgInt32, pfnAlgInt32_multisample,
-                std::move(pData), psOptions->bComputeAtEdges, pfnProgress,
-                pProgressData);
-        }
-        else
-        {
-            GDALGeneric3x3Processing<float>(
-                hSrcBand, hDstBand, pfnAlgFloat, pfnAlgFloat_multisample,
-                std::move(pData), psOptions->bComputeAtEdges, pfnProgress,
-                pProgressData);
-        }
-    }
+    Process(hDstDataset, pfnProgress, pProgressData);
 
     return hDstDataset;
 }
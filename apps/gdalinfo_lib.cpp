@@ -90,6 +90,14 @@ struct GDALInfoOptions
     /*! force computation of the checksum for each band in the dataset */
     bool bComputeChecksum = false;
 
+    /*! algorithm of the hash of the pixel values of the dataset to compute
+        (XXH64 or SHA256), or empty */
+    std::string osHashAlgorithm{};
+
+    /*! number of threads used to compute the hash, or empty to use
+        GDAL_NUM_THREADS */
+    std::string osNumThreads{};
+
     /*! allow or suppress printing of nodata value */
     bool bShowNodata = true;
 
@@ -286,6 +294,17 @@ GDALInfoAppOptionsGetParser(GDALInfoOptions *psOptions,
         .help(_(
             "Force computation of the checksum for each band in the dataset."));
 
+    argParser->add_argument("-hash")
+        .metavar("<XXH64|SHA256>")
+        .choices("XXH64", "SHA256")
+        .store_into(psOptions->osHashAlgorithm)
+        .help(_("Compute a hash of the pixel values of the dataset."));
+
+    argParser->add_argument("-num_threads")
+        .metavar("<value>")
+        .store_into(psOptions->osNumThreads)
+        .help(_("Number of threads used to compute the hash, or ALL_CPUS."));
+
     argParser->add_argument("-listmdd")
         .flag()
         .store_into(psOptions->bListMDD)
@@ -991,6 +1010,56 @@ char *GDALInfo(GDALDatasetH hDataset, const GDALInfoOptions *psOptions)
         hTransform = nullptr;
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Compute the hash of the pixel values of the dataset.            */
+    /* -------------------------------------------------------------------- */
+    if (!psOptions->osHashAlgorithm.empty())
+    {
+        CPLStringList aosHashOptions;
+        aosHashOptions.SetNameValue("ALGORITHM",
+                                    psOptions->osHashAlgorithm.c_str());
+        if (!psOptions->osNumThreads.empty())
+        {
+            aosHashOptions.SetNameValue("NUM_THREADS",
+                                        psOptions->osNumThreads.c_str());
+        }
+        char *pszHash = GDALComputeDatasetHash(hDataset, aosHashOptions.List(),
+                                               nullptr, nullptr);
+        if (!pszHash)
+        {
+            if (bJson)
+            {
+                json_object_put(poJsonObject);
+                json_object_put(poBands);
+                json_object_put(poStac);
+                json_object_put(poStacRasterBands);
+                json_object_put(poStacEOBands);
+            }
+            if (psOptionsToFree != nullptr)
+                GDALInfoOptionsFree(psOptionsToFree);
+            return nullptr;
+        }
+        else
+        {
+            if (bJson)
+            {
+                json_object *poHash = json_object_new_object();
+                json_object_object_add(
+                    poHash, "algorithm",
+                    json_object_new_string(psOptions->osHashAlgorithm.c_str()));
+                json_object_object_add(poHash, "value",
+                                       json_object_new_string(pszHash));
+                json_object_object_add(poJsonObject, "hash", poHash);
+            }
+            else
+            {
+                Concat(osStr, psOptions->bStdoutOutput, "Hash (%s): %s\n",
+                       psOptions->osHashAlgorithm.c_str(), pszHash);
+            }
+            CPLFree(pszHash);
+        }
+    }
+
     /* ==================================================================== */
     /*      Loop over bands.                                                */
     /* ==================================================================== */
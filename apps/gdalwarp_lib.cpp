@@ -2721,7 +2721,14 @@ GDALWarpDirect(const char *pszDest, GDALDatasetH hDstDS, int nSrcCount,
          */
         GDALTransformerArgUniquePtr hTransformArg;
         if (hUniqueTransformArg)
+        {
             hTransformArg = std::move(hUniqueTransformArg);
+            // The transformer was created before the output dataset. Let it
+            // know its dimensions, for TRANSFORM_GRID_CACHE.
+            GDALSetGenImgProjTransformerDstSize(hTransformArg.get(),
+                                                GDALGetRasterXSize(hDstDS),
+                                                GDALGetRasterYSize(hDstDS));
+        }
         else
         {
             hTransformArg.reset(GDALCreateGenImgProjTransformer2(
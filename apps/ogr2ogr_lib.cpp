@@ -6542,7 +6542,24 @@ bool LayerTranslator::Translate(
         else if (psOptions->nFIDToFetch != OGRNullFID)
             poFeature.reset(poSrcLayer->GetFeature(psOptions->nFIDToFetch));
         else
-            poFeature.reset(poSrcLayer->GetNextFeature());
+        {
+            // Recycle the feature of the previous iteration, so that the
+            // source driver can reuse its field values and geometry.
+            if (!poFeature)
+            {
+                if (psInfo->m_bCanAvoidSetFrom && poDstFeature)
+                {
+                    poFeature = std::move(poDstFeature);
+                    poFeature->SetFDefnUnsafe(poSrcFDefn);
+                }
+                else
+                {
+                    poFeature = std::make_unique<OGRFeature>(poSrcFDefn);
+                }
+            }
+            if (!poSrcLayer->GetNextFeatureInto(*poFeature))
+                poFeature.reset();
+        }
 
         if (poFeature == nullptr)
         {
@@ -11,6 +11,7 @@
 # SPDX-License-Identifier: MIT
 ###############################################################################
 
+import math
 import struct
 
 import gdaltest
@@ -607,3 +608,72 @@ cellsize     1
             elev_values.append((f["ELEV_MIN"], f["ELEV_MAX"]))
 
         assert elev_values == expected_elev_values, (elev_values, expected_elev_values)
+
+
+###############################################################################
+# Test that multi-threaded processing by strips gives the same contours as
+# single-threaded processing
+
+
+@pytest.mark.parametrize("polygonize", [False, True])
+def test_contour_num_threads(polygonize):
+
+    xsize = 61
+    ysize = 47
+    src_ds = gdal.GetDriverByName("MEM").Create("", xsize, ysize, 1, gdal.GDT_Float64)
+    data = b"".join(
+        struct.pack(
+            "d",
+            10 * math.sin(x * 0.21) * math.cos(y * 0.17) + 0.01 * x + 0.037 * y,
+        )
+        for y in range(ysize)
+        for x in range(xsize)
+    )
+    src_ds.GetRasterBand(1).WriteRaster(0, 0, xsize, ysize, data)
+
+    def _contour(num_threads):
+        ogr_ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+        lyr = ogr_ds.CreateLayer(
+            "contour", geom_type=ogr.wkbPolygon if polygonize else ogr.wkbLineString
+        )
+        lyr.CreateField(ogr.FieldDefn("ID", ogr.OFTInteger))
+        lyr.CreateField(ogr.FieldDefn("ELEV", ogr.OFTReal))
+        options = [
+            "LEVEL_INTERVAL=2.5",
+            "ID_FIELD=0",
+            "ELEV_FIELD_MIN=1" if polygonize else "ELEV_FIELD=1",
+        ]
+        if num_threads:
+            options.append(f"NUM_THREADS={num_threads}")
+        if polygonize:
+            options.append("POLYGONIZE=YES")
+        with gdal.config_option("GDAL_CONTOUR_ROWS_PER_STRIP", "5"):
+            assert (
+                gdal.ContourGenerateEx(src_ds.GetRasterBand(1), lyr, options=options)
+                == gdal.CE_None
+            )
+        res = {}
+        wkts = []
+        for f in lyr:
+            g = f.GetGeometryRef()
+            wkts.append(g.ExportToWkt())
+            count, measure = res.get(f["ELEV"], (0, 0))
+            res[f["ELEV"]] = (
+                count + 1,
+                measure + (g.GetArea() if polygonize else g.Length()),
+            )
+        return res, wkts
+
+    ref, ref_wkts = _contour(1)
+    assert ref
+
+    # Single-threaded by default, even if GDAL_NUM_THREADS is set, so that
+    # the order of the features is unchanged
+    with gdal.config_option("GDAL_NUM_THREADS", "ALL_CPUS"):
+        assert _contour(None)[1] == ref_wkts
+
+    got, _ = _contour(3)
+    assert set(got.keys()) == set(ref.keys())
+    for elev in ref:
+        assert got[elev][0] == ref[elev][0], elev
+        assert got[elev][1] == pytest.approx(ref[elev][1], rel=1e-12), elev
@@ -12,6 +12,7 @@
 ###############################################################################
 
 import array
+import random
 import struct
 
 import pytest
@@ -386,3 +387,91 @@ def test_fillnodata_nearest(
         for i in range(height)
     ]
     assert got == expected
+
+
+###############################################################################
+# Test that processing by strips, with several threads, or with the quadrant
+# search index, gives the same result as the processing by lines.
+
+
+@pytest.mark.parametrize("interpolation", ["INV_DIST", "NEAREST"])
+@pytest.mark.parametrize("smoothing_iterations", [0, 2])
+@pytest.mark.parametrize("user_mask", [False, True])
+@pytest.mark.parametrize(
+    "use_strips,num_threads,quadrant_search",
+    [
+        ("NO", 1, "INDEX"),
+        ("YES", 1, "SCAN"),
+        ("YES", 3, "SCAN"),
+        ("YES", 3, "INDEX"),
+    ],
+)
+def test_fillnodata_strips_threads_index(
+    interpolation,
+    smoothing_iterations,
+    user_mask,
+    use_strips,
+    num_threads,
+    quadrant_search,
+):
+
+    width = 37
+    height = 29
+    rng = random.Random(0)
+    values = array.array(
+        "f",
+        [
+            0 if rng.random() < 0.8 else rng.uniform(1, 1000)
+            for _ in range(width * height)
+        ],
+    )
+
+    def fill(options, config_options):
+        ds = gdal.GetDriverByName("MEM").Create("", width, height, 2, gdal.GDT_Float32)
+        ds.GetRasterBand(1).SetNoDataValue(0)
+        ds.GetRasterBand(1).WriteRaster(0, 0, width, height, values.tobytes())
+        mask_band = None
+        if user_mask:
+            mask_band = ds.GetRasterBand(2)
+            mask_band.WriteRaster(
+                0,
+                0,
+                width,
+                height,
+                array.array(
+                    "f", [255 if v != 0 and v < 900 else 0 for v in values]
+                ).tobytes(),
+            )
+        with gdal.config_options(config_options):
+            gdal.FillNodata(
+                targetBand=ds.GetRasterBand(1),
+                maxSearchDist=6.5,
+                maskBand=mask_band,
+                smoothingIterations=smoothing_iterations,
+                options=["TEMP_FILE_DRIVER=MEM", "INTERPOLATION=" + interpolation]
+                + options,
+            )
+        return ds.GetRasterBand(1).ReadRaster()
+
+    expected = fill([], {"GDAL_FILLNODATA_USE_STRIPS": "NO"})
+    got = fill(
+        ["NUM_THREADS=%d" % num_threads, "QUADRANT_SEARCH=" + quadrant_search],
+        {
+            "GDAL_FILLNODATA_USE_STRIPS": use_strips,
+            "GDAL_FILLNODATA_ROWS_PER_STRIP": "4",
+        },
+    )
+    assert got == expected
+
+
+def test_fillnodata_invalid_quadrant_search():
+
+    ds = gdal.GetDriverByName("MEM").Create("", 1, 1)
+    with pytest.raises(Exception, match="Unsupported quadrant search method"):
+        gdal.FillNodata(
+            targetBand=ds.GetRasterBand(1),
+            maxSearchDist=1,
+            maskBand=None,
+            smoothingIterations=0,
+            options=["QUADRANT_SEARCH=INVALID"],
+        )
@@ -13,6 +13,7 @@
 ###############################################################################
 
 
+import random
 import struct
 from collections import defaultdict
 
@@ -427,3 +428,84 @@ def test_polygonize_8():
         wkt
         == "POLYGON ((1 4,1 3,0 3,0 1,1 1,1 0,3 0,3 1,4 1,4 3,3 3,3 4,1 4),(1 3,3 3,3 1,1 1,1 3))"
     )
+
+
+###############################################################################
+# Test that multi-threaded polygonization, which processes the raster by
+# horizontal strips and stitches polygons crossing strip boundaries, gives
+# the same polygons as the single-threaded one.
+
+
+@pytest.mark.parametrize("connectedness", [4, 8])
+@pytest.mark.parametrize("is_int_polygonize", [True, False])
+def test_polygonize_multithreaded(connectedness, is_int_polygonize):
+
+    rng = random.Random(0)
+    xsize = 37
+    ysize = 53
+    src_ds = gdal.GetDriverByName("MEM").Create("", xsize, ysize, 1, gdal.GDT_Int16)
+    src_band = src_ds.GetRasterBand(1)
+    src_band.SetNoDataValue(255)
+    src_band.WriteRaster(
+        0,
+        0,
+        xsize,
+        ysize,
+        struct.pack(
+            "h" * (xsize * ysize),
+            *[
+                255 if rng.random() < 0.1 else rng.randint(0, 2)
+                for _ in range(xsize * ysize)
+            ],
+        ),
+    )
+
+    def polygonize(options, sort=True):
+        mem_ds = ogr.GetDriverByName("MEM").CreateDataSource("out")
+        mem_layer = mem_ds.CreateLayer("poly", None, ogr.wkbPolygon)
+        mem_layer.CreateField(ogr.FieldDefn("DN", ogr.OFTInteger))
+        if connectedness == 8:
+            options = options + ["8CONNECTED=8"]
+        func = gdal.Polygonize if is_int_polygonize else gdal.FPolygonize
+        assert func(src_band, src_band.GetMaskBand(), mem_layer, 0, options) == 0
+        ret = []
+        for f in mem_layer:
+            geom = f.GetGeometryRef()
+            ret.append(
+                (
+                    f.GetField("DN"),
+                    geom.GetGeometryRef(0).GetEnvelope(),
+                    geom.GetArea(),
+                    geom.GetGeometryCount(),
+                    geom.Clone(),
+                )
+            )
+        if sort:
+            ret.sort(key=lambda x: x[0:4])
+        return ret
+
+    ref = polygonize([])
+    with gdal.config_option("GDAL_POLYGONIZE_ROWS_PER_STRIP", "3"):
+        got = polygonize(["NUM_THREADS=4"])
+
+        # NUM_THREADS does not default to GDAL_NUM_THREADS, so the feature
+        # order is the single-threaded one
+        ref_unsorted = polygonize([], sort=False)
+        with gdal.config_option("GDAL_NUM_THREADS", "4"):
+            got_unsorted = polygonize([], sort=False)
+        assert [x[0:4] for x in got_unsorted] == [x[0:4] for x in ref_unsorted]
+
+    assert len(got) == len(ref)
+    for (got_dn, got_env, got_area, got_count, got_geom), (
+        ref_dn,
+        ref_env,
+        ref_area,
+        ref_count,
+        ref_geom,
+    ) in zip(got, ref):
+        assert got_dn == ref_dn
+        assert got_env == ref_env
+        assert got_area == ref_area
+        assert got_count == ref_count
+        if ogrtest.have_geos():
+            assert got_geom.Equals(ref_geom)
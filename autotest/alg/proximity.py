@@ -12,6 +12,9 @@
 ###############################################################################
 
 
+import math
+import struct
+
 import pytest
 
 from osgeo import gdal
@@ -109,3 +112,86 @@ def test_proximity_3():
     if cs != cs_expected:
         print("Got: ", cs)
         pytest.fail("got wrong checksum")
+
+
+###############################################################################
+# Test that distances are exact, also along diagonals
+
+
+def test_proximity_exact_distance():
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 5, 4)
+    src_ds.WriteRaster(
+        0,
+        0,
+        5,
+        4,
+        b"\x00\x00\x00\x00\x01"
+        + b"\x00\x00\x00\x00\x00"
+        + b"\x00\x00\x00\x01\x00"
+        + b"\x00\x01\x00\x00\x00",
+    )
+    dst_ds = gdal.GetDriverByName("MEM").Create("", 5, 4, 1, gdal.GDT_Float64)
+
+    gdal.ComputeProximity(src_ds.GetRasterBand(1), dst_ds.GetRasterBand(1))
+
+    # The nearest target pixel of (1, 0) is (3, 2), not (4, 0)
+    assert struct.unpack("d", dst_ds.ReadRaster(1, 0, 1, 1))[0] == pytest.approx(
+        2 * math.sqrt(2), rel=1e-6
+    )
+
+
+###############################################################################
+# Test DISTUNITS=GEO with non-square pixels
+
+
+def test_proximity_geo_non_square_pixels():
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 3, 3)
+    src_ds.SetGeoTransform([0, 2, 0, 0, 0, -1])
+    src_ds.WriteRaster(1, 1, 1, 1, b"\x01")
+    dst_ds = gdal.GetDriverByName("MEM").Create("", 3, 3, 1, gdal.GDT_Float32)
+
+    gdal.ComputeProximity(
+        src_ds.GetRasterBand(1),
+        dst_ds.GetRasterBand(1),
+        options=["DISTUNITS=GEO", "MAXDIST=2", "NODATA=-1"],
+    )
+
+    got = struct.unpack("f" * 9, dst_ds.ReadRaster())
+    assert got == pytest.approx([-1, 1, -1, 2, 0, 2, -1, 1, -1])
+
+
+###############################################################################
+# Test that the result does not depend on the number of threads and strips
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+@pytest.mark.parametrize("rows_per_strip", [None, "1", "7"])
+def test_proximity_threads_and_strips(num_threads, rows_per_strip):
+
+    src_ds = gdal.Open("data/pat.tif")
+    src_band = src_ds.GetRasterBand(1)
+
+    dst_ds = gdal.GetDriverByName("MEM").Create("", 25, 25, 1, gdal.GDT_Float32)
+    gdal.ComputeProximity(src_band, dst_ds.GetRasterBand(1))
+    expected = dst_ds.ReadRaster()
+
+    dst_ds = gdal.GetDriverByName("MEM").Create("", 25, 25, 1, gdal.GDT_Float32)
+    with gdal.config_option("GDAL_PROXIMITY_ROWS_PER_STRIP", rows_per_strip):
+        gdal.ComputeProximity(
+            src_band,
+            dst_ds.GetRasterBand(1),
+            options=["NUM_THREADS=" + num_threads],
+        )
+    assert dst_ds.ReadRaster() == expected
+
+    # Byte output uses a temporary work file
+    dst_ds = gdal.GetDriverByName("MEM").Create("", 25, 25, 1, gdal.GDT_Byte)
+    with gdal.config_option("GDAL_PROXIMITY_ROWS_PER_STRIP", rows_per_strip):
+        gdal.ComputeProximity(
+            src_band,
+            dst_ds.GetRasterBand(1),
+            options=["NUM_THREADS=" + num_threads],
+        )
+    assert dst_ds.GetRasterBand(1).Checksum() == 1941
@@ -11,6 +11,7 @@
 # SPDX-License-Identifier: MIT
 ###############################################################################
 
+import math
 import struct
 
 import ogrtest
@@ -1039,3 +1040,159 @@ def test_rasterize_bugfix_gh12129():
 
     # 121 on s390x
     assert target_ds.GetRasterBand(1).Checksum() in (120, 121)
+
+
+###############################################################################
+# Test filled polygon scan conversion on polygons with many vertices, and on
+# self-touching polygons. Coordinates are chosen so that no edge goes through
+# a pixel center, which makes the result that of the even-odd rule applied to
+# pixel centers.
+
+
+def _rasterize_star_ring(nb_vertices, cx, cy):
+    points = []
+    for k in range(nb_vertices):
+        angle = 2 * math.pi * k / nb_vertices
+        r = 44.3 if k % 2 == 0 else 26.9 + 8 * math.sin(k * 0.013)
+        points.append(
+            (round(cx + r * math.cos(angle), 6), round(cy + r * math.sin(angle), 6))
+        )
+    points.append(points[0])
+    return "(" + ",".join(f"{x} {y}" for x, y in points) + ")"
+
+
+def _rasterize_circle_ring(nb_vertices, cx, cy, r):
+    points = []
+    for k in range(nb_vertices):
+        angle = -2 * math.pi * k / nb_vertices
+        points.append(
+            (round(cx + r * math.cos(angle), 6), round(cy + r * math.sin(angle), 6))
+        )
+    points.append(points[0])
+    return "(" + ",".join(f"{x} {y}" for x, y in points) + ")"
+
+
+@pytest.mark.parametrize(
+    "wkt,expected_checksum",
+    [
+        # 1500 vertices
+        (f"POLYGON ({_rasterize_star_ring(1500, 50.17, 49.83)})", 46358),
+        # 1500 vertices with a hole of 600 vertices
+        (
+            f"POLYGON ({_rasterize_star_ring(1500, 50.17, 49.83)},"
+            f"{_rasterize_circle_ring(600, 50.17, 49.83, 12.4)})",
+            40503,
+        ),
+        # Ring touching itself at a vertex, delimiting an inverted hole
+        (
+            "POLYGON ((10 10,90 10,90 90,50.25 50.75,60.5 80.3,40.5 80.3,"
+            "50.25 50.75,10 90,10 10))",
+            61819,
+        ),
+        # Bow tie
+        ("POLYGON ((15 15,50.3 45.7,85 15,85 85,50.3 45.7,15 85,15 15))", 30023),
+        # Ring touching itself at a vertex on the exterior boundary
+        (
+            "POLYGON ((10 10,90 10,90 90,10 90,10 50.3,50.6 50.3,30.2 70.1,"
+            "10 50.3,10 10))",
+            7751,
+        ),
+    ],
+)
+def test_rasterize_many_vertices_and_self_touching_polygons(wkt, expected_checksum):
+
+    sr_wkt = 'LOCAL_CS["arbitrary"]'
+    sr = osr.SpatialReference(sr_wkt)
+
+    target_ds = gdal.GetDriverByName("MEM").Create("", 100, 100, 1, gdal.GDT_Byte)
+    target_ds.SetGeoTransform((0, 1, 0, 100, 0, -1))
+    target_ds.SetProjection(sr_wkt)
+
+    rast_ogr_ds = ogr.GetDriverByName("MEM").CreateDataSource("wrk")
+    rast_mem_lyr = rast_ogr_ds.CreateLayer("poly", srs=sr)
+    feat = ogr.Feature(rast_mem_lyr.GetLayerDefn())
+    feat.SetGeometryDirectly(ogr.Geometry(wkt=wkt))
+    rast_mem_lyr.CreateFeature(feat)
+
+    gdal.RasterizeLayer(target_ds, [1], rast_mem_lyr, burn_values=[255])
+
+    assert target_ds.GetRasterBand(1).Checksum() == expected_checksum
+
+
+###############################################################################
+# Test that multi-threaded rasterization gives the same result as the
+# single-threaded one, whatever the merge algorithm
+
+
+@pytest.mark.parametrize("merge_alg", ["REPLACE", "ADD"])
+@pytest.mark.parametrize("all_touched", ["NO", "YES"])
+@pytest.mark.parametrize("chunkysize", [0, 7])
+def test_rasterize_num_threads(merge_alg, all_touched, chunkysize):
+
+    sr_wkt = 'LOCAL_CS["arbitrary"]'
+    sr = osr.SpatialReference(sr_wkt)
+
+    rast_ogr_ds = ogr.GetDriverByName("MEM").CreateDataSource("wrk")
+    rast_mem_lyr = rast_ogr_ds.CreateLayer("shapes", srs=sr)
+    rast_mem_lyr.CreateField(ogr.FieldDefn("val", ogr.OFTReal))
+
+    wkts = []
+    for i in range(200):
+        x = (i * 37) % 100
+        y = (i * 53) % 100
+        if i % 3 == 0:
+            wkts.append(
+                f"POLYGON (({x} {y},{x + 20.5} {y + 3},{x + 7} {y + 25.25},{x} {y}))"
+            )
+        elif i % 3 == 1:
+            wkts.append(f"LINESTRING ({x} {y},{x + 30} {y + 12.5},{x + 3} {y + 40})")
+        else:
+            wkts.append(f"POINT ({x + 0.5} {y + 0.5})")
+    for i, wkt in enumerate(wkts):
+        feat = ogr.Feature(rast_mem_lyr.GetLayerDefn())
+        feat.SetGeometryDirectly(ogr.CreateGeometryFromWkt(wkt))
+        feat["val"] = 1 + i % 7
+        rast_mem_lyr.CreateFeature(feat)
+
+    def rasterize(num_threads):
+        ds = gdal.GetDriverByName("MEM").Create("", 100, 120, 1, gdal.GDT_Float32)
+        ds.SetGeoTransform((0, 1, 0, 110, 0, -1))
+        ds.SetProjection(sr_wkt)
+        options = [
+            f"MERGE_ALG={merge_alg}",
+            f"ALL_TOUCHED={all_touched}",
+            f"CHUNKYSIZE={chunkysize}",
+            f"NUM_THREADS={num_threads}",
+        ]
+        gdal.RasterizeLayer(ds, [1], rast_mem_lyr, options=options + ["ATTRIBUTE=val"])
+        layer_data = ds.ReadRaster()
+
+        ds.GetRasterBand(1).Fill(0)
+        with gdal.config_option("GDAL_NUM_THREADS", str(num_threads)):
+            gdal.Rasterize(
+                ds,
+                rast_ogr_ds,
+                attribute="val",
+                allTouched=all_touched == "YES",
+                add=merge_alg == "ADD",
+                optim="RASTER",
+            )
+        return layer_data, ds.ReadRaster()
+
+    ref_layer_data, ref_geoms_data = rasterize(1)
+    assert ref_layer_data != b"\0" * len(ref_layer_data)
+    assert ref_layer_data == ref_geoms_data
+    layer_data, geoms_data = rasterize(4)
+
+    # Compare pixel by pixel, chunk by chunk, so that a feature read issue
+    # affecting only some chunks is reported where it happens
+    ref_values = struct.unpack("f" * (100 * 120), ref_layer_data)
+    values = struct.unpack("f" * (100 * 120), layer_data)
+    geoms_values = struct.unpack("f" * (100 * 120), geoms_data)
+    nb_rows_per_chunk = chunkysize if chunkysize else 120
+    for y_start in range(0, 120, nb_rows_per_chunk):
+        chunk = slice(y_start * 100, min(120, y_start + nb_rows_per_chunk) * 100)
+        if y_start < 100:
+            assert any(ref_values[chunk]), y_start
+        assert values[chunk] == ref_values[chunk], y_start
+        assert geoms_values[chunk] == ref_values[chunk], y_start
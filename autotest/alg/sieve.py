@@ -13,6 +13,8 @@
 ###############################################################################
 
 
+import random
+
 import gdaltest
 import pytest
 
@@ -341,3 +343,63 @@ def test_sieve_all_masked():
     gdal.SieveFilter(src_band, mask_band, src_band, 4, 4)
 
     assert src_band.Checksum() == expected_cs
+
+
+###############################################################################
+# Test that processing by small tiles, with several threads, gives the same
+# result as processing the raster as a single tile.
+
+
+@pytest.mark.parametrize("connectedness", [4, 8])
+@pytest.mark.parametrize("use_mask", [False, True])
+@pytest.mark.parametrize("tile_size,num_threads", [(1, 1), (5, 1), (7, 3)])
+def test_sieve_tiles_threads(connectedness, use_mask, tile_size, num_threads):
+
+    width = 37
+    height = 29
+    rng = random.Random(connectedness + 2 * use_mask)
+    # Mix of large patches and noise
+    values = [
+        (x // 9 + y // 6) % 3 if rng.random() < 0.8 else rng.randrange(4)
+        for y in range(height)
+        for x in range(width)
+    ]
+
+    drv = gdal.GetDriverByName("MEM")
+    src_ds = drv.Create("", width, height, 1, gdal.GDT_Byte)
+    src_band = src_ds.GetRasterBand(1)
+    src_band.WriteRaster(0, 0, width, height, bytes(values))
+
+    mask_band = None
+    if use_mask:
+        mask_ds = drv.Create("", width, height, 1, gdal.GDT_Byte)
+        mask_band = mask_ds.GetRasterBand(1)
+        mask_band.WriteRaster(
+            0,
+            0,
+            width,
+            height,
+            bytes(0 if rng.random() < 0.1 else 1 for _ in range(width * height)),
+        )
+
+    def sieve(options, config_options):
+        dst_ds = drv.Create("", width, height, 1, gdal.GDT_Byte)
+        dst_band = dst_ds.GetRasterBand(1)
+        with gdal.config_options(config_options):
+            gdal.SieveFilter(
+                src_band,
+                mask_band,
+                dst_band,
+                6,
+                connectedness,
+                options=options,
+            )
+        return dst_band.ReadRaster()
+
+    expected = sieve([], {})
+    assert expected != bytes(values)
+    got = sieve(
+        [f"NUM_THREADS={num_threads}"],
+        {"GDAL_SIEVE_TILE_SIZE": str(tile_size)},
+    )
+    assert got == expected
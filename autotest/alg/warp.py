@@ -1529,6 +1529,39 @@ def test_warp_53(typestr, option, alg_name, expected_cs):
     assert cs2 == 1218
 
 
+###############################################################################
+# Test that the optimized resampling of sources with nodata values gives the
+# same result as the general case
+
+
+@pytest.mark.parametrize("typestr", ("Byte", "Int16", "UInt16", "Float32"))
+@pytest.mark.parametrize("alg_name", ("bilinear", "cubic", "lanczos"))
+@pytest.mark.parametrize("band_nodata", (True, False))
+def test_warp_nodata_optimized_vs_general_case(typestr, alg_name, band_nodata):
+
+    src_ds = gdal.Translate(
+        "",
+        "../gcore/data/byte.tif",
+        options=f"-a_srs EPSG:32611 -of MEM -ot {typestr} -a_nodata 0",
+    )
+    if not band_nodata:
+        src_ds.GetRasterBand(1).SetNoDataValue(None)
+    zero = struct.pack("B" * 3, 0, 0, 0)
+    for y in (0, 5, 11, 19):
+        src_ds.GetRasterBand(1).WriteRaster(
+            (y * 7) % 18, y, 3, 1, zero, buf_type=gdal.GDT_Byte
+        )
+    options = f"-of MEM -ts 47 53 -r {alg_name} -te 440750 3750150 441950 3751250"
+    if not band_nodata:
+        options += " -srcnodata 0"
+
+    ref_ds = gdal.Warp("", src_ds, options=options + " -wo USE_GENERAL_CASE=TRUE")
+    out_ds = gdal.Warp("", src_ds, options=options)
+    assert (
+        out_ds.GetRasterBand(1).ReadRaster() == ref_ds.GetRasterBand(1).ReadRaster()
+    )
+
+
 ###############################################################################
 # Test Alpha on UInt16/Int16
 
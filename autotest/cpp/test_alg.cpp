@@ -11,12 +11,14 @@
  ****************************************************************************/
 
 #include <array>
+#include <limits>
 
 #include "gdal_unit_test.h"
 
 #include "cpl_conv.h"
 
 #include "gdal_alg.h"
+#include "gdal_alg_priv.h"
 #include "gdalwarper.h"
 #include "gdal_priv.h"
 
@@ -506,4 +508,140 @@ TEST_F(test_alg, GDALIsLineOfSightVisible_through_mountain)
                                          nullptr, nullptr, nullptr));
 }
 
+// Test GDALGenImgProjTransform() with a transformation grid and no Z array
+TEST_F(test_alg, GDALGenImgProjTransform_grid_null_z)
+{
+    auto poDriver = GDALDriver::FromHandle(GDALGetDriverByName("MEM"));
+    GDALDatasetUniquePtr poSrcDS(
+        poDriver->Create("", 100, 100, 1, GDT_Byte, nullptr));
+    poSrcDS->SetProjection(SRS_WKT_WGS84_LAT_LONG);
+    double adfSrcGeoTransform[6] = {2, 0.01, 0, 49, 0, -0.01};
+    poSrcDS->SetGeoTransform(adfSrcGeoTransform);
+    GDALDatasetUniquePtr poDstDS(
+        poDriver->Create("", 70, 110, 1, GDT_Byte, nullptr));
+    poDstDS->SetProjection("EPSG:32631");
+    double adfDstGeoTransform[6] = {420000, 1000, 0, 5430000, 0, -1000};
+    poDstDS->SetGeoTransform(adfDstGeoTransform);
+
+    const char *const apszOptions[] = {"TRANSFORM_GRID_CACHE=MEMORY",
+                                       nullptr};
+    void *hTransformer = GDALCreateGenImgProjTransformer2(
+        GDALDataset::ToHandle(poSrcDS.get()),
+        GDALDataset::ToHandle(poDstDS.get()), apszOptions);
+    ASSERT_TRUE(hTransformer != nullptr);
+
+    // Points in valid cells of the grid, and outside of the grid
+    std::array<double, 4> adfX = {10.5, 35.25, 69.0, -5.0};
+    std::array<double, 4> adfY = {20.5, 99.75, 0.0, 120.0};
+    std::array<double, 4> adfXZ = adfX;
+    std::array<double, 4> adfYZ = adfY;
+    std::array<double, 4> adfZ = {0, 0, 0, 0};
+    std::array<int, 4> abSuccess = {0, 0, 0, 0};
+    std::array<int, 4> abSuccessZ = {0, 0, 0, 0};
+    EXPECT_TRUE(GDALGenImgProjTransform(hTransformer, TRUE, 4, adfX.data(),
+                                        adfY.data(), nullptr,
+                                        abSuccess.data()));
+    EXPECT_TRUE(GDALGenImgProjTransform(hTransformer, TRUE, 4, adfXZ.data(),
+                                        adfYZ.data(), adfZ.data(),
+                                        abSuccessZ.data()));
+    for (int i = 0; i < 4; i++)
+    {
+        EXPECT_TRUE(abSuccess[i]);
+        EXPECT_EQ(abSuccess[i], abSuccessZ[i]);
+        EXPECT_EQ(adfX[i], adfXZ[i]);
+        EXPECT_EQ(adfY[i], adfYZ[i]);
+    }
+    GDALDestroyGenImgProjTransformer(hTransformer);
+}
+
+// Test GDALParabolaLowerEnvelope
+TEST_F(test_alg, GDALParabolaLowerEnvelope)
+{
+    GDALParabolaLowerEnvelope oEnvelope;
+    oEnvelope.Reserve(16);
+    EXPECT_EQ(oEnvelope.GetMin(0), std::numeric_limits<double>::infinity());
+
+    // Each parabola extends the envelope to the right of the previous one
+    oEnvelope.Add(0, 0);
+    oEnvelope.Add(5, 0);
+    oEnvelope.Add(7, 1);
+    ASSERT_EQ(oEnvelope.GetSiteCount(), 3);
+    EXPECT_EQ(oEnvelope.GetBound(0), -std::numeric_limits<double>::infinity());
+    EXPECT_EQ(oEnvelope.GetBound(1), 2.5);
+    EXPECT_EQ(oEnvelope.GetBound(2), 6.25);
+    EXPECT_EQ(oEnvelope.GetMin(2), 4);
+    EXPECT_EQ(oEnvelope.GetMin(3), 4);
+    EXPECT_EQ(oEnvelope.GetMin(6), 1);
+    EXPECT_EQ(oEnvelope.GetMin(10), 10);
+
+    // A low parabola hides the last two ones
+    oEnvelope.Add(8, -40);
+    ASSERT_EQ(oEnvelope.GetSiteCount(), 2);
+    EXPECT_EQ(oEnvelope.GetSite(1), 8);
+    EXPECT_EQ(oEnvelope.GetHeight(1), -40);
+    EXPECT_EQ(oEnvelope.GetBound(1), 1.5);
+
+    oEnvelope.Reset();
+    EXPECT_EQ(oEnvelope.GetSiteCount(), 0);
+
+    // Compare with the exhaustive minimum, with a X scale
+    const double dfScale = 2.25;
+    GDALParabolaLowerEnvelope oScaledEnvelope(dfScale);
+    oScaledEnvelope.Reserve(16);
+    const double adfHeights[16] = {9,  3, 7, 0.5, 12, 4, 4, 1,
+                                   30, 2, 6, 8,   0,  5, 11, 3};
+    for (int q = 0; q < 16; q++)
+        oScaledEnvelope.Add(q, adfHeights[q]);
+    for (int x = -3; x < 20; x++)
+    {
+        double dfMin = std::numeric_limits<double>::infinity();
+        for (int q = 0; q < 16; q++)
+            dfMin = std::min(dfMin,
+                             dfScale * (x - q) * (x - q) + adfHeights[q]);
+        EXPECT_DOUBLE_EQ(oScaledEnvelope.GetMin(x), dfMin) << x;
+    }
+}
+
+// Test that GDALComputeDatasetHash() reports completion only once all rows
+// are hashed, and that the hash does not depend on the number of threads
+TEST_F(test_alg, GDALComputeDatasetHash_progress)
+{
+    auto poDriver = GDALDriver::FromHandle(GDALGetDriverByName("MEM"));
+    // Large enough to be split into several chunks of rows
+    GDALDatasetUniquePtr poDS(
+        poDriver->Create("", 1024, 4096, 1, GDT_Byte, nullptr));
+    ASSERT_TRUE(poDS != nullptr);
+    poDS->GetRasterBand(1)->Fill(1);
+
+    const auto Progress = [](double dfComplete, const char *, void *pData)
+    {
+        static_cast<std::vector<double> *>(pData)->push_back(dfComplete);
+        return TRUE;
+    };
+
+    std::string osRefHash;
+    for (const char *pszNumThreads : {"1", "4"})
+    {
+        const char *const apszOptions[] = {
+            CPLSPrintf("NUM_THREADS=%s", pszNumThreads), nullptr};
+        std::vector<double> adfProgress;
+        char *pszHash = GDALComputeDatasetHash(
+            GDALDataset::ToHandle(poDS.get()), apszOptions, Progress,
+            &adfProgress);
+        ASSERT_TRUE(pszHash != nullptr);
+        if (osRefHash.empty())
+            osRefHash = pszHash;
+        EXPECT_STREQ(pszHash, osRefHash.c_str());
+        CPLFree(pszHash);
+
+        ASSERT_GT(adfProgress.size(), 2U);
+        EXPECT_EQ(adfProgress.back(), 1.0);
+        for (size_t i = 0; i + 1 < adfProgress.size(); ++i)
+        {
+            EXPECT_LT(adfProgress[i], 1.0);
+            EXPECT_LE(adfProgress[i], adfProgress[i + 1]);
+        }
+    }
+}
+
 }  // namespace
@@ -4506,6 +4506,358 @@ TEST_F(test_ogr, OGRFeature_SetGeomField)
     poFeatureDefn->Release();
 }
 
+TEST_F(test_ogr, OGRFeature_Swap_and_string_recycling)
+{
+    OGRFeatureDefn *poFeatureDefn = new OGRFeatureDefn();
+    poFeatureDefn->Reference();
+    OGRFieldDefn oFieldDefn("str", OFTString);
+    poFeatureDefn->AddFieldDefn(&oFieldDefn);
+
+    OGRFeature oFeat(poFeatureDefn);
+    oFeat.SetField(0, "abcdef");
+    const char *pszBefore = oFeat.GetFieldAsString(0);
+    oFeat.SetField(0, "abc");
+    EXPECT_STREQ(oFeat.GetFieldAsString(0), "abc");
+    // Shorter value stored in the existing buffer
+    EXPECT_EQ(oFeat.GetFieldAsString(0), pszBefore);
+    oFeat.SetField(0, "abcdefghijklmnop");
+    EXPECT_STREQ(oFeat.GetFieldAsString(0), "abcdefghijklmnop");
+    // Overlapping source and destination
+    oFeat.SetField(0, oFeat.GetFieldAsString(0) + 4);
+    EXPECT_STREQ(oFeat.GetFieldAsString(0), "efghijklmnop");
+    oFeat.SetFID(1);
+    oFeat.SetGeometryDirectly(new OGRPoint(1, 2));
+    oFeat.SetStyleString("PEN(c:#FF0000)");
+
+    OGRFeature oOther(poFeatureDefn);
+    oOther.SetFieldNull(0);
+    oOther.SetFID(2);
+
+    oFeat.Swap(oOther);
+    EXPECT_EQ(oFeat.GetFID(), 2);
+    EXPECT_TRUE(oFeat.IsFieldNull(0));
+    EXPECT_EQ(oFeat.GetGeometryRef(), nullptr);
+    EXPECT_EQ(oFeat.GetStyleString(), nullptr);
+    EXPECT_EQ(oOther.GetFID(), 1);
+    EXPECT_STREQ(oOther.GetFieldAsString(0), "efghijklmnop");
+    ASSERT_NE(oOther.GetGeometryRef(), nullptr);
+    EXPECT_EQ(oOther.GetGeometryRef()->toPoint()->getY(), 2);
+    EXPECT_STREQ(oOther.GetStyleString(), "PEN(c:#FF0000)");
+
+    poFeatureDefn->Release();
+}
+
+// Check that GetNextFeatureInto() returns the same features as
+// GetNextFeature(), with a single recycled feature.
+static void CheckGetNextFeatureInto(OGRLayer *poLayer,
+                                    size_t nExpectedCount)
+{
+    std::vector<std::unique_ptr<OGRFeature>> apoExpected;
+    poLayer->ResetReading();
+    while (auto poFeature =
+               std::unique_ptr<OGRFeature>(poLayer->GetNextFeature()))
+    {
+        apoExpected.push_back(std::move(poFeature));
+    }
+    EXPECT_EQ(apoExpected.size(), nExpectedCount);
+
+    poLayer->ResetReading();
+    OGRFeature oFeature(poLayer->GetLayerDefn());
+    size_t i = 0;
+    while (poLayer->GetNextFeatureInto(oFeature))
+    {
+        ASSERT_LT(i, apoExpected.size());
+        EXPECT_TRUE(oFeature.Equal(apoExpected[i].get()))
+            << "feature " << i << ": " << oFeature.DumpReadableAsString()
+            << " vs " << apoExpected[i]->DumpReadableAsString();
+        ++i;
+    }
+    EXPECT_EQ(i, apoExpected.size());
+
+    // Through the C API, with a feature that has a different definition
+    OGRFeatureDefn *poOtherDefn = new OGRFeatureDefn();
+    poOtherDefn->Reference();
+    {
+        OGRFeature oOtherFeature(poOtherDefn);
+        poLayer->ResetReading();
+        i = 0;
+        while (OGR_L_GetNextFeatureInto(OGRLayer::ToHandle(poLayer),
+                                        OGRFeature::ToHandle(&oOtherFeature)))
+        {
+            ASSERT_LT(i, apoExpected.size());
+            EXPECT_TRUE(oOtherFeature.Equal(apoExpected[i].get()));
+            ++i;
+        }
+        EXPECT_EQ(i, apoExpected.size());
+    }
+    poOtherDefn->Release();
+}
+
+TEST_F(test_ogr, GetNextFeatureInto_shapefile)
+{
+    if (!GDALGetDriverByName("ESRI Shapefile"))
+    {
+        GTEST_SKIP() << "ESRI Shapefile driver missing";
+    }
+
+    {
+        GDALDatasetUniquePtr poDS(GDALDataset::Open(
+            (data_ + SEP + "poly.shp").c_str(), GDAL_OF_VECTOR));
+        ASSERT_TRUE(poDS != nullptr);
+        OGRLayer *poLayer = poDS->GetLayer(0);
+        CheckGetNextFeatureInto(poLayer, 10);
+
+        poLayer->SetAttributeFilter("EAS_ID > 170");
+        CheckGetNextFeatureInto(poLayer, 4);
+        poLayer->SetAttributeFilter(nullptr);
+
+        poLayer->SetSpatialFilterRect(479500, 4763500, 480500, 4764500);
+        const auto nCount = static_cast<size_t>(poLayer->GetFeatureCount());
+        EXPECT_GT(nCount, 0U);
+        EXPECT_LT(nCount, 10U);
+        CheckGetNextFeatureInto(poLayer, nCount);
+        poLayer->SetSpatialFilter(nullptr);
+
+        poLayer->SetIgnoredFields(CPLStringList({"AREA", "OGR_GEOMETRY"}));
+        CheckGetNextFeatureInto(poLayer, 10);
+    }
+
+    const struct
+    {
+        OGRwkbGeometryType eType;
+        std::vector<const char *> apszWKT;
+    } asTestCases[] = {
+        {wkbPoint, {"POINT (1 2)", nullptr, "POINT (3 4)", "POINT (5 6)"}},
+        {wkbPointM, {"POINT M (1 2 3)", "POINT M (4 5 6)"}},
+        {wkbLineString,
+         {"LINESTRING (0 0,1 1,2 2,3 3)", "LINESTRING (0 0,1 1)", nullptr,
+          "MULTILINESTRING ((0 0,1 1),(2 2,3 3))",
+          "LINESTRING (0 0,1 1,2 2,3 3,4 4,5 5)"}},
+        {wkbLineStringZM,
+         {"LINESTRING ZM (0 0 1 2,1 1 3 4)",
+          "LINESTRING ZM (0 0 5 6,1 1 7 8,2 2 9 10)"}},
+        {wkbLineStringM,
+         {"LINESTRING M (0 0 1,1 1 2)", "LINESTRING M (0 0 3,1 1 4,2 2 5)"}},
+        {wkbPolygon,
+         {"POLYGON ((0 0,0 1,1 1,1 0,0 0))",
+          "POLYGON ((0 0,0 10,10 10,10 0,0 0),(1 1,2 1,2 2,1 2,1 1))",
+          "POLYGON ((0 0,0 1,1 1,0 0))",
+          "POLYGON ((0 0,0 2,2 2,2 0,0 0))",
+          "MULTIPOLYGON (((0 0,0 1,1 1,1 0,0 0)),((2 2,2 3,3 3,3 2,2 2)))"}},
+        {wkbPolygon25D,
+         {"POLYGON Z ((0 0 1,0 1 2,1 1 3,1 0 4,0 0 1))",
+          "POLYGON Z ((0 0 5,0 1 6,1 1 7,0 0 5))"}},
+    };
+
+    int iTest = 0;
+    for (const auto &sTestCase : asTestCases)
+    {
+        const std::string osFilename(
+            CPLSPrintf("/vsimem/GetNextFeatureInto_%d.shp", iTest++));
+        {
+            GDALDatasetUniquePtr poDS(
+                GetGDALDriverManager()
+                    ->GetDriverByName("ESRI Shapefile")
+                    ->Create(osFilename.c_str(), 0, 0, 0, GDT_Unknown,
+                             nullptr));
+            ASSERT_TRUE(poDS != nullptr);
+            OGRLayer *poLayer =
+                poDS->CreateLayer("test", nullptr, sTestCase.eType, nullptr);
+            ASSERT_TRUE(poLayer != nullptr);
+            OGRFieldDefn oFieldStr("str", OFTString);
+            ASSERT_EQ(poLayer->CreateField(&oFieldStr), OGRERR_NONE);
+            OGRFieldDefn oFieldInt("int", OFTInteger);
+            ASSERT_EQ(poLayer->CreateField(&oFieldInt), OGRERR_NONE);
+            int i = 0;
+            for (const char *pszWKT : sTestCase.apszWKT)
+            {
+                OGRFeature oFeature(poLayer->GetLayerDefn());
+                if (pszWKT)
+                {
+                    auto [poGeom, eErr] =
+                        OGRGeometryFactory::createFromWkt(pszWKT);
+                    ASSERT_EQ(eErr, OGRERR_NONE);
+                    oFeature.SetGeometry(std::move(poGeom));
+                }
+                if ((i % 3) != 1)
+                    oFeature.SetField(
+                        0, std::string(1 + 5 * (i % 2), 'x').c_str());
+                oFeature.SetField(1, i);
+                ASSERT_EQ(poLayer->CreateFeature(&oFeature), OGRERR_NONE);
+                ++i;
+            }
+        }
+        GDALDatasetUniquePtr poDS(
+            GDALDataset::Open(osFilename.c_str(), GDAL_OF_VECTOR));
+        ASSERT_TRUE(poDS != nullptr);
+        CheckGetNextFeatureInto(poDS->GetLayer(0),
+                                sTestCase.apszWKT.size());
+        poDS.reset();
+        VSIUnlink(osFilename.c_str());
+        VSIUnlink(CPLResetExtensionSafe(osFilename.c_str(), "shx").c_str());
+        VSIUnlink(CPLResetExtensionSafe(osFilename.c_str(), "dbf").c_str());
+    }
+}
+
+TEST_F(test_ogr, GetNextFeatureInto_CSV_GeoJSON_MEM)
+{
+    if (GDALGetDriverByName("CSV"))
+    {
+        const char *pszFilename = "/vsimem/GetNextFeatureInto.csv";
+        // The last record has no value for the int column.
+        const char *pszContent = "WKT,str,int\n"
+                                 "\"POINT (1 2)\",foobar,1\n"
+                                 ",a,\n"
+                                 "\"LINESTRING (1 2,3 4)\",,3\n"
+                                 "\"POINT (3 4)\",abc,4\n"
+                                 "\"POINT (5 6)\",de\n";
+        VSIFCloseL(VSIFileFromMemBuffer(
+            pszFilename,
+            reinterpret_cast<GByte *>(const_cast<char *>(pszContent)),
+            strlen(pszContent), false));
+        GDALDatasetUniquePtr poDS(
+            GDALDataset::Open(pszFilename, GDAL_OF_VECTOR));
+        ASSERT_TRUE(poDS != nullptr);
+        OGRLayer *poLayer = poDS->GetLayer(0);
+        CheckGetNextFeatureInto(poLayer, 5);
+
+        // The buffer of a string field is reused when the new value fits
+        {
+            OGRFeature oFeature(poLayer->GetLayerDefn());
+            poLayer->ResetReading();
+            ASSERT_TRUE(poLayer->GetNextFeatureInto(oFeature));
+            const char *pszStr = oFeature.GetFieldAsString(1);
+            EXPECT_STREQ(pszStr, "foobar");
+            ASSERT_TRUE(poLayer->GetNextFeatureInto(oFeature));
+            EXPECT_EQ(oFeature.GetFieldAsString(1), pszStr);
+            EXPECT_STREQ(oFeature.GetFieldAsString(1), "a");
+        }
+
+        poLayer->SetAttributeFilter("str = 'abc'");
+        CheckGetNextFeatureInto(poLayer, 1);
+        poLayer->SetAttributeFilter(nullptr);
+        poLayer->SetIgnoredFields(CPLStringList({"str"}));
+        CheckGetNextFeatureInto(poLayer, 5);
+        poDS.reset();
+        VSIUnlink(pszFilename);
+
+        // Empty strings read as null
+        VSIFCloseL(VSIFileFromMemBuffer(
+            pszFilename,
+            reinterpret_cast<GByte *>(const_cast<char *>(pszContent)),
+            strlen(pszContent), false));
+        const char *const apszOpenOptions[] = {"EMPTY_STRING_AS_NULL=YES",
+                                               nullptr};
+        poDS.reset(GDALDataset::Open(pszFilename, GDAL_OF_VECTOR, nullptr,
+                                     apszOpenOptions));
+        ASSERT_TRUE(poDS != nullptr);
+        CheckGetNextFeatureInto(poDS->GetLayer(0), 5);
+        poDS.reset();
+        VSIUnlink(pszFilename);
+    }
+
+    if (GDALGetDriverByName("GeoJSON"))
+    {
+        const char *pszFilename = "/vsimem/GetNextFeatureInto.geojson";
+        const char *pszContent =
+            "{\"type\":\"FeatureCollection\",\"features\":["
+            "{\"type\":\"Feature\",\"properties\":{\"str\":\"foobar\"},"
+            "\"geometry\":{\"type\":\"LineString\","
+            "\"coordinates\":[[1,2],[3,4],[5,6]]}},"
+            "{\"type\":\"Feature\",\"properties\":{\"str\":\"a\"},"
+            "\"geometry\":{\"type\":\"LineString\","
+            "\"coordinates\":[[1,2],[3,4]]}},"
+            "{\"type\":\"Feature\",\"properties\":{\"str\":null},"
+            "\"geometry\":null},"
+            "{\"type\":\"Feature\",\"properties\":{},"
+            "\"geometry\":{\"type\":\"Point\",\"coordinates\":[1,2]}}]}";
+        // Not a VSIFileFromMemBuffer() one, since the file is rewritten below
+        VSILFILE *fp = VSIFOpenL(pszFilename, "wb");
+        ASSERT_TRUE(fp != nullptr);
+        VSIFWriteL(pszContent, 1, strlen(pszContent), fp);
+        VSIFCloseL(fp);
+
+        // Streamed reading
+        GDALDatasetUniquePtr poDS(
+            GDALDataset::Open(pszFilename, GDAL_OF_VECTOR));
+        ASSERT_TRUE(poDS != nullptr);
+        OGRLayer *poLayer = poDS->GetLayer(0);
+        CheckGetNextFeatureInto(poLayer, 4);
+        poLayer->SetAttributeFilter("str IS NOT NULL");
+        CheckGetNextFeatureInto(poLayer, 2);
+        poDS.reset();
+
+        // Reading of the features ingested in memory
+        poDS.reset(
+            GDALDataset::Open(pszFilename, GDAL_OF_VECTOR | GDAL_OF_UPDATE));
+        ASSERT_TRUE(poDS != nullptr);
+        poLayer = poDS->GetLayer(0);
+        OGRFieldDefn oField("other", OFTInteger);
+        ASSERT_EQ(poLayer->CreateField(&oField), OGRERR_NONE);
+        CheckGetNextFeatureInto(poLayer, 4);
+        poDS.reset();
+        VSIUnlink(pszFilename);
+    }
+
+    {
+        GDALDatasetUniquePtr poDS(
+            GetGDALDriverManager()->GetDriverByName("MEM")->Create(
+                "", 0, 0, 0, GDT_Unknown, nullptr));
+        ASSERT_TRUE(poDS != nullptr);
+        OGRLayer *poLayer =
+            poDS->CreateLayer("test", nullptr, wkbUnknown, nullptr);
+        ASSERT_TRUE(poLayer != nullptr);
+        OGRFieldDefn oFieldStr("str", OFTString);
+        ASSERT_EQ(poLayer->CreateField(&oFieldStr), OGRERR_NONE);
+        OGRFieldDefn oFieldList("list", OFTIntegerList);
+        ASSERT_EQ(poLayer->CreateField(&oFieldList), OGRERR_NONE);
+        const char *const apszWKT[] = {
+            "POLYGON ((0 0,0 1,1 1,1 0,0 0))",
+            "POLYGON ((0 0,0 10,10 10,10 0,0 0),(1 1,2 1,2 2,1 2,1 1))",
+            "POLYGON ((0 0,0 10,10 10,0 0),(1 1,2 1,2 2,1 1))",
+            "POLYGON Z ((0 0 1,0 1 2,1 1 3,0 0 1))",
+            "LINESTRING (0 0,1 1,2 2)",
+            "LINESTRING (0 0,1 1)",
+            nullptr,
+            "POINT (1 2)",
+            "POINT EMPTY",
+            "MULTIPOINT ((1 2),(3 4))"};
+        int i = 0;
+        for (const char *pszWKT : apszWKT)
+        {
+            OGRFeature oFeature(poLayer->GetLayerDefn());
+            if (pszWKT)
+            {
+                auto [poGeom, eErr] = OGRGeometryFactory::createFromWkt(pszWKT);
+                ASSERT_EQ(eErr, OGRERR_NONE);
+                oFeature.SetGeometry(std::move(poGeom));
+            }
+            if ((i % 3) == 0)
+                oFeature.SetField(0, std::string(10 - i, 'x').c_str());
+            else if ((i % 3) == 1)
+                oFeature.SetFieldNull(0);
+            if ((i % 2) == 0)
+            {
+                const int anList[] = {i, i + 1};
+                oFeature.SetField(1, 2, anList);
+            }
+            if (i == 3)
+                oFeature.SetStyleString("PEN(c:#FF0000)");
+            ASSERT_EQ(poLayer->CreateFeature(&oFeature), OGRERR_NONE);
+            ++i;
+        }
+        CheckGetNextFeatureInto(poLayer, CPL_ARRAYSIZE(apszWKT));
+
+        // Default implementation
+        OGRLayer *poSQLLayer =
+            poDS->ExecuteSQL("SELECT * FROM test WHERE str IS NOT NULL",
+                             nullptr, nullptr);
+        ASSERT_TRUE(poSQLLayer != nullptr);
+        CheckGetNextFeatureInto(poSQLLayer, 4);
+        poDS->ReleaseResultSet(poSQLLayer);
+    }
+}
+
 TEST_F(test_ogr, GetArrowStream_DateTime_As_String)
 {
     auto poDS = std::unique_ptr<GDALDataset>(
@@ -17,6 +17,7 @@
 
 #include "gtest_include.h"
 
+#include <cmath>
 #include <limits>
 
 namespace
@@ -858,4 +859,222 @@ TEST_F(test_ogr_wkb, OGRWKBTransformFixture_ct_failure)
     }
 }
 
+class OGRWKBPreparedPolygonFixture
+    : public test_ogr_wkb,
+      public ::testing::WithParamInterface<
+          std::tuple<const char *, bool, const char *>>
+{
+  public:
+    static constexpr const char *FILTER_WKT =
+        "MULTIPOLYGON(((0 0,10 0,10 10,0 10,0 0),(4 4,6 4,6 6,4 6,4 4)),"
+        "((20 0,30 0,25 10,20 0)))";
+
+    static std::vector<std::tuple<const char *, bool, const char *>>
+    GetTupleValues()
+    {
+        return {
+            std::make_tuple("POINT(1 1)", true, "POINT_IN"),
+            std::make_tuple("POINT(5 5)", false, "POINT_IN_HOLE"),
+            std::make_tuple("POINT(4 5)", true, "POINT_ON_HOLE_BOUNDARY"),
+            std::make_tuple("POINT(10 5)", true, "POINT_ON_BOUNDARY"),
+            std::make_tuple("POINT(0 0)", true, "POINT_ON_VERTEX"),
+            std::make_tuple("POINT(11 5)", false, "POINT_OUT"),
+            std::make_tuple("POINT(25 5)", true, "POINT_IN_SECOND_PART"),
+            std::make_tuple("POINT(22.5 5)", true, "POINT_ON_SLANTED_EDGE"),
+            std::make_tuple("POINT(22.4 5)", false, "POINT_OUT_SLANTED_EDGE"),
+            std::make_tuple("POINT(15 5)", false, "POINT_BETWEEN_PARTS"),
+            std::make_tuple("POINT EMPTY", false, "POINT_EMPTY"),
+            std::make_tuple("POINT Z(1 1 5)", true, "POINTZ_IN"),
+            std::make_tuple("POINT M(11 5 5)", false, "POINTM_OUT"),
+            std::make_tuple("LINESTRING(1 1,2 2)", true, "LINESTRING_IN"),
+            std::make_tuple("LINESTRING(4.5 4.5,5.5 5.5)", false,
+                            "LINESTRING_IN_HOLE"),
+            std::make_tuple("LINESTRING(4.5 4.5,7 5.5)", true,
+                            "LINESTRING_CROSSING_HOLE"),
+            std::make_tuple("LINESTRING(11 1,19 2)", false, "LINESTRING_OUT"),
+            std::make_tuple("LINESTRING(10 -1,10 11)", true,
+                            "LINESTRING_ALONG_BOUNDARY"),
+            std::make_tuple("LINESTRING(17.5 -5,27.5 15)", true,
+                            "LINESTRING_ALONG_SLANTED_EDGE"),
+            std::make_tuple("LINESTRING(-5 15,15 -5)", true,
+                            "LINESTRING_CROSSING"),
+            std::make_tuple("LINESTRING(-5 25,25 -5)", true,
+                            "LINESTRING_CROSSING_BOTH_PARTS"),
+            std::make_tuple("LINESTRING(1 1,1 1)", true,
+                            "LINESTRING_DEGENERATE"),
+            std::make_tuple("LINESTRING EMPTY", false, "LINESTRING_EMPTY"),
+            std::make_tuple("MULTILINESTRING((11 1,19 2),(1 1,2 2))", true,
+                            "MULTILINESTRING"),
+            std::make_tuple("POLYGON((4.5 4.5,5.5 4.5,5.5 5.5,4.5 4.5))",
+                            false, "POLYGON_IN_HOLE"),
+            std::make_tuple("POLYGON((1 1,2 1,2 2,1 1))", true, "POLYGON_IN"),
+            std::make_tuple("POLYGON((10 1,12 1,12 2,10 1))", true,
+                            "POLYGON_TOUCHING"),
+            std::make_tuple("POLYGON((-5 -5,50 -5,50 50,-5 -5))", true,
+                            "POLYGON_CROSSING"),
+            std::make_tuple("POLYGON((-5 -5,15 -5,15 15,-5 15,-5 -5))", true,
+                            "POLYGON_CONTAINING_PART"),
+            std::make_tuple("POLYGON((-5 -5,50 -5,50 50,-5 50,-5 -5),"
+                            "(-1 -1,40 -1,40 40,-1 40,-1 -1))",
+                            false, "POLYGON_FILTER_IN_HOLE"),
+            std::make_tuple("POLYGON EMPTY", false, "POLYGON_EMPTY"),
+            std::make_tuple("MULTIPOLYGON(((11 1,12 1,12 2,11 1)),"
+                            "((1 1,2 1,2 2,1 1)))",
+                            true, "MULTIPOLYGON"),
+            std::make_tuple("MULTIPOINT((15 5),(25 5))", true, "MULTIPOINT"),
+            std::make_tuple("GEOMETRYCOLLECTION(POINT(15 5))", false,
+                            "GEOMETRYCOLLECTION"),
+            std::make_tuple("TIN(((1 1,2 1,2 2,1 1)))", true, "TIN"),
+        };
+    }
+};
+
+TEST_P(OGRWKBPreparedPolygonFixture, test)
+{
+    const char *pszInput = std::get<0>(GetParam());
+    const bool bIntersects = std::get<1>(GetParam());
+
+    OGRGeometry *poFilterGeom = nullptr;
+    EXPECT_EQ(OGRGeometryFactory::createFromWkt(FILTER_WKT, nullptr,
+                                                &poFilterGeom),
+              OGRERR_NONE);
+    ASSERT_TRUE(poFilterGeom != nullptr);
+    auto poPrepared = OGRWKBPreparedPolygon::Create(poFilterGeom);
+    delete poFilterGeom;
+    ASSERT_TRUE(poPrepared != nullptr);
+
+    OGRGeometry *poGeom = nullptr;
+    EXPECT_EQ(OGRGeometryFactory::createFromWkt(pszInput, nullptr, &poGeom),
+              OGRERR_NONE);
+    ASSERT_TRUE(poGeom != nullptr);
+    for (const auto eByteOrder : {wkbNDR, wkbXDR})
+    {
+        std::vector<GByte> abyWkb(poGeom->WkbSize());
+        poGeom->exportToWkb(eByteOrder, abyWkb.data(), wkbVariantIso);
+        bool bError = false;
+        EXPECT_EQ(poPrepared->Intersects(abyWkb.data(), abyWkb.size(), bError),
+                  bIntersects);
+        EXPECT_FALSE(bError);
+
+        if (!bIntersects && abyWkb.size() > 9)
+        {
+            poPrepared->Intersects(abyWkb.data(), abyWkb.size() - 1, bError);
+            EXPECT_TRUE(bError);
+        }
+    }
+    delete poGeom;
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    test_ogr_wkb, OGRWKBPreparedPolygonFixture,
+    ::testing::ValuesIn(OGRWKBPreparedPolygonFixture::GetTupleValues()),
+    [](const ::testing::TestParamInfo<OGRWKBPreparedPolygonFixture::ParamType>
+           &l_info) { return std::get<2>(l_info.param); });
+
+TEST_F(test_ogr_wkb, OGRWKBPreparedPolygon_near_degenerate)
+{
+    // (dfX, dfY) is exactly on the edge from (1.625, 3.875) to (-2, -7),
+    // but the floating-point evaluation of the orientation determinant gives
+    // -1.8e-15, within the error bound of the fast filter. The same rounded
+    // value is also obtained for the points one ulp away along X, so only
+    // the exact expansion can classify them.
+    const double dfX = 0.5375000000000001;
+    const double dfY = 0.6125000000000003;
+
+    OGRPolygon oTriangle;
+    {
+        auto poRing = std::make_unique<OGRLinearRing>();
+        poRing->addPoint(1.625, 3.875);
+        poRing->addPoint(-2, -7);
+        poRing->addPoint(10, -7);
+        poRing->addPoint(1.625, 3.875);
+        oTriangle.addRing(std::move(poRing));
+    }
+    auto poPrepared = OGRWKBPreparedPolygon::Create(&oTriangle);
+    ASSERT_TRUE(poPrepared != nullptr);
+
+    const auto Intersects = [&poPrepared](const OGRGeometry &oGeom)
+    {
+        std::vector<GByte> abyWkb(oGeom.WkbSize());
+        oGeom.exportToWkb(wkbNDR, abyWkb.data(), wkbVariantIso);
+        bool bError = false;
+        const bool bRet =
+            poPrepared->Intersects(abyWkb.data(), abyWkb.size(), bError);
+        EXPECT_FALSE(bError);
+        return bRet;
+    };
+
+    const double dfXOutside =
+        std::nextafter(dfX, -std::numeric_limits<double>::infinity());
+    const double dfXInside =
+        std::nextafter(dfX, std::numeric_limits<double>::infinity());
+
+    EXPECT_TRUE(Intersects(OGRPoint(dfX, dfY)));
+    EXPECT_FALSE(Intersects(OGRPoint(dfXOutside, dfY)));
+    EXPECT_TRUE(Intersects(OGRPoint(dfXInside, dfY)));
+
+    {
+        // Touching the edge from outside
+        OGRLineString oLS;
+        oLS.addPoint(-1, dfY);
+        oLS.addPoint(dfX, dfY);
+        EXPECT_TRUE(Intersects(oLS));
+    }
+    {
+        // Stopping one ulp before the edge
+        OGRLineString oLS;
+        oLS.addPoint(-1, dfY);
+        oLS.addPoint(dfXOutside, dfY);
+        EXPECT_FALSE(Intersects(oLS));
+    }
+}
+
+TEST_F(test_ogr_wkb, OGRWKBPreparedPolygon_unsupported)
+{
+    {
+        OGRLineString ls;
+        ls.addPoint(0, 0);
+        ls.addPoint(1, 1);
+        EXPECT_TRUE(OGRWKBPreparedPolygon::Create(&ls) == nullptr);
+    }
+    {
+        OGRCurvePolygon cp;
+        EXPECT_TRUE(OGRWKBPreparedPolygon::Create(&cp) == nullptr);
+    }
+    {
+        OGRPolygon p;
+        EXPECT_TRUE(OGRWKBPreparedPolygon::Create(&p) == nullptr);
+    }
+
+    OGRPolygon p(0, 0, 10, 10);
+    auto poPrepared = OGRWKBPreparedPolygon::Create(&p);
+    ASSERT_TRUE(poPrepared != nullptr);
+    {
+        // Curve geometries must be evaluated by another method
+        OGRCircularString cs;
+        cs.addPoint(-1, 5);
+        cs.addPoint(5, 6);
+        cs.addPoint(11, 5);
+        std::vector<GByte> abyWkb(cs.WkbSize());
+        static_cast<OGRGeometry &>(cs).exportToWkb(wkbNDR, abyWkb.data(),
+                                                   wkbVariantIso);
+        bool bError = false;
+        EXPECT_FALSE(
+            poPrepared->Intersects(abyWkb.data(), abyWkb.size(), bError));
+        EXPECT_TRUE(bError);
+    }
+    {
+        OGRLineString ls;
+        ls.addPoint(1, 1);
+        ls.addPoint(std::numeric_limits<double>::infinity(), 1);
+        std::vector<GByte> abyWkb(ls.WkbSize());
+        static_cast<OGRGeometry &>(ls).exportToWkb(wkbNDR, abyWkb.data(),
+                                                   wkbVariantIso);
+        bool bError = false;
+        EXPECT_FALSE(
+            poPrepared->Intersects(abyWkb.data(), abyWkb.size(), bError));
+        EXPECT_TRUE(bError);
+    }
+}
+
 }  // namespace
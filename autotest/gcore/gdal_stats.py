@@ -942,3 +942,69 @@ def test_stats_all_large_values(value):
     src_ds.WriteRaster(0, 0, 2, 1, struct.pack("d" * 2, value, value))
     assert src_ds.GetRasterBand(1).ComputeRasterMinMax(False) == (value, value)
     assert src_ds.GetRasterBand(1).ComputeStatistics(False) == [value, value, value, 0]
+
+
+###############################################################################
+# Test that multi-threaded statistics, min/max and histogram computation
+# return the same results as the single-threaded code path
+
+
+@pytest.mark.parametrize(
+    "datatype", [gdal.GDT_Byte, gdal.GDT_UInt16, gdal.GDT_Int16, gdal.GDT_Float32]
+)
+@pytest.mark.parametrize("with_mask", [False, True])
+def test_stats_multithreaded(datatype, with_mask):
+
+    # Large enough to be split into several batches of blocks
+    width = 2048
+    height = 1536
+    src_ds = gdal.GetDriverByName("MEM").Create("", width, height, 1, datatype)
+    src_ds.GetRasterBand(1).WriteRaster(
+        0,
+        0,
+        width,
+        height,
+        bytes((i * 7 + (i >> 11) * 13) % 251 for i in range(width * height)),
+        buf_type=gdal.GDT_Byte,
+    )
+    if with_mask:
+        src_ds.CreateMaskBand(gdal.GMF_PER_DATASET)
+        mask_band = src_ds.GetRasterBand(1).GetMaskBand()
+        mask_band.Fill(255)
+        mask_band.WriteRaster(
+            width // 4, height // 4, width // 2, height // 2, b"\x00", 1, 1
+        )
+
+    def compute():
+        band = src_ds.GetRasterBand(1)
+        minmax = band.ComputeRasterMinMax(False)
+        stats = band.ComputeStatistics(False)
+        hist = band.GetHistogram(-0.5, 255.5, 256, False, False)
+        approx_hist = band.GetHistogram(-0.5, 255.5, 256, False, True)
+        return minmax, stats, hist, approx_hist
+
+    with gdal.config_option("GDAL_NUM_THREADS", "1"):
+        ref_minmax, ref_stats, ref_hist, ref_approx_hist = compute()
+        with gdal.config_option("GDAL_STATISTICS_FIXED_ORDER", "YES"):
+            ref_fixed_order_stats = compute()[1]
+    assert ref_fixed_order_stats[0] == ref_stats[0]
+    assert ref_fixed_order_stats[1] == ref_stats[1]
+    assert ref_fixed_order_stats[2] == pytest.approx(ref_stats[2], rel=1e-12)
+    assert ref_fixed_order_stats[3] == pytest.approx(ref_stats[3], rel=1e-12)
+
+    for num_threads in ("2", "ALL_CPUS"):
+        with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+            minmax, stats, hist, approx_hist = compute()
+        assert minmax == ref_minmax
+        assert stats[0] == ref_stats[0]
+        assert stats[1] == ref_stats[1]
+        assert stats[2] == pytest.approx(ref_stats[2], rel=1e-12)
+        assert stats[3] == pytest.approx(ref_stats[3], rel=1e-12)
+        # Merging of partial statistics in a fixed order is bit-identical
+        assert stats == ref_fixed_order_stats
+        with gdal.config_options(
+            {"GDAL_NUM_THREADS": num_threads, "GDAL_STATISTICS_FIXED_ORDER": "YES"}
+        ):
+            assert compute()[1] == ref_fixed_order_stats
+        assert hist == ref_hist
+        assert approx_hist == ref_approx_hist
@@ -600,3 +600,83 @@ def test_geoloc_warnings_inconsistent_size(
         else:
             assert gdal.GetLastErrorMsg() == ""
         assert tr
+
+
+###############################################################################
+# Test building the backmap with several threads
+
+
+@pytest.mark.parametrize("convention", ["TOP_LEFT_CORNER", "PIXEL_CENTER"])
+def test_geoloc_GEOLOC_NUM_THREADS(tmp_vsimem, convention):
+
+    r = random.Random(0)
+
+    xsize = 40
+    ysize = 700
+    geoloc_filename = str(tmp_vsimem / "geoloc.tif")
+    geoloc_ds = gdal.GetDriverByName("GTiff").Create(
+        geoloc_filename, xsize, ysize, 2, gdal.GDT_Float64
+    )
+    for y in range(ysize):
+        geoloc_ds.GetRasterBand(1).WriteRaster(
+            0,
+            y,
+            xsize,
+            1,
+            array.array(
+                "d",
+                [
+                    -80 + 0.01 * x + 0.001 * y + r.uniform(-0.001, 0.001)
+                    for x in range(xsize)
+                ],
+            ),
+        )
+        geoloc_ds.GetRasterBand(2).WriteRaster(
+            0,
+            y,
+            xsize,
+            1,
+            array.array(
+                "d",
+                [
+                    50 - 0.01 * y + 0.002 * x + r.uniform(-0.001, 0.001)
+                    for x in range(xsize)
+                ],
+            ),
+        )
+    geoloc_ds = None
+
+    ds = gdal.GetDriverByName("MEM").Create("", xsize, ysize)
+    md = {
+        "LINE_OFFSET": "0",
+        "LINE_STEP": "1",
+        "PIXEL_OFFSET": "0",
+        "PIXEL_STEP": "1",
+        "X_DATASET": geoloc_filename,
+        "X_BAND": "1",
+        "Y_DATASET": geoloc_filename,
+        "Y_BAND": "2",
+        "SRS": 'GEOGCS["WGS 84",DATUM["WGS_1984",SPHEROID["WGS 84",6378137,298.257223563,AUTHORITY["EPSG","7030"]],AUTHORITY["EPSG","6326"]],PRIMEM["Greenwich",0,AUTHORITY["EPSG","8901"]],UNIT["degree",0.0174532925199433,AUTHORITY["EPSG","9122"]],AXIS["Latitude",NORTH],AXIS["Longitude",EAST],AUTHORITY["EPSG","4326"]]',
+        "GEOREFERENCING_CONVENTION": convention,
+    }
+    ds.SetMetadata(md, "GEOLOCATION")
+
+    tr_ref = gdal.Transformer(ds, None, ["GEOLOC_NUM_THREADS=1"])
+    tr = gdal.Transformer(ds, None, ["GEOLOC_NUM_THREADS=4"])
+    # GEOLOC_NUM_THREADS does not default to GDAL_NUM_THREADS
+    with gdal.config_option("GDAL_NUM_THREADS", "4"):
+        tr_default = gdal.Transformer(ds, None, [])
+
+    for x, y in [(10, 10), (1.5, 2.5), (20.5, 255.5), (33, 512.25), (5, 690)]:
+        success, pnt = tr.TransformPoint(False, x, y)
+        assert success
+        success, pnt_ref = tr_ref.TransformPoint(True, pnt[0], pnt[1])
+        assert success
+        assert tr_default.TransformPoint(True, pnt[0], pnt[1]) == (
+            success,
+            pnt_ref,
+        )
+        success, pnt = tr.TransformPoint(True, pnt[0], pnt[1])
+        assert success
+        assert pnt == pytest.approx(pnt_ref, abs=1e-3)
+        assert pnt == pytest.approx((x, y, 0), abs=1e-2)
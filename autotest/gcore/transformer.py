@@ -557,6 +557,58 @@ def test_transformer_9():
     gdal.Unlink("/vsimem/dem.tif")
 
 
+###############################################################################
+# Test that RPC points transformed in batches give the same results as when
+# transformed one at a time, and as the scalar implementation
+
+
+@pytest.mark.skipif(
+    not gdaltest.vrt_has_open_support(),
+    reason="VRT driver open missing",
+)
+@pytest.mark.parametrize("use_avx", ["YES", "NO"])
+def test_transformer_rpc_batch(use_avx):
+
+    ds = gdal.Open("data/rpc.vrt")
+    with gdal.config_option("GDAL_USE_AVX", use_avx):
+        tr = gdal.Transformer(ds, None, ["METHOD=RPC"])
+    # Per-point scalar evaluation
+    with gdal.config_options(
+        {"GDAL_USE_AVX": "NO", "GDAL_RPC_BATCH_EVALUATION": "NO"}
+    ):
+        tr_scalar = gdal.Transformer(ds, None, ["METHOD=RPC"])
+
+    # Number of points not multiple of the SIMD width
+    points = [
+        (125.6480 + i * 1e-4, 39.8690 + j * 1e-4, (i - j) * 10.0)
+        for j in range(7)
+        for i in range(11)
+    ]
+    (pnts, successes) = tr.TransformPoints(1, points)
+    (pnts_scalar, successes_scalar) = tr_scalar.TransformPoints(1, points)
+    assert successes_scalar == successes
+    assert pnts == pnts_scalar
+    for point, pnt, success in zip(points, pnts, successes):
+        assert success
+        (success, pnt_single) = tr_scalar.TransformPoint(1, *point)
+        assert success
+        assert pnt_single == pnt
+
+    # Reference values computed with the scalar evaluation of the RPC
+    # polynomials done prior to the introduction of batch evaluation
+    expected = {
+        0: (-20.002415150698653, 92.06067614185304),
+        10: (128.37594807756068, 32.928036016761325),
+        38: (50.76440840853684, 23.4750607937076),
+        40: (80.43869900508435, 11.649402091594311),
+        66: (-26.814925486063657, 14.016771641787273),
+        76: (121.53631354827303, -45.10828494455927),
+    }
+    for idx, (x, y) in expected.items():
+        assert pnts[idx][0] == pytest.approx(x, abs=1e-9), idx
+        assert pnts[idx][1] == pytest.approx(y, abs=1e-9), idx
+
+
 ###############################################################################
 # Test RPC DEM transform from geoid height to ellipsoidal height
 
@@ -1318,6 +1370,90 @@ def test_transformer_gcp_antimeridian_unwrap():
     )
 
 
+###############################################################################
+# Test TRANSFORM_GRID_CACHE
+
+
+def test_transformer_grid_cache(tmp_vsimem):
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 100, 100)
+    src_ds.SetGeoTransform([2, 0.01, 0, 49, 0, -0.01])
+    src_ds.SetProjection("EPSG:4326")
+
+    dst_ds = gdal.GetDriverByName("MEM").Create("", 70, 110)
+    dst_ds.SetGeoTransform([420000, 1000, 0, 5430000, 0, -1000])
+    dst_ds.SetProjection("EPSG:32631")
+
+    grid_filename = str(tmp_vsimem / "grid.bin")
+    points = [
+        (i * 0.7, j * 1.3) for j in range(-2, 90, 3) for i in range(-2, 105, 3)
+    ]
+
+    tr_ref = gdal.Transformer(src_ds, dst_ds, [])
+    (ref_pnts, ref_successes) = tr_ref.TransformPoints(1, points)
+
+    class my_error_handler:
+        def __init__(self):
+            self.debug_msg_list = []
+
+        def handler(self, eErrClass, err_no, msg):
+            if eErrClass == gdal.CE_Debug:
+                self.debug_msg_list.append(msg)
+
+    def check(options):
+        # Returns the WARP debug messages emitted from the creation to the
+        # destruction of the transformer
+        handler = my_error_handler()
+        try:
+            gdal.PushErrorHandler(handler.handler)
+            gdal.SetCurrentErrorHandlerCatchDebug(True)
+            with gdaltest.config_option("CPL_DEBUG", "WARP"):
+                tr = gdal.Transformer(src_ds, dst_ds, options)
+                (pnts, successes) = tr.TransformPoints(1, points)
+                del tr
+        finally:
+            gdal.PopErrorHandler()
+
+        assert successes == ref_successes
+        for pnt, ref_pnt in zip(pnts, ref_pnts):
+            assert pnt == pytest.approx(ref_pnt, abs=0.125)
+        # Interpolated values are close to, but not exactly, the reference ones
+        nb_diff = sum(1 for pnt, ref_pnt in zip(pnts, ref_pnts) if pnt != ref_pnt)
+        assert nb_diff > len(points) // 2
+
+        msgs = [msg for msg in handler.debug_msg_list if msg.startswith("WARP:")]
+        stats = [msg for msg in msgs if "points interpolated" in msg]
+        assert len(stats) == 1
+        nb_interpolated = int(stats[0].split(" ")[3])
+        assert nb_interpolated > len(points) // 2
+        return msgs
+
+    # Grid computed and written in the cache
+    msgs = check([f"TRANSFORM_GRID_CACHE={grid_filename}"])
+    assert not any("Transformation grid read from" in msg for msg in msgs)
+    assert gdal.VSIStatL(grid_filename) is not None
+    size = gdal.VSIStatL(grid_filename).size
+
+    # Grid read from the cache
+    msgs = check([f"TRANSFORM_GRID_CACHE={grid_filename}"])
+    assert f"WARP: Transformation grid read from {grid_filename}" in msgs
+
+    # Different parameters: the cache is rewritten
+    msgs = check([f"TRANSFORM_GRID_CACHE={grid_filename}", "TRANSFORM_GRID_STEP=4"])
+    assert not any("Transformation grid read from" in msg for msg in msgs)
+    assert gdal.VSIStatL(grid_filename).size > size
+
+    # In-memory grid
+    check(["TRANSFORM_GRID_CACHE=MEMORY"])
+
+    with pytest.raises(Exception):
+        gdal.Transformer(
+            src_ds,
+            dst_ds,
+            ["TRANSFORM_GRID_CACHE=MEMORY", "TRANSFORM_GRID_STEP=0"],
+        )
+
+
 ###############################################################################
 # Test passing an unknown transformer option.
 
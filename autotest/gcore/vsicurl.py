@@ -11,6 +11,7 @@
 # SPDX-License-Identifier: MIT
 ###############################################################################
 
+import json
 import sys
 import time
 
@@ -1678,3 +1679,67 @@ def test_vsicurl_GDAL_HTTP_MAX_TOTAL_CONNECTIONS(server):
         full_filename = f"/vsicurl/http://localhost:{server.port}/test.bin"
         statres = gdal.VSIStatL(full_filename)
         assert statres.size == 3
+
+
+###############################################################################
+# Test persistent disk cache (CPL_VSIL_CURL_DISK_CACHE_DIR)
+
+
+@gdaltest.enable_exceptions()
+def test_vsicurl_disk_cache(server, tmp_path):
+
+    full_filename = f"/vsicurl/http://localhost:{server.port}/test_disk_cache.bin"
+
+    def read(etag, get_body=None):
+        gdal.VSICurlClearCache()
+        handler = webserver.SequentialHandler()
+        handler.add("GET", "/", 404)
+        handler.add(
+            "HEAD",
+            "/test_disk_cache.bin",
+            200,
+            {"Content-Length": "3", "ETag": f'"{etag}"'},
+        )
+        if get_body:
+            handler.add(
+                "GET", "/test_disk_cache.bin", 200, {"Content-Length": "3"}, get_body
+            )
+        with webserver.install_http_handler(handler):
+            f = gdal.VSIFOpenL(full_filename, "rb")
+            assert f is not None
+            try:
+                return gdal.VSIFReadL(1, 3, f).decode("ascii")
+            finally:
+                gdal.VSIFCloseL(f)
+
+    with gdal.config_options(
+        {
+            "CPL_VSIL_CURL_DISK_CACHE_DIR": str(tmp_path),
+            "CPL_VSIL_NETWORK_STATS_ENABLED": "YES",
+        },
+        thread_local=False,
+    ):
+        gdal.NetworkStatsReset()
+        assert read("first", "foo") == "foo"
+        j = json.loads(gdal.NetworkStatsGetAsSerializedJSON())
+        assert j["disk_cache"] == {
+            "hit": {"count": 0, "read_bytes": 0},
+            "miss": {"count": 1},
+        }
+
+        # Served from the disk cache: no GET request
+        gdal.NetworkStatsReset()
+        assert read("first") == "foo"
+        j = json.loads(gdal.NetworkStatsGetAsSerializedJSON())
+        assert j["disk_cache"] == {
+            "hit": {"count": 1, "read_bytes": 3},
+            "miss": {"count": 0},
+        }
+        assert "GET" not in j["methods"]
+
+        # File modified on server side
+        gdal.NetworkStatsReset()
+        assert read("second", "bar") == "bar"
+
+    gdal.NetworkStatsReset()
+    gdal.VSICurlClearCache()
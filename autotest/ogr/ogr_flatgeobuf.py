@@ -1167,6 +1167,104 @@ def test_ogr_flatgeobuf_arrow_stream_empty_file():
     ogr.GetDriverByName("FlatGeobuf").DeleteDataSource("/vsimem/test.fgb")
 
 
+###############################################################################
+# Test that the geometries returned by GetArrowStream(), that are decoded
+# directly to WKB for the most common types, match the ones of GetNextFeature()
+
+
+@pytest.mark.parametrize(
+    "geom_type,wkts",
+    [
+        (ogr.wkbPoint, ["POINT (1 2)", "POINT (-1 -2)", "POINT (5 5)"]),
+        (ogr.wkbPoint25D, ["POINT Z (1 2 3)", "POINT Z (-1 -2 -3)"]),
+        (ogr.wkbPointM, ["POINT M (1 2 3)", "POINT M (-1 -2 -3)"]),
+        (ogr.wkbPointZM, ["POINT ZM (1 2 3 4)", "POINT ZM (-1 -2 -3 -4)"]),
+        (
+            ogr.wkbMultiPoint,
+            ["MULTIPOINT ((1 2),(3 4))", "MULTIPOINT ((-1 -2))"],
+        ),
+        (
+            ogr.wkbLineString,
+            ["LINESTRING (1 2,3 4)", "LINESTRING (-1 -2,-3 -4,5 5)"],
+        ),
+        (
+            ogr.wkbLineString25D,
+            ["LINESTRING Z (1 2 3,4 5 6)", "LINESTRING Z (-1 -2 0,3 4 0)"],
+        ),
+        (
+            ogr.wkbMultiLineString,
+            [
+                "MULTILINESTRING ((1 2,3 4))",
+                "MULTILINESTRING ((1 2,3 4),(-1 -2,-3 -4,-5 -6))",
+            ],
+        ),
+        (
+            ogr.wkbPolygon,
+            [
+                "POLYGON ((0 0,0 1,1 1,0 0))",
+                "POLYGON ((-5 -5,-5 5,5 5,5 -5,-5 -5),(0 0,0 1,1 1,0 0))",
+            ],
+        ),
+        (
+            ogr.wkbPolygonZM,
+            ["POLYGON ZM ((0 0 1 2,0 1 3 4,1 1 5 6,0 0 1 2))"],
+        ),
+        (
+            ogr.wkbMultiPolygon,
+            [
+                "MULTIPOLYGON (((0 0,0 1,1 1,0 0)))",
+                "MULTIPOLYGON (((2 2,2 3,3 3,2 2)),((-5 -5,-5 5,5 5,5 -5,-5 -5),(0 0,0 1,1 1,0 0)))",
+            ],
+        ),
+        (
+            ogr.wkbUnknown,
+            [
+                "POINT (1 2)",
+                "LINESTRING (1 2,3 4)",
+                "GEOMETRYCOLLECTION (POINT (1 2),LINESTRING (3 4,5 6))",
+                "CIRCULARSTRING (0 0,1 1,2 0)",
+            ],
+        ),
+    ],
+)
+@pytest.mark.parametrize("spatial_filter", [None, "rect", "polygon"])
+def test_ogr_flatgeobuf_arrow_stream_geometries(
+    tmp_vsimem, geom_type, wkts, spatial_filter
+):
+    gdaltest.importorskip_gdal_array()
+    pytest.importorskip("numpy")
+
+    filename = str(tmp_vsimem / "test.fgb")
+    ds = ogr.GetDriverByName("FlatGeoBuf").CreateDataSource(filename)
+    lyr = ds.CreateLayer("test", geom_type=geom_type)
+    for wkt in wkts:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f.SetGeometry(ogr.CreateGeometryFromWkt(wkt))
+        lyr.CreateFeature(f)
+    ds = None
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    if spatial_filter == "rect":
+        lyr.SetSpatialFilterRect(0, 0, 2, 2)
+    elif spatial_filter == "polygon":
+        lyr.SetSpatialFilter(
+            ogr.CreateGeometryFromWkt("POLYGON ((0 0,0 2,2 0,0 0))")
+        )
+
+    expected = {}
+    for f in lyr:
+        expected[f.GetFID()] = f.GetGeometryRef().ExportToIsoWkb()
+
+    got = {}
+    stream = lyr.GetArrowStreamAsNumPy(options=["MAX_FEATURES_IN_BATCH=2"])
+    for batch in stream:
+        for fid, wkb in zip(batch["OGC_FID"], batch["wkb_geometry"]):
+            got[fid] = bytes(wkb)
+
+    assert got == expected
+
+
 def test_ogr_flatgeobuf_issue_7401():
     # Verify null geom handling without spatial index
     ds = ogr.GetDriverByName("FlatGeobuf").CreateDataSource("/vsimem/test.fgb")
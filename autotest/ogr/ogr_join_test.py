@@ -546,3 +546,156 @@ def test_ogr_join_on_special_field():
         assert f["a"] == "a2"
         assert f["b"] is None
         assert sql_lyr.GetNextFeature() is None
+
+
+###############################################################################
+# Test that joins evaluated with a hash table of the secondary layer give the
+# same results as when evaluated with attribute filters
+
+
+@pytest.mark.parametrize(
+    "config_options",
+    [
+        {"OGR_SQL_HASH_JOIN": "NO"},
+        {},
+        # Force the features of the secondary layer to a temporary file
+        {"OGR_SQL_JOIN_MAX_MEMORY": "1000B"},
+    ],
+)
+def test_ogr_join_hash_table(config_options):
+
+    ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+    lyr = ds.CreateLayer("first")
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("real", ogr.OFTReal))
+    for i in range(100):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        if i % 10 != 0:
+            f["str"] = "key%d" % (i % 50)
+            f["int"] = i % 50
+            f["real"] = (i % 50) + (0.5 if i % 3 == 0 else 0)
+        lyr.CreateFeature(f)
+
+    lyr = ds.CreateLayer("second")
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("int64", ogr.OFTInteger64))
+    lyr.CreateField(ogr.FieldDefn("val", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("padding", ogr.OFTString))
+    for i in range(60):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        if i != 7:
+            # String comparisons are case-insensitive
+            f["str"] = ("KEY%d" if i % 2 else "key%d") % (i % 40)
+            f["int64"] = i % 40
+        f["val"] = "val%d" % i
+        f["padding"] = "x" * 100
+        lyr.CreateFeature(f)
+
+    with gdal.config_options(config_options):
+        for key_primary, key_secondary in [
+            ("str", "str"),
+            ("int", "int64"),
+            ("real", "int64"),
+            ("fid", "int64"),
+        ]:
+            with ds.ExecuteSQL(
+                f"SELECT val FROM first LEFT JOIN second ON "
+                f"first.{key_primary} = second.{key_secondary}"
+            ) as sql_lyr:
+                got = [(f.GetFID(), f["val"]) for f in sql_lyr]
+
+            expected = []
+            first_lyr = ds.GetLayerByName("first")
+            second_lyr = ds.GetLayerByName("second")
+            for f in first_lyr:
+                key = f.GetFID() if key_primary == "fid" else f[key_primary]
+                match = None
+                if key is not None:
+                    for f2 in second_lyr:
+                        key2 = f2[key_secondary]
+                        if key2 is not None and (
+                            key2.lower() == key.lower()
+                            if key_primary == "str"
+                            else key2 == key
+                        ):
+                            match = f2
+                            break
+                expected.append((f.GetFID(), match["val"] if match else None))
+
+            assert got == expected, (key_primary, key_secondary)
+
+
+###############################################################################
+# Test that string keys of a join keep the comparison semantics of the
+# secondary layer when it evaluates attribute filters natively
+
+
+@pytest.mark.require_driver("GPKG")
+@pytest.mark.parametrize("hash_join", ["YES", "NO"])
+def test_ogr_join_hash_table_mixed_case_native_filter(tmp_vsimem, hash_join):
+
+    ds = ogr.GetDriverByName("GPKG").CreateDataSource(tmp_vsimem / "test.gpkg")
+    lyr = ds.CreateLayer("first", geom_type=ogr.wkbNone)
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    for key in ["key1", "KEY1", "Key2", "key3"]:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["str"] = key
+        lyr.CreateFeature(f)
+    lyr = ds.CreateLayer("second", geom_type=ogr.wkbNone)
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("val", ogr.OFTString))
+    for key, val in [("KEY1", "upper1"), ("key1", "lower1"), ("key2", "lower2")]:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["str"] = key
+        f["val"] = val
+        lyr.CreateFeature(f)
+
+    with gdal.config_option("OGR_SQL_HASH_JOIN", hash_join), ds.ExecuteSQL(
+        "SELECT first.str, val FROM first LEFT JOIN second "
+        "ON first.str = second.str",
+        dialect="OGRSQL",
+    ) as sql_lyr:
+        got = [(f["str"], f["val"]) for f in sql_lyr]
+
+    # SQLite string comparisons are case-sensitive
+    assert got == [
+        ("key1", "lower1"),
+        ("KEY1", "upper1"),
+        ("Key2", None),
+        ("key3", None),
+    ]
+
+
+###############################################################################
+# Test that the secondary layer is not fully read when its join field has an
+# attribute index
+
+
+@pytest.mark.require_driver("ESRI Shapefile")
+def test_ogr_join_hash_table_indexed_secondary_layer(tmp_path):
+
+    ds = ogr.GetDriverByName("ESRI Shapefile").CreateDataSource(tmp_path)
+    lyr = ds.CreateLayer("first", geom_type=ogr.wkbNone)
+    lyr.CreateField(ogr.FieldDefn("key", ogr.OFTInteger))
+    for i in (5, 500):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["key"] = i
+        lyr.CreateFeature(f)
+    lyr = ds.CreateLayer("second", geom_type=ogr.wkbNone)
+    lyr.CreateField(ogr.FieldDefn("key", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("val", ogr.OFTString))
+    for i in range(1000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["key"] = i
+        f["val"] = "val%d" % i
+        lyr.CreateFeature(f)
+    ds.ExecuteSQL("CREATE INDEX ON second USING key")
+    ds = None
+
+    ds = ogr.Open(tmp_path)
+    with ds.ExecuteSQL(
+        "SELECT val FROM first LEFT JOIN second ON first.key = second.key"
+    ) as sql_lyr:
+        assert [f["val"] for f in sql_lyr] == ["val5", "val500"]
+    assert ds.GetLayerByName("second").GetFeaturesRead() < 1000
@@ -593,3 +593,76 @@ def test_algebra_erase_5(A, empty, C):
     assert C.GetFeatureCount() == A.GetFeatureCount(), (
         "Layer.Erase returned " + str(C.GetFeatureCount()) + " features"
     )
+
+
+###############################################################################
+# Test that USE_IN_MEMORY_INDEX and NUM_THREADS give the same results as the
+# default code path
+
+
+def _square(x, y, size):
+
+    x2 = x + size
+    y2 = y + size
+    return ogr.Geometry(wkt=f"POLYGON(({x} {y},{x} {y2},{x2} {y2},{x2} {y},{x} {y}))")
+
+
+@pytest.mark.parametrize(
+    "operation",
+    ["Intersection", "Union", "SymDifference", "Identity", "Update", "Clip", "Erase"],
+)
+@pytest.mark.parametrize("method_filter", [False, True])
+def test_algebra_use_in_memory_index(mem_ds, operation, method_filter):
+
+    input_lyr = mem_ds.CreateLayer("input")
+    input_lyr.CreateField(ogr.FieldDefn("input_id", ogr.OFTInteger))
+    input_lyr.CreateField(ogr.FieldDefn("input_str", ogr.OFTString))
+    for i in range(20):
+        for j in range(20):
+            feat = ogr.Feature(input_lyr.GetLayerDefn())
+            feat["input_id"] = i * 20 + j
+            feat["input_str"] = str(i * 20 + j)
+            x = i * 1.5
+            y = j * 1.5
+            feat.SetGeometryDirectly(_square(x, y, 1))
+            input_lyr.CreateFeature(feat)
+    # Feature without geometry
+    feat = ogr.Feature(input_lyr.GetLayerDefn())
+    feat["input_id"] = -1
+    input_lyr.CreateFeature(feat)
+
+    method_lyr = mem_ds.CreateLayer("method")
+    method_lyr.CreateField(ogr.FieldDefn("method_id", ogr.OFTInteger))
+    method_lyr.CreateField(ogr.FieldDefn("method_real", ogr.OFTReal))
+    for i in range(7):
+        for j in range(7):
+            feat = ogr.Feature(method_lyr.GetLayerDefn())
+            feat["method_id"] = i * 7 + j
+            feat["method_real"] = (i * 7 + j) * 0.5
+            x = 0.7 + i * 4
+            y = 0.3 + j * 4
+            feat.SetGeometryDirectly(_square(x, y, 3))
+            method_lyr.CreateFeature(feat)
+    if method_filter:
+        method_lyr.SetSpatialFilterRect(5, 5, 20, 20)
+
+    ref_lyr = mem_ds.CreateLayer("ref")
+    getattr(input_lyr, operation)(method_lyr, ref_lyr)
+    assert ref_lyr.GetFeatureCount() > 0
+
+    for options in (
+        ["USE_IN_MEMORY_INDEX=YES"],
+        ["USE_IN_MEMORY_INDEX=YES", "NUM_THREADS=4"],
+    ):
+        out_lyr = mem_ds.CreateLayer("out_" + "_".join(options))
+        getattr(input_lyr, operation)(method_lyr, out_lyr, options=options)
+        assert out_lyr.GetFeatureCount() == ref_lyr.GetFeatureCount()
+        for f_ref, f_out in zip(ref_lyr, out_lyr):
+            assert f_out.GetGeometryRef().Equals(f_ref.GetGeometryRef())
+            f_out.SetGeometry(None)
+            f_ref.SetGeometry(None)
+            f_out.SetFID(f_ref.GetFID())
+            assert f_out.Equal(f_ref)
+
+    if method_filter:
+        assert method_lyr.GetSpatialFilter() is not None
@@ -5938,7 +5938,7 @@ def test_ogr_shape_arrow_stream():
         lyr.GetMetadataItem(
             "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
         )
-        == "NO"
+        == "YES"
     )
     assert len(batches) == 1
     assert len(batches[0]) == 5
@@ -6035,7 +6035,7 @@ def test_ogr_shape_arrow_stream_fid_optim(tmp_vsimem):
     )
     assert len(batches) == 0
 
-    # Regular code path
+    # Optimized code path
     lyr.SetIgnoredFields(ignored_fields[0:-1])
     stream = lyr.GetArrowStreamAsNumPy(options=["USE_MASKED_ARRAYS=NO"])
     batches = [batch for batch in stream]
@@ -6044,14 +6044,14 @@ def test_ogr_shape_arrow_stream_fid_optim(tmp_vsimem):
         lyr.GetMetadataItem(
             "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
         )
-        == "NO"
+        == "YES"
     )
     assert len(batches) == 1
     assert len(batches[0]) == 2
     assert len(batches[0]["OGC_FID"]) == 10
     assert list(batches[0]["OGC_FID"]) == [0, 1, 2, 3, 4, 5, 6, 7, 8, 9]
 
-    # Regular code path
+    # Optimized code path
     lyr.SetIgnoredFields(ignored_fields[1:])
     stream = lyr.GetArrowStreamAsNumPy(options=["USE_MASKED_ARRAYS=NO"])
     batches = [batch for batch in stream]
@@ -6060,7 +6060,7 @@ def test_ogr_shape_arrow_stream_fid_optim(tmp_vsimem):
         lyr.GetMetadataItem(
             "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
         )
-        == "NO"
+        == "YES"
     )
     assert len(batches) == 1
     assert len(batches[0]) == 2
@@ -6132,6 +6132,204 @@ def test_ogr_shape_arrow_stream_fid_optim(tmp_vsimem):
     assert len(batches) == 0
 
 
+###############################################################################
+# Read a layer with GetArrowStreamAsNumPy(), with binary values as bytes
+
+
+def _get_shape_arrow_batches(lyr):
+    import numpy
+
+    stream = lyr.GetArrowStreamAsNumPy(
+        options=["USE_MASKED_ARRAYS=NO", "MAX_FEATURES_IN_BATCH=3"]
+    )
+    return [
+        {
+            k: [bytes(x) if isinstance(x, numpy.ndarray) else x for x in v]
+            for k, v in batch.items()
+        }
+        for batch in stream
+    ]
+
+
+###############################################################################
+# Test that the native GetArrowStream() implementation returns the same
+# content as the generic one
+
+
+def test_ogr_shape_arrow_stream_native(tmp_vsimem):
+    gdaltest.importorskip_gdal_array()
+    pytest.importorskip("numpy")
+
+    filename = str(tmp_vsimem / "test_ogr_shape_arrow_stream_native.shp")
+    ds = gdal.GetDriverByName("ESRI Shapefile").Create(
+        filename, 0, 0, 0, gdal.GDT_Unknown
+    )
+    lyr = ds.CreateLayer(
+        "test", geom_type=ogr.wkbPolygon25D, options=["AUTO_REPACK=NO"]
+    )
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+    fld_defn = ogr.FieldDefn("int64", ogr.OFTInteger64)
+    fld_defn.SetWidth(18)
+    lyr.CreateField(fld_defn)
+    fld_defn = ogr.FieldDefn("real", ogr.OFTReal)
+    fld_defn.SetWidth(24)
+    fld_defn.SetPrecision(15)
+    lyr.CreateField(fld_defn)
+    lyr.CreateField(ogr.FieldDefn("date", ogr.OFTDate))
+    fld_defn = ogr.FieldDefn("bool", ogr.OFTInteger)
+    fld_defn.SetSubType(ogr.OFSTBoolean)
+    lyr.CreateField(fld_defn)
+
+    values = [
+        (
+            "foo",
+            1,
+            1234567890123,
+            1.5,
+            "2022/05/31",
+            True,
+            "POLYGON Z ((0 0 1,0 1 2,1 1 3,0 0 1))",
+        ),
+        (None, None, None, None, None, None, None),
+        (
+            "\u00e9t\u00e9",
+            -12345678,
+            -1,
+            -0.1,
+            "1900/01/01",
+            False,
+            "MULTIPOLYGON Z (((0 0 1,0 1 2,1 1 3,0 0 1)),"
+            "((10 10 1,10 11 2,11 11 3,10 10 1)))",
+        ),
+        (
+            "deleted",
+            2,
+            2,
+            2.0,
+            "2000/01/01",
+            True,
+            "POLYGON Z ((0 0 0,0 1 0,1 1 0,0 0 0))",
+        ),
+        (
+            "bar",
+            123456789,
+            -12345678901234567,
+            1234.5678,
+            "2100/12/31",
+            None,
+            "POLYGON Z ((0 0 0,0 -1 0,-1 -1 0,0 0 0))",
+        ),
+    ]
+    for str_val, int_val, int64_val, real_val, date_val, bool_val, wkt in values:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["str"] = str_val
+        f["int"] = int_val
+        f["int64"] = int64_val
+        f["real"] = real_val
+        f["date"] = date_val
+        f["bool"] = bool_val
+        if wkt:
+            f.SetGeometry(ogr.CreateGeometryFromWkt(wkt))
+        lyr.CreateFeature(f)
+    lyr.DeleteFeature(3)
+    ds.Close()
+
+    def get_batches():
+        return _get_shape_arrow_batches(lyr)
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+
+    batches = get_batches()
+    assert (
+        lyr.GetMetadataItem(
+            "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
+        )
+        == "YES"
+    )
+    assert len(batches) == 2
+    assert batches[0]["OGC_FID"] == [0, 1, 2]
+    assert batches[1]["OGC_FID"] == [4]
+    assert batches[0]["str"][2] == "\u00e9t\u00e9".encode("utf-8")
+    assert batches[1]["int"][0] == 123456789
+    assert batches[1]["int64"][0] == -12345678901234567
+    assert batches[1]["real"][0] == 1234.5678
+
+    with gdaltest.config_option("OGR_SHAPE_STREAM_BASE_IMPL", "YES"):
+        ref_batches = get_batches()
+    assert (
+        lyr.GetMetadataItem(
+            "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
+        )
+        == "NO"
+    )
+    assert batches == ref_batches
+
+    lyr.SetIgnoredFields(["str", "date"])
+    batches = get_batches()
+    assert (
+        lyr.GetMetadataItem(
+            "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
+        )
+        == "YES"
+    )
+    with gdaltest.config_option("OGR_SHAPE_STREAM_BASE_IMPL", "YES"):
+        ref_batches = get_batches()
+    assert batches == ref_batches
+
+
+###############################################################################
+# Test that the native GetArrowStream() implementation returns the same
+# content as the generic one, on existing files of the various shape types
+
+
+@pytest.mark.parametrize(
+    "filename",
+    [
+        "gjpoint.shp",
+        "testpointm.shp",
+        "testpointzm.shp",
+        "pointz_without_m.shp",
+        "pointzm_with_one_valid_m.shp",
+        "pointzm_with_all_nodata_m.shp",
+        "gjmultipoint.shp",
+        "multipointz_without_m.shp",
+        "multipointz_non_constant_z.shp",
+        "emptymultipoint.shp",
+        "gjline.shp",
+        "gjmultiline.shp",
+        "arcm_with_m.shp",
+        "arcm_without_m.shp",
+        "emptymultiline.shp",
+        "gjpoly.shp",
+        "gjmultipoly.shp",
+        "polygonm_with_m.shp",
+        "polygonm_without_m.shp",
+        "multipatch.shp",
+    ],
+)
+def test_ogr_shape_arrow_stream_native_shape_types(filename):
+    gdaltest.importorskip_gdal_array()
+    pytest.importorskip("numpy")
+
+    ds = ogr.Open("data/shp/" + filename)
+    lyr = ds.GetLayer(0)
+
+    batches = _get_shape_arrow_batches(lyr)
+    assert (
+        lyr.GetMetadataItem(
+            "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
+        )
+        == "YES"
+    )
+    assert sum(len(batch["OGC_FID"]) for batch in batches) == lyr.GetFeatureCount()
+
+    with gdaltest.config_option("OGR_SHAPE_STREAM_BASE_IMPL", "YES"):
+        ref_batches = _get_shape_arrow_batches(lyr)
+    assert batches == ref_batches
+
+
 ###############################################################################
 # Test DBF Logical field type
 
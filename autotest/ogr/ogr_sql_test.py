@@ -2234,3 +2234,49 @@ def test_ogr_sql_union_layer_feature_count_add_overflow():
             "select * from test union all select * from test2", dialect="OGRSQL"
         ) as sql_lyr:
             assert sql_lyr.GetFeatureCount() == 0
+
+
+###############################################################################
+# Test ORDER BY with an external merge sort, when the sort keys do not fit
+# in OGR_SQL_SORT_MAX_MEMORY
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_ogr_sql_order_by_external_sort(num_threads):
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    lyr = ds.CreateLayer("test")
+    lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("real", ogr.OFTReal))
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("dt", ogr.OFTDateTime))
+    for i in range(1000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        if i % 17 != 0:
+            f["int"] = (i * 7) % 13
+        if i % 19 != 0:
+            f["real"] = ((i * 11) % 23) / 2.0
+        if i % 23 != 0:
+            f["str"] = "val%d" % ((i * 3) % 29)
+        f["dt"] = "2025/01/%02d 12:%02d:00" % (1 + i % 28, i % 60)
+        lyr.CreateFeature(f)
+
+    def get_fids(sql):
+        with ds.ExecuteSQL(sql) as sql_lyr:
+            return [f.GetFID() for f in sql_lyr]
+
+    sqls = [
+        "SELECT * FROM test ORDER BY int",
+        "SELECT * FROM test ORDER BY real DESC",
+        "SELECT * FROM test ORDER BY str, int DESC",
+        "SELECT * FROM test ORDER BY dt DESC, FID",
+        "SELECT * FROM test WHERE int > 3 ORDER BY str DESC, real",
+    ]
+    expected = [get_fids(sql) for sql in sqls]
+    assert len(expected[0]) == 1000
+
+    with gdal.config_options(
+        {"OGR_SQL_SORT_MAX_MEMORY": "1000B", "GDAL_NUM_THREADS": num_threads}
+    ):
+        for sql, expected_fids in zip(sqls, expected):
+            assert get_fids(sql) == expected_fids, sql
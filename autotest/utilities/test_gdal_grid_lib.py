@@ -1120,3 +1120,59 @@ def test_gdal_grid_lib_errors():
             algorithm="invdist",
             SQLStatement="invalid",
         )
+
+
+###############################################################################
+# Test that the index of points gives the same result as the exhaustive search
+
+
+@pytest.mark.parametrize(
+    "algorithm",
+    [
+        "nearest",
+        "nearest:radius1=3:radius2=2:angle=30",
+        "invdist:radius1=4:radius2=4:max_points=5",
+        "average:radius1=3:radius2=2:angle=-20:min_points=2",
+        "minimum:radius1=2.5:radius2=2.5",
+        "range:radius1=2.5:radius2=5",
+        "count:radius1=1.5:radius2=1.5:angle=45",
+        "average_distance:radius1=3:radius2=3",
+        "average_distance_pts:radius1=2:radius2=2",
+    ],
+)
+@pytest.mark.parametrize("num_threads", ["1", "3"])
+def test_gdal_grid_lib_point_index(algorithm, num_threads):
+
+    import random
+
+    rnd = random.Random(0)
+    mem_ds = gdal.GetDriverByName("MEM").CreateVector("")
+    lyr = mem_ds.CreateLayer("test")
+    for i in range(2000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        # Rounded coordinates to get duplicated points and ties in distances
+        x = round(rnd.uniform(0, 40) ** 2 / 40, 1)
+        y = round(rnd.uniform(0, 30), 1)
+        f.SetGeometry(ogr.CreateGeometryFromWkt(f"POINT Z ({x} {y} {i % 97})"))
+        lyr.CreateFeature(f)
+
+    def grid(threshold):
+        with gdal.config_options(
+            {
+                "GDAL_GRID_POINT_COUNT_THRESHOLD": threshold,
+                "GDAL_NUM_THREADS": num_threads,
+            }
+        ):
+            ds = gdal.Grid(
+                "",
+                mem_ds,
+                width=83,
+                height=61,
+                outputBounds=[-1, -1, 41, 31],
+                format="MEM",
+                outputType=gdal.GDT_Float64,
+                algorithm=algorithm,
+            )
+            return ds.ReadRaster()
+
+    assert grid("0") == grid("1000000000")
@@ -162,3 +162,132 @@ def test_gdalalg_raster_info_read_gdalg_with_input_format():
     info["input"] = "../gdrivers/data/gdalg/read_byte.gdalg.json"
     info["input-format"] = "GDALG"
     assert info.Run()
+
+
+def _sha256_dataset_hash(ds):
+    import hashlib
+    import struct
+
+    def h(domain, data):
+        return hashlib.sha256(bytes([domain]) + data).digest()
+
+    band_hashes = b""
+    for i in range(ds.RasterCount):
+        band = ds.GetRasterBand(i + 1)
+        line_size = band.XSize * gdal.GetDataTypeSize(band.DataType) // 8
+        data = band.ReadRaster()
+        level = [
+            h(0, data[y * line_size : (y + 1) * line_size]) for y in range(band.YSize)
+        ]
+        while len(level) > 1:
+            new_level = [
+                h(1, level[j] + level[j + 1]) for j in range(0, len(level) - 1, 2)
+            ]
+            if len(level) % 2:
+                new_level.append(level[-1])
+            level = new_level
+        band_hashes += h(
+            2,
+            gdal.GetDataTypeName(band.DataType).encode("ascii")
+            + b"\0"
+            + struct.pack("<II", band.XSize, band.YSize)
+            + level[0],
+        )
+    return h(3, struct.pack("<I", ds.RasterCount) + band_hashes).hex()
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_gdalalg_raster_info_hash(tmp_vsimem, num_threads):
+
+    src_ds = gdal.Translate(
+        "", "../gcore/data/rgbsmall.tif", format="MEM", outputType=gdal.GDT_UInt16
+    )
+    tiled_ds = gdal.Translate(
+        tmp_vsimem / "tiled.tif",
+        src_ds,
+        creationOptions=["TILED=YES", "BLOCKXSIZE=16", "BLOCKYSIZE=16"],
+    )
+    striped_ds = gdal.Translate(
+        tmp_vsimem / "striped.tif",
+        src_ds,
+        creationOptions=["BLOCKYSIZE=1", "INTERLEAVE=PIXEL"],
+    )
+
+    def get_hash(ds, algorithm):
+        info = get_info_alg()
+        info["input"] = ds
+        assert info.ParseRunAndFinalize(["--hash", algorithm, "-j", num_threads])
+        j = json.loads(info["output-string"])
+        assert j["hash"]["algorithm"] == algorithm
+        return j["hash"]["value"]
+
+    expected = _sha256_dataset_hash(src_ds)
+    assert get_hash(src_ds, "SHA256") == expected
+    assert get_hash(tiled_ds, "SHA256") == expected
+    assert get_hash(striped_ds, "SHA256") == expected
+
+    xxh64 = get_hash(src_ds, "XXH64")
+    assert len(xxh64) == 16
+    assert get_hash(tiled_ds, "XXH64") == xxh64
+    assert get_hash(striped_ds, "XXH64") == xxh64
+
+    src_ds.GetRasterBand(3).WriteRaster(0, 49, 1, 1, b"\x01\x00")
+    assert get_hash(src_ds, "XXH64") != xxh64
+    assert get_hash(src_ds, "SHA256") == _sha256_dataset_hash(src_ds)
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_gdalalg_raster_info_hash_known_answer(num_threads):
+
+    import struct
+
+    ds = gdal.GetDriverByName("MEM").Create("", 37, 5, 0)
+    ds.AddBand(gdal.GDT_Byte)
+    ds.AddBand(gdal.GDT_UInt16)
+    ds.GetRasterBand(1).WriteRaster(
+        0,
+        0,
+        37,
+        5,
+        bytes((x * 3 + y * 7) % 256 for y in range(5) for x in range(37)),
+    )
+    ds.GetRasterBand(2).WriteRaster(
+        0,
+        0,
+        37,
+        5,
+        b"".join(struct.pack("=H", x * y * 257) for y in range(5) for x in range(37)),
+    )
+
+    def get_hash(algorithm):
+        info = get_info_alg()
+        info["input"] = ds
+        with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+            assert info.ParseRunAndFinalize(["--hash", algorithm])
+        return json.loads(info["output-string"])["hash"]["value"]
+
+    # Reference values, that must not change across GDAL versions
+    assert get_hash("XXH64") == "5de7f27f4e845bbb"
+    assert (
+        get_hash("SHA256")
+        == "577348936865601e7c5dfe1c932c16280c5c2268072fcc977e2cdfc80fb78135"
+    )
+
+
+def test_gdalalg_raster_info_hash_read_error(tmp_vsimem):
+
+    vrt_filename = tmp_vsimem / "test.vrt"
+    gdal.FileFromMemBuffer(
+        vrt_filename,
+        """<VRTDataset rasterXSize="20" rasterYSize="20">
+  <VRTRasterBand dataType="Byte" band="1">
+    <SimpleSource>
+      <SourceFilename>/vsimem/i_do_not_exist.tif</SourceFilename>
+    </SimpleSource>
+  </VRTRasterBand>
+</VRTDataset>""",
+    )
+
+    info = get_info_alg()
+    with pytest.raises(Exception):
+        info.ParseRunAndFinalize(["--hash", "XXH64", vrt_filename])
@@ -106,3 +106,49 @@ def test_gdalalg_vector_buffer(input_wkt, options, output_wkt):
     )
     out_f = out_lyr.GetNextFeature()
     assert out_f.GetGeometryRef() is None
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_gdalalg_vector_buffer_num_threads(num_threads):
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 0, 0, 0, gdal.GDT_Unknown)
+    src_lyr = src_ds.CreateLayer("the_layer")
+    src_lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+
+    # More features than a single batch, so that several batches are needed
+    N = 1000
+    for i in range(N):
+        f = ogr.Feature(src_lyr.GetLayerDefn())
+        f["id"] = i
+        if i % 10 != 0:
+            f.SetGeometry(ogr.CreateGeometryFromWkt(f"POINT ({i} 0)"))
+        src_lyr.CreateFeature(f)
+
+    alg = get_alg()
+    alg["input"] = src_ds
+    alg["output"] = ""
+    alg["output-format"] = "stream"
+    alg["distance"] = 1
+    alg["endcap-style"] = "square"
+    alg["num-threads"] = num_threads
+
+    assert alg.Run()
+
+    out_ds = alg["output"].GetDataset()
+    out_lyr = out_ds.GetLayer(0)
+    for _ in range(2):
+        i = 0
+        for out_f in out_lyr:
+            assert out_f["id"] == i
+            if i % 10 == 0:
+                assert out_f.GetGeometryRef() is None
+            else:
+                assert out_f.GetGeometryRef().GetEnvelope() == (
+                    i - 1,
+                    i + 1,
+                    -1,
+                    1,
+                )
+            i += 1
+        assert i == N
+        out_lyr.ResetReading()
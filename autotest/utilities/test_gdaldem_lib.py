@@ -910,3 +910,128 @@ def test_gdaldem_lib_dict_arguments():
     ind = opt.index("-co")
 
     assert opt[ind : ind + 4] == ["-co", "COMPRESS=DEFLATE", "-co", "LEVEL=4"]
+
+
+###############################################################################
+# Test that multi-threaded processing gives the same result as the
+# single-threaded code path
+
+
+@pytest.mark.parametrize("datatype", [gdal.GDT_Int16, gdal.GDT_Float32])
+@pytest.mark.parametrize(
+    "processing,options",
+    [
+        ("hillshade", {}),
+        ("hillshade", {"computeEdges": True}),
+        ("hillshade", {"multiDirectional": True, "computeEdges": True}),
+        ("slope", {}),
+        ("aspect", {"computeEdges": True}),
+        ("TRI", {}),
+        ("TPI", {}),
+        ("roughness", {"computeEdges": True}),
+        ("color-relief", {"colorFilename": "data/color_file.txt"}),
+    ],
+)
+def test_gdaldem_lib_multithreaded(tmp_vsimem, datatype, processing, options):
+
+    # Large enough to be split into several chunks of lines
+    src_ds = gdal.Translate(
+        "",
+        "../gdrivers/data/n43.tif",
+        format="MEM",
+        outputType=datatype,
+        width=3000,
+        height=1200,
+        resampleAlg=gdal.GRIORA_Bilinear,
+    )
+    src_ds.GetRasterBand(1).SetNoDataValue(0)
+    src_ds.GetRasterBand(1).WriteRaster(
+        1000, 500, 10, 10, b"\x00" * 100, buf_type=gdal.GDT_Byte
+    )
+
+    def compute(num_threads):
+        with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+            ds = gdal.DEMProcessing("", src_ds, processing, format="MEM", **options)
+        return [
+            ds.GetRasterBand(i + 1).ReadRaster() for i in range(ds.RasterCount)
+        ]
+
+    ref = compute("1")
+    assert compute("4") == ref
+
+    # NUM_THREADS creation option takes precedence over GDAL_NUM_THREADS
+    with gdal.config_option("GDAL_NUM_THREADS", "1"):
+        ds = gdal.DEMProcessing(
+            tmp_vsimem / "out.tif",
+            src_ds,
+            processing,
+            format="GTiff",
+            creationOptions=["NUM_THREADS=ALL_CPUS"],
+            **options,
+        )
+    assert [
+        ds.GetRasterBand(i + 1).ReadRaster() for i in range(ds.RasterCount)
+    ] == ref
+
+
+###############################################################################
+# Test multi-threaded processing with output drivers, or creation options,
+# that require going through CreateCopy()
+
+
+@pytest.mark.parametrize(
+    "format,creation_options",
+    [
+        ("GTiff", ["TILED=YES", "COMPRESS=DEFLATE"]),
+        ("COG", ["COMPRESS=LZW"]),
+    ],
+)
+@pytest.mark.parametrize("processing", ["hillshade", "color-relief"])
+def test_gdaldem_lib_multithreaded_create_copy(
+    tmp_vsimem, format, creation_options, processing
+):
+
+    if gdal.GetDriverByName(format) is None:
+        pytest.skip(f"{format} driver missing")
+
+    src_ds = gdal.Translate(
+        "",
+        "../gdrivers/data/n43.tif",
+        format="MEM",
+        width=3000,
+        height=1200,
+        resampleAlg=gdal.GRIORA_Bilinear,
+    )
+    options = (
+        {"colorFilename": "data/color_file.txt"}
+        if processing == "color-relief"
+        else {}
+    )
+
+    def compute(num_threads):
+        ds = gdal.DEMProcessing(
+            tmp_vsimem / f"out_{num_threads}.tif",
+            src_ds,
+            processing,
+            format=format,
+            creationOptions=creation_options + [f"NUM_THREADS={num_threads}"],
+            **options,
+        )
+        return [
+            ds.GetRasterBand(i + 1).Checksum() for i in range(ds.RasterCount)
+        ]
+
+    ref = compute(1)
+
+    debug_msgs = []
+
+    def my_handler(errorClass, errno, msg):
+        if errorClass == gdal.CE_Debug:
+            debug_msgs.append(msg)
+
+    with gdal.config_option("CPL_DEBUG", "GDALDEM"), gdaltest.error_handler(
+        my_handler
+    ):
+        gdal.SetCurrentErrorHandlerCatchDebug(True)
+        assert compute(4) == ref
+    assert any("Computing on 4 threads" in msg for msg in debug_msgs)
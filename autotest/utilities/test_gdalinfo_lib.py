@@ -335,3 +335,38 @@ def test_gdalinfo_lib_json_stac_common_name():
     ds.GetRasterBand(1).SetColorInterpretation(gdal.GCI_PanBand)
     ret = gdal.Info(ds, options="-json")
     assert ret["stac"]["eo:bands"][0]["common_name"] == "pan"
+
+
+###############################################################################
+# Test -hash with JSON output
+
+
+@pytest.mark.parametrize("algorithm", ["XXH64", "SHA256"])
+def test_gdalinfo_lib_json_hash(algorithm):
+
+    ds = gdal.Open("../gcore/data/byte.tif")
+
+    ret = gdal.Info(ds, options=["-json", "-hash", algorithm])
+    assert ret["hash"]["algorithm"] == algorithm
+    assert len(ret["hash"]["value"]) == (16 if algorithm == "XXH64" else 64)
+
+    gdaltest.validate_json(ret, "gdalinfo_output.schema.json")
+
+
+###############################################################################
+# Test that -hash reports a failure when pixels cannot be read
+
+
+@pytest.mark.parametrize("options", [["-hash", "XXH64"], ["-json", "-hash", "SHA256"]])
+def test_gdalinfo_lib_hash_read_error(options):
+
+    ds = gdal.Open("""<VRTDataset rasterXSize="20" rasterYSize="20">
+  <VRTRasterBand dataType="Byte" band="1">
+    <SimpleSource>
+      <SourceFilename>/vsimem/i_do_not_exist.tif</SourceFilename>
+    </SimpleSource>
+  </VRTRasterBand>
+</VRTDataset>""")
+
+    with pytest.raises(Exception):
+        gdal.Info(ds, options=options + ["-num_threads", "2"])
@@ -4569,3 +4569,55 @@ def test_gdalwarp_lib_int_max_sized_raster(tmp_vsimem):
             transformerOptions=["SRC_METHOD=NO_GEOTRANSFORM"],
             height=2147483647,
         )
+
+
+###############################################################################
+# Test TRANSFORM_GRID_CACHE when gdalwarp creates the output dataset
+
+
+def test_gdalwarp_lib_transform_grid_cache_new_output(tmp_vsimem):
+
+    src_ds = gdal.Open("../gcore/data/byte.tif")
+    grid_filename = str(tmp_vsimem / "grid.bin")
+
+    class my_error_handler:
+        def __init__(self):
+            self.debug_msg_list = []
+
+        def handler(self, eErrClass, err_no, msg):
+            if eErrClass == gdal.CE_Debug:
+                self.debug_msg_list.append(msg)
+
+    def warp(out_filename):
+        handler = my_error_handler()
+        try:
+            gdal.PushErrorHandler(handler.handler)
+            gdal.SetCurrentErrorHandlerCatchDebug(True)
+            with gdaltest.config_option("CPL_DEBUG", "WARP"):
+                gdal.Warp(
+                    out_filename,
+                    src_ds,
+                    dstSRS="EPSG:4326",
+                    transformerOptions=[f"TRANSFORM_GRID_CACHE={grid_filename}"],
+                )
+        finally:
+            gdal.PopErrorHandler()
+
+        msgs = [msg for msg in handler.debug_msg_list if msg.startswith("WARP:")]
+        stats = [msg for msg in msgs if "points interpolated" in msg]
+        assert len(stats) == 1
+        assert int(stats[0].split(" ")[3]) > 0
+        return msgs
+
+    out_filename = str(tmp_vsimem / "out.tif")
+    msgs = warp(out_filename)
+    assert not any("Transformation grid read from" in msg for msg in msgs)
+    assert gdal.VSIStatL(grid_filename) is not None
+    with gdal.Open(out_filename) as ds:
+        cs = ds.GetRasterBand(1).Checksum()
+
+    out_filename2 = str(tmp_vsimem / "out2.tif")
+    msgs = warp(out_filename2)
+    assert f"WARP: Transformation grid read from {grid_filename}" in msgs
+    with gdal.Open(out_filename2) as ds:
+        assert ds.GetRasterBand(1).Checksum() == cs
@@ -253,6 +253,8 @@ class CPL_DLL OGRMemLayer CPL_NON_FINAL : public OGRLayer
     // doesn't change.
     IOGRMemLayerFeatureIterator *GetIterator();
 
+    OGRFeature *GetNextMatchingFeatureRef();
+
   protected:
     OGRFeature *GetFeatureRef(GIntBig nFeatureId);
 
@@ -265,6 +267,7 @@ class CPL_DLL OGRMemLayer CPL_NON_FINAL : public OGRLayer
 
     void ResetReading() override;
     OGRFeature *GetNextFeature() override;
+    bool GetNextFeatureInto(OGRFeature &oFeature) override;
     virtual OGRErr SetNextByIndex(GIntBig nIndex) override;
 
     OGRFeature *GetFeature(GIntBig nFeatureId) override;
@@ -121,10 +121,13 @@ void OGRMemLayer::ResetReading()
 }
 
 /************************************************************************/
-/*                           GetNextFeature()                           */
+/*                     GetNextMatchingFeatureRef()                      */
+/*                                                                      */
+/*      Return the internal instance of the next feature matching the  */
+/*      filters.                                                        */
 /************************************************************************/
 
-OGRFeature *OGRMemLayer::GetNextFeature()
+OGRFeature *OGRMemLayer::GetNextMatchingFeatureRef()
 
 {
     while (true)
@@ -153,13 +156,117 @@ OGRFeature *OGRMemLayer::GetNextFeature()
             (m_poAttrQuery == nullptr || m_poAttrQuery->Evaluate(poFeature)))
         {
             m_nFeaturesRead++;
-            return poFeature->Clone();
+            return poFeature;
         }
     }
 
     return nullptr;
 }
 
+/************************************************************************/
+/*                           GetNextFeature()                           */
+/************************************************************************/
+
+OGRFeature *OGRMemLayer::GetNextFeature()
+
+{
+    OGRFeature *poFeature = GetNextMatchingFeatureRef();
+    return poFeature ? poFeature->Clone() : nullptr;
+}
+
+/************************************************************************/
+/*                        AssignGeometryInPlace()                       */
+/*                                                                      */
+/*      Copy poSrc into poDst if they are of the same type, reusing     */
+/*      the coordinate arrays of poDst.                                 */
+/************************************************************************/
+
+static bool AssignGeometryInPlace(OGRGeometry *poDst, const OGRGeometry *poSrc)
+{
+    if (poDst->getGeometryType() != poSrc->getGeometryType())
+        return false;
+
+    switch (wkbFlatten(poSrc->getGeometryType()))
+    {
+        case wkbPoint:
+            *(poDst->toPoint()) = *(poSrc->toPoint());
+            return true;
+
+        case wkbLineString:
+            *(poDst->toLineString()) = *(poSrc->toLineString());
+            return true;
+
+        case wkbPolygon:
+        {
+            OGRPolygon *poDstPoly = poDst->toPolygon();
+            const OGRPolygon *poSrcPoly = poSrc->toPolygon();
+            if (poSrcPoly->getExteriorRing() == nullptr ||
+                poDstPoly->getExteriorRing() == nullptr ||
+                poSrcPoly->getNumInteriorRings() !=
+                    poDstPoly->getNumInteriorRings())
+            {
+                return false;
+            }
+            *(poDstPoly->getExteriorRing()) = *(poSrcPoly->getExteriorRing());
+            for (int i = 0; i < poSrcPoly->getNumInteriorRings(); ++i)
+            {
+                *(poDstPoly->getInteriorRing(i)) =
+                    *(poSrcPoly->getInteriorRing(i));
+            }
+            poDstPoly->assignSpatialReference(poSrc->getSpatialReference());
+            return true;
+        }
+
+        default:
+            break;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                         GetNextFeatureInto()                         */
+/************************************************************************/
+
+bool OGRMemLayer::GetNextFeatureInto(OGRFeature &oFeature)
+
+{
+    if (oFeature.GetDefnRef() != m_poFeatureDefn)
+        return OGRLayer::GetNextFeatureInto(oFeature);
+
+    const OGRFeature *poSrcFeature = GetNextMatchingFeatureRef();
+    if (!poSrcFeature)
+        return false;
+
+    // Copy the internal feature into oFeature, recycling its string
+    // fields and geometries.
+    const int nFieldCount = m_poFeatureDefn->GetFieldCount();
+    for (int i = 0; i < nFieldCount; ++i)
+        oFeature.SetField(i, poSrcFeature->GetRawFieldRef(i));
+
+    const int nGeomFieldCount = m_poFeatureDefn->GetGeomFieldCount();
+    for (int i = 0; i < nGeomFieldCount; ++i)
+    {
+        const OGRGeometry *poSrcGeom = poSrcFeature->GetGeomFieldRef(i);
+        OGRGeometry *poDstGeom = oFeature.GetGeomFieldRef(i);
+        if (poSrcGeom == nullptr)
+        {
+            oFeature.SetGeomFieldDirectly(i, nullptr);
+        }
+        else if (poDstGeom == nullptr ||
+                 !AssignGeometryInPlace(poDstGeom, poSrcGeom))
+        {
+            oFeature.SetGeomField(i, poSrcGeom);
+        }
+    }
+
+    oFeature.SetFID(poSrcFeature->GetFID());
+    oFeature.SetStyleString(poSrcFeature->GetStyleString());
+    oFeature.SetNativeData(poSrcFeature->GetNativeData());
+    oFeature.SetNativeMediaType(poSrcFeature->GetNativeMediaType());
+
+    return true;
+}
+
 /************************************************************************/
 /*                           SetNextByIndex()                           */
 /************************************************************************/
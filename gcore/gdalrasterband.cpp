@@ -24,10 +24,13 @@
 #include <cstdlib>
 #include <cstring>
 #include <algorithm>
+#include <functional>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <new>
 #include <type_traits>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -38,6 +41,7 @@
 #include "cpl_vsi.h"
 #include "gdal.h"
 #include "gdal_rat.h"
+#include "gdal_thread_pool.h"
 #include "gdal_priv_templates.hpp"
 #include "gdal_interpolateatpoint.h"
 #include "gdal_minmax_element.hpp"
@@ -4087,6 +4091,384 @@ inline bool ARE_REAL_EQUAL(GFloat16 dfVal1, GFloat16 dfVal2, int ulp = 2)
                                       abs(dfVal1 + dfVal2) * ulp;
 }
 
+/************************************************************************/
+/*                    GDALGetStatisticsThreadCount()                    */
+/************************************************************************/
+
+static int GDALGetStatisticsThreadCount()
+{
+    const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    return std::max(1, std::min(128, EQUAL(pszThreads, "ALL_CPUS")
+                                         ? CPLGetNumCPUs()
+                                         : atoi(pszThreads)));
+}
+
+/************************************************************************/
+/*                          GDALSampledBlock                            */
+/************************************************************************/
+
+namespace
+{
+/** Block handed to the batch processing function of
+ * GDALProcessSampledBlocksMultiThreaded() */
+struct GDALSampledBlock
+{
+    GDALRasterBlock *poBlock = nullptr;
+    int nXCheck = 0;
+    int nYCheck = 0;
+    //! Mask values, with a line stride of nBlockXSize. Empty if no mask band.
+    std::vector<GByte> abyMask{};
+};
+
+using GDALSampledBlockBatchFunc =
+    std::function<void(size_t, const std::vector<GDALSampledBlock> &)>;
+}  // namespace
+
+/************************************************************************/
+/*                    GDALGetSampledBlocksPerBatch()                    */
+/************************************************************************/
+
+// The batch size only depends on the block size, and not on the number of
+// threads, so that results accumulated per batch and merged in batch order
+// are reproducible whatever the number of threads.
+static int GDALGetSampledBlocksPerBatch(GDALRasterBand *poBand)
+{
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    constexpr GIntBig PIXELS_PER_BATCH = 1024 * 1024;
+    return static_cast<int>(std::max<GIntBig>(
+        1, PIXELS_PER_BATCH / (static_cast<GIntBig>(nBlockXSize) *
+                               std::max(1, nBlockYSize))));
+}
+
+/************************************************************************/
+/*                    GDALGetSampledBlockBatchCount()                   */
+/************************************************************************/
+
+static size_t GDALGetSampledBlockBatchCount(GDALRasterBand *poBand,
+                                            int nSampleRate)
+{
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    const GIntBig nTotalBlocks =
+        static_cast<GIntBig>(DIV_ROUND_UP(poBand->GetXSize(), nBlockXSize)) *
+        DIV_ROUND_UP(poBand->GetYSize(), nBlockYSize);
+    const GIntBig nSampledBlocks = DIV_ROUND_UP(nTotalBlocks, nSampleRate);
+    return static_cast<size_t>(
+        DIV_ROUND_UP(nSampledBlocks, GDALGetSampledBlocksPerBatch(poBand)));
+}
+
+/************************************************************************/
+/*                GDALProcessSampledBlocksMultiThreaded()               */
+/************************************************************************/
+
+// Iterates over one block every nSampleRate blocks of poBand, and calls
+// pfnProcessBatch(iBatch, aoBlocks) from the global thread pool on
+// consecutive batches of them.
+// Blocks and mask values are fetched on the calling thread, as drivers are
+// not generally safe to read from several threads, and overlap with the
+// computations done by the worker threads. At most nThreads batches are
+// pending at any time, to bound the number of locked blocks.
+static bool GDALProcessSampledBlocksMultiThreaded(
+    GDALRasterBand *poBand, int nSampleRate, GDALRasterBand *poMaskBand,
+    int nThreads, const GDALSampledBlockBatchFunc &pfnProcessBatch,
+    const char *pszProgressMessage, GDALProgressFunc pfnProgress,
+    void *pProgressData)
+{
+    auto poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue()
+                                   : std::unique_ptr<CPLJobQueue>(nullptr);
+    if (!poJobQueue)
+        return false;
+
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    const int nBlocksPerRow = DIV_ROUND_UP(poBand->GetXSize(), nBlockXSize);
+    const GIntBig nTotalBlocks =
+        static_cast<GIntBig>(nBlocksPerRow) *
+        DIV_ROUND_UP(poBand->GetYSize(), nBlockYSize);
+    const int nBlocksPerBatch = GDALGetSampledBlocksPerBatch(poBand);
+
+    const auto ReleaseBlocks = [](std::vector<GDALSampledBlock> &aoBlocks)
+    {
+        for (auto &oBlock : aoBlocks)
+            oBlock.poBlock->DropLock();
+    };
+
+    size_t iBatch = 0;
+    for (GIntBig iSampleBlock = 0; iSampleBlock < nTotalBlocks; ++iBatch)
+    {
+        auto poBatch = std::make_shared<std::vector<GDALSampledBlock>>();
+        for (; iSampleBlock < nTotalBlocks &&
+               poBatch->size() < static_cast<size_t>(nBlocksPerBatch);
+             iSampleBlock += nSampleRate)
+        {
+            const int iYBlock = static_cast<int>(iSampleBlock / nBlocksPerRow);
+            const int iXBlock = static_cast<int>(iSampleBlock % nBlocksPerRow);
+
+            GDALSampledBlock oBlock;
+            oBlock.poBlock = poBand->GetLockedBlockRef(iXBlock, iYBlock);
+            if (oBlock.poBlock == nullptr)
+            {
+                ReleaseBlocks(*poBatch);
+                poJobQueue->WaitCompletion();
+                return false;
+            }
+            poBand->GetActualBlockSize(iXBlock, iYBlock, &oBlock.nXCheck,
+                                       &oBlock.nYCheck);
+            poBatch->push_back(oBlock);
+
+            if (poMaskBand)
+            {
+                auto &abyMask = poBatch->back().abyMask;
+                try
+                {
+                    abyMask.resize(static_cast<size_t>(nBlockXSize) *
+                                   oBlock.nYCheck);
+                }
+                catch (const std::bad_alloc &)
+                {
+                    CPLError(CE_Failure, CPLE_OutOfMemory,
+                             "Out of memory allocating mask buffer");
+                    ReleaseBlocks(*poBatch);
+                    poJobQueue->WaitCompletion();
+                    return false;
+                }
+                if (poMaskBand->RasterIO(
+                        GF_Read, iXBlock * nBlockXSize, iYBlock * nBlockYSize,
+                        oBlock.nXCheck, oBlock.nYCheck, abyMask.data(),
+                        oBlock.nXCheck, oBlock.nYCheck, GDT_Byte, 0,
+                        nBlockXSize, nullptr) != CE_None)
+                {
+                    ReleaseBlocks(*poBatch);
+                    poJobQueue->WaitCompletion();
+                    return false;
+                }
+            }
+        }
+
+        poJobQueue->SubmitJob(
+            [poBatch, iBatch, &pfnProcessBatch, &ReleaseBlocks]()
+            {
+                pfnProcessBatch(iBatch, *poBatch);
+                ReleaseBlocks(*poBatch);
+            });
+
+        // Do not get too far ahead of worker threads
+        poJobQueue->WaitCompletion(nThreads);
+
+        if (!pfnProgress(static_cast<double>(iSampleBlock) /
+                             static_cast<double>(nTotalBlocks),
+                         pszProgressMessage, pProgressData))
+        {
+            poJobQueue->WaitCompletion();
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            return false;
+        }
+    }
+
+    poJobQueue->WaitCompletion();
+    return true;
+}
+
+/************************************************************************/
+/*                      ComputeHistogramForBlock()                      */
+/************************************************************************/
+
+static bool ComputeHistogramForBlock(
+    const void *pData, const GByte *pabyMaskData, int nXCheck, int nYCheck,
+    int nBlockXSize, int nBlockYSize, GDALDataType eDataType, bool bSignedByte,
+    const GDALNoDataValues &sNoDataValues, double dfMin, double dfScale,
+    int nBuckets, bool bIncludeOutOfRange, GUIntBig *panHistogram)
+{
+    // this is a special case for a common situation.
+    if (eDataType == GDT_Byte && !bSignedByte && dfScale == 1.0 &&
+        (dfMin >= -0.5 && dfMin <= 0.5) && nYCheck == nBlockYSize &&
+        nXCheck == nBlockXSize && nBuckets == 256)
+    {
+        const GPtrDiff_t nPixels = static_cast<GPtrDiff_t>(nXCheck) * nYCheck;
+        const GByte *pabyData = static_cast<const GByte *>(pData);
+
+        for (GPtrDiff_t i = 0; i < nPixels; i++)
+        {
+            if (pabyMaskData && pabyMaskData[i] == 0)
+                continue;
+            if (!(sNoDataValues.bGotNoDataValue &&
+                  (pabyData[i] ==
+                   static_cast<GByte>(sNoDataValues.dfNoDataValue))))
+            {
+                panHistogram[pabyData[i]]++;
+            }
+        }
+
+        return true;
+    }
+
+    // This isn't the fastest way to do this, but is easier for now.
+    for (int iY = 0; iY < nYCheck; iY++)
+    {
+        for (int iX = 0; iX < nXCheck; iX++)
+        {
+            const GPtrDiff_t iOffset =
+                iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
+
+            if (pabyMaskData && pabyMaskData[iOffset] == 0)
+                continue;
+
+            double dfValue = 0.0;
+
+            switch (eDataType)
+            {
+                case GDT_Byte:
+                {
+                    if (bSignedByte)
+                        dfValue =
+                            static_cast<const signed char *>(pData)[iOffset];
+                    else
+                        dfValue = static_cast<const GByte *>(pData)[iOffset];
+                    break;
+                }
+                case GDT_Int8:
+                    dfValue = static_cast<const GInt8 *>(pData)[iOffset];
+                    break;
+                case GDT_UInt16:
+                    dfValue = static_cast<const GUInt16 *>(pData)[iOffset];
+                    break;
+                case GDT_Int16:
+                    dfValue = static_cast<const GInt16 *>(pData)[iOffset];
+                    break;
+                case GDT_UInt32:
+                    dfValue = static_cast<const GUInt32 *>(pData)[iOffset];
+                    break;
+                case GDT_Int32:
+                    dfValue = static_cast<const GInt32 *>(pData)[iOffset];
+                    break;
+                case GDT_UInt64:
+                    dfValue = static_cast<double>(
+                        static_cast<const GUInt64 *>(pData)[iOffset]);
+                    break;
+                case GDT_Int64:
+                    dfValue = static_cast<double>(
+                        static_cast<const GInt64 *>(pData)[iOffset]);
+                    break;
+                case GDT_Float16:
+                {
+                    using namespace std;
+                    const GFloat16 hfValue =
+                        static_cast<const GFloat16 *>(pData)[iOffset];
+                    if (isnan(hfValue) ||
+                        (sNoDataValues.bGotFloat16NoDataValue &&
+                         ARE_REAL_EQUAL(hfValue, sNoDataValues.hfNoDataValue)))
+                        continue;
+                    dfValue = hfValue;
+                    break;
+                }
+                case GDT_Float32:
+                {
+                    const float fValue =
+                        static_cast<const float *>(pData)[iOffset];
+                    if (std::isnan(fValue) ||
+                        (sNoDataValues.bGotFloatNoDataValue &&
+                         ARE_REAL_EQUAL(fValue, sNoDataValues.fNoDataValue)))
+                        continue;
+                    dfValue = fValue;
+                    break;
+                }
+                case GDT_Float64:
+                    dfValue = static_cast<const double *>(pData)[iOffset];
+                    if (std::isnan(dfValue))
+                        continue;
+                    break;
+                case GDT_CInt16:
+                {
+                    double dfReal =
+                        static_cast<const GInt16 *>(pData)[iOffset * 2];
+                    double dfImag =
+                        static_cast<const GInt16 *>(pData)[iOffset * 2 + 1];
+                    dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
+                    break;
+                }
+                case GDT_CInt32:
+                {
+                    double dfReal =
+                        static_cast<const GInt32 *>(pData)[iOffset * 2];
+                    double dfImag =
+                        static_cast<const GInt32 *>(pData)[iOffset * 2 + 1];
+                    dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
+                    break;
+                }
+                case GDT_CFloat16:
+                {
+                    double dfReal =
+                        static_cast<const GFloat16 *>(pData)[iOffset * 2];
+                    double dfImag =
+                        static_cast<const GFloat16 *>(pData)[iOffset * 2 + 1];
+                    if (std::isnan(dfReal) || std::isnan(dfImag))
+                        continue;
+                    dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
+                    break;
+                }
+                case GDT_CFloat32:
+                {
+                    double dfReal =
+                        static_cast<const float *>(pData)[iOffset * 2];
+                    double dfImag =
+                        static_cast<const float *>(pData)[iOffset * 2 + 1];
+                    if (std::isnan(dfReal) || std::isnan(dfImag))
+                        continue;
+                    dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
+                    break;
+                }
+                case GDT_CFloat64:
+                {
+                    double dfReal =
+                        static_cast<const double *>(pData)[iOffset * 2];
+                    double dfImag =
+                        static_cast<const double *>(pData)[iOffset * 2 + 1];
+                    if (std::isnan(dfReal) || std::isnan(dfImag))
+                        continue;
+                    dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
+                    break;
+                }
+                case GDT_Unknown:
+                case GDT_TypeCount:
+                    CPLAssert(false);
+                    return false;
+            }
+
+            if (eDataType != GDT_Float16 && eDataType != GDT_Float32 &&
+                sNoDataValues.bGotNoDataValue &&
+                ARE_REAL_EQUAL(dfValue, sNoDataValues.dfNoDataValue))
+                continue;
+
+            // Given that dfValue and dfMin are not NaN, and dfScale > 0
+            // and finite, the result of the multiplication cannot be
+            // NaN
+            const double dfIndex = floor((dfValue - dfMin) * dfScale);
+
+            if (dfIndex < 0)
+            {
+                if (bIncludeOutOfRange)
+                    panHistogram[0]++;
+            }
+            else if (dfIndex >= nBuckets)
+            {
+                if (bIncludeOutOfRange)
+                    ++panHistogram[nBuckets - 1];
+            }
+            else
+            {
+                ++panHistogram[static_cast<int>(dfIndex)];
+            }
+        }
+    }
+
+    return true;
+}
+
 /************************************************************************/
 /*                            GetHistogram()                            */
 /************************************************************************/
@@ -4463,253 +4845,121 @@ CPLErr GDALRasterBand::GetHistogram(double dfMin, double dfMax, int nBuckets,
                 nSampleRate += 1;
         }
 
-        GByte *pabyMaskData = nullptr;
-        if (poMaskBand)
-        {
-            pabyMaskData = static_cast<GByte *>(
-                VSI_MALLOC2_VERBOSE(nBlockXSize, nBlockYSize));
-            if (!pabyMaskData)
-            {
-                return CE_Failure;
-            }
-        }
-
         /* --------------------------------------------------------------------
          */
         /*      Read the blocks, and add to histogram. */
         /* --------------------------------------------------------------------
          */
-        for (GIntBig iSampleBlock = 0;
-             iSampleBlock <
-             static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn;
-             iSampleBlock += nSampleRate)
-        {
-            if (!pfnProgress(
-                    static_cast<double>(iSampleBlock) /
-                        (static_cast<double>(nBlocksPerRow) * nBlocksPerColumn),
-                    "Compute Histogram", pProgressData))
+        const int nThreads = GDALGetStatisticsThreadCount();
+        if (nThreads > 1 &&
+            GDALGetSampledBlockBatchCount(this, nSampleRate) > 1)
+        {
+            // Histogram counts are integers, so merging per-batch histograms
+            // in any order gives the same result as the sequential code path.
+            std::mutex oMutex;
+            bool bOK = true;
+            const auto ProcessBatch =
+                [&](size_t, const std::vector<GDALSampledBlock> &aoBlocks)
             {
-                CPLFree(pabyMaskData);
-                return CE_Failure;
-            }
-
-            const int iYBlock = static_cast<int>(iSampleBlock / nBlocksPerRow);
-            const int iXBlock = static_cast<int>(iSampleBlock % nBlocksPerRow);
-
-            GDALRasterBlock *poBlock = GetLockedBlockRef(iXBlock, iYBlock);
-            if (poBlock == nullptr)
+                std::vector<GUIntBig> anBatchHistogram(nBuckets);
+                bool bBatchOK = true;
+                for (const auto &oBlock : aoBlocks)
+                {
+                    bBatchOK &= ComputeHistogramForBlock(
+                        oBlock.poBlock->GetDataRef(),
+                        oBlock.abyMask.empty() ? nullptr
+                                               : oBlock.abyMask.data(),
+                        oBlock.nXCheck, oBlock.nYCheck, nBlockXSize,
+                        nBlockYSize, eDataType, bSignedByte, sNoDataValues,
+                        dfMin, dfScale, nBuckets,
+                        CPL_TO_BOOL(bIncludeOutOfRange),
+                        anBatchHistogram.data());
+                }
+                std::lock_guard oLock(oMutex);
+                bOK &= bBatchOK;
+                for (int i = 0; i < nBuckets; ++i)
+                    panHistogram[i] += anBatchHistogram[i];
+            };
+            if (!GDALProcessSampledBlocksMultiThreaded(
+                    this, nSampleRate, poMaskBand, nThreads, ProcessBatch,
+                    "Compute Histogram", pfnProgress, pProgressData) ||
+                !bOK)
             {
-                CPLFree(pabyMaskData);
                 return CE_Failure;
             }
-
-            void *pData = poBlock->GetDataRef();
-
-            int nXCheck = 0, nYCheck = 0;
-            GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
-
-            if (poMaskBand &&
-                poMaskBand->RasterIO(GF_Read, iXBlock * nBlockXSize,
-                                     iYBlock * nBlockYSize, nXCheck, nYCheck,
-                                     pabyMaskData, nXCheck, nYCheck, GDT_Byte,
-                                     0, nBlockXSize, nullptr) != CE_None)
+        }
+        else
+        {
+            GByte *pabyMaskData = nullptr;
+            if (poMaskBand)
             {
-                CPLFree(pabyMaskData);
-                poBlock->DropLock();
-                return CE_Failure;
+                pabyMaskData = static_cast<GByte *>(
+                    VSI_MALLOC2_VERBOSE(nBlockXSize, nBlockYSize));
+                if (!pabyMaskData)
+                {
+                    return CE_Failure;
+                }
             }
 
-            // this is a special case for a common situation.
-            if (eDataType == GDT_Byte && !bSignedByte && dfScale == 1.0 &&
-                (dfMin >= -0.5 && dfMin <= 0.5) && nYCheck == nBlockYSize &&
-                nXCheck == nBlockXSize && nBuckets == 256)
+            for (GIntBig iSampleBlock = 0;
+                 iSampleBlock <
+                 static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn;
+                 iSampleBlock += nSampleRate)
             {
-                const GPtrDiff_t nPixels =
-                    static_cast<GPtrDiff_t>(nXCheck) * nYCheck;
-                GByte *pabyData = static_cast<GByte *>(pData);
-
-                for (GPtrDiff_t i = 0; i < nPixels; i++)
+                if (!pfnProgress(static_cast<double>(iSampleBlock) /
+                                     (static_cast<double>(nBlocksPerRow) *
+                                      nBlocksPerColumn),
+                                 "Compute Histogram", pProgressData))
                 {
-                    if (pabyMaskData && pabyMaskData[i] == 0)
-                        continue;
-                    if (!(sNoDataValues.bGotNoDataValue &&
-                          (pabyData[i] ==
-                           static_cast<GByte>(sNoDataValues.dfNoDataValue))))
-                    {
-                        panHistogram[pabyData[i]]++;
-                    }
+                    CPLFree(pabyMaskData);
+                    return CE_Failure;
                 }
 
-                poBlock->DropLock();
-                continue;  // To next sample block.
-            }
+                const int iYBlock =
+                    static_cast<int>(iSampleBlock / nBlocksPerRow);
+                const int iXBlock =
+                    static_cast<int>(iSampleBlock % nBlocksPerRow);
 
-            // This isn't the fastest way to do this, but is easier for now.
-            for (int iY = 0; iY < nYCheck; iY++)
-            {
-                for (int iX = 0; iX < nXCheck; iX++)
+                GDALRasterBlock *poBlock = GetLockedBlockRef(iXBlock, iYBlock);
+                if (poBlock == nullptr)
                 {
-                    const GPtrDiff_t iOffset =
-                        iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
-
-                    if (pabyMaskData && pabyMaskData[iOffset] == 0)
-                        continue;
+                    CPLFree(pabyMaskData);
+                    return CE_Failure;
+                }
 
-                    double dfValue = 0.0;
+                void *pData = poBlock->GetDataRef();
 
-                    switch (eDataType)
-                    {
-                        case GDT_Byte:
-                        {
-                            if (bSignedByte)
-                                dfValue =
-                                    static_cast<signed char *>(pData)[iOffset];
-                            else
-                                dfValue = static_cast<GByte *>(pData)[iOffset];
-                            break;
-                        }
-                        case GDT_Int8:
-                            dfValue = static_cast<GInt8 *>(pData)[iOffset];
-                            break;
-                        case GDT_UInt16:
-                            dfValue = static_cast<GUInt16 *>(pData)[iOffset];
-                            break;
-                        case GDT_Int16:
-                            dfValue = static_cast<GInt16 *>(pData)[iOffset];
-                            break;
-                        case GDT_UInt32:
-                            dfValue = static_cast<GUInt32 *>(pData)[iOffset];
-                            break;
-                        case GDT_Int32:
-                            dfValue = static_cast<GInt32 *>(pData)[iOffset];
-                            break;
-                        case GDT_UInt64:
-                            dfValue = static_cast<double>(
-                                static_cast<GUInt64 *>(pData)[iOffset]);
-                            break;
-                        case GDT_Int64:
-                            dfValue = static_cast<double>(
-                                static_cast<GInt64 *>(pData)[iOffset]);
-                            break;
-                        case GDT_Float16:
-                        {
-                            using namespace std;
-                            const GFloat16 hfValue =
-                                static_cast<GFloat16 *>(pData)[iOffset];
-                            if (isnan(hfValue) ||
-                                (sNoDataValues.bGotFloat16NoDataValue &&
-                                 ARE_REAL_EQUAL(hfValue,
-                                                sNoDataValues.hfNoDataValue)))
-                                continue;
-                            dfValue = hfValue;
-                            break;
-                        }
-                        case GDT_Float32:
-                        {
-                            const float fValue =
-                                static_cast<float *>(pData)[iOffset];
-                            if (std::isnan(fValue) ||
-                                (sNoDataValues.bGotFloatNoDataValue &&
-                                 ARE_REAL_EQUAL(fValue,
-                                                sNoDataValues.fNoDataValue)))
-                                continue;
-                            dfValue = fValue;
-                            break;
-                        }
-                        case GDT_Float64:
-                            dfValue = static_cast<double *>(pData)[iOffset];
-                            if (std::isnan(dfValue))
-                                continue;
-                            break;
-                        case GDT_CInt16:
-                        {
-                            double dfReal =
-                                static_cast<GInt16 *>(pData)[iOffset * 2];
-                            double dfImag =
-                                static_cast<GInt16 *>(pData)[iOffset * 2 + 1];
-                            dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
-                            break;
-                        }
-                        case GDT_CInt32:
-                        {
-                            double dfReal =
-                                static_cast<GInt32 *>(pData)[iOffset * 2];
-                            double dfImag =
-                                static_cast<GInt32 *>(pData)[iOffset * 2 + 1];
-                            dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
-                            break;
-                        }
-                        case GDT_CFloat16:
-                        {
-                            double dfReal =
-                                static_cast<GFloat16 *>(pData)[iOffset * 2];
-                            double dfImag =
-                                static_cast<GFloat16 *>(pData)[iOffset * 2 + 1];
-                            if (std::isnan(dfReal) || std::isnan(dfImag))
-                                continue;
-                            dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
-                            break;
-                        }
-                        case GDT_CFloat32:
-                        {
-                            double dfReal =
-                                static_cast<float *>(pData)[iOffset * 2];
-                            double dfImag =
-                                static_cast<float *>(pData)[iOffset * 2 + 1];
-                            if (std::isnan(dfReal) || std::isnan(dfImag))
-                                continue;
-                            dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
-                            break;
-                        }
-                        case GDT_CFloat64:
-                        {
-                            double dfReal =
-                                static_cast<double *>(pData)[iOffset * 2];
-                            double dfImag =
-                                static_cast<double *>(pData)[iOffset * 2 + 1];
-                            if (std::isnan(dfReal) || std::isnan(dfImag))
-                                continue;
-                            dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
-                            break;
-                        }
-                        case GDT_Unknown:
-                        case GDT_TypeCount:
-                            CPLAssert(false);
-                            CPLFree(pabyMaskData);
-                            return CE_Failure;
-                    }
+                int nXCheck = 0, nYCheck = 0;
+                GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
 
-                    if (eDataType != GDT_Float16 && eDataType != GDT_Float32 &&
-                        sNoDataValues.bGotNoDataValue &&
-                        ARE_REAL_EQUAL(dfValue, sNoDataValues.dfNoDataValue))
-                        continue;
+                if (poMaskBand &&
+                    poMaskBand->RasterIO(GF_Read, iXBlock * nBlockXSize,
+                                         iYBlock * nBlockYSize, nXCheck,
+                                         nYCheck, pabyMaskData, nXCheck,
+                                         nYCheck, GDT_Byte, 0, nBlockXSize,
+                                         nullptr) != CE_None)
+                {
+                    CPLFree(pabyMaskData);
+                    poBlock->DropLock();
+                    return CE_Failure;
+                }
 
-                    // Given that dfValue and dfMin are not NaN, and dfScale > 0
-                    // and finite, the result of the multiplication cannot be
-                    // NaN
-                    const double dfIndex = floor((dfValue - dfMin) * dfScale);
+                const bool bOK = ComputeHistogramForBlock(
+                    pData, pabyMaskData, nXCheck, nYCheck, nBlockXSize,
+                    nBlockYSize, eDataType, bSignedByte, sNoDataValues, dfMin,
+                    dfScale, nBuckets, CPL_TO_BOOL(bIncludeOutOfRange),
+                    panHistogram);
 
-                    if (dfIndex < 0)
-                    {
-                        if (bIncludeOutOfRange)
-                            panHistogram[0]++;
-                    }
-                    else if (dfIndex >= nBuckets)
-                    {
-                        if (bIncludeOutOfRange)
-                            ++panHistogram[nBuckets - 1];
-                    }
-                    else
-                    {
-                        ++panHistogram[static_cast<int>(dfIndex)];
-                    }
+                poBlock->DropLock();
+                if (!bOK)
+                {
+                    CPLFree(pabyMaskData);
+                    return CE_Failure;
                 }
             }
 
-            poBlock->DropLock();
+            CPLFree(pabyMaskData);
         }
-
-        CPLFree(pabyMaskData);
     }
 
     pfnProgress(1.0, "Compute Histogram", pProgressData);
@@ -6386,6 +6636,107 @@ static inline double GetPixelValue(GDALDataType eDataType, bool bSignedByte,
     return dfValue;
 }
 
+/************************************************************************/
+/*                          GDALWelfordStats                            */
+/************************************************************************/
+
+namespace
+{
+/** Running minimum, maximum, mean and sum of squares of differences to the
+ * mean, updated with the Welford algorithm */
+struct GDALWelfordStats
+{
+    double dfMin = std::numeric_limits<double>::infinity();
+    double dfMax = -std::numeric_limits<double>::infinity();
+    double dfMean = 0.0;
+    double dfM2 = 0.0;
+    GUIntBig nSampleCount = 0;
+    GUIntBig nValidCount = 0;
+
+    inline void Add(double dfValue)
+    {
+        dfMin = std::min(dfMin, dfValue);
+        dfMax = std::max(dfMax, dfValue);
+
+        nValidCount++;
+        if (dfMin == dfMax)
+        {
+            if (nValidCount == 1)
+                dfMean = dfMin;
+        }
+        else
+        {
+            const double dfDelta = dfValue - dfMean;
+            dfMean += dfDelta / nValidCount;
+            dfM2 += dfDelta * (dfValue - dfMean);
+        }
+    }
+
+    // Combine with statistics computed on another set of samples, using
+    // the pairwise formula of Chan et al.
+    void Merge(const GDALWelfordStats &other)
+    {
+        nSampleCount += other.nSampleCount;
+        if (other.nValidCount == 0)
+            return;
+        if (nValidCount == 0)
+        {
+            dfMin = other.dfMin;
+            dfMax = other.dfMax;
+            dfMean = other.dfMean;
+            dfM2 = other.dfM2;
+            nValidCount = other.nValidCount;
+            return;
+        }
+
+        dfMin = std::min(dfMin, other.dfMin);
+        dfMax = std::max(dfMax, other.dfMax);
+
+        const double dfCount = static_cast<double>(nValidCount);
+        const double dfOtherCount = static_cast<double>(other.nValidCount);
+        const double dfNewCount = dfCount + dfOtherCount;
+        const double dfDelta = other.dfMean - dfMean;
+        dfMean += dfDelta * (dfOtherCount / dfNewCount);
+        dfM2 += other.dfM2 +
+                dfDelta * dfDelta * (dfCount * dfOtherCount / dfNewCount);
+        nValidCount += other.nValidCount;
+    }
+};
+}  // namespace
+
+/************************************************************************/
+/*                   ComputeStatisticsGenericForBlock()                 */
+/************************************************************************/
+
+static void ComputeStatisticsGenericForBlock(
+    const void *pData, const GByte *pabyMaskData, int nXCheck, int nYCheck,
+    int nBlockXSize, GDALDataType eDataType, bool bSignedByte,
+    const GDALNoDataValues &sNoDataValues, GDALWelfordStats &sStats)
+{
+    // This isn't the fastest way to do this, but is easier for now.
+    for (int iY = 0; iY < nYCheck; iY++)
+    {
+        for (int iX = 0; iX < nXCheck; iX++)
+        {
+            const GPtrDiff_t iOffset =
+                iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
+            if (pabyMaskData && pabyMaskData[iOffset] == 0)
+                continue;
+
+            bool bValid = true;
+            const double dfValue = GetPixelValue(
+                eDataType, bSignedByte, pData, iOffset, sNoDataValues, bValid);
+
+            if (!bValid)
+                continue;
+
+            sStats.Add(dfValue);
+        }
+    }
+
+    sStats.nSampleCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
+}
+
 /************************************************************************/
 /*                         SetValidPercent()                            */
 /************************************************************************/
@@ -6453,6 +6804,13 @@ void GDALRasterBand::SetValidPercent(GUIntBig nSampleCount,
  *
  * Cached statistics can be cleared with GDALDataset::ClearStatistics().
  *
+ * Starting with GDAL 3.12, the GDAL_NUM_THREADS configuration option can be
+ * set to ALL_CPUS or a number of threads, so that the computation on blocks
+ * is spread over worker threads. Blocks are still read from the calling
+ * thread. For data types other than Byte and UInt16, the mean and standard
+ * deviation may then differ from the single-threaded ones in the last bits,
+ * unless the GDAL_STATISTICS_FIXED_ORDER configuration option is set to YES.
+ *
  * This method is the same as the C function GDALComputeRasterStatistics().
  *
  * @param bApproxOK If TRUE statistics may be computed based on overviews
@@ -6726,55 +7084,118 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                     ? static_cast<GUInt32>(sNoDataValues.dfNoDataValue + 1e-10)
                     : nMaxValueType + 1;
 
-            for (GIntBig iSampleBlock = 0;
-                 iSampleBlock <
-                 static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn;
-                 iSampleBlock += nSampleRate)
+            const int nThreads = GDALGetStatisticsThreadCount();
+            if (nThreads > 1 &&
+                GDALGetSampledBlockBatchCount(this, nSampleRate) > 1)
             {
-                const int iYBlock =
-                    static_cast<int>(iSampleBlock / nBlocksPerRow);
-                const int iXBlock =
-                    static_cast<int>(iSampleBlock % nBlocksPerRow);
+                // All accumulators are integers, so merging them in any
+                // order gives the same result as the sequential code path.
+                std::mutex oMutex;
+                const auto ProcessBatch =
+                    [&](size_t, const std::vector<GDALSampledBlock> &aoBlocks)
+                {
+                    GUInt32 nBatchMin = nMaxValueType;
+                    GUInt32 nBatchMax = 0;
+                    GUIntBig nBatchSum = 0;
+                    GUIntBig nBatchSumSquare = 0;
+                    GUIntBig nBatchSampleCount = 0;
+                    GUIntBig nBatchValidCount = 0;
+                    for (const auto &oBlock : aoBlocks)
+                    {
+                        const void *pData = oBlock.poBlock->GetDataRef();
+                        if (eDataType == GDT_Byte)
+                        {
+                            ComputeStatisticsInternal<
+                                GByte, /* COMPUTE_OTHER_STATS = */ true>::
+                                f(oBlock.nXCheck, nBlockXSize, oBlock.nYCheck,
+                                  static_cast<const GByte *>(pData),
+                                  nNoDataValue <= nMaxValueType, nNoDataValue,
+                                  nBatchMin, nBatchMax, nBatchSum,
+                                  nBatchSumSquare, nBatchSampleCount,
+                                  nBatchValidCount);
+                        }
+                        else
+                        {
+                            ComputeStatisticsInternal<
+                                GUInt16, /* COMPUTE_OTHER_STATS = */ true>::
+                                f(oBlock.nXCheck, nBlockXSize, oBlock.nYCheck,
+                                  static_cast<const GUInt16 *>(pData),
+                                  nNoDataValue <= nMaxValueType, nNoDataValue,
+                                  nBatchMin, nBatchMax, nBatchSum,
+                                  nBatchSumSquare, nBatchSampleCount,
+                                  nBatchValidCount);
+                        }
+                    }
 
-                GDALRasterBlock *const poBlock =
-                    GetLockedBlockRef(iXBlock, iYBlock);
-                if (poBlock == nullptr)
+                    std::lock_guard oLock(oMutex);
+                    nMin = std::min(nMin, nBatchMin);
+                    nMax = std::max(nMax, nBatchMax);
+                    nSum += nBatchSum;
+                    nSumSquare += nBatchSumSquare;
+                    nSampleCount += nBatchSampleCount;
+                    nValidCount += nBatchValidCount;
+                };
+                if (!GDALProcessSampledBlocksMultiThreaded(
+                        this, nSampleRate, nullptr, nThreads, ProcessBatch,
+                        "Compute Statistics", pfnProgress, pProgressData))
+                {
                     return CE_Failure;
+                }
+            }
+            else
+            {
+                for (GIntBig iSampleBlock = 0;
+                     iSampleBlock <
+                     static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn;
+                     iSampleBlock += nSampleRate)
+                {
+                    const int iYBlock =
+                        static_cast<int>(iSampleBlock / nBlocksPerRow);
+                    const int iXBlock =
+                        static_cast<int>(iSampleBlock % nBlocksPerRow);
 
-                void *const pData = poBlock->GetDataRef();
+                    GDALRasterBlock *const poBlock =
+                        GetLockedBlockRef(iXBlock, iYBlock);
+                    if (poBlock == nullptr)
+                        return CE_Failure;
 
-                int nXCheck = 0, nYCheck = 0;
-                GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
+                    void *const pData = poBlock->GetDataRef();
 
-                if (eDataType == GDT_Byte)
-                {
-                    ComputeStatisticsInternal<
-                        GByte, /* COMPUTE_OTHER_STATS = */ true>::
-                        f(nXCheck, nBlockXSize, nYCheck,
-                          static_cast<const GByte *>(pData),
-                          nNoDataValue <= nMaxValueType, nNoDataValue, nMin,
-                          nMax, nSum, nSumSquare, nSampleCount, nValidCount);
-                }
-                else
-                {
-                    ComputeStatisticsInternal<
-                        GUInt16, /* COMPUTE_OTHER_STATS = */ true>::
-                        f(nXCheck, nBlockXSize, nYCheck,
-                          static_cast<const GUInt16 *>(pData),
-                          nNoDataValue <= nMaxValueType, nNoDataValue, nMin,
-                          nMax, nSum, nSumSquare, nSampleCount, nValidCount);
-                }
+                    int nXCheck = 0, nYCheck = 0;
+                    GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
 
-                poBlock->DropLock();
+                    if (eDataType == GDT_Byte)
+                    {
+                        ComputeStatisticsInternal<
+                            GByte, /* COMPUTE_OTHER_STATS = */ true>::
+                            f(nXCheck, nBlockXSize, nYCheck,
+                              static_cast<const GByte *>(pData),
+                              nNoDataValue <= nMaxValueType, nNoDataValue,
+                              nMin, nMax, nSum, nSumSquare, nSampleCount,
+                              nValidCount);
+                    }
+                    else
+                    {
+                        ComputeStatisticsInternal<
+                            GUInt16, /* COMPUTE_OTHER_STATS = */ true>::
+                            f(nXCheck, nBlockXSize, nYCheck,
+                              static_cast<const GUInt16 *>(pData),
+                              nNoDataValue <= nMaxValueType, nNoDataValue,
+                              nMin, nMax, nSum, nSumSquare, nSampleCount,
+                              nValidCount);
+                    }
 
-                if (!pfnProgress(static_cast<double>(iSampleBlock) /
-                                     (static_cast<double>(nBlocksPerRow) *
-                                      nBlocksPerColumn),
-                                 "Compute Statistics", pProgressData))
-                {
-                    ReportError(CE_Failure, CPLE_UserInterrupt,
-                                "User terminated");
-                    return CE_Failure;
+                    poBlock->DropLock();
+
+                    if (!pfnProgress(static_cast<double>(iSampleBlock) /
+                                         (static_cast<double>(nBlocksPerRow) *
+                                          nBlocksPerColumn),
+                                     "Compute Statistics", pProgressData))
+                    {
+                        ReportError(CE_Failure, CPLE_UserInterrupt,
+                                    "User terminated");
+                        return CE_Failure;
+                    }
                 }
             }
 
@@ -6843,101 +7264,118 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
             return CE_Failure;
         }
 
-        GByte *pabyMaskData = nullptr;
-        if (poMaskBand)
-        {
-            pabyMaskData = static_cast<GByte *>(
-                VSI_MALLOC2_VERBOSE(nBlockXSize, nBlockYSize));
-            if (!pabyMaskData)
+        GDALWelfordStats sStats;
+        const int nThreads = GDALGetStatisticsThreadCount();
+        const size_t nBatchCount =
+            GDALGetSampledBlockBatchCount(this, nSampleRate);
+        // With GDAL_STATISTICS_FIXED_ORDER=YES, the single-threaded
+        // computation also goes through batches, so that its result is
+        // bit-identical to the multi-threaded one.
+        if (nBatchCount > 1 &&
+            (nThreads > 1 || CPLTestBool(CPLGetConfigOption(
+                                 "GDAL_STATISTICS_FIXED_ORDER", "NO"))))
+        {
+            // Statistics of each batch are merged in batch order, so that
+            // the result does not depend on the number of threads.
+            std::vector<GDALWelfordStats> asBatchStats(nBatchCount);
+            const auto ProcessBatch =
+                [&](size_t iBatch,
+                    const std::vector<GDALSampledBlock> &aoBlocks)
+            {
+                for (const auto &oBlock : aoBlocks)
+                {
+                    ComputeStatisticsGenericForBlock(
+                        oBlock.poBlock->GetDataRef(),
+                        oBlock.abyMask.empty() ? nullptr
+                                               : oBlock.abyMask.data(),
+                        oBlock.nXCheck, oBlock.nYCheck, nBlockXSize, eDataType,
+                        bSignedByte, sNoDataValues, asBatchStats[iBatch]);
+                }
+            };
+            if (!GDALProcessSampledBlocksMultiThreaded(
+                    this, nSampleRate, poMaskBand, nThreads, ProcessBatch,
+                    "Compute Statistics", pfnProgress, pProgressData))
             {
                 return CE_Failure;
             }
+            for (const auto &sBatchStats : asBatchStats)
+                sStats.Merge(sBatchStats);
         }
-
-        for (GIntBig iSampleBlock = 0;
-             iSampleBlock <
-             static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn;
-             iSampleBlock += nSampleRate)
+        else
         {
-            const int iYBlock = static_cast<int>(iSampleBlock / nBlocksPerRow);
-            const int iXBlock = static_cast<int>(iSampleBlock % nBlocksPerRow);
-
-            GDALRasterBlock *const poBlock =
-                GetLockedBlockRef(iXBlock, iYBlock);
-            if (poBlock == nullptr)
+            GByte *pabyMaskData = nullptr;
+            if (poMaskBand)
             {
-                CPLFree(pabyMaskData);
-                return CE_Failure;
+                pabyMaskData = static_cast<GByte *>(
+                    VSI_MALLOC2_VERBOSE(nBlockXSize, nBlockYSize));
+                if (!pabyMaskData)
+                {
+                    return CE_Failure;
+                }
             }
 
-            void *const pData = poBlock->GetDataRef();
-
-            int nXCheck = 0, nYCheck = 0;
-            GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
-
-            if (poMaskBand &&
-                poMaskBand->RasterIO(GF_Read, iXBlock * nBlockXSize,
-                                     iYBlock * nBlockYSize, nXCheck, nYCheck,
-                                     pabyMaskData, nXCheck, nYCheck, GDT_Byte,
-                                     0, nBlockXSize, nullptr) != CE_None)
+            for (GIntBig iSampleBlock = 0;
+                 iSampleBlock <
+                 static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn;
+                 iSampleBlock += nSampleRate)
             {
-                CPLFree(pabyMaskData);
-                poBlock->DropLock();
-                return CE_Failure;
-            }
+                const int iYBlock =
+                    static_cast<int>(iSampleBlock / nBlocksPerRow);
+                const int iXBlock =
+                    static_cast<int>(iSampleBlock % nBlocksPerRow);
 
-            // This isn't the fastest way to do this, but is easier for now.
-            for (int iY = 0; iY < nYCheck; iY++)
-            {
-                for (int iX = 0; iX < nXCheck; iX++)
+                GDALRasterBlock *const poBlock =
+                    GetLockedBlockRef(iXBlock, iYBlock);
+                if (poBlock == nullptr)
                 {
-                    const GPtrDiff_t iOffset =
-                        iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
-                    if (pabyMaskData && pabyMaskData[iOffset] == 0)
-                        continue;
-
-                    bool bValid = true;
-                    double dfValue =
-                        GetPixelValue(eDataType, bSignedByte, pData, iOffset,
-                                      sNoDataValues, bValid);
+                    CPLFree(pabyMaskData);
+                    return CE_Failure;
+                }
 
-                    if (!bValid)
-                        continue;
+                void *const pData = poBlock->GetDataRef();
 
-                    dfMin = std::min(dfMin, dfValue);
-                    dfMax = std::max(dfMax, dfValue);
+                int nXCheck = 0, nYCheck = 0;
+                GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
 
-                    nValidCount++;
-                    if (dfMin == dfMax)
-                    {
-                        if (nValidCount == 1)
-                            dfMean = dfMin;
-                    }
-                    else
-                    {
-                        const double dfDelta = dfValue - dfMean;
-                        dfMean += dfDelta / nValidCount;
-                        dfM2 += dfDelta * (dfValue - dfMean);
-                    }
+                if (poMaskBand &&
+                    poMaskBand->RasterIO(GF_Read, iXBlock * nBlockXSize,
+                                         iYBlock * nBlockYSize, nXCheck,
+                                         nYCheck, pabyMaskData, nXCheck,
+                                         nYCheck, GDT_Byte, 0, nBlockXSize,
+                                         nullptr) != CE_None)
+                {
+                    CPLFree(pabyMaskData);
+                    poBlock->DropLock();
+                    return CE_Failure;
                 }
-            }
 
-            nSampleCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
+                ComputeStatisticsGenericForBlock(
+                    pData, pabyMaskData, nXCheck, nYCheck, nBlockXSize,
+                    eDataType, bSignedByte, sNoDataValues, sStats);
 
-            poBlock->DropLock();
+                poBlock->DropLock();
 
-            if (!pfnProgress(
-                    static_cast<double>(iSampleBlock) /
-                        (static_cast<double>(nBlocksPerRow) * nBlocksPerColumn),
-                    "Compute Statistics", pProgressData))
-            {
-                ReportError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                CPLFree(pabyMaskData);
-                return CE_Failure;
+                if (!pfnProgress(static_cast<double>(iSampleBlock) /
+                                     (static_cast<double>(nBlocksPerRow) *
+                                      nBlocksPerColumn),
+                                 "Compute Statistics", pProgressData))
+                {
+                    ReportError(CE_Failure, CPLE_UserInterrupt,
+                                "User terminated");
+                    CPLFree(pabyMaskData);
+                    return CE_Failure;
+                }
             }
+
+            CPLFree(pabyMaskData);
         }
 
-        CPLFree(pabyMaskData);
+        dfMin = sStats.dfMin;
+        dfMax = sStats.dfMax;
+        dfMean = sStats.dfMean;
+        dfM2 = sStats.dfM2;
+        nSampleCount = sStats.nSampleCount;
+        nValidCount = sStats.nValidCount;
     }
 
     if (!pfnProgress(1.0, "Compute Statistics", pProgressData))
@@ -7280,6 +7718,33 @@ static bool ComputeMinMaxGenericIterBlocks(
     int nBlockXSize, nBlockYSize;
     poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
 
+    const int nThreads = GDALGetStatisticsThreadCount();
+    if (nThreads > 1 && GDALGetSampledBlockBatchCount(poBand, nSampleRate) > 1)
+    {
+        std::mutex oMutex;
+        const auto ProcessBatch =
+            [&](size_t, const std::vector<GDALSampledBlock> &aoBlocks)
+        {
+            double dfBatchMin = std::numeric_limits<double>::infinity();
+            double dfBatchMax = -std::numeric_limits<double>::infinity();
+            for (const auto &oBlock : aoBlocks)
+            {
+                ComputeMinMaxGeneric(
+                    oBlock.poBlock->GetDataRef(), eDataType, bSignedByte,
+                    oBlock.nXCheck, oBlock.nYCheck, nBlockXSize, sNoDataValues,
+                    oBlock.abyMask.empty() ? nullptr : oBlock.abyMask.data(),
+                    dfBatchMin, dfBatchMax);
+            }
+
+            std::lock_guard oLock(oMutex);
+            dfMin = std::min(dfMin, dfBatchMin);
+            dfMax = std::max(dfMax, dfBatchMax);
+        };
+        return GDALProcessSampledBlocksMultiThreaded(
+            poBand, nSampleRate, poMaskBand, nThreads, ProcessBatch, nullptr,
+            GDALDummyProgress, nullptr);
+    }
+
     if (poMaskBand)
     {
         pabyMaskData =
@@ -7431,9 +7896,10 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
                         eDataType == GDT_Int16 || eDataType == GDT_UInt16);
 
     const auto ComputeMinMaxForBlock =
-        [this, bSignedByte, &sNoDataValues, &nMin, &nMax, &nMinInt16,
-         &nMaxInt16](const void *pData, int nXCheck, int nBufferWidth,
-                     int nYCheck)
+        [this, bSignedByte,
+         &sNoDataValues](const void *pData, int nXCheck, int nBufferWidth,
+                         int nYCheck, GUInt32 &nMinOut, GUInt32 &nMaxOut,
+                         GInt16 &nMinInt16Out, GInt16 &nMaxInt16Out)
     {
         if (eDataType == GDT_Byte && !bSignedByte)
         {
@@ -7450,7 +7916,8 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
                                       /* COMPUTE_OTHER_STATS = */ false>::
                 f(nXCheck, nBufferWidth, nYCheck,
                   static_cast<const GByte *>(pData), bHasNoData, nNoDataValue,
-                  nMin, nMax, nSum, nSumSquare, nSampleCount, nValidCount);
+                  nMinOut, nMaxOut, nSum, nSumSquare, nSampleCount,
+                  nValidCount);
         }
         else if (eDataType == GDT_UInt16)
         {
@@ -7467,7 +7934,8 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
                                       /* COMPUTE_OTHER_STATS = */ false>::
                 f(nXCheck, nBufferWidth, nYCheck,
                   static_cast<const GUInt16 *>(pData), bHasNoData, nNoDataValue,
-                  nMin, nMax, nSum, nSumSquare, nSampleCount, nValidCount);
+                  nMinOut, nMaxOut, nSum, nSumSquare, nSampleCount,
+                  nValidCount);
         }
         else if (eDataType == GDT_Int16)
         {
@@ -7485,7 +7953,7 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
                     ComputeMinMax<int16_t, true>(
                         static_cast<const int16_t *>(pData) +
                             static_cast<size_t>(iY) * nBufferWidth,
-                        nXCheck, nNoDataValue, &nMinInt16, &nMaxInt16);
+                        nXCheck, nNoDataValue, &nMinInt16Out, &nMaxInt16Out);
                 }
             }
             else
@@ -7495,7 +7963,7 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
                     ComputeMinMax<int16_t, false>(
                         static_cast<const int16_t *>(pData) +
                             static_cast<size_t>(iY) * nBufferWidth,
-                        nXCheck, 0, &nMinInt16, &nMaxInt16);
+                        nXCheck, 0, &nMinInt16Out, &nMaxInt16Out);
                 }
             }
         }
@@ -7561,7 +8029,8 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
 
         if (bUseOptimizedPath)
         {
-            ComputeMinMaxForBlock(pData, nXReduced, nXReduced, nYReduced);
+            ComputeMinMaxForBlock(pData, nXReduced, nXReduced, nYReduced, nMin,
+                                  nMax, nMinInt16, nMaxInt16);
         }
         else
         {
@@ -7601,32 +8070,71 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
 
         if (bUseOptimizedPath)
         {
-            for (GIntBig iSampleBlock = 0;
-                 iSampleBlock <
-                 static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn;
-                 iSampleBlock += nSampleRate)
+            const int nThreads = GDALGetStatisticsThreadCount();
+            if (nThreads > 1 &&
+                GDALGetSampledBlockBatchCount(this, nSampleRate) > 1)
             {
-                const int iYBlock =
-                    static_cast<int>(iSampleBlock / nBlocksPerRow);
-                const int iXBlock =
-                    static_cast<int>(iSampleBlock % nBlocksPerRow);
+                std::mutex oMutex;
+                const auto ProcessBatch =
+                    [&](size_t, const std::vector<GDALSampledBlock> &aoBlocks)
+                {
+                    GUInt32 nBatchMin = (eDataType == GDT_Byte) ? 255 : 65535;
+                    GUInt32 nBatchMax = 0;
+                    GInt16 nBatchMinInt16 = std::numeric_limits<GInt16>::max();
+                    GInt16 nBatchMaxInt16 =
+                        std::numeric_limits<GInt16>::lowest();
+                    for (const auto &oBlock : aoBlocks)
+                    {
+                        ComputeMinMaxForBlock(
+                            oBlock.poBlock->GetDataRef(), oBlock.nXCheck,
+                            nBlockXSize, oBlock.nYCheck, nBatchMin, nBatchMax,
+                            nBatchMinInt16, nBatchMaxInt16);
+                    }
 
-                GDALRasterBlock *poBlock = GetLockedBlockRef(iXBlock, iYBlock);
-                if (poBlock == nullptr)
+                    std::lock_guard oLock(oMutex);
+                    nMin = std::min(nMin, nBatchMin);
+                    nMax = std::max(nMax, nBatchMax);
+                    nMinInt16 = std::min(nMinInt16, nBatchMinInt16);
+                    nMaxInt16 = std::max(nMaxInt16, nBatchMaxInt16);
+                };
+                if (!GDALProcessSampledBlocksMultiThreaded(
+                        this, nSampleRate, nullptr, nThreads, ProcessBatch,
+                        nullptr, GDALDummyProgress, nullptr))
+                {
                     return CE_Failure;
+                }
+            }
+            else
+            {
+                for (GIntBig iSampleBlock = 0;
+                     iSampleBlock <
+                     static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn;
+                     iSampleBlock += nSampleRate)
+                {
+                    const int iYBlock =
+                        static_cast<int>(iSampleBlock / nBlocksPerRow);
+                    const int iXBlock =
+                        static_cast<int>(iSampleBlock % nBlocksPerRow);
 
-                void *const pData = poBlock->GetDataRef();
+                    GDALRasterBlock *poBlock =
+                        GetLockedBlockRef(iXBlock, iYBlock);
+                    if (poBlock == nullptr)
+                        return CE_Failure;
 
-                int nXCheck = 0, nYCheck = 0;
-                GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
+                    void *const pData = poBlock->GetDataRef();
 
-                ComputeMinMaxForBlock(pData, nXCheck, nBlockXSize, nYCheck);
+                    int nXCheck = 0, nYCheck = 0;
+                    GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
 
-                poBlock->DropLock();
+                    ComputeMinMaxForBlock(pData, nXCheck, nBlockXSize, nYCheck,
+                                          nMin, nMax, nMinInt16, nMaxInt16);
 
-                if (eDataType == GDT_Byte && !bSignedByte && nMin == 0 &&
-                    nMax == 255)
-                    break;
+                    poBlock->DropLock();
+
+                    if (eDataType == GDT_Byte && !bSignedByte && nMin == 0 &&
+                        nMax == 255)
+                        break;
+                }
             }
         }
         else
@@ -17,7 +17,10 @@
 #include "gdal_priv.h"
 
 #include <algorithm>
+#include <atomic>
 #include <climits>
+#include <cstdint>
+#include <cstdlib>
 #include <cstring>
 #include <mutex>
 
@@ -30,24 +33,38 @@
 
 // Will later be overridden by the default 5% if GDAL_CACHEMAX not defined.
 static GIntBig nCacheMax = 40 * 1024 * 1024;
-static GIntBig nCacheUsed = 0;
-
-static GDALRasterBlock *poOldest = nullptr;  // Tail.
-static GDALRasterBlock *poNewest = nullptr;  // Head.
+static std::atomic<GIntBig> nCacheUsed{0};
 
 static int nDisableDirtyBlockFlushCounter = 0;
 
-#if 0
-static CPLMutex *hRBLock = nullptr;
-#define INITIALIZE_LOCK CPLMutexHolderD(&hRBLock)
-#define TAKE_LOCK CPLMutexHolderOptionalLockD(hRBLock)
-#define DESTROY_LOCK CPLDestroyMutex(hRBLock)
-#else
-
-static CPLLock *hRBLock = nullptr;
 static bool bDebugContention = false;
 static bool bSleepsForBockCacheDebug = false;
 
+/************************************************************************/
+/*                     GDALRasterBlockCacheShard                        */
+/************************************************************************/
+
+// The LRU list of cached blocks is split into a power-of-two number of
+// shards (see GDAL_BLOCK_CACHE_SHARDS), each with its own lock, so that
+// threads working on different blocks do not serialize on a single lock.
+// The total amount of cached memory (nCacheUsed) is tracked globally.
+// By default, there is a single shard, which gives a strict global LRU order.
+
+namespace
+{
+struct alignas(64) GDALRasterBlockCacheShard
+{
+    CPLLock *hLock = nullptr;
+    GDALRasterBlock *poOldest = nullptr;  // Tail.
+    GDALRasterBlock *poNewest = nullptr;  // Head.
+};
+}  // namespace
+
+constexpr int MAX_BLOCK_CACHE_SHARDS = 64;
+static GDALRasterBlockCacheShard asShards[MAX_BLOCK_CACHE_SHARDS];
+static int nShardCount = 1;
+static int nNextFlushShard = 0;
+
 static CPLLockType GetLockType()
 {
     static int nLockType = -1;
@@ -75,13 +92,84 @@ static CPLLockType GetLockType()
     return static_cast<CPLLockType>(nLockType);
 }
 
-#define INITIALIZE_LOCK                                                        \
-    CPLLockHolderD(&hRBLock, GetLockType());                                   \
-    CPLLockSetDebugPerf(hRBLock, bDebugContention)
-#define TAKE_LOCK CPLLockHolderOptionalLockD(hRBLock)
-#define DESTROY_LOCK CPLDestroyLock(hRBLock)
+#define INITIALIZE_LOCK(oShard)                                                \
+    CPLLockHolderD(&((oShard).hLock), GetLockType());                          \
+    CPLLockSetDebugPerf((oShard).hLock, bDebugContention)
+#define TAKE_LOCK(oShard) CPLLockHolderOptionalLockD((oShard).hLock)
+#define DESTROY_LOCK(oShard) CPLDestroyLock((oShard).hLock)
 
-#endif
+/************************************************************************/
+/*                        GetShardCountFromConfig()                     */
+/************************************************************************/
+
+static int GetShardCountFromConfig()
+{
+    const char *pszShards = CPLGetConfigOption("GDAL_BLOCK_CACHE_SHARDS", "1");
+    int nRequested;
+    if (EQUAL(pszShards, "AUTO") || EQUAL(pszShards, "ALL_CPUS"))
+    {
+        nRequested = CPLGetNumCPUs();
+    }
+    else
+    {
+        nRequested = atoi(pszShards);
+        if (nRequested <= 0)
+        {
+            CPLError(CE_Warning, CPLE_NotSupported,
+                     "Invalid value for GDAL_BLOCK_CACHE_SHARDS: %s. "
+                     "Using a single shard.",
+                     pszShards);
+            nRequested = 1;
+        }
+    }
+
+    // Round up to the next power of two, so that we can use masking
+    int nShards = 1;
+    while (nShards < nRequested && nShards < MAX_BLOCK_CACHE_SHARDS)
+        nShards *= 2;
+    return nShards;
+}
+
+/************************************************************************/
+/*                        InitializeShardLocks()                        */
+/************************************************************************/
+
+static void InitializeShardLocks()
+{
+    for (int i = 0; i < nShardCount; ++i)
+    {
+        INITIALIZE_LOCK(asShards[i]);
+    }
+}
+
+/************************************************************************/
+/*                            GetShardIndex()                           */
+/************************************************************************/
+
+static inline int GetShardIndex(GDALRasterBlock *poBlock)
+{
+    if (nShardCount == 1)
+        return 0;
+
+    // The band and block coordinates of a block do not change while it is
+    // in the LRU list, so this is stable over the lifetime of the list entry.
+    GUIntBig nHash =
+        static_cast<GUIntBig>(reinterpret_cast<uintptr_t>(poBlock->GetBand()));
+    nHash ^= nHash >> 17;
+    nHash += static_cast<GUIntBig>(static_cast<unsigned>(poBlock->GetXOff())) *
+             0x9E3779B97F4A7C15ULL;
+    nHash ^= static_cast<GUIntBig>(static_cast<unsigned>(poBlock->GetYOff())) *
+             0xC2B2AE3D27D4EB4FULL;
+    nHash ^= nHash >> 29;
+    nHash *= 0xBF58476D1CE4E5B9ULL;
+    nHash ^= nHash >> 32;
+    return static_cast<int>(nHash & static_cast<unsigned>(nShardCount - 1));
+}
+
+static inline GDALRasterBlockCacheShard &GetShard(GDALRasterBlock *poBlock)
+{
+    return asShards[GetShardIndex(poBlock)];
+}
 
 // #define ENABLE_DEBUG
 
@@ -221,9 +309,10 @@ GIntBig CPL_STDCALL GDALGetCacheMax64()
         flagSetupGDALGetCacheMax64,
         []()
         {
-            {
-                INITIALIZE_LOCK;
-            }
+            nShardCount = GetShardCountFromConfig();
+            if (nShardCount > 1)
+                CPLDebug("GDAL", "GDAL_BLOCK_CACHE_SHARDS = %d", nShardCount);
+            InitializeShardLocks();
             bSleepsForBockCacheDebug =
                 CPLTestBool(CPLGetConfigOption("GDAL_DEBUG_BLOCK_CACHE", "NO"));
 
@@ -272,14 +361,15 @@ GIntBig CPL_STDCALL GDALGetCacheMax64()
 
 int CPL_STDCALL GDALGetCacheUsed()
 {
-    if (nCacheUsed > INT_MAX)
+    const GIntBig nUsed = nCacheUsed;
+    if (nUsed > INT_MAX)
     {
         CPLErrorOnce(CE_Warning, CPLE_AppDefined,
                      "Cache used value doesn't fit on a 32 bit integer. "
                      "Call GDALGetCacheUsed64() instead");
         return INT_MAX;
     }
-    return static_cast<int>(nCacheUsed);
+    return static_cast<int>(nUsed);
 }
 
 /************************************************************************/
@@ -377,11 +467,19 @@ int CPL_STDCALL GDALFlushCacheBlock()
 int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
 
 {
-    GDALRasterBlock *poTarget;
-
+    GDALRasterBlock *poTarget = nullptr;
+
+    // When the cache is sharded, start from a different shard at each call
+    // so that eviction pressure is spread over all of them.
+    const int nStartShard =
+        nShardCount == 1
+            ? 0
+            : (CPLAtomicInc(&nNextFlushShard) & (nShardCount - 1));
+    for (int i = 0; i < nShardCount && poTarget == nullptr; ++i)
     {
-        INITIALIZE_LOCK;
-        poTarget = poOldest;
+        auto &oShard = asShards[(nStartShard + i) & (nShardCount - 1)];
+        INITIALIZE_LOCK(oShard);
+        poTarget = oShard.poOldest;
 
         while (poTarget != nullptr)
         {
@@ -395,7 +493,7 @@ int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
         }
 
         if (poTarget == nullptr)
-            return FALSE;
+            continue;
 #ifndef __COVERITY__
         // Disabled to avoid complains about sleeping under locks, that
         // are only true for debug/testing code
@@ -412,6 +510,9 @@ int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
         poTarget->GetBand()->UnreferenceBlock(poTarget);
     }
 
+    if (poTarget == nullptr)
+        return FALSE;
+
 #ifndef __COVERITY__
     // Disabled to avoid complains about sleeping under locks, that
     // are only true for debug/testing code
@@ -536,11 +637,11 @@ GDALRasterBlock::GDALRasterBlock(GDALRasterBand *poBandIn, int nXOffIn,
       nXOff(nXOffIn), nYOff(nYOffIn), nXSize(0), nYSize(0), pData(nullptr),
       poBand(poBandIn), poNext(nullptr), poPrevious(nullptr), bMustDetach(true)
 {
-    if (!hRBLock)
+    if (!asShards[0].hLock)
     {
         // Needed for scenarios where GDALAllRegister() is called after
         // GDALDestroyDriverManager()
-        INITIALIZE_LOCK;
+        InitializeShardLocks();
     }
 
     CPLAssert(poBandIn != nullptr);
@@ -657,19 +758,20 @@ void GDALRasterBlock::Detach()
 {
     if (bMustDetach)
     {
-        TAKE_LOCK;
+        TAKE_LOCK(GetShard(this));
         Detach_unlocked();
     }
 }
 
 void GDALRasterBlock::Detach_unlocked()
 {
-    if (poOldest == this)
-        poOldest = poPrevious;
+    auto &oShard = GetShard(this);
+    if (oShard.poOldest == this)
+        oShard.poOldest = poPrevious;
 
-    if (poNewest == this)
+    if (oShard.poNewest == this)
     {
-        poNewest = poNext;
+        oShard.poNewest = poNext;
     }
 
     if (poPrevious != nullptr)
@@ -683,7 +785,8 @@ void GDALRasterBlock::Detach_unlocked()
     bMustDetach = false;
 
     if (pData)
-        nCacheUsed -= GetEffectiveBlockSize(GetBlockSize());
+        nCacheUsed -=
+            static_cast<GIntBig>(GetEffectiveBlockSize(GetBlockSize()));
 
 #ifdef ENABLE_DEBUG
     Verify();
@@ -703,26 +806,31 @@ void GDALRasterBlock::Detach_unlocked()
 void GDALRasterBlock::Verify()
 
 {
-    TAKE_LOCK;
-
-    CPLAssert((poNewest == nullptr && poOldest == nullptr) ||
-              (poNewest != nullptr && poOldest != nullptr));
-
-    if (poNewest != nullptr)
+    for (int i = 0; i < nShardCount; ++i)
     {
-        CPLAssert(poNewest->poPrevious == nullptr);
-        CPLAssert(poOldest->poNext == nullptr);
+        auto &oShard = asShards[i];
+        TAKE_LOCK(oShard);
+
+        CPLAssert((oShard.poNewest == nullptr && oShard.poOldest == nullptr) ||
+                  (oShard.poNewest != nullptr && oShard.poOldest != nullptr));
 
-        GDALRasterBlock *poLast = nullptr;
-        for (GDALRasterBlock *poBlock = poNewest; poBlock != nullptr;
-             poBlock = poBlock->poNext)
+        if (oShard.poNewest != nullptr)
         {
-            CPLAssert(poBlock->poPrevious == poLast);
+            CPLAssert(oShard.poNewest->poPrevious == nullptr);
+            CPLAssert(oShard.poOldest->poNext == nullptr);
 
-            poLast = poBlock;
-        }
+            GDALRasterBlock *poLast = nullptr;
+            for (GDALRasterBlock *poBlock = oShard.poNewest; poBlock != nullptr;
+                 poBlock = poBlock->poNext)
+            {
+                CPLAssert(poBlock->poPrevious == poLast);
+                CPLAssert(GetShardIndex(poBlock) == i);
 
-        CPLAssert(poOldest == poLast);
+                poLast = poBlock;
+            }
+
+            CPLAssert(oShard.poOldest == poLast);
+        }
     }
 }
 
@@ -735,24 +843,27 @@ void GDALRasterBlock::Verify()
 #ifdef notdef
 void GDALRasterBlock::CheckNonOrphanedBlocks(GDALRasterBand *poBand)
 {
-    TAKE_LOCK;
-    for (GDALRasterBlock *poBlock = poNewest; poBlock != nullptr;
-         poBlock = poBlock->poNext)
+    for (int i = 0; i < nShardCount; ++i)
     {
-        if (poBlock->GetBand() == poBand)
+        TAKE_LOCK(asShards[i]);
+        for (GDALRasterBlock *poBlock = asShards[i].poNewest;
+             poBlock != nullptr; poBlock = poBlock->poNext)
         {
-            printf("Cache has still blocks of band %p\n", poBand); /*ok*/
-            printf("Band : %d\n", poBand->GetBand());              /*ok*/
-            printf("nRasterXSize = %d\n", poBand->GetXSize());     /*ok*/
-            printf("nRasterYSize = %d\n", poBand->GetYSize());     /*ok*/
-            int nBlockXSize, nBlockYSize;
-            poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
-            printf("nBlockXSize = %d\n", nBlockXSize);      /*ok*/
-            printf("nBlockYSize = %d\n", nBlockYSize);      /*ok*/
-            printf("Dataset : %p\n", poBand->GetDataset()); /*ok*/
-            if (poBand->GetDataset())
-                printf("Dataset : %s\n", /*ok*/
-                       poBand->GetDataset()->GetDescription());
+            if (poBlock->GetBand() == poBand)
+            {
+                printf("Cache has still blocks of band %p\n", poBand); /*ok*/
+                printf("Band : %d\n", poBand->GetBand());              /*ok*/
+                printf("nRasterXSize = %d\n", poBand->GetXSize());     /*ok*/
+                printf("nRasterYSize = %d\n", poBand->GetYSize());     /*ok*/
+                int nBlockXSize, nBlockYSize;
+                poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+                printf("nBlockXSize = %d\n", nBlockXSize);      /*ok*/
+                printf("nBlockYSize = %d\n", nBlockYSize);      /*ok*/
+                printf("Dataset : %p\n", poBand->GetDataset()); /*ok*/
+                if (poBand->GetDataset())
+                    printf("Dataset : %s\n", /*ok*/
+                           poBand->GetDataset()->GetDescription());
+            }
         }
     }
 }
@@ -809,11 +920,13 @@ CPLErr GDALRasterBlock::Write()
 void GDALRasterBlock::Touch()
 
 {
+    auto &oShard = GetShard(this);
+
     // Can be safely tested outside the lock
-    if (poNewest == this)
+    if (oShard.poNewest == this)
         return;
 
-    TAKE_LOCK;
+    TAKE_LOCK(oShard);
     Touch_unlocked();
 }
 
@@ -826,15 +939,16 @@ void GDALRasterBlock::Touch_unlocked()
     // 1. Thread 1 calls Touch() and poNewest != this at that point
     // 2. Thread 2 detaches poNewest
     // 3. Thread 1 arrives here
-    if (poNewest == this)
+    auto &oShard = GetShard(this);
+    if (oShard.poNewest == this)
         return;
 
     // We should not try to touch a block that has been detached.
     // If that happen, corruption has already occurred.
     CPLAssert(bMustDetach);
 
-    if (poOldest == this)
-        poOldest = this->poPrevious;
+    if (oShard.poOldest == this)
+        oShard.poOldest = this->poPrevious;
 
     if (poPrevious != nullptr)
         poPrevious->poNext = poNext;
@@ -843,19 +957,19 @@ void GDALRasterBlock::Touch_unlocked()
         poNext->poPrevious = poPrevious;
 
     poPrevious = nullptr;
-    poNext = poNewest;
+    poNext = oShard.poNewest;
 
-    if (poNewest != nullptr)
+    if (oShard.poNewest != nullptr)
     {
-        CPLAssert(poNewest->poPrevious == nullptr);
-        poNewest->poPrevious = this;
+        CPLAssert(oShard.poNewest->poPrevious == nullptr);
+        oShard.poNewest->poPrevious = this;
     }
-    poNewest = this;
+    oShard.poNewest = this;
 
-    if (poOldest == nullptr)
+    if (oShard.poOldest == nullptr)
     {
         CPLAssert(poPrevious == nullptr && poNext == nullptr);
-        poOldest = this;
+        oShard.poOldest = this;
     }
 #ifdef ENABLE_DEBUG
     Verify();
@@ -884,7 +998,7 @@ CPLErr GDALRasterBlock::Internalize()
 
     void *pNewData = nullptr;
 
-    // This call will initialize the hRBLock mutex. Other call places can
+    // This call will initialize the shard locks. Other call places can
     // only be called if we have go through there.
     const GIntBig nCurCacheMax = GDALGetCacheMax64();
 
@@ -896,18 +1010,26 @@ CPLErr GDALRasterBlock::Internalize()
     /* -------------------------------------------------------------------- */
     bool bFirstIter = true;
     bool bLoopAgain = false;
+    bool bTouched = false;
     GDALDataset *poThisDS = poBand->GetDataset();
+    // Start evicting from the shard of this block, and then go through
+    // the other ones if that is not enough.
+    const int iThisShard = GetShardIndex(this);
+    int iShard = iThisShard;
+    int nShardsVisited = 1;
     do
     {
         bLoopAgain = false;
         GDALRasterBlock *apoBlocksToFree[64] = {nullptr};
         int nBlocksToFree = 0;
         {
-            TAKE_LOCK;
+            auto &oShard = asShards[iShard];
+            TAKE_LOCK(oShard);
 
             if (bFirstIter)
-                nCacheUsed += GetEffectiveBlockSize(nSizeInBytes);
-            GDALRasterBlock *poTarget = poOldest;
+                nCacheUsed +=
+                    static_cast<GIntBig>(GetEffectiveBlockSize(nSizeInBytes));
+            GDALRasterBlock *poTarget = oShard.poOldest;
             while (nCacheUsed > nCurCacheMax)
             {
                 GDALRasterBlock *poDirtyBlockOtherDataset = nullptr;
@@ -954,7 +1076,7 @@ CPLErr GDALRasterBlock::Internalize()
                     }
                     else
                     {
-                        poTarget = poOldest;
+                        poTarget = oShard.poOldest;
                         while (poTarget != nullptr)
                         {
                             if (CPLAtomicCompareAndExchange(
@@ -1008,6 +1130,13 @@ CPLErr GDALRasterBlock::Internalize()
                 }
                 else
                 {
+                    // Nothing more can be evicted from this shard.
+                    if (nShardsVisited < nShardCount)
+                    {
+                        ++nShardsVisited;
+                        iShard = (iShard + 1) & (nShardCount - 1);
+                        bLoopAgain = true;
+                    }
                     break;
                 }
             }
@@ -1017,8 +1146,11 @@ CPLErr GDALRasterBlock::Internalize()
             /*      Add this block to the list. */
             /* ------------------------------------------------------------------
              */
-            if (!bLoopAgain)
+            if (!bLoopAgain && iShard == iThisShard)
+            {
                 Touch_unlocked();
+                bTouched = true;
+            }
         }
 
         bFirstIter = false;
@@ -1068,6 +1200,12 @@ CPLErr GDALRasterBlock::Internalize()
         }
     } while (bLoopAgain);
 
+    if (!bTouched)
+    {
+        TAKE_LOCK(asShards[iThisShard]);
+        Touch_unlocked();
+    }
+
     if (pNewData == nullptr)
     {
         pNewData = VSI_MALLOC_ALIGNED_AUTO_VERBOSE(nSizeInBytes);
@@ -1129,9 +1267,12 @@ void GDALRasterBlock::MarkClean()
 /*! @cond Doxygen_Suppress */
 void GDALRasterBlock::DestroyRBMutex()
 {
-    if (hRBLock != nullptr)
-        DESTROY_LOCK;
-    hRBLock = nullptr;
+    for (auto &oShard : asShards)
+    {
+        if (oShard.hLock != nullptr)
+            DESTROY_LOCK(oShard);
+        oShard.hLock = nullptr;
+    }
 }
 
 /*! @endcond */
@@ -1214,7 +1355,7 @@ int GDALRasterBlock::DropLockForRemovalFromStorage()
 #endif
 
     // Wait for the block for having been unreferenced.
-    TAKE_LOCK;
+    TAKE_LOCK(GetShard(this));
 
     return FALSE;
 }
@@ -1223,7 +1364,7 @@ int GDALRasterBlock::DropLockForRemovalFromStorage()
 void GDALRasterBlock::DumpAll()
 {
     int iBlock = 0;
-    for( GDALRasterBlock *poBlock = poNewest;
+    for( GDALRasterBlock *poBlock = asShards[0].poNewest;
          poBlock != nullptr;
          poBlock = poBlock->poNext )
     {
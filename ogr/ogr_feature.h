@@ -1253,6 +1253,7 @@ class CPL_DLL OGRFeature
     OGRErr SetGeomField(int iField, std::unique_ptr<OGRGeometry>);
 
     void Reset();
+    void Swap(OGRFeature &oOther);
 
     OGRFeature *Clone() const CPL_WARN_UNUSED_RESULT;
     virtual OGRBoolean Equal(const OGRFeature *poFeature) const;
@@ -31,6 +31,7 @@
 #include <map>
 #include <vector>
 #include <set>
+#include <unordered_set>
 
 #if defined(_WIN32) && !defined(strcasecmp)
 #define strcasecmp stricmp
@@ -369,6 +370,38 @@ class CPL_UNSTABLE_API swq_summary
         bool operator()(const CPLString &, const CPLString &) const;
     };
 
+    // Hash and equality functions consistent with Comparator, for
+    // oSetDistinctValues.
+    struct Hash
+    {
+        swq_field_type eType;
+
+        Hash() : eType(SWQ_STRING)
+        {
+        }
+
+        explicit Hash(swq_field_type eTypeIn) : eType(eTypeIn)
+        {
+        }
+
+        size_t operator()(const CPLString &) const;
+    };
+
+    struct Equal
+    {
+        swq_field_type eType;
+
+        Equal() : eType(SWQ_STRING)
+        {
+        }
+
+        explicit Equal(swq_field_type eTypeIn) : eType(eTypeIn)
+        {
+        }
+
+        bool operator()(const CPLString &, const CPLString &) const;
+    };
+
     //! Return the sum, using Kahan-Babuska-Neumaier algorithm.
     // Cf cf KahanBabushkaNeumaierSum of https://en.wikipedia.org/wiki/Kahan_summation_algorithm#Further_enhancements
     double sum() const
@@ -378,8 +411,10 @@ class CPL_UNSTABLE_API swq_summary
 
     GIntBig count = 0;
 
+    // Distinct values, in their order of appearance
     std::vector<CPLString> oVectorDistinctValues{};
-    std::set<CPLString, Comparator> oSetDistinctValues{};
+    std::unordered_set<CPLString, Hash, Equal> oSetDistinctValues{};
+    Comparator oComparator{};
     bool sum_only_finite_terms = true;
     // Sum accumulator. To get the accurate sum, use the sum() method
     double sum_acc = 0.0;
@@ -808,6 +808,760 @@ bool OGRWKBIntersectsPessimistic(const GByte *pabyWkb, size_t nWKBSize,
     return bRet;
 }
 
+/************************************************************************/
+/*                     OGRWKBExactOrientation()                         */
+/************************************************************************/
+
+// Error-free transformations, from "Adaptive Precision Floating-Point
+// Arithmetic and Fast Robust Geometric Predicates", J. R. Shewchuk, 1997.
+
+static inline void OGRWKBTwoSum(double a, double b, double &x, double &y)
+{
+    x = a + b;
+    const double bVirtual = x - a;
+    const double aVirtual = x - bVirtual;
+    y = (a - aVirtual) + (b - bVirtual);
+}
+
+static inline void OGRWKBTwoProduct(double a, double b, double &x, double &y)
+{
+    x = a * b;
+    y = std::fma(a, b, -x);
+}
+
+// Returns the sign of (dfX1 - dfX) * (dfY2 - dfY) - (dfY1 - dfY) * (dfX2 - dfX)
+// computed exactly, by accumulating all the terms in a floating-point
+// expansion (barring overflow and underflow).
+static int OGRWKBExactOrientation(double dfX1, double dfY1, double dfX2,
+                                  double dfY2, double dfX, double dfY)
+{
+    double adfA[2], adfB[2], adfC[2], adfD[2];
+    OGRWKBTwoSum(dfX1, -dfX, adfA[0], adfA[1]);
+    OGRWKBTwoSum(dfY2, -dfY, adfB[0], adfB[1]);
+    OGRWKBTwoSum(dfY1, -dfY, adfC[0], adfC[1]);
+    OGRWKBTwoSum(dfX2, -dfX, adfD[0], adfD[1]);
+
+    // Grow-Expansion with zero elimination: adfExpansion[] is a
+    // non-overlapping expansion sorted by increasing magnitude.
+    double adfExpansion[16];
+    int nComponents = 0;
+    const auto AddTerm = [&adfExpansion, &nComponents](double dfQ)
+    {
+        int nNewComponents = 0;
+        for (int i = 0; i < nComponents; ++i)
+        {
+            double dfH = 0;
+            OGRWKBTwoSum(dfQ, adfExpansion[i], dfQ, dfH);
+            if (dfH != 0)
+                adfExpansion[nNewComponents++] = dfH;
+        }
+        if (dfQ != 0)
+            adfExpansion[nNewComponents++] = dfQ;
+        nComponents = nNewComponents;
+    };
+
+    for (int i = 0; i < 2; ++i)
+    {
+        for (int j = 0; j < 2; ++j)
+        {
+            double dfHi = 0;
+            double dfLo = 0;
+            OGRWKBTwoProduct(adfA[i], adfB[j], dfHi, dfLo);
+            AddTerm(dfHi);
+            AddTerm(dfLo);
+            OGRWKBTwoProduct(adfC[i], adfD[j], dfHi, dfLo);
+            AddTerm(-dfHi);
+            AddTerm(-dfLo);
+        }
+    }
+
+    // The most significant component gives the sign of the expansion
+    if (nComponents == 0)
+        return 0;
+    return adfExpansion[nComponents - 1] > 0 ? 1 : -1;
+}
+
+/************************************************************************/
+/*                         OGRWKBOrientation()                          */
+/************************************************************************/
+
+constexpr int OGR_WKB_ORIENTATION_UNCERTAIN = 2;
+
+// Returns 1 if (dfX, dfY) is on the left of the directed line going from
+// (dfX1, dfY1) to (dfX2, dfY2), -1 if it is on its right, 0 if the 3 points
+// are collinear, or OGR_WKB_ORIENTATION_UNCERTAIN for non-finite values.
+// The fast path uses the error bound of Shewchuk's orient2d() filter, and
+// the exact computation is only done when it is not conclusive.
+static inline int OGRWKBOrientation(double dfX1, double dfY1, double dfX2,
+                                    double dfY2, double dfX, double dfY)
+{
+    const double dfDetLeft = (dfX1 - dfX) * (dfY2 - dfY);
+    const double dfDetRight = (dfY1 - dfY) * (dfX2 - dfX);
+    const double dfDet = dfDetLeft - dfDetRight;
+    constexpr double EPSILON = std::numeric_limits<double>::epsilon() / 2;
+    constexpr double ERR_BOUND = (3.0 + 16.0 * EPSILON) * EPSILON;
+    const double dfErrBound =
+        ERR_BOUND * (std::fabs(dfDetLeft) + std::fabs(dfDetRight));
+    if (dfDet >= dfErrBound || -dfDet >= dfErrBound)
+    {
+        // Note: dfDet == 0 can only be reached if dfErrBound == 0, that
+        // is when both terms are exactly zero.
+        return dfDet > 0 ? 1 : dfDet < 0 ? -1 : 0;
+    }
+    if (!std::isfinite(dfErrBound))
+        return OGR_WKB_ORIENTATION_UNCERTAIN;
+    return OGRWKBExactOrientation(dfX1, dfY1, dfX2, dfY2, dfX, dfY);
+}
+
+/************************************************************************/
+/*                      OGRWKBSegmentsIntersect()                       */
+/************************************************************************/
+
+// Returns 1 if segments [(dfAX1, dfAY1), (dfAX2, dfAY2)] and
+// [(dfBX1, dfBY1), (dfBX2, dfBY2)] intersect (touching included),
+// 0 if they do not, or -1 if this cannot be established reliably.
+// Segments must not be degenerate.
+static int OGRWKBSegmentsIntersect(double dfAX1, double dfAY1, double dfAX2,
+                                   double dfAY2, double dfBX1, double dfBY1,
+                                   double dfBX2, double dfBY2)
+{
+    const int o1 = OGRWKBOrientation(dfAX1, dfAY1, dfAX2, dfAY2, dfBX1, dfBY1);
+    const int o2 = OGRWKBOrientation(dfAX1, dfAY1, dfAX2, dfAY2, dfBX2, dfBY2);
+    if (o1 == o2 && o1 != 0 && o1 != OGR_WKB_ORIENTATION_UNCERTAIN)
+        return 0;
+    const int o3 = OGRWKBOrientation(dfBX1, dfBY1, dfBX2, dfBY2, dfAX1, dfAY1);
+    const int o4 = OGRWKBOrientation(dfBX1, dfBY1, dfBX2, dfBY2, dfAX2, dfAY2);
+    if (o3 == o4 && o3 != 0 && o3 != OGR_WKB_ORIENTATION_UNCERTAIN)
+        return 0;
+    if (o1 == OGR_WKB_ORIENTATION_UNCERTAIN ||
+        o2 == OGR_WKB_ORIENTATION_UNCERTAIN ||
+        o3 == OGR_WKB_ORIENTATION_UNCERTAIN ||
+        o4 == OGR_WKB_ORIENTATION_UNCERTAIN)
+    {
+        return -1;
+    }
+    if (o1 == 0 && o2 == 0)
+    {
+        // Collinear segments: check if their extents overlap
+        return std::max(std::min(dfAX1, dfAX2), std::min(dfBX1, dfBX2)) <=
+                       std::min(std::max(dfAX1, dfAX2),
+                                std::max(dfBX1, dfBX2)) &&
+                   std::max(std::min(dfAY1, dfAY2), std::min(dfBY1, dfBY2)) <=
+                       std::min(std::max(dfAY1, dfAY2),
+                                std::max(dfBY1, dfBY2))
+                   ? 1
+                   : 0;
+    }
+    return 1;
+}
+
+/************************************************************************/
+/*                        OGRWKBCrossingTest()                          */
+/************************************************************************/
+
+// Updates bInside for a crossing number test of the point (dfX, dfY),
+// with a ray cast towards +X, against the edge [(dfX1, dfY1), (dfX2, dfY2)].
+// Returns 1 if the point is on the edge, -1 if this cannot be established
+// reliably, or 0 otherwise.
+static inline int OGRWKBCrossingTest(double dfX1, double dfY1, double dfX2,
+                                     double dfY2, double dfX, double dfY,
+                                     bool &bInside)
+{
+    const bool bAbove1 = dfY1 > dfY;
+    const bool bAbove2 = dfY2 > dfY;
+    const bool bStraddles = bAbove1 != bAbove2;
+    if (!bStraddles && (bAbove1 || (dfY1 != dfY && dfY2 != dfY)))
+        return 0;
+    if (dfX > std::max(dfX1, dfX2))
+        return 0;
+    if (dfX < std::min(dfX1, dfX2))
+    {
+        if (bStraddles)
+            bInside = !bInside;
+        return 0;
+    }
+    const int nOrientation =
+        OGRWKBOrientation(dfX1, dfY1, dfX2, dfY2, dfX, dfY);
+    if (nOrientation == OGR_WKB_ORIENTATION_UNCERTAIN)
+        return -1;
+    if (nOrientation == 0)
+        return 1;
+    // An upward edge crosses the ray if the point is on its left, and a
+    // downward edge if the point is on its right.
+    if (bStraddles && (nOrientation > 0) == bAbove2)
+        bInside = !bInside;
+    return 0;
+}
+
+/************************************************************************/
+/*                          OGRWKBReadXY()                              */
+/************************************************************************/
+
+static inline void OGRWKBReadXY(const GByte *pabyPoint,
+                                OGRwkbByteOrder eByteOrder, double &dfX,
+                                double &dfY)
+{
+    memcpy(&dfX, pabyPoint, sizeof(double));
+    memcpy(&dfY, pabyPoint + sizeof(double), sizeof(double));
+    if (OGR_SWAP(eByteOrder))
+    {
+        CPL_SWAP64PTR(&dfX);
+        CPL_SWAP64PTR(&dfY);
+    }
+}
+
+/************************************************************************/
+/*                 OGRWKBPreparedPolygon::Create()                      */
+/************************************************************************/
+
+std::unique_ptr<OGRWKBPreparedPolygon>
+OGRWKBPreparedPolygon::Create(const OGRGeometry *poGeom)
+{
+    if (!poGeom || poGeom->IsEmpty())
+        return nullptr;
+    const auto eFlatType = wkbFlatten(poGeom->getGeometryType());
+    if (eFlatType != wkbPolygon && eFlatType != wkbMultiPolygon)
+        return nullptr;
+
+    auto poRet =
+        std::unique_ptr<OGRWKBPreparedPolygon>(new OGRWKBPreparedPolygon());
+
+    const auto AddPolygon = [&poRet](const OGRPolygon *poPoly)
+    {
+        const OGRLinearRing *poExteriorRing = poPoly->getExteriorRing();
+        if (!poExteriorRing || poExteriorRing->IsEmpty())
+            return true;
+        poRet->m_asParts.push_back(
+            {poExteriorRing->getX(0), poExteriorRing->getY(0)});
+        for (const auto *poRing : *poPoly)
+        {
+            const int nPoints = poRing->getNumPoints();
+            for (int i = 0; i < nPoints; ++i)
+            {
+                // Implicitly close unclosed rings
+                const int iNext = (i + 1 < nPoints) ? i + 1 : 0;
+                const Edge sEdge{poRing->getX(i), poRing->getY(i),
+                                 poRing->getX(iNext), poRing->getY(iNext)};
+                if (!std::isfinite(sEdge.dfX1) || !std::isfinite(sEdge.dfY1))
+                    return false;
+                // Skip degenerate edges
+                if (sEdge.dfX1 != sEdge.dfX2 || sEdge.dfY1 != sEdge.dfY2)
+                    poRet->m_asEdges.push_back(sEdge);
+            }
+        }
+        return true;
+    };
+
+    if (eFlatType == wkbPolygon)
+    {
+        if (!AddPolygon(poGeom->toPolygon()))
+            return nullptr;
+    }
+    else
+    {
+        for (const auto *poPoly : *(poGeom->toMultiPolygon()))
+        {
+            if (!AddPolygon(poPoly))
+                return nullptr;
+        }
+    }
+    if (poRet->m_asEdges.empty() ||
+        poRet->m_asEdges.size() > std::numeric_limits<uint32_t>::max())
+    {
+        return nullptr;
+    }
+
+    poGeom->getEnvelope(&poRet->m_sEnvelope);
+    return poRet;
+}
+
+/************************************************************************/
+/*                OGRWKBPreparedPolygon::GetBand()                      */
+/************************************************************************/
+
+inline int OGRWKBPreparedPolygon::GetBand(double dfY) const
+{
+    const double dfBand = (dfY - m_sEnvelope.MinY) * m_dfInvBandHeight;
+    if (!(dfBand > 0))
+        return 0;
+    if (dfBand >= m_nBands)
+        return m_nBands - 1;
+    return static_cast<int>(dfBand);
+}
+
+/************************************************************************/
+/*               OGRWKBPreparedPolygon::BuildIndex()                    */
+/************************************************************************/
+
+void OGRWKBPreparedPolygon::BuildIndex()
+{
+    const size_t nEdges = m_asEdges.size();
+    const double dfHeight = m_sEnvelope.MaxY - m_sEnvelope.MinY;
+
+    // Aim at a few edges per band, but reduce the number of bands if long
+    // edges would make the index too large.
+    m_nBands =
+        static_cast<int>(std::min<size_t>(std::max<size_t>(nEdges / 4, 1),
+                                          65536));
+    size_t nEntries = 0;
+    while (true)
+    {
+        m_dfInvBandHeight = dfHeight > 0 ? m_nBands / dfHeight : 0;
+        nEntries = 0;
+        for (const auto &sEdge : m_asEdges)
+        {
+            nEntries += GetBand(std::max(sEdge.dfY1, sEdge.dfY2)) -
+                        GetBand(std::min(sEdge.dfY1, sEdge.dfY2)) + 1;
+        }
+        if (m_nBands == 1 || nEntries <= 16 * nEdges)
+            break;
+        m_nBands /= 2;
+    }
+
+    m_anBandStart.assign(m_nBands + 1, 0);
+    for (const auto &sEdge : m_asEdges)
+    {
+        const int iBandMax = GetBand(std::max(sEdge.dfY1, sEdge.dfY2));
+        for (int iBand = GetBand(std::min(sEdge.dfY1, sEdge.dfY2));
+             iBand <= iBandMax; ++iBand)
+        {
+            ++m_anBandStart[iBand + 1];
+        }
+    }
+    for (int iBand = 0; iBand < m_nBands; ++iBand)
+        m_anBandStart[iBand + 1] += m_anBandStart[iBand];
+
+    m_anBandEdges.resize(nEntries);
+    std::vector<size_t> anBandCur(m_anBandStart.begin(),
+                                  m_anBandStart.end() - 1);
+    for (size_t i = 0; i < nEdges; ++i)
+    {
+        const auto &sEdge = m_asEdges[i];
+        const int iBandMax = GetBand(std::max(sEdge.dfY1, sEdge.dfY2));
+        for (int iBand = GetBand(std::min(sEdge.dfY1, sEdge.dfY2));
+             iBand <= iBandMax; ++iBand)
+        {
+            m_anBandEdges[anBandCur[iBand]++] = static_cast<uint32_t>(i);
+        }
+    }
+}
+
+/************************************************************************/
+/*               OGRWKBPreparedPolygon::LocatePoint()                   */
+/************************************************************************/
+
+// Returns 1 if the point is inside or on the boundary of the prepared
+// geometry, 0 if it is outside, or -1 if this cannot be established reliably.
+int OGRWKBPreparedPolygon::LocatePoint(double dfX, double dfY) const
+{
+    if (!(dfX >= m_sEnvelope.MinX && dfX <= m_sEnvelope.MaxX &&
+          dfY >= m_sEnvelope.MinY && dfY <= m_sEnvelope.MaxY))
+    {
+        return 0;
+    }
+
+    // Parity of crossings over all edges, as done by GEOS
+    // IndexedPointInAreaLocator.
+    bool bInside = false;
+    const int iBand = GetBand(dfY);
+    for (size_t i = m_anBandStart[iBand]; i < m_anBandStart[iBand + 1]; ++i)
+    {
+        const auto &sEdge = m_asEdges[m_anBandEdges[i]];
+        const int nRet = OGRWKBCrossingTest(sEdge.dfX1, sEdge.dfY1, sEdge.dfX2,
+                                            sEdge.dfY2, dfX, dfY, bInside);
+        if (nRet != 0)
+            return nRet;
+    }
+    return bInside ? 1 : 0;
+}
+
+/************************************************************************/
+/*            OGRWKBPreparedPolygon::IntersectsSegment()                */
+/************************************************************************/
+
+// Returns 1 if the segment intersects an edge of the prepared geometry,
+// 0 if it does not, or -1 if this cannot be established reliably.
+int OGRWKBPreparedPolygon::IntersectsSegment(double dfX1, double dfY1,
+                                             double dfX2, double dfY2) const
+{
+    const double dfMinX = std::min(dfX1, dfX2);
+    const double dfMaxX = std::max(dfX1, dfX2);
+    const double dfMinY = std::min(dfY1, dfY2);
+    const double dfMaxY = std::max(dfY1, dfY2);
+    if (dfMaxX < m_sEnvelope.MinX || dfMinX > m_sEnvelope.MaxX ||
+        dfMaxY < m_sEnvelope.MinY || dfMinY > m_sEnvelope.MaxY)
+    {
+        return 0;
+    }
+
+    bool bUncertain = false;
+    const int iBandMax = GetBand(dfMaxY);
+    for (int iBand = GetBand(dfMinY); iBand <= iBandMax; ++iBand)
+    {
+        for (size_t i = m_anBandStart[iBand]; i < m_anBandStart[iBand + 1];
+             ++i)
+        {
+            const auto &sEdge = m_asEdges[m_anBandEdges[i]];
+            if (std::max(sEdge.dfX1, sEdge.dfX2) < dfMinX ||
+                std::min(sEdge.dfX1, sEdge.dfX2) > dfMaxX ||
+                std::max(sEdge.dfY1, sEdge.dfY2) < dfMinY ||
+                std::min(sEdge.dfY1, sEdge.dfY2) > dfMaxY)
+            {
+                continue;
+            }
+            const int nRet = OGRWKBSegmentsIntersect(
+                dfX1, dfY1, dfX2, dfY2, sEdge.dfX1, sEdge.dfY1, sEdge.dfX2,
+                sEdge.dfY2);
+            if (nRet > 0)
+                return 1;
+            if (nRet < 0)
+                bUncertain = true;
+        }
+    }
+    return bUncertain ? -1 : 0;
+}
+
+/************************************************************************/
+/*           OGRWKBPreparedPolygon::IntersectsLineString()              */
+/************************************************************************/
+
+bool OGRWKBPreparedPolygon::IntersectsLineString(
+    const GByte *data, const size_t size, const OGRwkbByteOrder eByteOrder,
+    const int nDim, size_t &iOffsetInOut, bool &bErrorOut) const
+{
+    const uint32_t nPoints =
+        OGRWKBReadUInt32AtOffset(data, eByteOrder, iOffsetInOut);
+    if (nPoints > (size - iOffsetInOut) / (nDim * sizeof(double)))
+    {
+        bErrorOut = true;
+        return false;
+    }
+    const GByte *pabyPoints = data + iOffsetInOut;
+    const size_t nPointSize = nDim * sizeof(double);
+    iOffsetInOut += nPoints * nPointSize;
+    if (nPoints == 0)
+        return false;
+
+    double dfX0 = 0;
+    double dfY0 = 0;
+    OGRWKBReadXY(pabyPoints, eByteOrder, dfX0, dfY0);
+    if (!std::isfinite(dfX0) || !std::isfinite(dfY0))
+    {
+        bErrorOut = true;
+        return false;
+    }
+
+    bool bUncertain = false;
+    double dfPrevX = dfX0;
+    double dfPrevY = dfY0;
+    for (uint32_t j = 1; j < nPoints; ++j)
+    {
+        double dfX = 0;
+        double dfY = 0;
+        OGRWKBReadXY(pabyPoints + j * nPointSize, eByteOrder, dfX, dfY);
+        if (dfX == dfPrevX && dfY == dfPrevY)
+            continue;
+        if (!std::isfinite(dfX) || !std::isfinite(dfY))
+        {
+            bErrorOut = true;
+            return false;
+        }
+        const int nRet = IntersectsSegment(dfPrevX, dfPrevY, dfX, dfY);
+        if (nRet > 0)
+            return true;
+        if (nRet < 0)
+            bUncertain = true;
+        dfPrevX = dfX;
+        dfPrevY = dfY;
+    }
+    if (bUncertain)
+    {
+        bErrorOut = true;
+        return false;
+    }
+
+    // No edge crossing: the line string is either fully inside or fully
+    // outside.
+    const int nRet = LocatePoint(dfX0, dfY0);
+    if (nRet < 0)
+        bErrorOut = true;
+    return nRet > 0;
+}
+
+/************************************************************************/
+/*                    OGRWKBLocatePointInRings()                        */
+/************************************************************************/
+
+// Returns 1 if the point is inside or on the boundary of the WKB polygon
+// whose nRings rings start at data + iOffset, 0 if it is outside, or -1 if
+// this cannot be established reliably. The WKB must have been validated.
+static int OGRWKBLocatePointInRings(const GByte *data,
+                                    const OGRwkbByteOrder eByteOrder,
+                                    const int nDim, size_t iOffset,
+                                    const uint32_t nRings, const double dfX,
+                                    const double dfY)
+{
+    const size_t nPointSize = nDim * sizeof(double);
+    bool bInside = false;
+    for (uint32_t i = 0; i < nRings; ++i)
+    {
+        const uint32_t nPoints =
+            OGRWKBReadUInt32AtOffset(data, eByteOrder, iOffset);
+        const GByte *pabyPoints = data + iOffset;
+        iOffset += nPoints * nPointSize;
+        if (nPoints == 0)
+            continue;
+        double dfPrevX = 0;
+        double dfPrevY = 0;
+        OGRWKBReadXY(pabyPoints + (nPoints - 1) * nPointSize, eByteOrder,
+                     dfPrevX, dfPrevY);
+        for (uint32_t j = 0; j < nPoints; ++j)
+        {
+            double dfCurX = 0;
+            double dfCurY = 0;
+            OGRWKBReadXY(pabyPoints + j * nPointSize, eByteOrder, dfCurX,
+                         dfCurY);
+            if (dfCurX != dfPrevX || dfCurY != dfPrevY)
+            {
+                const int nRet = OGRWKBCrossingTest(
+                    dfPrevX, dfPrevY, dfCurX, dfCurY, dfX, dfY, bInside);
+                if (nRet != 0)
+                    return nRet;
+            }
+            dfPrevX = dfCurX;
+            dfPrevY = dfCurY;
+        }
+    }
+    return bInside ? 1 : 0;
+}
+
+/************************************************************************/
+/*             OGRWKBPreparedPolygon::IntersectsPolygon()               */
+/************************************************************************/
+
+bool OGRWKBPreparedPolygon::IntersectsPolygon(const GByte *data,
+                                              const size_t size,
+                                              const OGRwkbByteOrder eByteOrder,
+                                              const int nDim,
+                                              size_t &iOffsetInOut,
+                                              bool &bErrorOut) const
+{
+    const uint32_t nRings =
+        OGRWKBReadUInt32AtOffset(data, eByteOrder, iOffsetInOut);
+    if (nRings > (size - iOffsetInOut) / sizeof(uint32_t))
+    {
+        bErrorOut = true;
+        return false;
+    }
+    const size_t iRingsOffset = iOffsetInOut;
+    const size_t nPointSize = nDim * sizeof(double);
+
+    // Test the edges of all rings against the edges of the prepared geometry
+    bool bEmpty = true;
+    bool bUncertain = false;
+    double dfX0 = 0;
+    double dfY0 = 0;
+    OGREnvelope sExteriorEnvelope;
+    for (uint32_t i = 0; i < nRings; ++i)
+    {
+        if (iOffsetInOut + sizeof(uint32_t) > size)
+        {
+            bErrorOut = true;
+            return false;
+        }
+        const uint32_t nPoints =
+            OGRWKBReadUInt32AtOffset(data, eByteOrder, iOffsetInOut);
+        if (nPoints > (size - iOffsetInOut) / nPointSize)
+        {
+            bErrorOut = true;
+            return false;
+        }
+        const GByte *pabyPoints = data + iOffsetInOut;
+        iOffsetInOut += nPoints * nPointSize;
+        if (i == 0)
+            bEmpty = (nPoints == 0);
+        if (bEmpty || nPoints == 0)
+            continue;
+
+        double dfPrevX = 0;
+        double dfPrevY = 0;
+        OGRWKBReadXY(pabyPoints + (nPoints - 1) * nPointSize, eByteOrder,
+                     dfPrevX, dfPrevY);
+        for (uint32_t j = 0; j < nPoints; ++j)
+        {
+            double dfX = 0;
+            double dfY = 0;
+            OGRWKBReadXY(pabyPoints + j * nPointSize, eByteOrder, dfX, dfY);
+            if (!std::isfinite(dfX) || !std::isfinite(dfY))
+            {
+                bErrorOut = true;
+                return false;
+            }
+            if (i == 0)
+            {
+                if (j == 0)
+                {
+                    dfX0 = dfX;
+                    dfY0 = dfY;
+                }
+                sExteriorEnvelope.Merge(dfX, dfY);
+            }
+            if (dfX != dfPrevX || dfY != dfPrevY)
+            {
+                const int nRet = IntersectsSegment(dfPrevX, dfPrevY, dfX, dfY);
+                if (nRet > 0)
+                    return true;
+                if (nRet < 0)
+                    bUncertain = true;
+            }
+            dfPrevX = dfX;
+            dfPrevY = dfY;
+        }
+    }
+    if (bEmpty)
+        return false;
+    if (bUncertain)
+    {
+        bErrorOut = true;
+        return false;
+    }
+
+    // No edge crossing: the geometries are either disjoint, or one is
+    // contained in the other.
+    int nRet = LocatePoint(dfX0, dfY0);
+    if (nRet == 0)
+    {
+        for (const auto &sPart : m_asParts)
+        {
+            if (sPart.dfX >= sExteriorEnvelope.MinX &&
+                sPart.dfX <= sExteriorEnvelope.MaxX &&
+                sPart.dfY >= sExteriorEnvelope.MinY &&
+                sPart.dfY <= sExteriorEnvelope.MaxY)
+            {
+                nRet = OGRWKBLocatePointInRings(data, eByteOrder, nDim,
+                                                iRingsOffset, nRings,
+                                                sPart.dfX, sPart.dfY);
+                if (nRet != 0)
+                    break;
+            }
+        }
+    }
+    if (nRet < 0)
+        bErrorOut = true;
+    return nRet > 0;
+}
+
+/************************************************************************/
+/*                OGRWKBPreparedPolygon::Intersects()                   */
+/************************************************************************/
+
+bool OGRWKBPreparedPolygon::Intersects(const GByte *data, const size_t size,
+                                       size_t &iOffsetInOut, const int nRec,
+                                       bool &bErrorOut) const
+{
+    if (size - iOffsetInOut < MIN_WKB_SIZE)
+    {
+        bErrorOut = true;
+        return false;
+    }
+    const int nByteOrder = DB2_V72_FIX_BYTE_ORDER(data[iOffsetInOut]);
+    if (!(nByteOrder == wkbXDR || nByteOrder == wkbNDR))
+    {
+        bErrorOut = true;
+        return false;
+    }
+    const OGRwkbByteOrder eByteOrder = static_cast<OGRwkbByteOrder>(nByteOrder);
+
+    OGRwkbGeometryType eGeometryType = wkbUnknown;
+    OGRReadWKBGeometryType(data + iOffsetInOut, wkbVariantIso, &eGeometryType);
+    iOffsetInOut += 5;
+    const auto eFlatType = wkbFlatten(eGeometryType);
+    const int nDim = 2 + (OGR_GT_HasZ(eGeometryType) ? 1 : 0) +
+                     (OGR_GT_HasM(eGeometryType) ? 1 : 0);
+
+    if (eFlatType == wkbPoint)
+    {
+        if (size - iOffsetInOut < nDim * sizeof(double))
+        {
+            bErrorOut = true;
+            return false;
+        }
+        double dfX = 0;
+        double dfY = 0;
+        OGRWKBReadXY(data + iOffsetInOut, eByteOrder, dfX, dfY);
+        iOffsetInOut += nDim * sizeof(double);
+        if (std::isnan(dfX))
+        {
+            // POINT EMPTY
+            return false;
+        }
+        const int nRet = LocatePoint(dfX, dfY);
+        if (nRet < 0)
+            bErrorOut = true;
+        return nRet > 0;
+    }
+
+    if (eFlatType == wkbLineString)
+    {
+        return IntersectsLineString(data, size, eByteOrder, nDim, iOffsetInOut,
+                                    bErrorOut);
+    }
+
+    if (eFlatType == wkbPolygon || eFlatType == wkbTriangle)
+    {
+        return IntersectsPolygon(data, size, eByteOrder, nDim, iOffsetInOut,
+                                 bErrorOut);
+    }
+
+    if (eFlatType == wkbMultiPoint || eFlatType == wkbMultiLineString ||
+        eFlatType == wkbMultiPolygon || eFlatType == wkbGeometryCollection ||
+        eFlatType == wkbPolyhedralSurface || eFlatType == wkbTIN)
+    {
+        if (nRec == 128)
+        {
+            bErrorOut = true;
+            return false;
+        }
+        const uint32_t nParts =
+            OGRWKBReadUInt32AtOffset(data, eByteOrder, iOffsetInOut);
+        if (nParts > (size - iOffsetInOut) / MIN_WKB_SIZE)
+        {
+            bErrorOut = true;
+            return false;
+        }
+        for (uint32_t k = 0; k < nParts; k++)
+        {
+            if (Intersects(data, size, iOffsetInOut, nRec + 1, bErrorOut))
+                return true;
+            else if (bErrorOut)
+                return false;
+        }
+        return false;
+    }
+
+    // Curve geometries are not handled
+    bErrorOut = true;
+    return false;
+}
+
+/************************************************************************/
+/*                OGRWKBPreparedPolygon::Intersects()                   */
+/************************************************************************/
+
+bool OGRWKBPreparedPolygon::Intersects(const GByte *pabyWkb, size_t nWKBSize,
+                                       bool &bErrorOut) const
+{
+    // Deferred until now, as the filter may be replaced, or all features
+    // rejected on their envelope, before an exact test is needed.
+    std::call_once(
+        m_oIndexBuiltFlag,
+        [this]() { const_cast<OGRWKBPreparedPolygon *>(this)->BuildIndex(); });
+
+    size_t iOffsetInOut = 0;
+    bErrorOut = false;
+    return Intersects(pabyWkb, nWKBSize, iOffsetInOut, 0, bErrorOut);
+}
+
 /************************************************************************/
 /*                            epsilonEqual()                            */
 /************************************************************************/
@@ -18,6 +18,8 @@
 #include "cpl_port.h"
 #include "ogr_core.h"
 
+#include <memory>
+#include <mutex>
 #include <vector>
 
 bool CPL_DLL OGRWKBGetGeomType(const GByte *pabyWkb, size_t nWKBSize,
@@ -90,6 +92,111 @@ bool CPL_DLL OGRWKBTransform(GByte *pabyWkb, size_t nWKBSize,
                              OGRWKBTransformCache &oCache,
                              OGREnvelope3D &sEnvelope);
 
+/************************************************************************/
+/*                       OGRWKBPreparedPolygon                          */
+/************************************************************************/
+
+class OGRGeometry;
+
+/** Polygonal filter geometry prepared to test exactly whether WKB geometries
+ * intersect it, without instantiating OGRGeometry objects.
+ *
+ * The edges of the filter geometry are indexed by horizontal bands, so that
+ * point-in-polygon and segment intersection tests only visit the edges
+ * whose vertical extent is relevant. The index is built on the first call to
+ * Intersects(), in a thread-safe way.
+ *
+ * @since GDAL 3.12
+ */
+class CPL_DLL OGRWKBPreparedPolygon
+{
+  public:
+    /** Create a prepared geometry from a Polygon or a MultiPolygon.
+     *
+     * Returns nullptr for other geometry types (including curve polygons),
+     * empty geometries or geometries with non-finite coordinates.
+     */
+    static std::unique_ptr<OGRWKBPreparedPolygon>
+    Create(const OGRGeometry *poGeom);
+
+    /** Return whether the WKB geometry intersects the prepared geometry.
+     *
+     * Boundaries are taken into account, consistently with
+     * OGRGeometry::Intersects(). Only the X and Y coordinates are considered.
+     *
+     * Computations are exact, using adaptive precision arithmetic for
+     * nearly degenerate configurations.
+     *
+     * bErrorOut is set to true, and false is returned, when the WKB geometry
+     * is corrupted, when it contains curve geometries, or non-finite
+     * coordinates, or coordinates so large that computations overflow.
+     * The caller should then use another method, such as GEOS.
+     */
+    bool Intersects(const GByte *pabyWkb, size_t nWKBSize,
+                    bool &bErrorOut) const;
+
+    /** Return the envelope of the prepared geometry. */
+    const OGREnvelope &GetEnvelope() const
+    {
+        return m_sEnvelope;
+    }
+
+  private:
+    struct Edge
+    {
+        double dfX1;
+        double dfY1;
+        double dfX2;
+        double dfY2;
+    };
+
+    struct Part
+    {
+        // First vertex of the exterior ring
+        double dfX;
+        double dfY;
+    };
+
+    std::vector<Edge> m_asEdges{};
+    std::vector<Part> m_asParts{};
+
+    // Edges are indexed by horizontal bands: the indices of the edges
+    // overlapping band i are in
+    // m_anBandEdges[m_anBandStart[i] .. m_anBandStart[i+1]-1]
+    std::vector<size_t> m_anBandStart{};
+    std::vector<uint32_t> m_anBandEdges{};
+    int m_nBands = 0;
+    double m_dfInvBandHeight = 0;
+    mutable std::once_flag m_oIndexBuiltFlag{};
+
+    OGREnvelope m_sEnvelope{};
+
+    OGRWKBPreparedPolygon() = default;
+
+    void BuildIndex();
+
+    inline int GetBand(double dfY) const;
+
+    int LocatePoint(double dfX, double dfY) const;
+
+    int IntersectsSegment(double dfX1, double dfY1, double dfX2,
+                          double dfY2) const;
+
+    bool IntersectsLineString(const GByte *data, size_t size,
+                              OGRwkbByteOrder eByteOrder, int nDim,
+                              size_t &iOffsetInOut, bool &bErrorOut) const;
+
+    bool IntersectsPolygon(const GByte *data, size_t size,
+                           OGRwkbByteOrder eByteOrder, int nDim,
+                           size_t &iOffsetInOut, bool &bErrorOut) const;
+
+    bool Intersects(const GByte *data, size_t size, size_t &iOffsetInOut,
+                    int nRec, bool &bErrorOut) const;
+
+    OGRWKBPreparedPolygon(const OGRWKBPreparedPolygon &) = delete;
+    OGRWKBPreparedPolygon &operator=(const OGRWKBPreparedPolygon &) = delete;
+};
+
 /************************************************************************/
 /*                       OGRAppendBuffer                                */
 /************************************************************************/
@@ -28,6 +28,7 @@
 #include <limits>
 #include <map>
 #include <new>
+#include <utility>
 #include <vector>
 
 #include "cpl_conv.h"
@@ -363,6 +364,33 @@ void OGRFeature::Reset()
     }
 }
 
+/************************************************************************/
+/*                                Swap()                                */
+/************************************************************************/
+
+/** Exchange the content of this feature with the one of another feature.
+ *
+ * This includes the feature definition, the FID, field values, geometries,
+ * style string and native data. No memory allocation is done, which makes
+ * it possible to move the content of a newly created feature into a
+ * recycled OGRFeature instance.
+ *
+ * @param oOther other feature.
+ * @since GDAL 3.12
+ */
+void OGRFeature::Swap(OGRFeature &oOther)
+{
+    std::swap(nFID, oOther.nFID);
+    std::swap(poDefn, oOther.poDefn);
+    std::swap(papoGeometries, oOther.papoGeometries);
+    std::swap(pauFields, oOther.pauFields);
+    std::swap(m_pszNativeData, oOther.m_pszNativeData);
+    std::swap(m_pszNativeMediaType, oOther.m_pszNativeMediaType);
+    std::swap(m_pszStyleString, oOther.m_pszStyleString);
+    std::swap(m_poStyleTable, oOther.m_poStyleTable);
+    std::swap(m_pszTmpFieldValue, oOther.m_pszTmpFieldValue);
+}
+
 /************************************************************************/
 /*                        SetFDefnUnsafe()                              */
 /************************************************************************/
@@ -4199,6 +4227,26 @@ void OGR_F_SetFieldDouble(OGRFeatureH hFeat, int iField, double dfValue)
     OGRFeature::FromHandle(hFeat)->SetField(iField, dfValue);
 }
 
+/************************************************************************/
+/*                         RecycleStringField()                         */
+/************************************************************************/
+
+// Copy pszValue into the already allocated string of a set field, if that
+// allocation is large enough, to save a free()/malloc() pair when features
+// are recycled (see OGRLayer::GetNextFeatureInto()).
+// This is best-effort: the allocated size is not stored, so the length of
+// the current value is used as a lower bound of it. After a short value has
+// been set, a longer one thus causes a new allocation, even if the buffer
+// was initially large enough for it.
+static bool RecycleStringField(OGRField &sField, const char *pszValue)
+{
+    const size_t nLen = strlen(pszValue);
+    if (strlen(sField.String) < nLen)
+        return false;
+    memmove(sField.String, pszValue, nLen + 1);
+    return true;
+}
+
 /************************************************************************/
 /*                              SetField()                              */
 /************************************************************************/
@@ -4257,10 +4305,16 @@ void OGRFeature::SetField(int iField, const char *pszValue)
     OGRFieldType eType = poFDefn->GetType();
     if (eType == OFTString)
     {
+        if (pszValue == nullptr)
+            pszValue = "";
         if (IsFieldSetAndNotNullUnsafe(iField))
+        {
+            if (RecycleStringField(pauFields[iField], pszValue))
+                return;
             CPLFree(pauFields[iField].String);
+        }
 
-        pauFields[iField].String = VSI_STRDUP_VERBOSE(pszValue ? pszValue : "");
+        pauFields[iField].String = VSI_STRDUP_VERBOSE(pszValue);
         if (pauFields[iField].String == nullptr)
         {
             OGR_RawField_SetUnset(&pauFields[iField]);
@@ -5469,7 +5523,16 @@ bool OGRFeature::SetFieldInternal(int iField, const OGRField *puValue)
     else if (poFDefn->GetType() == OFTString)
     {
         if (IsFieldSetAndNotNullUnsafe(iField))
+        {
+            if (puValue->String != nullptr &&
+                !OGR_RawField_IsUnset(puValue) &&
+                !OGR_RawField_IsNull(puValue) &&
+                RecycleStringField(pauFields[iField], puValue->String))
+            {
+                return true;
+            }
             CPLFree(pauFields[iField].String);
+        }
 
         if (puValue->String == nullptr)
             pauFields[iField].String = nullptr;
@@ -6549,13 +6612,17 @@ OGRErr OGRFeature::SetFieldsFrom(const OGRFeature *poSrcFeature,
             }
             if (eSrcType == OFTString)
             {
+                const char *pszSrcValue =
+                    poSrcFeature->GetFieldAsStringUnsafe(iField);
                 if (IsFieldSetAndNotNullUnsafe(iDstField))
+                {
+                    if (RecycleStringField(pauFields[iDstField], pszSrcValue))
+                        continue;
                     CPLFree(pauFields[iDstField].String);
+                }
 
-                SetFieldSameTypeUnsafe(
-                    iDstField,
-                    VSI_STRDUP_VERBOSE(
-                        poSrcFeature->GetFieldAsStringUnsafe(iField)));
+                SetFieldSameTypeUnsafe(iDstField,
+                                       VSI_STRDUP_VERBOSE(pszSrcValue));
                 continue;
             }
         }
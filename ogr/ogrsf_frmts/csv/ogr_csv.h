@@ -17,6 +17,7 @@
 #include "ogrsf_frmts.h"
 
 #include <set>
+#include <vector>
 
 typedef enum
 {
@@ -81,7 +82,12 @@ class OGRCSVLayer final : public IOGRCSVLayer, public OGRLayer
 
     bool bHasFieldNames = false;
 
-    OGRFeature *GetNextUnfilteredFeature();
+    OGRFeature *
+    GetNextUnfilteredFeature(OGRFeature *poFeatureToReuse = nullptr);
+
+    // Whether each field has been set by the record being read into a
+    // recycled feature.
+    std::vector<bool> m_abFieldSetInRecord{};
 
     bool bNew = false;
     bool bInWriteMode = false;
@@ -214,6 +220,7 @@ class OGRCSVLayer final : public IOGRCSVLayer, public OGRLayer
 
     void ResetReading() override;
     OGRFeature *GetNextFeature() override;
+    bool GetNextFeatureInto(OGRFeature &oFeature) override;
     virtual OGRFeature *GetFeature(GIntBig nFID) override;
 
     OGRFeatureDefn *GetLayerDefn() override
@@ -1328,9 +1328,13 @@ OGRFeature *OGRCSVLayer::GetFeature(GIntBig nFID)
 
 /************************************************************************/
 /*                      GetNextUnfilteredFeature()                      */
+/*                                                                      */
+/*      If poFeatureToReuse is not null, it is filled and returned,     */
+/*      instead of a new feature.                                       */
 /************************************************************************/
 
-OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
+OGRFeature *
+OGRCSVLayer::GetNextUnfilteredFeature(OGRFeature *poFeatureToReuse)
 
 {
     if (fpCSV == nullptr)
@@ -1341,8 +1345,46 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
     if (papszTokens == nullptr)
         return nullptr;
 
-    // Create the OGR feature.
-    OGRFeature *poFeature = new OGRFeature(poFeatureDefn);
+    // Create the OGR feature, or recycle the provided one. In the latter
+    // case, string fields are not unset beforehand, so that SetField() can
+    // reuse their buffers. The ones that the record does not set are unset
+    // after it has been read.
+    OGRFeature *poFeature = poFeatureToReuse;
+    const bool bRecycleStrings = poFeature != nullptr && !bIsEurostatTSV;
+    if (poFeature == nullptr)
+    {
+        poFeature = new OGRFeature(poFeatureDefn);
+    }
+    else if (!bRecycleStrings)
+    {
+        poFeature->Reset();
+    }
+    else
+    {
+        const int nFieldCount = poFeatureDefn->GetFieldCount();
+        m_abFieldSetInRecord.assign(nFieldCount, false);
+        poFeature->SetFID(OGRNullFID);
+        for (int i = 0; i < nFieldCount; i++)
+        {
+            if (poFeatureDefn->GetFieldDefn(i)->GetType() != OFTString)
+                poFeature->UnsetField(i);
+        }
+        for (int i = 0; i < poFeatureDefn->GetGeomFieldCount(); i++)
+            poFeature->SetGeomFieldDirectly(i, nullptr);
+        poFeature->SetStyleString(nullptr);
+        poFeature->SetNativeData(nullptr);
+        poFeature->SetNativeMediaType(nullptr);
+    }
+    const auto SetStringField =
+        [this, poFeature, bRecycleStrings](int iField, const char *pszValue)
+    {
+        if (pszValue)
+            poFeature->SetField(iField, pszValue);
+        else
+            poFeature->SetFieldNull(iField);
+        if (bRecycleStrings)
+            m_abFieldSetInRecord[iField] = true;
+    };
 
     // Set attributes for any indicated attribute records.
     int iOGRField = 0;
@@ -1581,11 +1623,11 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
         {
             if (bEmptyStringNull && papszTokens[iAttr][0] == '\0')
             {
-                poFeature->SetFieldNull(iOGRField);
+                SetStringField(iOGRField, nullptr);
             }
             else
             {
-                poFeature->SetField(iOGRField, papszTokens[iAttr]);
+                SetStringField(iOGRField, papszTokens[iAttr]);
                 if (!bWarningBadTypeOrWidth && poFieldDefn->GetWidth() > 0 &&
                     static_cast<int>(strlen(papszTokens[iAttr])) >
                         poFieldDefn->GetWidth())
@@ -1601,13 +1643,25 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
             if (papszTokens[iAttr][0] != '\0' &&
                 !poFeatureDefn->GetFieldDefn(iOGRField)->IsIgnored())
             {
-                poFeature->SetField(iOGRField, papszTokens[iAttr]);
+                SetStringField(iOGRField, papszTokens[iAttr]);
             }
         }
 
         iOGRField++;
     }
 
+    if (bRecycleStrings)
+    {
+        for (int i = 0; i < static_cast<int>(m_abFieldSetInRecord.size()); i++)
+        {
+            if (!m_abFieldSetInRecord[i] &&
+                poFeatureDefn->GetFieldDefn(i)->GetType() == OFTString)
+            {
+                poFeature->UnsetField(i);
+            }
+        }
+    }
+
     // Eurostat TSV files.
 
     for (int iAttr = 0; bIsEurostatTSV && iAttr < nAttrCount; iAttr++)
@@ -1758,6 +1812,31 @@ OGRFeature *OGRCSVLayer::GetNextFeature()
     }
 }
 
+/************************************************************************/
+/*                         GetNextFeatureInto()                         */
+/************************************************************************/
+
+bool OGRCSVLayer::GetNextFeatureInto(OGRFeature &oFeature)
+
+{
+    if (oFeature.GetDefnRef() != poFeatureDefn)
+        return OGRLayer::GetNextFeatureInto(oFeature);
+
+    if (bNeedRewindBeforeRead)
+        ResetReading();
+
+    while (true)
+    {
+        if (!GetNextUnfilteredFeature(&oFeature))
+            return false;
+
+        if ((m_poFilterGeom == nullptr ||
+             FilterGeometry(oFeature.GetGeomFieldRef(m_iGeomFieldFilter))) &&
+            (m_poAttrQuery == nullptr || m_poAttrQuery->Evaluate(&oFeature)))
+            return true;
+    }
+}
+
 /************************************************************************/
 /*                           TestCapability()                           */
 /************************************************************************/
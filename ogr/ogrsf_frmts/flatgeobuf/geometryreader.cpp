@@ -505,3 +505,211 @@ OGRGeometry *GeometryReader::read()
     }
     return nullptr;
 }
+
+/************************************************************************/
+/*                         ISO WKB decoding                             */
+/************************************************************************/
+
+static void AppendUInt32(uint32_t nVal, std::vector<GByte> &wkb)
+{
+    CPL_LSBPTR32(&nVal);
+    const GByte *pabyVal = reinterpret_cast<const GByte *>(&nVal);
+    wkb.insert(wkb.end(), pabyVal, pabyVal + sizeof(nVal));
+}
+
+void GeometryReader::appendWkbHeader(OGRwkbGeometryType eType,
+                                     std::vector<GByte> &wkb) const
+{
+    wkb.push_back(static_cast<GByte>(wkbNDR));
+    uint32_t nType = static_cast<uint32_t>(eType);
+    if (m_hasZ)
+        nType += 1000;
+    if (m_hasM)
+        nType += 2000;
+    AppendUInt32(nType, wkb);
+}
+
+// Appends the coordinates of points [offset, offset + length[ of a
+// non-nested geometry. FlatGeobuf coordinates and NDR WKB are both
+// little-endian, so values are copied as raw bytes on all hosts.
+bool GeometryReader::appendWkbPoints(const FlatGeobuf::Geometry *geometry,
+                                     uint32_t offset, uint32_t length,
+                                     std::vector<GByte> &wkb) const
+{
+    const auto pXy = geometry->xy();
+    if (pXy == nullptr || length == 0 ||
+        pXy->size() >= feature_max_buffer_size / sizeof(OGRRawPoint))
+        return false;
+    const uint64_t end = static_cast<uint64_t>(offset) + length;
+    if (end > pXy->size() / 2)
+        return false;
+    const GByte *pabyZ = nullptr;
+    if (m_hasZ)
+    {
+        const auto pZ = geometry->z();
+        if (pZ == nullptr || end > pZ->size())
+            return false;
+        pabyZ = reinterpret_cast<const GByte *>(pZ->data() + offset);
+    }
+    const GByte *pabyM = nullptr;
+    if (m_hasM)
+    {
+        const auto pM = geometry->m();
+        if (pM == nullptr || end > pM->size())
+            return false;
+        pabyM = reinterpret_cast<const GByte *>(pM->data() + offset);
+    }
+
+    const GByte *pabyXY = reinterpret_cast<const GByte *>(pXy->data()) +
+                          static_cast<size_t>(offset) * sizeof(OGRRawPoint);
+    const size_t nDims = 2 + (m_hasZ ? 1 : 0) + (m_hasM ? 1 : 0);
+    const size_t nStart = wkb.size();
+    wkb.resize(nStart + static_cast<size_t>(length) * nDims * sizeof(double));
+    GByte *pabyOut = wkb.data() + nStart;
+    if (nDims == 2)
+    {
+        memcpy(pabyOut, pabyXY, static_cast<size_t>(length) * 2 * 8);
+        return true;
+    }
+    for (uint32_t i = 0; i < length; i++)
+    {
+        memcpy(pabyOut, pabyXY + static_cast<size_t>(i) * 16, 16);
+        pabyOut += 16;
+        if (pabyZ)
+        {
+            memcpy(pabyOut, pabyZ + static_cast<size_t>(i) * 8, 8);
+            pabyOut += 8;
+        }
+        if (pabyM)
+        {
+            memcpy(pabyOut, pabyM + static_cast<size_t>(i) * 8, 8);
+            pabyOut += 8;
+        }
+    }
+    return true;
+}
+
+bool GeometryReader::appendWkbPolygon(const FlatGeobuf::Geometry *geometry,
+                                      std::vector<GByte> &wkb) const
+{
+    const auto pXy = geometry->xy();
+    if (pXy == nullptr)
+        return false;
+    appendWkbHeader(wkbPolygon, wkb);
+    const auto ends = geometry->ends();
+    if (ends == nullptr || ends->size() < 2)
+    {
+        const uint32_t length = pXy->size() / 2;
+        AppendUInt32(1, wkb);
+        AppendUInt32(length, wkb);
+        return appendWkbPoints(geometry, 0, length, wkb);
+    }
+    AppendUInt32(ends->size(), wkb);
+    uint32_t offset = 0;
+    for (uint32_t i = 0; i < ends->size(); i++)
+    {
+        const auto e = ends->Get(i);
+        if (e <= offset)
+            return false;
+        AppendUInt32(e - offset, wkb);
+        if (!appendWkbPoints(geometry, offset, e - offset, wkb))
+            return false;
+        offset = e;
+    }
+    return true;
+}
+
+bool GeometryReader::readWkb(std::vector<GByte> &wkb) const
+{
+    wkb.clear();
+    // Empty geometries are left to read(), as the dimension flags of their
+    // OGRGeometry counterparts do not only depend on m_hasZ / m_hasM.
+    switch (m_geometryType)
+    {
+        case GeometryType::Point:
+            appendWkbHeader(wkbPoint, wkb);
+            return appendWkbPoints(m_geometry, 0, 1, wkb);
+
+        case GeometryType::MultiPoint:
+        {
+            const auto pXy = m_geometry->xy();
+            if (pXy == nullptr || pXy->size() < 2)
+                return false;
+            const uint32_t length = pXy->size() / 2;
+            appendWkbHeader(wkbMultiPoint, wkb);
+            AppendUInt32(length, wkb);
+            for (uint32_t i = 0; i < length; i++)
+            {
+                appendWkbHeader(wkbPoint, wkb);
+                if (!appendWkbPoints(m_geometry, i, 1, wkb))
+                    return false;
+            }
+            return true;
+        }
+
+        case GeometryType::LineString:
+        {
+            const auto pXy = m_geometry->xy();
+            if (pXy == nullptr)
+                return false;
+            const uint32_t length = pXy->size() / 2;
+            appendWkbHeader(wkbLineString, wkb);
+            AppendUInt32(length, wkb);
+            return appendWkbPoints(m_geometry, 0, length, wkb);
+        }
+
+        case GeometryType::MultiLineString:
+        {
+            const auto pXy = m_geometry->xy();
+            if (pXy == nullptr)
+                return false;
+            appendWkbHeader(wkbMultiLineString, wkb);
+            const auto ends = m_geometry->ends();
+            if (ends == nullptr || ends->size() < 2)
+            {
+                const uint32_t length = pXy->size() / 2;
+                AppendUInt32(1, wkb);
+                appendWkbHeader(wkbLineString, wkb);
+                AppendUInt32(length, wkb);
+                return appendWkbPoints(m_geometry, 0, length, wkb);
+            }
+            AppendUInt32(ends->size(), wkb);
+            uint32_t offset = 0;
+            for (uint32_t i = 0; i < ends->size(); i++)
+            {
+                const auto e = ends->Get(i);
+                if (e <= offset)
+                    return false;
+                appendWkbHeader(wkbLineString, wkb);
+                AppendUInt32(e - offset, wkb);
+                if (!appendWkbPoints(m_geometry, offset, e - offset, wkb))
+                    return false;
+                offset = e;
+            }
+            return true;
+        }
+
+        case GeometryType::Polygon:
+            return appendWkbPolygon(m_geometry, wkb);
+
+        case GeometryType::MultiPolygon:
+        {
+            const auto parts = m_geometry->parts();
+            if (parts == nullptr || parts->size() == 0)
+                return false;
+            appendWkbHeader(wkbMultiPolygon, wkb);
+            AppendUInt32(parts->size(), wkb);
+            for (uoffset_t i = 0; i < parts->size(); i++)
+            {
+                const auto part = parts->Get(i);
+                if (part == nullptr || !appendWkbPolygon(part, wkb))
+                    return false;
+            }
+            return true;
+        }
+
+        default:
+            break;
+    }
+    return false;
+}
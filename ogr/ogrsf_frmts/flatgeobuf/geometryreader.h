@@ -24,6 +24,8 @@
 
 #include "ogr_p.h"
 
+#include <vector>
+
 namespace ogr_flatgeobuf
 {
 
@@ -66,6 +68,14 @@ class GeometryReader
         return GeometryReader(part, geometryType, m_hasZ, m_hasM).read();
     }
 
+    bool appendWkbPoints(const FlatGeobuf::Geometry *geometry,
+                         uint32_t offset, uint32_t length,
+                         std::vector<GByte> &wkb) const;
+    bool appendWkbPolygon(const FlatGeobuf::Geometry *geometry,
+                          std::vector<GByte> &wkb) const;
+    void appendWkbHeader(OGRwkbGeometryType eType,
+                         std::vector<GByte> &wkb) const;
+
     template <class T> T *readSimpleCurve(const bool halfLength = false)
     {
         if (halfLength)
@@ -96,6 +106,12 @@ class GeometryReader
     }
 
     OGRGeometry *read();
+
+    // Decodes the geometry directly as ISO WKB (NDR), without instantiating
+    // an OGRGeometry. Only handles Point, LineString, Polygon and their Multi
+    // variants. Returns false for other types or inconsistent data, in which
+    // case read() must be used (and will report errors).
+    bool readWkb(std::vector<GByte> &wkb) const;
 };
 
 }  // namespace ogr_flatgeobuf
@@ -117,6 +117,7 @@ class OGRFlatGeobufLayer final : public OGRLayer,
     // shared
     GByte *m_featureBuf = nullptr;  // reusable/resizable feature data buffer
     uint32_t m_featureBufSize = 0;  // current feature buffer size
+    std::vector<GByte> m_abyArrowWKB{};  // reusable WKB buffer for Arrow
 
     // deserialize
     void ensurePadfBuffers(size_t count);
@@ -1604,20 +1604,40 @@ begin:
             auto geometryType = m_geometryType;
             if (geometryType == GeometryType::Unknown)
                 geometryType = geometry->type();
-            auto poOGRGeometry = std::unique_ptr<OGRGeometry>(
-                GeometryReader(geometry, geometryType, m_hasZ, m_hasM).read());
-            if (poOGRGeometry == nullptr)
+            GeometryReader oReader(geometry, geometryType, m_hasZ, m_hasM);
+            // Decode the common geometry types straight to WKB, and only
+            // go through an OGRGeometry for the other ones.
+            std::unique_ptr<OGRGeometry> poOGRGeometry;
+            if (oReader.readWkb(m_abyArrowWKB))
             {
-                CPLError(CE_Failure, CPLE_AppDefined,
-                         "Failed to read geometry");
-                goto error;
+                OGREnvelope sEnvelope;
+                if (m_poFilterGeom &&
+                    !FilterWKBGeometry(m_abyArrowWKB.data(),
+                                       m_abyArrowWKB.size(),
+                                       /* bEnvelopeAlreadySet = */ false,
+                                       sEnvelope))
+                {
+                    goto end_of_loop;
+                }
             }
+            else
+            {
+                poOGRGeometry.reset(oReader.read());
+                if (poOGRGeometry == nullptr)
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "Failed to read geometry");
+                    goto error;
+                }
 
-            if (!FilterGeometry(poOGRGeometry.get()))
-                goto end_of_loop;
+                if (!FilterGeometry(poOGRGeometry.get()))
+                    goto end_of_loop;
+            }
 
             const int iArrowField = sHelper.m_mapOGRGeomFieldToArrowField[0];
-            const size_t nWKBSize = poOGRGeometry->WkbSize();
+            const size_t nWKBSize = poOGRGeometry
+                                        ? poOGRGeometry->WkbSize()
+                                        : m_abyArrowWKB.size();
 
             if (iFeat > 0)
             {
@@ -1639,7 +1659,10 @@ begin:
                 errorErrno = ENOMEM;
                 goto error;
             }
-            poOGRGeometry->exportToWkb(wkbNDR, outPtr, wkbVariantIso);
+            if (poOGRGeometry)
+                poOGRGeometry->exportToWkb(wkbNDR, outPtr, wkbVariantIso);
+            else
+                memcpy(outPtr, m_abyArrowWKB.data(), nWKBSize);
         }
 
         abSetFields.clear();
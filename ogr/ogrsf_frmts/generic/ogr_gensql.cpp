@@ -19,10 +19,17 @@
 #include "ogr_recordbatch.h"
 #include "ogrlayerarrow.h"
 #include "cpl_time.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 #include <algorithm>
+#include <cmath>
+#include <deque>
+#include <future>
 #include <limits>
 #include <map>
+#include <queue>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 //! @cond Doxygen_Suppress
@@ -1472,6 +1479,402 @@ static CPLString GetFilterForJoin(swq_expr_node *poExpr, OGRFeature *poSrcFeat,
     return "";
 }
 
+/************************************************************************/
+/*                 OGRGenSQLResultsLayer::JoinHashTable                 */
+/************************************************************************/
+
+// Features of the secondary layer of a join, indexed by the value of their
+// join key, for joins whose condition is an equality between a field of the
+// primary table and a field of the secondary table. This replaces the
+// installation of an attribute filter on the secondary layer for each
+// primary feature, which is a full scan of the secondary layer when it has
+// no attribute index.
+// Features are stored serialized, in memory, and are moved to a temporary
+// file when their cumulated size exceeds OGR_SQL_JOIN_MAX_MEMORY.
+struct OGRGenSQLResultsLayer::JoinHashTable
+{
+    enum class KeyType
+    {
+        INTEGER,
+        REAL,
+        STRING
+    };
+
+    KeyType eKeyType = KeyType::STRING;
+    int iPrimaryField = -1;
+    int iSecondaryField = -1;
+    bool bBuilt = false;
+
+    // Key to (offset, size) of the serialized feature, in abyMemStorage, or
+    // in fpSpill if it is not null.
+    std::unordered_map<std::string, std::pair<vsi_l_offset, size_t>> oMap{};
+    std::vector<GByte> abyMemStorage{};
+    VSILFILE *fpSpill = nullptr;
+    vsi_l_offset nSpillSize = 0;
+    std::vector<GByte> abyBuffer{};
+
+    JoinHashTable() = default;
+
+    ~JoinHashTable()
+    {
+        if (fpSpill)
+            VSIFCloseL(fpSpill);
+    }
+
+    bool GetKey(const OGRFeature *poFeature, int iField,
+                std::string &osKey) const;
+    bool Build(OGRLayer *poJoinLayer);
+    std::unique_ptr<OGRFeature> Fetch(OGRLayer *poJoinLayer,
+                                      const OGRFeature *poSrcFeat);
+
+    CPL_DISALLOW_COPY_ASSIGN(JoinHashTable)
+};
+
+/************************************************************************/
+/*                               GetKey()                               */
+/************************************************************************/
+
+// Compute the hash key of a field, consistently with the semantics of
+// the OGR SQL = operator: numeric comparison of numbers and case-insensitive
+// comparison of strings. Returns false for null values, that never match.
+bool OGRGenSQLResultsLayer::JoinHashTable::GetKey(const OGRFeature *poFeature,
+                                                  int iField,
+                                                  std::string &osKey) const
+{
+    if (!poFeature->IsFieldSetAndNotNull(iField))
+        return false;
+    switch (eKeyType)
+    {
+        case KeyType::INTEGER:
+        {
+            const GIntBig nVal = poFeature->GetFieldAsInteger64(iField);
+            osKey.assign(reinterpret_cast<const char *>(&nVal), sizeof(nVal));
+            break;
+        }
+
+        case KeyType::REAL:
+        {
+            double dfVal = poFeature->GetFieldAsDouble(iField);
+            if (std::isnan(dfVal))
+                return false;
+            if (dfVal == 0)
+                dfVal = 0;  // -0 == 0
+            osKey.assign(reinterpret_cast<const char *>(&dfVal),
+                         sizeof(dfVal));
+            break;
+        }
+
+        case KeyType::STRING:
+        {
+            osKey = poFeature->GetFieldAsString(iField);
+            for (char &ch : osKey)
+            {
+                if (ch >= 'a' && ch <= 'z')
+                    ch = static_cast<char>(ch - 'a' + 'A');
+            }
+            break;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                               Build()                                */
+/************************************************************************/
+
+bool OGRGenSQLResultsLayer::JoinHashTable::Build(OGRLayer *poJoinLayer)
+{
+    bBuilt = true;
+
+    GIntBig nMaxMemory = 0;
+    const char *pszMaxMemory =
+        CPLGetConfigOption("OGR_SQL_JOIN_MAX_MEMORY", "10%");
+    bool bUnitSpecified = false;
+    if (CPLParseMemorySize(pszMaxMemory, &nMaxMemory, &bUnitSpecified) !=
+        CE_None)
+    {
+        return false;
+    }
+    if (!bUnitSpecified && nMaxMemory < 100000)
+        nMaxMemory *= 1024 * 1024;
+
+    poJoinLayer->SetAttributeFilter(nullptr);
+    poJoinLayer->ResetReading();
+
+    std::string osKey;
+    try
+    {
+        for (auto &&poFeature : *poJoinLayer)
+        {
+            // Only the first matching feature is used for the join
+            if (!GetKey(poFeature.get(), iSecondaryField, osKey) ||
+                cpl::contains(oMap, osKey))
+            {
+                continue;
+            }
+            if (!poFeature->SerializeToBinary(abyBuffer))
+                return false;
+
+            if (!fpSpill && static_cast<GIntBig>(abyMemStorage.size() +
+                                                 abyBuffer.size()) >
+                                nMaxMemory)
+            {
+                const std::string osTmpFilename =
+                    CPLGenerateTempFilenameSafe("ogr_sql_join");
+                fpSpill = VSIFOpenL(osTmpFilename.c_str(), "w+b");
+                if (!fpSpill)
+                {
+                    CPLError(CE_Failure, CPLE_FileIO, "Cannot create %s",
+                             osTmpFilename.c_str());
+                    return false;
+                }
+                // Unlink it now to avoid stale temporary file if killing
+                // the process (only works on Unix)
+                VSIUnlink(osTmpFilename.c_str());
+                CPLDebug("GenSQL",
+                         "Join on layer %s: moving features to temporary "
+                         "file %s",
+                         poJoinLayer->GetName(), osTmpFilename.c_str());
+                if (VSIFWriteL(abyMemStorage.data(), 1, abyMemStorage.size(),
+                               fpSpill) != abyMemStorage.size())
+                {
+                    CPLError(CE_Failure, CPLE_FileIO,
+                             "Cannot write into temporary file");
+                    return false;
+                }
+                nSpillSize = abyMemStorage.size();
+                abyMemStorage.clear();
+                abyMemStorage.shrink_to_fit();
+            }
+
+            if (fpSpill)
+            {
+                if (VSIFWriteL(abyBuffer.data(), 1, abyBuffer.size(),
+                               fpSpill) != abyBuffer.size())
+                {
+                    CPLError(CE_Failure, CPLE_FileIO,
+                             "Cannot write into temporary file");
+                    return false;
+                }
+                oMap[osKey] = std::make_pair(nSpillSize, abyBuffer.size());
+                nSpillSize += abyBuffer.size();
+            }
+            else
+            {
+                oMap[osKey] =
+                    std::make_pair(static_cast<vsi_l_offset>(
+                                       abyMemStorage.size()),
+                                   abyBuffer.size());
+                abyMemStorage.insert(abyMemStorage.end(), abyBuffer.begin(),
+                                     abyBuffer.end());
+            }
+        }
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory when building join hash table");
+        return false;
+    }
+
+    poJoinLayer->ResetReading();
+    return true;
+}
+
+/************************************************************************/
+/*                               Fetch()                                */
+/************************************************************************/
+
+std::unique_ptr<OGRFeature>
+OGRGenSQLResultsLayer::JoinHashTable::Fetch(OGRLayer *poJoinLayer,
+                                            const OGRFeature *poSrcFeat)
+{
+    std::string osKey;
+    if (!GetKey(poSrcFeat, iPrimaryField, osKey))
+        return nullptr;
+    const auto oIter = oMap.find(osKey);
+    if (oIter == oMap.end())
+        return nullptr;
+
+    const auto [nOffset, nSize] = oIter->second;
+    const GByte *pabyData;
+    if (fpSpill)
+    {
+        abyBuffer.resize(nSize);
+        if (VSIFSeekL(fpSpill, nOffset, SEEK_SET) != 0 ||
+            VSIFReadL(abyBuffer.data(), 1, nSize, fpSpill) != nSize)
+        {
+            CPLError(CE_Failure, CPLE_FileIO,
+                     "Cannot read from temporary file");
+            return nullptr;
+        }
+        pabyData = abyBuffer.data();
+    }
+    else
+    {
+        pabyData = abyMemStorage.data() + static_cast<size_t>(nOffset);
+    }
+
+    auto poFeature = std::make_unique<OGRFeature>(poJoinLayer->GetLayerDefn());
+    if (!poFeature->DeserializeFromBinary(pabyData, nSize))
+        return nullptr;
+    return poFeature;
+}
+
+/************************************************************************/
+/*                         InitJoinHashTables()                         */
+/************************************************************************/
+
+// Determine the joins that can be evaluated with a hash table, that is
+// those whose condition is "primary_field = secondary_field", with fields of
+// compatible types, and whose secondary layer evaluates attribute filters
+// through OGR SQL without an index. Layers that translate attribute filters
+// natively may use other comparison semantics (e.g. case-sensitive string
+// comparisons) and indexes that the per-feature filter benefits from.
+void OGRGenSQLResultsLayer::InitJoinHashTables()
+{
+    m_bJoinHashTablesInitialized = true;
+
+    swq_select *psSelectInfo = m_pSelectInfo.get();
+    m_apoJoinHashTables.resize(psSelectInfo->join_count);
+    if (!CPLTestBool(CPLGetConfigOption("OGR_SQL_HASH_JOIN", "YES")))
+        return;
+
+    const auto GetKeyType = [](OGRFieldType eType,
+                               JoinHashTable::KeyType &eKeyType)
+    {
+        switch (eType)
+        {
+            case OFTInteger:
+            case OFTInteger64:
+                eKeyType = JoinHashTable::KeyType::INTEGER;
+                return true;
+            case OFTReal:
+                eKeyType = JoinHashTable::KeyType::REAL;
+                return true;
+            case OFTString:
+                eKeyType = JoinHashTable::KeyType::STRING;
+                return true;
+            default:
+                break;
+        }
+        return false;
+    };
+
+    const auto poSrcFDefn = m_poSrcLayer->GetLayerDefn();
+    for (int iJoin = 0; iJoin < psSelectInfo->join_count; iJoin++)
+    {
+        const swq_join_def *psJoinInfo = psSelectInfo->join_defs + iJoin;
+        const swq_expr_node *poExpr = psJoinInfo->poExpr;
+        OGRLayer *poJoinLayer = m_apoTableLayers[psJoinInfo->secondary_table];
+        // Reading the whole secondary layer while the primary one is being
+        // iterated is not possible for a self join.
+        if (poJoinLayer == m_poSrcLayer || poExpr->eNodeType != SNT_OPERATION ||
+            poExpr->nOperation != SWQ_EQ || poExpr->nSubExprCount != 2 ||
+            poExpr->papoSubExpr[0]->eNodeType != SNT_COLUMN ||
+            poExpr->papoSubExpr[1]->eNodeType != SNT_COLUMN)
+        {
+            continue;
+        }
+        const swq_expr_node *poPrimary = poExpr->papoSubExpr[0];
+        const swq_expr_node *poSecondary = poExpr->papoSubExpr[1];
+        if (poPrimary->table_index != 0)
+            std::swap(poPrimary, poSecondary);
+        if (poPrimary->table_index != 0 ||
+            poSecondary->table_index != psJoinInfo->secondary_table)
+        {
+            continue;
+        }
+
+        const auto poJoinFDefn = poJoinLayer->GetLayerDefn();
+        JoinHashTable::KeyType eSecondaryKeyType;
+        if (poSecondary->field_index < 0 ||
+            poSecondary->field_index >= poJoinFDefn->GetFieldCount() ||
+            !GetKeyType(
+                poJoinFDefn->GetFieldDefn(poSecondary->field_index)->GetType(),
+                eSecondaryKeyType))
+        {
+            continue;
+        }
+
+        JoinHashTable::KeyType ePrimaryKeyType;
+        if (poPrimary->field_index < 0)
+            continue;
+        if (poPrimary->field_index < poSrcFDefn->GetFieldCount())
+        {
+            if (!GetKeyType(
+                    poSrcFDefn->GetFieldDefn(poPrimary->field_index)->GetType(),
+                    ePrimaryKeyType))
+            {
+                continue;
+            }
+        }
+        else if (poPrimary->field_index <
+                 poSrcFDefn->GetFieldCount() + SPECIAL_FIELD_COUNT)
+        {
+            switch (SpecialFieldTypes[poPrimary->field_index -
+                                      poSrcFDefn->GetFieldCount()])
+            {
+                case SWQ_INTEGER:
+                case SWQ_INTEGER64:
+                    ePrimaryKeyType = JoinHashTable::KeyType::INTEGER;
+                    break;
+                case SWQ_FLOAT:
+                    ePrimaryKeyType = JoinHashTable::KeyType::REAL;
+                    break;
+                default:
+                    ePrimaryKeyType = JoinHashTable::KeyType::STRING;
+                    break;
+            }
+        }
+        else
+        {
+            continue;
+        }
+
+        // Numbers compared to strings follow conversion rules that are not
+        // worth replicating
+        auto poHashTable = std::make_unique<JoinHashTable>();
+        if (ePrimaryKeyType == eSecondaryKeyType)
+            poHashTable->eKeyType = ePrimaryKeyType;
+        else if (ePrimaryKeyType != JoinHashTable::KeyType::STRING &&
+                 eSecondaryKeyType != JoinHashTable::KeyType::STRING)
+            poHashTable->eKeyType = JoinHashTable::KeyType::REAL;
+        else
+            continue;
+        poHashTable->iPrimaryField = poPrimary->field_index;
+        poHashTable->iSecondaryField = poSecondary->field_index;
+
+        // Probe how the secondary layer evaluates the filters that are
+        // installed on it when not using a hash table.
+        std::string osProbeFilter = "\"";
+        osProbeFilter +=
+            poJoinFDefn->GetFieldDefn(poSecondary->field_index)->GetNameRef();
+        osProbeFilter += eSecondaryKeyType == JoinHashTable::KeyType::STRING
+                             ? "\" = ''"
+                             : "\" = 0";
+        bool bUseHashTable = false;
+        {
+            CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+            if (poJoinLayer->SetAttributeFilter(osProbeFilter.c_str()) ==
+                OGRERR_NONE)
+            {
+                bUseHashTable =
+                    poJoinLayer->m_poAttrQuery != nullptr &&
+                    !poJoinLayer->m_poAttrQuery->CanUseIndex(poJoinLayer) &&
+                    !poJoinLayer->TestCapability(OLCFastFeatureCount);
+            }
+            poJoinLayer->SetAttributeFilter(nullptr);
+        }
+        if (!bUseHashTable)
+            continue;
+
+        CPLDebug("GenSQL", "Using hash table for join on layer %s",
+                 poJoinLayer->GetName());
+        m_apoJoinHashTables[iJoin] = std::move(poHashTable);
+    }
+}
+
 /************************************************************************/
 /*                          TranslateFeature()                          */
 /************************************************************************/
@@ -1505,6 +1908,24 @@ std::unique_ptr<OGRFeature> OGRGenSQLResultsLayer::TranslateFeature(
 
         OGRLayer *poJoinLayer = m_apoTableLayers[psJoinInfo->secondary_table];
 
+        if (!m_bJoinHashTablesInitialized)
+            InitJoinHashTables();
+        auto &poHashTable = m_apoJoinHashTables[iJoin];
+        if (poHashTable && !poHashTable->bBuilt &&
+            !poHashTable->Build(poJoinLayer))
+        {
+            CPLDebug("GenSQL",
+                     "Cannot build hash table for join on layer %s. "
+                     "Using attribute filters instead",
+                     poJoinLayer->GetName());
+            poHashTable.reset();
+        }
+        if (poHashTable)
+        {
+            apoFeatures.push_back(poHashTable->Fetch(poJoinLayer, poSrcFeat));
+            continue;
+        }
+
         const std::string osFilter =
             GetFilterForJoin(psJoinInfo->poExpr, poSrcFeat, poJoinLayer,
                              psJoinInfo->secondary_table);
@@ -1982,24 +2403,26 @@ OGRFeature *OGRGenSQLResultsLayer::GetFeature(GIntBig nFID)
         {
             if (m_aosDistinctList.empty())
             {
-                std::set<CPLString, swq_summary::Comparator>::const_iterator
-                    oIter = oSummary.oSetDistinctValues.begin();
-                std::set<CPLString, swq_summary::Comparator>::const_iterator
-                    oEnd = oSummary.oSetDistinctValues.end();
+                // Distinct values have been collected with a hash set, in
+                // their order of appearance: sort them once.
+                oSummary.oSetDistinctValues.clear();
+                std::sort(oSummary.oVectorDistinctValues.begin(),
+                          oSummary.oVectorDistinctValues.end(),
+                          oSummary.oComparator);
                 try
                 {
                     m_aosDistinctList.reserve(
-                        oSummary.oSetDistinctValues.size());
-                    for (; oIter != oEnd; ++oIter)
+                        oSummary.oVectorDistinctValues.size());
+                    for (const auto &osVal : oSummary.oVectorDistinctValues)
                     {
-                        m_aosDistinctList.push_back(*oIter);
+                        m_aosDistinctList.push_back(osVal);
                     }
                 }
                 catch (std::bad_alloc &)
                 {
                     return nullptr;
                 }
-                oSummary.oSetDistinctValues.clear();
+                oSummary.oVectorDistinctValues.clear();
             }
 
             if (nFID < 0 ||
@@ -2181,6 +2604,357 @@ void OGRGenSQLResultsLayer::ReadIndexFields(OGRFeature *poSrcFeat,
     }
 }
 
+/************************************************************************/
+/*                           OGRGenSQLSortRun                           */
+/************************************************************************/
+
+// Run of the external merge sort done by CreateOrderByIndex() when the sort
+// keys do not fit in OGR_SQL_SORT_MAX_MEMORY: sort keys and FIDs of
+// consecutive source features, that are sorted and written to a temporary
+// file by a worker thread, and then read back during the merges.
+struct OGRGenSQLSortRun
+{
+    // Before the run is written
+    std::vector<OGRField> asIndexFields{};
+    std::vector<GIntBig> anFIDList{};
+    // Sequence number of the first feature of the run in the source layer
+    GIntBig nFirstSeq = 0;
+    size_t nSize = 0;
+    // 0 for runs written from source features, N + 1 for runs resulting
+    // from the merge of runs of level N.
+    int nLevel = 0;
+
+    std::string osFilename{};
+    VSILFILE *fp = nullptr;
+
+    // During the merge: current record
+    size_t nRemaining = 0;
+    std::vector<OGRField> asCurFields{};
+    std::vector<std::string> aosCurStrings{};
+    GIntBig nCurFID = 0;
+    GIntBig nCurSeq = 0;
+
+    OGRGenSQLSortRun() = default;
+
+    ~OGRGenSQLSortRun()
+    {
+        if (fp)
+        {
+            VSIFCloseL(fp);
+            VSIUnlink(osFilename.c_str());
+        }
+    }
+
+    bool ReadRecord(const std::vector<bool> &abStringKey);
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRGenSQLSortRun)
+};
+
+/************************************************************************/
+/*                     OGRGenSQLSortRun::ReadRecord()                   */
+/************************************************************************/
+
+// Records are made, for each sort key, of its raw OGRField, followed, for
+// non-null strings, by their length and content, and then by the FID and
+// the sequence number of the feature.
+bool OGRGenSQLSortRun::ReadRecord(const std::vector<bool> &abStringKey)
+{
+    CPLAssert(nRemaining > 0);
+    --nRemaining;
+
+    const size_t nOrderItems = abStringKey.size();
+    asCurFields.resize(nOrderItems);
+    aosCurStrings.resize(nOrderItems);
+    bool bOK = VSIFReadL(asCurFields.data(), sizeof(OGRField), nOrderItems,
+                         fp) == nOrderItems;
+    for (size_t iKey = 0; bOK && iKey < nOrderItems; ++iKey)
+    {
+        OGRField &sField = asCurFields[iKey];
+        if (abStringKey[iKey] && !OGR_RawField_IsUnset(&sField) &&
+            !OGR_RawField_IsNull(&sField))
+        {
+            uint32_t nLen = 0;
+            bOK = VSIFReadL(&nLen, sizeof(nLen), 1, fp) == 1;
+            if (bOK)
+            {
+                aosCurStrings[iKey].resize(nLen);
+                bOK = VSIFReadL(aosCurStrings[iKey].data(), 1, nLen, fp) ==
+                      nLen;
+                sField.String = aosCurStrings[iKey].data();
+            }
+        }
+    }
+    bOK = bOK && VSIFReadL(&nCurFID, sizeof(nCurFID), 1, fp) == 1 &&
+          VSIFReadL(&nCurSeq, sizeof(nCurSeq), 1, fp) == 1;
+    if (!bOK)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot read from temporary file %s",
+                 osFilename.c_str());
+    }
+    return bOK;
+}
+
+/************************************************************************/
+/*                          WriteSortRecord()                           */
+/*                                                                      */
+/*      Write a record of a run of the external merge sort, in the      */
+/*      format read by OGRGenSQLSortRun::ReadRecord().                  */
+/************************************************************************/
+
+static bool WriteSortRecord(VSILFILE *fp, const OGRField *pasFields,
+                            const std::vector<bool> &abStringKey, GIntBig nFID,
+                            GIntBig nSeq)
+{
+    const size_t nOrderItems = abStringKey.size();
+    bool bOK =
+        VSIFWriteL(pasFields, sizeof(OGRField), nOrderItems, fp) == nOrderItems;
+    for (size_t iKey = 0; bOK && iKey < nOrderItems; ++iKey)
+    {
+        const OGRField *psField = pasFields + iKey;
+        if (abStringKey[iKey] && !OGR_RawField_IsUnset(psField) &&
+            !OGR_RawField_IsNull(psField))
+        {
+            const uint32_t nLen =
+                static_cast<uint32_t>(strlen(psField->String));
+            bOK = VSIFWriteL(&nLen, sizeof(nLen), 1, fp) == 1 &&
+                  VSIFWriteL(psField->String, 1, nLen, fp) == nLen;
+        }
+    }
+    return bOK && VSIFWriteL(&nFID, sizeof(nFID), 1, fp) == 1 &&
+           VSIFWriteL(&nSeq, sizeof(nSeq), 1, fp) == 1;
+}
+
+/************************************************************************/
+/*                          SortAndWriteRun()                           */
+/*                                                                      */
+/*      Sort a run of the external merge sort and write it to a         */
+/*      temporary file. Called from worker threads, so it must not      */
+/*      access the source layer.                                        */
+/************************************************************************/
+
+bool OGRGenSQLResultsLayer::SortAndWriteRun(
+    OGRGenSQLSortRun &oRun, const std::vector<bool> &abStringKey,
+    const OGRFieldDefn *const *papoKeyFieldDefns) const
+{
+    const size_t nOrderItems = abStringKey.size();
+    bool bOK = false;
+    try
+    {
+        std::vector<size_t> anOrder(oRun.nSize);
+        for (size_t i = 0; i < oRun.nSize; ++i)
+            anOrder[i] = i;
+        // Stable, so that the result is the same as the in-memory merge sort
+        std::stable_sort(
+            anOrder.begin(), anOrder.end(),
+            [this, &oRun, nOrderItems, papoKeyFieldDefns](size_t a, size_t b)
+            {
+                return Compare(oRun.asIndexFields.data() + a * nOrderItems,
+                               oRun.asIndexFields.data() + b * nOrderItems,
+                               papoKeyFieldDefns) < 0;
+            });
+
+        bOK = true;
+        for (size_t i = 0; bOK && i < oRun.nSize; ++i)
+        {
+            const size_t iRec = anOrder[i];
+            bOK = WriteSortRecord(
+                oRun.fp, oRun.asIndexFields.data() + iRec * nOrderItems,
+                abStringKey, oRun.anFIDList[iRec],
+                oRun.nFirstSeq + static_cast<GIntBig>(iRec));
+        }
+        if (!bOK)
+        {
+            CPLError(CE_Failure, CPLE_FileIO,
+                     "Cannot write into temporary file %s",
+                     oRun.osFilename.c_str());
+        }
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "CreateOrderByIndex(): out of memory");
+    }
+
+    // Same as FreeIndexFields(), without going through the layer definition
+    for (size_t i = 0; i < oRun.nSize; ++i)
+    {
+        for (size_t iKey = 0; iKey < nOrderItems; ++iKey)
+        {
+            OGRField *psField = oRun.asIndexFields.data() + i * nOrderItems +
+                                iKey;
+            if (abStringKey[iKey] && !OGR_RawField_IsUnset(psField) &&
+                !OGR_RawField_IsNull(psField))
+            {
+                CPLFree(psField->String);
+            }
+        }
+    }
+    oRun.asIndexFields = std::vector<OGRField>();
+    oRun.anFIDList = std::vector<GIntBig>();
+    oRun.nRemaining = oRun.nSize;
+    return bOK;
+}
+
+/************************************************************************/
+/*                             MergeRuns()                              */
+/*                                                                      */
+/*      Merge runs of the external merge sort, calling oEmitFunc() on   */
+/*      the run holding the next record, in sorted order.               */
+/************************************************************************/
+
+bool OGRGenSQLResultsLayer::MergeRuns(
+    OGRGenSQLSortRun *const *papoRuns, size_t nRuns,
+    const std::vector<bool> &abStringKey,
+    const OGRFieldDefn *const *papoKeyFieldDefns,
+    const std::function<bool(const OGRGenSQLSortRun &)> &oEmitFunc) const
+{
+    // Returns true if the current record of a must be emitted after the one
+    // of b. Ties are resolved with the sequence number, for a stable sort.
+    const auto Greater = [this, papoKeyFieldDefns](const OGRGenSQLSortRun *a,
+                                                   const OGRGenSQLSortRun *b)
+    {
+        const int nRes = Compare(a->asCurFields.data(), b->asCurFields.data(),
+                                 papoKeyFieldDefns);
+        return nRes > 0 || (nRes == 0 && a->nCurSeq > b->nCurSeq);
+    };
+    std::priority_queue<OGRGenSQLSortRun *, std::vector<OGRGenSQLSortRun *>,
+                        decltype(Greater)>
+        oQueue(Greater);
+
+    for (size_t i = 0; i < nRuns; ++i)
+    {
+        OGRGenSQLSortRun *poRun = papoRuns[i];
+        if (VSIFSeekL(poRun->fp, 0, SEEK_SET) != 0)
+            return false;
+        if (poRun->nRemaining)
+        {
+            if (!poRun->ReadRecord(abStringKey))
+                return false;
+            oQueue.push(poRun);
+        }
+    }
+
+    while (!oQueue.empty())
+    {
+        OGRGenSQLSortRun *poRun = oQueue.top();
+        oQueue.pop();
+        if (!oEmitFunc(*poRun))
+            return false;
+        if (poRun->nRemaining)
+        {
+            if (!poRun->ReadRecord(abStringKey))
+                return false;
+            oQueue.push(poRun);
+        }
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                        MergeRunsIntoNewRun()                         */
+/*                                                                      */
+/*      Replace nRuns runs of apoRuns, starting at iFirst, by the       */
+/*      result of their merge, written to a new temporary file.         */
+/************************************************************************/
+
+bool OGRGenSQLResultsLayer::MergeRunsIntoNewRun(
+    std::vector<std::unique_ptr<OGRGenSQLSortRun>> &apoRuns, size_t iFirst,
+    size_t nRuns, const std::vector<bool> &abStringKey,
+    const OGRFieldDefn *const *papoKeyFieldDefns) const
+{
+    auto poNewRun = std::make_unique<OGRGenSQLSortRun>();
+    poNewRun->osFilename = CPLGenerateTempFilenameSafe("ogr_sql_sort");
+    poNewRun->fp = VSIFOpenL(poNewRun->osFilename.c_str(), "w+b");
+    if (!poNewRun->fp)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot create %s",
+                 poNewRun->osFilename.c_str());
+        return false;
+    }
+    VSIUnlink(poNewRun->osFilename.c_str());
+
+    std::vector<OGRGenSQLSortRun *> apoRunsToMerge;
+    for (size_t i = iFirst; i < iFirst + nRuns; ++i)
+    {
+        apoRunsToMerge.push_back(apoRuns[i].get());
+        poNewRun->nSize += apoRuns[i]->nSize;
+        poNewRun->nLevel = std::max(poNewRun->nLevel, apoRuns[i]->nLevel + 1);
+    }
+
+    VSILFILE *fpNew = poNewRun->fp;
+    if (!MergeRuns(apoRunsToMerge.data(), apoRunsToMerge.size(), abStringKey,
+                   papoKeyFieldDefns,
+                   [fpNew, &abStringKey](const OGRGenSQLSortRun &oRun)
+                   {
+                       return WriteSortRecord(fpNew, oRun.asCurFields.data(),
+                                              abStringKey, oRun.nCurFID,
+                                              oRun.nCurSeq);
+                   }))
+    {
+        CPLError(CE_Failure, CPLE_FileIO,
+                 "Cannot merge runs into temporary file %s",
+                 poNewRun->osFilename.c_str());
+        return false;
+    }
+    poNewRun->nRemaining = poNewRun->nSize;
+
+    apoRuns.erase(apoRuns.begin() + iFirst, apoRuns.begin() + iFirst + nRuns);
+    apoRuns.insert(apoRuns.begin() + iFirst, std::move(poNewRun));
+    return true;
+}
+
+/************************************************************************/
+/*                           MergeSortRuns()                            */
+/*                                                                      */
+/*      Merge the runs of the external merge sort into m_anFIDIndex.    */
+/************************************************************************/
+
+bool OGRGenSQLResultsLayer::MergeSortRuns(
+    std::vector<std::unique_ptr<OGRGenSQLSortRun>> &apoRuns,
+    const std::vector<bool> &abStringKey,
+    const OGRFieldDefn *const *papoKeyFieldDefns)
+{
+    size_t nTotalSize = 0;
+    for (const auto &poRun : apoRuns)
+        nTotalSize += poRun->nSize;
+    try
+    {
+        m_anFIDIndex.reserve(nTotalSize);
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "CreateOrderByIndex(): out of memory");
+        return false;
+    }
+
+    std::vector<OGRGenSQLSortRun *> apoRunsToMerge;
+    for (const auto &poRun : apoRuns)
+        apoRunsToMerge.push_back(poRun.get());
+
+    bool bAlreadySorted = true;
+    if (!MergeRuns(apoRunsToMerge.data(), apoRunsToMerge.size(), abStringKey,
+                   papoKeyFieldDefns,
+                   [this, &bAlreadySorted](const OGRGenSQLSortRun &oRun)
+                   {
+                       if (oRun.nCurSeq !=
+                           static_cast<GIntBig>(m_anFIDIndex.size()))
+                           bAlreadySorted = false;
+                       m_anFIDIndex.push_back(oRun.nCurFID);
+                       return true;
+                   }))
+    {
+        return false;
+    }
+
+    // See comment in CreateOrderByIndex()
+    if (bAlreadySorted)
+        m_anFIDIndex.clear();
+
+    return true;
+}
+
 /************************************************************************/
 /*                         CreateOrderByIndex()                         */
 /*                                                                      */
@@ -2194,8 +2968,8 @@ void OGRGenSQLResultsLayer::ReadIndexFields(OGRFeature *poSrcFeat,
 /*      this in memory copy of the order-by fields to create the        */
 /*      required index.                                                 */
 /*                                                                      */
-/*      Keeping all the key values in memory will *not* scale up to     */
-/*      very large input datasets.                                      */
+/*      When the key values do not fit in OGR_SQL_SORT_MAX_MEMORY, an   */
+/*      external merge sort is done instead (see OGRGenSQLSortRun).     */
 /************************************************************************/
 
 void OGRGenSQLResultsLayer::CreateOrderByIndex()
@@ -2215,6 +2989,33 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
 
     ResetReading();
 
+    // Field definitions of the sort keys (nullptr for special fields),
+    // resolved once, since the sort may be run in worker threads that
+    // must not access the source layer.
+    std::vector<const OGRFieldDefn *> apoKeyFieldDefns(nOrderItems);
+    std::vector<bool> abStringKey(nOrderItems);
+    {
+        const OGRFeatureDefn *poSrcDefn = m_poSrcLayer->GetLayerDefn();
+        for (int iKey = 0; iKey < nOrderItems; iKey++)
+        {
+            const swq_order_def *psKeyDef = psSelectInfo->order_defs + iKey;
+            if (psKeyDef->field_index >= m_iFIDFieldIndex)
+            {
+                abStringKey[iKey] =
+                    SpecialFieldTypes[psKeyDef->field_index -
+                                      m_iFIDFieldIndex] == SWQ_STRING;
+            }
+            else
+            {
+                apoKeyFieldDefns[iKey] =
+                    poSrcDefn->GetFieldDefn(psKeyDef->field_index);
+                abStringKey[iKey] =
+                    apoKeyFieldDefns[iKey]->GetType() == OFTString;
+            }
+        }
+    }
+    const OGRFieldDefn *const *papoKeyFieldDefns = apoKeyFieldDefns.data();
+
     /* -------------------------------------------------------------------- */
     /*      Optimize (memory-wise) ORDER BY ... LIMIT 1 [OFFSET 0] case.    */
     /* -------------------------------------------------------------------- */
@@ -2231,7 +3032,8 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
             ReadIndexFields(poSrcFeat.get(), nOrderItems,
                             asCurrentFields.data());
             if (!bFoundSrcFeature ||
-                Compare(asCurrentFields.data(), asBestFields.data()) < 0)
+                Compare(asCurrentFields.data(), asBestFields.data(),
+                        papoKeyFieldDefns) < 0)
             {
                 bFoundSrcFeature = true;
                 nBestFID = poSrcFeat->GetFID();
@@ -2291,6 +3093,148 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
 
     IndexFieldsFreer oIndexFieldsFreer(*this, asIndexFields, nIndexSize);
 
+    /* -------------------------------------------------------------------- */
+    /*      Beyond OGR_SQL_SORT_MAX_MEMORY, do an external merge sort:      */
+    /*      runs of key values are sorted and written to temporary files    */
+    /*      by worker threads, while the next run is read, and they are     */
+    /*      merged at the end.                                              */
+    /* -------------------------------------------------------------------- */
+    GIntBig nMaxMemory = 0;
+    {
+        const char *pszMaxMemory =
+            CPLGetConfigOption("OGR_SQL_SORT_MAX_MEMORY", "10%");
+        bool bUnitSpecified = false;
+        if (CPLParseMemorySize(pszMaxMemory, &nMaxMemory, &bUnitSpecified) !=
+            CE_None)
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Invalid value for OGR_SQL_SORT_MAX_MEMORY: %s",
+                     pszMaxMemory);
+            nMaxMemory = std::numeric_limits<GIntBig>::max();
+        }
+        else if (!bUnitSpecified && nMaxMemory < 100000)
+        {
+            nMaxMemory *= 1024 * 1024;
+        }
+    }
+    const char *pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    const int nThreads =
+        std::max(1, std::min(128, EQUAL(pszNumThreads, "ALL_CPUS")
+                                      ? CPLGetNumCPUs()
+                                      : atoi(pszNumThreads)));
+    // Up to nThreads runs are being sorted while the next one is read
+    const GIntBig nRunMaxMemory = nMaxMemory / (nThreads + 1);
+    // Maximum number of runs merged at once, to bound the number of
+    // simultaneously opened temporary files.
+    constexpr size_t MAX_MERGE_FAN_IN = 64;
+
+    GIntBig nRunMemory = 0;
+    GIntBig nSeq = 0;
+    std::vector<std::unique_ptr<OGRGenSQLSortRun>> apoRuns;
+    std::deque<std::future<bool>> aoPendingRuns;
+    // Must be destroyed first, since it waits for jobs using the above
+    std::unique_ptr<CPLJobQueue> poJobQueue;
+
+    const auto FlushRun = [&]()
+    {
+        auto poRun = std::make_unique<OGRGenSQLSortRun>();
+        poRun->osFilename = CPLGenerateTempFilenameSafe("ogr_sql_sort");
+        poRun->fp = VSIFOpenL(poRun->osFilename.c_str(), "w+b");
+        if (!poRun->fp)
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot create %s",
+                     poRun->osFilename.c_str());
+            return false;
+        }
+        // Unlink it now to avoid stale temporary file if killing the
+        // process (only works on Unix)
+        VSIUnlink(poRun->osFilename.c_str());
+        if (apoRuns.empty())
+        {
+            CPLDebug("GenSQL",
+                     "ORDER BY: sort keys exceed OGR_SQL_SORT_MAX_MEMORY. "
+                     "Using temporary files");
+            if (nThreads > 1)
+            {
+                auto poThreadPool = GDALGetGlobalThreadPool(nThreads);
+                if (poThreadPool)
+                    poJobQueue = poThreadPool->CreateJobQueue();
+            }
+        }
+        try
+        {
+            poRun->asIndexFields.assign(asIndexFields.begin(),
+                                        asIndexFields.begin() +
+                                            nIndexSize * nOrderItems);
+        }
+        catch (const std::bad_alloc &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "CreateOrderByIndex(): out of memory");
+            return false;
+        }
+        // Ownership of strings is transferred to the run
+        memset(asIndexFields.data(), 0,
+               sizeof(OGRField) * nOrderItems * nIndexSize);
+        poRun->anFIDList = std::move(anFIDList);
+        anFIDList.clear();
+        poRun->nSize = nIndexSize;
+        poRun->nFirstSeq = nSeq - static_cast<GIntBig>(nIndexSize);
+        nIndexSize = 0;
+        nRunMemory = 0;
+        OGRGenSQLSortRun *poRunRaw = poRun.get();
+        apoRuns.push_back(std::move(poRun));
+
+        if (!poJobQueue)
+        {
+            if (!SortAndWriteRun(*poRunRaw, abStringKey, papoKeyFieldDefns))
+                return false;
+        }
+        else
+        {
+            while (aoPendingRuns.size() >= static_cast<size_t>(nThreads))
+            {
+                const bool bOK = aoPendingRuns.front().get();
+                aoPendingRuns.pop_front();
+                if (!bOK)
+                    return false;
+            }
+            auto poPromise = std::make_shared<std::promise<bool>>();
+            aoPendingRuns.push_back(poPromise->get_future());
+            poJobQueue->SubmitJob(
+                [this, poRunRaw, &abStringKey, papoKeyFieldDefns, poPromise]()
+                {
+                    poPromise->set_value(SortAndWriteRun(
+                        *poRunRaw, abStringKey, papoKeyFieldDefns));
+                });
+        }
+
+        // Runs are kept ordered by decreasing level. When the last
+        // MAX_MERGE_FAN_IN runs have the same level, merge them into a run
+        // of the next level, so that the number of opened temporary files
+        // grows logarithmically with the number of runs.
+        while (apoRuns.size() >= MAX_MERGE_FAN_IN)
+        {
+            const size_t iFirst = apoRuns.size() - MAX_MERGE_FAN_IN;
+            const int nLevel = apoRuns.back()->nLevel;
+            if (apoRuns[iFirst]->nLevel != nLevel)
+                break;
+            while (!aoPendingRuns.empty())
+            {
+                const bool bOK = aoPendingRuns.front().get();
+                aoPendingRuns.pop_front();
+                if (!bOK)
+                    return false;
+            }
+            CPLDebug("GenSQL", "ORDER BY: merging %d runs of level %d",
+                     static_cast<int>(MAX_MERGE_FAN_IN), nLevel);
+            if (!MergeRunsIntoNewRun(apoRuns, iFirst, MAX_MERGE_FAN_IN,
+                                     abStringKey, papoKeyFieldDefns))
+                return false;
+        }
+        return true;
+    };
+
     /* -------------------------------------------------------------------- */
     /*      Read in all the key values.                                     */
     /* -------------------------------------------------------------------- */
@@ -2341,7 +3285,55 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
 
         anFIDList.push_back(poSrcFeat->GetFID());
 
+        nRunMemory += sizeof(OGRField) * nOrderItems + sizeof(GIntBig);
+        for (int iKey = 0; iKey < nOrderItems; iKey++)
+        {
+            const OGRField *psField =
+                asIndexFields.data() + nIndexSize * nOrderItems + iKey;
+            if (abStringKey[iKey] && !OGR_RawField_IsUnset(psField) &&
+                !OGR_RawField_IsNull(psField))
+            {
+                nRunMemory += strlen(psField->String) + 1;
+            }
+        }
+
         nIndexSize++;
+        nSeq++;
+
+        if (nRunMemory > nRunMaxMemory && !FlushRun())
+        {
+            m_anFIDIndex.clear();
+            return;
+        }
+    }
+
+    if (!apoRuns.empty())
+    {
+        bool bOK = nIndexSize == 0 || FlushRun();
+        while (!aoPendingRuns.empty())
+        {
+            bOK = aoPendingRuns.front().get() && bOK;
+            aoPendingRuns.pop_front();
+        }
+        // Reduce the number of runs so that the final merge does not
+        // exceed MAX_MERGE_FAN_IN, by merging the last (smallest) ones.
+        while (bOK && apoRuns.size() > MAX_MERGE_FAN_IN)
+        {
+            const size_t nRuns = std::min(
+                MAX_MERGE_FAN_IN, apoRuns.size() - MAX_MERGE_FAN_IN + 1);
+            bOK = MergeRunsIntoNewRun(apoRuns, apoRuns.size() - nRuns, nRuns,
+                                      abStringKey, papoKeyFieldDefns);
+        }
+        if (bOK)
+        {
+            CPLDebug("GenSQL", "ORDER BY: merging %d sorted runs",
+                     static_cast<int>(apoRuns.size()));
+            bOK = MergeSortRuns(apoRuns, abStringKey, papoKeyFieldDefns);
+        }
+        if (!bOK)
+            m_anFIDIndex.clear();
+        ResetReading();
+        return;
     }
 
     // CPLDebug("GenSQL", "CreateOrderByIndex() = %zu features", nIndexSize);
@@ -2375,7 +3367,8 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
     }
 
     // Note: this merge sort is slightly faster than std::sort()
-    SortIndexSection(asIndexFields.data(), panMerged, 0, nIndexSize);
+    SortIndexSection(asIndexFields.data(), papoKeyFieldDefns, panMerged, 0,
+                     nIndexSize);
     VSIFree(panMerged);
 
     /* -------------------------------------------------------------------- */
@@ -2408,9 +3401,10 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
 /*      Sort the records in a section of the index.                     */
 /************************************************************************/
 
-void OGRGenSQLResultsLayer::SortIndexSection(const OGRField *pasIndexFields,
-                                             GIntBig *panMerged, size_t nStart,
-                                             size_t nEntries)
+void OGRGenSQLResultsLayer::SortIndexSection(
+    const OGRField *pasIndexFields,
+    const OGRFieldDefn *const *papoKeyFieldDefns, GIntBig *panMerged,
+    size_t nStart, size_t nEntries)
 
 {
     if (nEntries < 2)
@@ -2424,8 +3418,10 @@ void OGRGenSQLResultsLayer::SortIndexSection(const OGRField *pasIndexFields,
     size_t nSecondGroup = nEntries - nFirstGroup;
     size_t nSecondStart = nStart + nFirstGroup;
 
-    SortIndexSection(pasIndexFields, panMerged, nFirstStart, nFirstGroup);
-    SortIndexSection(pasIndexFields, panMerged, nSecondStart, nSecondGroup);
+    SortIndexSection(pasIndexFields, papoKeyFieldDefns, panMerged, nFirstStart,
+                     nFirstGroup);
+    SortIndexSection(pasIndexFields, papoKeyFieldDefns, panMerged,
+                     nSecondStart, nSecondGroup);
 
     for (size_t iMerge = 0; iMerge < nEntries; ++iMerge)
     {
@@ -2438,7 +3434,8 @@ void OGRGenSQLResultsLayer::SortIndexSection(const OGRField *pasIndexFields,
         else
             nResult = Compare(
                 pasIndexFields + m_anFIDIndex[nFirstStart] * nOrderItems,
-                pasIndexFields + m_anFIDIndex[nSecondStart] * nOrderItems);
+                pasIndexFields + m_anFIDIndex[nSecondStart] * nOrderItems,
+                papoKeyFieldDefns);
 
         if (nResult > 0)
         {
@@ -2475,23 +3472,18 @@ template <class T> static inline int ComparePrimitive(const T &a, const T &b)
 /*                              Compare()                               */
 /************************************************************************/
 
-int OGRGenSQLResultsLayer::Compare(const OGRField *pasFirstTuple,
-                                   const OGRField *pasSecondTuple)
+int OGRGenSQLResultsLayer::Compare(
+    const OGRField *pasFirstTuple, const OGRField *pasSecondTuple,
+    const OGRFieldDefn *const *papoKeyFieldDefns) const
 
 {
-    swq_select *psSelectInfo = m_pSelectInfo.get();
+    const swq_select *psSelectInfo = m_pSelectInfo.get();
     int nResult = 0, iKey;
 
     for (iKey = 0; nResult == 0 && iKey < psSelectInfo->order_specs; iKey++)
     {
-        swq_order_def *psKeyDef = psSelectInfo->order_defs + iKey;
-        OGRFieldDefn *poFDefn = nullptr;
-
-        if (psKeyDef->field_index >= m_iFIDFieldIndex)
-            poFDefn = nullptr;
-        else
-            poFDefn = m_poSrcLayer->GetLayerDefn()->GetFieldDefn(
-                psKeyDef->field_index);
+        const swq_order_def *psKeyDef = psSelectInfo->order_defs + iKey;
+        const OGRFieldDefn *poFDefn = papoKeyFieldDefns[iKey];
 
         if (OGR_RawField_IsUnset(&pasFirstTuple[iKey]) ||
             OGR_RawField_IsNull(&pasFirstTuple[iKey]))
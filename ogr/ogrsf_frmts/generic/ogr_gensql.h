@@ -19,6 +19,7 @@
 #include "cpl_hash_set.h"
 #include "cpl_string.h"
 
+#include <functional>
 #include <vector>
 
 /*! @cond Doxygen_Suppress */
@@ -39,6 +40,7 @@
 /************************************************************************/
 
 class swq_select;
+struct OGRGenSQLSortRun;
 
 class OGRGenSQLResultsLayer final : public OGRLayer
 {
@@ -73,16 +75,40 @@ class OGRGenSQLResultsLayer final : public OGRLayer
     GIntBig m_nIteratedFeatures = -1;
     std::vector<std::string> m_aosDistinctList{};
 
+    // Hash tables of the features of the secondary layers, indexed by their
+    // join key, for joins whose condition is an equality. Null entries for
+    // joins that must be evaluated with an attribute filter.
+    struct JoinHashTable;
+    std::vector<std::unique_ptr<JoinHashTable>> m_apoJoinHashTables{};
+    bool m_bJoinHashTablesInitialized = false;
+
     bool PrepareSummary();
 
     std::unique_ptr<OGRFeature> TranslateFeature(std::unique_ptr<OGRFeature>);
     void CreateOrderByIndex();
     void ReadIndexFields(OGRFeature *poSrcFeat, int nOrderItems,
                          OGRField *pasIndexFields);
-    void SortIndexSection(const OGRField *pasIndexFields, GIntBig *panMerged,
-                          size_t nStart, size_t nEntries);
+    void SortIndexSection(const OGRField *pasIndexFields,
+                          const OGRFieldDefn *const *papoKeyFieldDefns,
+                          GIntBig *panMerged, size_t nStart, size_t nEntries);
     void FreeIndexFields(OGRField *pasIndexFields, size_t l_nIndexSize);
-    int Compare(const OGRField *pasFirst, const OGRField *pasSecond);
+    int Compare(const OGRField *pasFirst, const OGRField *pasSecond,
+                const OGRFieldDefn *const *papoKeyFieldDefns) const;
+    bool SortAndWriteRun(OGRGenSQLSortRun &oRun,
+                         const std::vector<bool> &abStringKey,
+                         const OGRFieldDefn *const *papoKeyFieldDefns) const;
+    bool MergeRuns(
+        OGRGenSQLSortRun *const *papoRuns, size_t nRuns,
+        const std::vector<bool> &abStringKey,
+        const OGRFieldDefn *const *papoKeyFieldDefns,
+        const std::function<bool(const OGRGenSQLSortRun &)> &oEmitFunc) const;
+    bool MergeRunsIntoNewRun(
+        std::vector<std::unique_ptr<OGRGenSQLSortRun>> &apoRuns, size_t iFirst,
+        size_t nRuns, const std::vector<bool> &abStringKey,
+        const OGRFieldDefn *const *papoKeyFieldDefns) const;
+    bool MergeSortRuns(std::vector<std::unique_ptr<OGRGenSQLSortRun>> &apoRuns,
+                       const std::vector<bool> &abStringKey,
+                       const OGRFieldDefn *const *papoKeyFieldDefns);
 
     void ClearFilters();
     void ApplyFiltersToSource();
@@ -95,6 +121,8 @@ class OGRGenSQLResultsLayer final : public OGRLayer
 
     void InvalidateOrderByIndex();
 
+    void InitJoinHashTables();
+
     int MustEvaluateSpatialFilterOnGenSQL();
 
     CPL_DISALLOW_COPY_ASSIGN(OGRGenSQLResultsLayer)
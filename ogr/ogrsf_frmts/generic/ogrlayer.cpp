@@ -20,11 +20,21 @@
 #include "ogr_wkb.h"
 #include "ogrlayer_private.h"
 
+#include "cpl_error_internal.h"
+#include "cpl_quad_tree.h"
 #include "cpl_time.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cmath>
+#include <functional>
 #include <limits>
+#include <memory>
 #include <set>
+#include <utility>
+#include <vector>
 
 /************************************************************************/
 /*                              OGRLayer()                              */
@@ -865,6 +875,85 @@ OGRFeatureH OGR_L_GetNextFeature(OGRLayerH hLayer)
     return OGRFeature::ToHandle(OGRLayer::FromHandle(hLayer)->GetNextFeature());
 }
 
+/************************************************************************/
+/*                         GetNextFeatureInto()                         */
+/************************************************************************/
+
+/**
+ \brief Fetch the next available feature from this layer into an existing
+ feature object.
+
+ This method is similar to GetNextFeature(), except that the content of the
+ next feature is stored in oFeature, whose previous content is discarded,
+ instead of being returned in a newly allocated object. This makes it
+ possible to read a whole layer with a single OGRFeature instance.
+
+ oFeature must have been created with the feature definition returned by
+ GetLayerDefn(). Drivers that override this method recycle, on a best-effort
+ basis, the memory held by oFeature, such as string field values or
+ geometries of the same type and with similar number of vertices as the
+ previous feature, which saves many memory allocations and deallocations
+ when iterating over big layers.
+ The default implementation calls GetNextFeature() and moves its result
+ into oFeature, with OGRFeature::Swap().
+
+ The same rules as for GetNextFeature() regarding spatial and attribute
+ filters, and concurrent modifications apply.
+
+ This method is the same as the C function OGR_L_GetNextFeatureInto().
+
+ @param oFeature feature into which the next feature is read.
+ @return true if a feature has been read, or false if no more features are
+ available (or in case of error). When false is returned, the content of
+ oFeature is unspecified.
+
+ @since GDAL 3.12
+*/
+
+bool OGRLayer::GetNextFeatureInto(OGRFeature &oFeature)
+
+{
+    auto poFeature = std::unique_ptr<OGRFeature>(GetNextFeature());
+    if (!poFeature)
+        return false;
+    oFeature.Swap(*poFeature);
+    return true;
+}
+
+/************************************************************************/
+/*                      OGR_L_GetNextFeatureInto()                      */
+/************************************************************************/
+
+/**
+ \brief Fetch the next available feature from this layer into an existing
+ feature object.
+
+ This function is similar to OGR_L_GetNextFeature(), except that the content
+ of the next feature is stored in hFeature, whose previous content is
+ discarded, instead of being returned in a newly allocated object.
+ hFeature must have been created with the feature definition returned by
+ OGR_L_GetLayerDefn().
+
+ This function is the same as the C++ method OGRLayer::GetNextFeatureInto().
+
+ @param hLayer handle to the layer from which feature are read.
+ @param hFeature handle to the feature into which the next feature is read.
+ @return true if a feature has been read, or false if no more features are
+ available (or in case of error).
+
+ @since GDAL 3.12
+*/
+
+bool OGR_L_GetNextFeatureInto(OGRLayerH hLayer, OGRFeatureH hFeature)
+
+{
+    VALIDATE_POINTER1(hLayer, "OGR_L_GetNextFeatureInto", false);
+    VALIDATE_POINTER1(hFeature, "OGR_L_GetNextFeatureInto", false);
+
+    return OGRLayer::FromHandle(hLayer)->GetNextFeatureInto(
+        *OGRFeature::FromHandle(hFeature));
+}
+
 /************************************************************************/
 /*                       ConvertGeomsIfNecessary()                      */
 /************************************************************************/
@@ -2154,6 +2243,8 @@ int OGRLayer::InstallFilter(const OGRGeometry *poFilter)
         m_pPreparedFilterGeom = nullptr;
     }
 
+    m_poPrivate->m_poPreparedWKBFilterGeom.reset();
+
     if (poFilter != nullptr)
         m_poFilterGeom = poFilter->clone();
 
@@ -2168,6 +2259,11 @@ int OGRLayer::InstallFilter(const OGRGeometry *poFilter)
     m_pPreparedFilterGeom =
         OGRCreatePreparedGeometry(OGRGeometry::ToHandle(m_poFilterGeom));
 
+    /* and as edges to evaluate it directly on WKB geometries (indexed on */
+    /* the first exact test) */
+    m_poPrivate->m_poPreparedWKBFilterGeom =
+        OGRWKBPreparedPolygon::Create(m_poFilterGeom);
+
     m_bFilterIsEnvelope = m_poFilterGeom->IsRectangle();
 
     return TRUE;
@@ -2335,7 +2431,8 @@ bool OGRLayer::FilterWKBGeometry(const GByte *pabyWKB, size_t nWKBSize,
     OGRPreparedGeometry *pPreparedFilterGeom = m_pPreparedFilterGeom;
     bool bRet = FilterWKBGeometry(
         pabyWKB, nWKBSize, bEnvelopeAlreadySet, sEnvelope, m_poFilterGeom,
-        m_bFilterIsEnvelope, m_sFilterEnvelope, pPreparedFilterGeom);
+        m_bFilterIsEnvelope, m_sFilterEnvelope, pPreparedFilterGeom,
+        m_poPrivate->m_poPreparedWKBFilterGeom.get());
     const_cast<OGRLayer *>(this)->m_pPreparedFilterGeom = pPreparedFilterGeom;
     return bRet;
 }
@@ -2348,6 +2445,19 @@ bool OGRLayer::FilterWKBGeometry(const GByte *pabyWKB, size_t nWKBSize,
                                  bool bFilterIsEnvelope,
                                  const OGREnvelope &sFilterEnvelope,
                                  OGRPreparedGeometry *&pPreparedFilterGeom)
+{
+    return FilterWKBGeometry(pabyWKB, nWKBSize, bEnvelopeAlreadySet,
+                             sEnvelope, poFilterGeom, bFilterIsEnvelope,
+                             sFilterEnvelope, pPreparedFilterGeom, nullptr);
+}
+
+/* static */
+bool OGRLayer::FilterWKBGeometry(
+    const GByte *pabyWKB, size_t nWKBSize, bool bEnvelopeAlreadySet,
+    OGREnvelope &sEnvelope, const OGRGeometry *poFilterGeom,
+    bool bFilterIsEnvelope, const OGREnvelope &sFilterEnvelope,
+    OGRPreparedGeometry *&pPreparedFilterGeom,
+    const OGRWKBPreparedPolygon *poPreparedWKBFilterGeom)
 {
     if (!poFilterGeom)
         return true;
@@ -2367,7 +2477,20 @@ bool OGRLayer::FilterWKBGeometry(const GByte *pabyWKB, size_t nWKBSize,
             {
                 return true;
             }
-            else if (OGRGeometryFactory::haveGEOS())
+
+            // Exact test directly on the WKB geometry, without
+            // instantiating it. Falls back to GEOS for curve geometries or
+            // non-finite coordinates.
+            if (poPreparedWKBFilterGeom)
+            {
+                bool bError = false;
+                const bool bRet = poPreparedWKBFilterGeom->Intersects(
+                    pabyWKB, nWKBSize, bError);
+                if (!bError)
+                    return bRet;
+            }
+
+            if (OGRGeometryFactory::haveGEOS())
             {
                 OGRGeometry *poGeom = nullptr;
                 int ret = FALSE;
@@ -3263,6 +3386,413 @@ static OGRGeometry *promote_to_multi(OGRGeometry *poGeom)
         return poGeom;
 }
 
+/************************************************************************/
+/*                        OGRLayerAlgebraIndex                          */
+/************************************************************************/
+
+namespace
+{
+
+// In-memory copy of the features of a layer, with a quad tree on the
+// envelopes of their geometry, used by the layer overlay methods when the
+// USE_IN_MEMORY_INDEX option is set, instead of setting a spatial filter on
+// the layer for each feature of the other layer.
+// Once loaded, it may be queried concurrently by several threads.
+class OGRLayerAlgebraIndex
+{
+  public:
+    OGRLayerAlgebraIndex() = default;
+    ~OGRLayerAlgebraIndex();
+
+    void Load(OGRLayer *poLayer);
+
+    size_t GetFeatureCount() const
+    {
+        return m_apoFeatures.size();
+    }
+
+    OGRFeature *GetFeature(int i) const
+    {
+        return m_apoFeatures[i].get();
+    }
+
+    std::vector<int> GetIntersecting(const OGRGeometry *poGeom) const;
+
+  private:
+    std::vector<OGRFeatureUniquePtr> m_apoFeatures{};
+    // Features whose envelope is not finite, and cannot be in the quad tree
+    std::vector<int> m_anNotInTree{};
+    CPLQuadTree *m_hTree = nullptr;
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRLayerAlgebraIndex)
+};
+
+OGRLayerAlgebraIndex::~OGRLayerAlgebraIndex()
+{
+    if (m_hTree)
+        CPLQuadTreeDestroy(m_hTree);
+}
+
+void OGRLayerAlgebraIndex::Load(OGRLayer *poLayer)
+{
+    std::vector<std::pair<int, CPLRectObj>> aoRects;
+    OGREnvelope sExtent;
+    for (auto &&poFeature : poLayer)
+    {
+        const int iFeature = static_cast<int>(m_apoFeatures.size());
+        const OGRGeometry *poGeom = poFeature->GetGeometryRef();
+        if (poGeom && !poGeom->IsEmpty())
+        {
+            OGREnvelope sEnv;
+            poGeom->getEnvelope(&sEnv);
+            if (std::isfinite(sEnv.MinX) && std::isfinite(sEnv.MinY) &&
+                std::isfinite(sEnv.MaxX) && std::isfinite(sEnv.MaxY))
+            {
+                sExtent.Merge(sEnv);
+                aoRects.emplace_back(
+                    iFeature,
+                    CPLRectObj{sEnv.MinX, sEnv.MinY, sEnv.MaxX, sEnv.MaxY});
+            }
+            else
+            {
+                m_anNotInTree.push_back(iFeature);
+            }
+        }
+        m_apoFeatures.push_back(std::move(poFeature));
+    }
+
+    if (!aoRects.empty())
+    {
+        const CPLRectObj sGlobalBounds{sExtent.MinX, sExtent.MinY,
+                                       sExtent.MaxX, sExtent.MaxY};
+        m_hTree = CPLQuadTreeCreate(&sGlobalBounds, nullptr);
+        CPLQuadTreeSetMaxDepth(m_hTree, CPLQuadTreeGetAdvisedMaxDepth(
+                                            static_cast<int>(aoRects.size())));
+        for (const auto &[iFeature, sRect] : aoRects)
+        {
+            CPLQuadTreeInsertWithBounds(
+                m_hTree,
+                reinterpret_cast<void *>(static_cast<uintptr_t>(iFeature)),
+                &sRect);
+        }
+    }
+}
+
+// Returns the indices, in increasing order, of the features whose geometry
+// intersects poGeom, that is the features that would be returned by the
+// layer with poGeom as spatial filter (see OGRLayer::FilterGeometry()).
+std::vector<int>
+OGRLayerAlgebraIndex::GetIntersecting(const OGRGeometry *poGeom) const
+{
+    std::vector<int> anRet;
+    if (poGeom->IsEmpty())
+        return anRet;
+
+    if (m_hTree)
+    {
+        OGREnvelope sEnv;
+        poGeom->getEnvelope(&sEnv);
+        const CPLRectObj sRect{sEnv.MinX, sEnv.MinY, sEnv.MaxX, sEnv.MaxY};
+        int nCount = 0;
+        void **pahFeatures = CPLQuadTreeSearch(m_hTree, &sRect, &nCount);
+        anRet.reserve(nCount + m_anNotInTree.size());
+        for (int i = 0; i < nCount; ++i)
+        {
+            anRet.push_back(
+                static_cast<int>(reinterpret_cast<uintptr_t>(pahFeatures[i])));
+        }
+        CPLFree(pahFeatures);
+    }
+    anRet.insert(anRet.end(), m_anNotInTree.begin(), m_anNotInTree.end());
+    std::sort(anRet.begin(), anRet.end());
+
+    OGRPreparedGeometryUniquePtr poPreparedGeom;
+    if (anRet.size() > 1)
+    {
+        poPreparedGeom.reset(OGRCreatePreparedGeometry(
+            OGRGeometry::ToHandle(const_cast<OGRGeometry *>(poGeom))));
+    }
+    size_t nKept = 0;
+    for (const int iFeature : anRet)
+    {
+        OGRGeometry *poOtherGeom = m_apoFeatures[iFeature]->GetGeometryRef();
+        const bool bIntersects =
+            poPreparedGeom ? CPL_TO_BOOL(OGRPreparedGeometryIntersects(
+                                 poPreparedGeom.get(),
+                                 OGRGeometry::ToHandle(poOtherGeom)))
+                           : CPL_TO_BOOL(poGeom->Intersects(poOtherGeom));
+        if (bIntersects)
+            anRet[nKept++] = iFeature;
+    }
+    anRet.resize(nKept);
+    return anRet;
+}
+
+/************************************************************************/
+/*                     OGRLayerAlgebraIndexedLayer                      */
+/************************************************************************/
+
+// Layer returning the features of another layer, loaded in memory in a
+// OGRLayerAlgebraIndex, so that setting a spatial filter on it is cheap.
+class OGRLayerAlgebraIndexedLayer final : public OGRLayer
+{
+  public:
+    explicit OGRLayerAlgebraIndexedLayer(OGRLayer *poSrcLayer)
+        : m_poSrcLayer(poSrcLayer)
+    {
+        SetDescription(poSrcLayer->GetDescription());
+        m_oIndex.Load(poSrcLayer);
+    }
+
+    void ResetReading() override
+    {
+        m_bCandidatesValid = false;
+        m_iNext = 0;
+    }
+
+    OGRFeature *GetNextFeature() override;
+
+    OGRFeatureDefn *GetLayerDefn() override
+    {
+        return m_poSrcLayer->GetLayerDefn();
+    }
+
+    const char *GetName() override
+    {
+        return m_poSrcLayer->GetName();
+    }
+
+    OGRwkbGeometryType GetGeomType() override
+    {
+        return m_poSrcLayer->GetGeomType();
+    }
+
+    OGRSpatialReference *GetSpatialRef() override
+    {
+        return m_poSrcLayer->GetSpatialRef();
+    }
+
+    int TestCapability(const char *) override
+    {
+        return FALSE;
+    }
+
+  private:
+    OGRLayer *m_poSrcLayer = nullptr;
+    OGRLayerAlgebraIndex m_oIndex{};
+    std::vector<int> m_anCandidates{};
+    bool m_bCandidatesValid = false;
+    size_t m_iNext = 0;
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRLayerAlgebraIndexedLayer)
+};
+
+OGRFeature *OGRLayerAlgebraIndexedLayer::GetNextFeature()
+{
+    if (!m_poFilterGeom)
+    {
+        if (m_iNext >= m_oIndex.GetFeatureCount())
+            return nullptr;
+        return m_oIndex.GetFeature(static_cast<int>(m_iNext++))->Clone();
+    }
+    if (!m_bCandidatesValid)
+    {
+        m_anCandidates = m_oIndex.GetIntersecting(m_poFilterGeom);
+        m_bCandidatesValid = true;
+    }
+    if (m_iNext >= m_anCandidates.size())
+        return nullptr;
+    return m_oIndex.GetFeature(m_anCandidates[m_iNext++])->Clone();
+}
+
+// Result of the processing of a feature of the input layer: geometry of a
+// feature to create in the result layer, and index in the
+// OGRLayerAlgebraIndex of the method feature whose fields must be set in it,
+// or -1.
+struct OGRLayerAlgebraResult
+{
+    int iMethodFeature = -1;
+    OGRGeometryUniquePtr poGeom{};
+};
+
+using OGRLayerAlgebraFunc =
+    std::function<OGRErr(OGRFeature *, std::vector<OGRLayerAlgebraResult> &)>;
+
+}  // namespace
+
+// Same as set_filter_from(), but for an in-memory index of the method layer:
+// retrieves the indices of the features that the method layer would return
+// with the spatial filter set.
+static OGRGeometry *get_candidates_from(const OGRLayerAlgebraIndex &oIndex,
+                                        OGRGeometry *pGeometryExistingFilter,
+                                        OGRFeature *pFeature,
+                                        std::vector<int> &anCandidates)
+{
+    OGRGeometry *geom = pFeature->GetGeometryRef();
+    if (!geom)
+        return nullptr;
+    if (pGeometryExistingFilter)
+    {
+        if (!geom->Intersects(pGeometryExistingFilter))
+            return nullptr;
+        OGRGeometryUniquePtr intersection(
+            geom->Intersection(pGeometryExistingFilter));
+        if (!intersection)
+            return nullptr;
+        anCandidates = oIndex.GetIntersecting(intersection.get());
+    }
+    else
+    {
+        anCandidates = oIndex.GetIntersecting(geom);
+    }
+    return geom;
+}
+
+static int get_num_threads(CSLConstList papszOptions)
+{
+    const char *pszNumThreads =
+        CSLFetchNameValue(papszOptions, "NUM_THREADS");
+    if (!pszNumThreads)
+        pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    return std::max(1, std::min(128, EQUAL(pszNumThreads, "ALL_CPUS")
+                                         ? CPLGetNumCPUs()
+                                         : atoi(pszNumThreads)));
+}
+
+// Calls pfnProcess() on each feature of pLayerInput, from several threads,
+// by batches of features, and creates the resulting features in pLayerResult,
+// in the order of the input features. Fields are set from the main thread, as
+// reading some field types of a feature is not thread-safe.
+static OGRErr process_in_parallel(OGRLayer *pLayerInput, OGRLayer *pLayerResult,
+                                  const OGRLayerAlgebraIndex &oIndex,
+                                  const int *mapInput, const int *mapMethod,
+                                  bool bPromoteToMulti, bool bSkipFailures,
+                                  int nThreads, double progress_max,
+                                  GDALProgressFunc pfnProgress,
+                                  void *pProgressArg,
+                                  const OGRLayerAlgebraFunc &pfnProcess)
+{
+    std::unique_ptr<CPLJobQueue> poJobQueue;
+    if (nThreads > 1)
+    {
+        auto poThreadPool = GDALGetGlobalThreadPool(nThreads);
+        if (poThreadPool)
+            poJobQueue = poThreadPool->CreateJobQueue();
+    }
+
+    struct Job
+    {
+        OGRFeatureUniquePtr poFeature{};
+        std::vector<OGRLayerAlgebraResult> aoResults{};
+        OGRErr eErr = OGRERR_NONE;
+        CPLErrorAccumulator oErrorAccumulator{};
+    };
+
+    const size_t nBatchSize =
+        poJobQueue ? static_cast<size_t>(256) * nThreads : 1;
+    OGRFeatureDefn *poDefnResult = pLayerResult->GetLayerDefn();
+    double progress_counter = 0;
+    double progress_ticker = 0;
+    std::vector<std::unique_ptr<Job>> apoJobs;
+    bool bEOF = false;
+    pLayerInput->ResetReading();
+    while (!bEOF)
+    {
+        apoJobs.clear();
+        while (apoJobs.size() < nBatchSize)
+        {
+            OGRFeatureUniquePtr poFeature(pLayerInput->GetNextFeature());
+            if (!poFeature)
+            {
+                bEOF = true;
+                break;
+            }
+            apoJobs.push_back(std::make_unique<Job>());
+            apoJobs.back()->poFeature = std::move(poFeature);
+        }
+
+        if (poJobQueue && apoJobs.size() > 1)
+        {
+            std::atomic<size_t> nNextJob{0};
+            const int nJobs =
+                static_cast<int>(std::min<size_t>(nThreads, apoJobs.size()));
+            for (int i = 0; i < nJobs; ++i)
+            {
+                poJobQueue->SubmitJob(
+                    [&apoJobs, &nNextJob, &pfnProcess]()
+                    {
+                        size_t iJob;
+                        while ((iJob = nNextJob++) < apoJobs.size())
+                        {
+                            Job &oJob = *(apoJobs[iJob]);
+                            auto oAccumulator =
+                                oJob.oErrorAccumulator.InstallForCurrentScope();
+                            CPL_IGNORE_RET_VAL(oAccumulator);
+                            oJob.eErr = pfnProcess(oJob.poFeature.get(),
+                                                   oJob.aoResults);
+                        }
+                    });
+            }
+            poJobQueue->WaitCompletion();
+        }
+        else
+        {
+            for (auto &poJob : apoJobs)
+            {
+                poJob->eErr =
+                    pfnProcess(poJob->poFeature.get(), poJob->aoResults);
+            }
+        }
+
+        for (auto &poJob : apoJobs)
+        {
+            if (pfnProgress)
+            {
+                double p = progress_counter / progress_max;
+                if (p > progress_ticker)
+                {
+                    if (!pfnProgress(p, "", pProgressArg))
+                    {
+                        CPLError(CE_Failure, CPLE_UserInterrupt,
+                                 "User terminated");
+                        return OGRERR_FAILURE;
+                    }
+                }
+                progress_counter += 1.0;
+            }
+
+            poJob->oErrorAccumulator.ReplayErrors();
+            for (auto &oResult : poJob->aoResults)
+            {
+                OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
+                z->SetFieldsFrom(poJob->poFeature.get(), mapInput);
+                if (oResult.iMethodFeature >= 0)
+                    z->SetFieldsFrom(oIndex.GetFeature(oResult.iMethodFeature),
+                                     mapMethod);
+                if (bPromoteToMulti)
+                    oResult.poGeom.reset(
+                        promote_to_multi(oResult.poGeom.release()));
+                z->SetGeometryDirectly(oResult.poGeom.release());
+                const OGRErr ret = pLayerResult->CreateFeature(z.get());
+                if (ret != OGRERR_NONE)
+                {
+                    if (!bSkipFailures)
+                        return ret;
+                    CPLErrorReset();
+                }
+            }
+            if (poJob->eErr != OGRERR_NONE)
+                return poJob->eErr;
+        }
+    }
+    if (pfnProgress && !pfnProgress(1.0, "", pProgressArg))
+    {
+        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+        return OGRERR_FAILURE;
+    }
+    return OGRERR_NONE;
+}
+
 /************************************************************************/
 /*                          Intersection()                              */
 /************************************************************************/
@@ -3317,6 +3847,17 @@ static OGRGeometry *promote_to_multi(OGRGeometry *poGeom)
  *     features with lower dimension geometry, but only if the result layer
  *     has an unknown geometry type.
  * </li>
+ * <li>USE_IN_MEMORY_INDEX=YES/NO. (GDAL >= 3.12) Set to YES to load
+ *     the features of the method layer in memory, and to use a spatial
+ *     index on them instead of setting spatial filters on the method layer.
+ *     This is much faster with layers that have no efficient spatial
+ *     filtering, at the expense of memory usage. Defaults to NO.
+ * </li>
+ * <li>NUM_THREADS=number|ALL_CPUS. (GDAL >= 3.12) Number of threads
+ *     used to process the features of the input layer, when
+ *     USE_IN_MEMORY_INDEX=YES. Defaults to the value of the
+ *     GDAL_NUM_THREADS configuration option, or 1.
+ * </li>
  * </ul>
  *
  * This method is the same as the C function OGR_L_Intersection().
@@ -3368,6 +3909,8 @@ OGRErr OGRLayer::Intersection(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         CSLFetchNameValueDef(papszOptions, "PRETEST_CONTAINMENT", "NO"));
     bool bKeepLowerDimGeom = CPLTestBool(CSLFetchNameValueDef(
         papszOptions, "KEEP_LOWER_DIMENSION_GEOMETRIES", "YES"));
+    const bool bUseInMemoryIndex = CPLTestBool(
+        CSLFetchNameValueDef(papszOptions, "USE_IN_MEMORY_INDEX", "NO"));
 
     // check for GEOS
     if (!OGRGeometryFactory::haveGEOS())
@@ -3392,7 +3935,6 @@ OGRErr OGRLayer::Intersection(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     if (ret != OGRERR_NONE)
         goto done;
     poDefnResult = pLayerResult->GetLayerDefn();
-    bEnvelopeSet = pLayerMethod->GetExtent(&sEnvelopeMethod, 1) == OGRERR_NONE;
     if (bKeepLowerDimGeom)
     {
         // require that the result layer is of geom type unknown
@@ -3404,6 +3946,104 @@ OGRErr OGRLayer::Intersection(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         }
     }
 
+    if (bUseInMemoryIndex)
+    {
+        OGRLayerAlgebraIndex oIndex;
+        oIndex.Load(pLayerMethod);
+
+        const auto process =
+            [&](OGRFeature *x, std::vector<OGRLayerAlgebraResult> &results)
+            -> OGRErr
+        {
+            std::vector<int> candidates;
+            CPLErrorReset();
+            OGRGeometry *x_geom = get_candidates_from(
+                oIndex, pGeometryMethodFilter, x, candidates);
+            if (CPLGetLastErrorType() != CE_None)
+            {
+                if (!bSkipFailures)
+                    return OGRERR_FAILURE;
+                CPLErrorReset();
+            }
+            if (!x_geom || candidates.empty())
+                return OGRERR_NONE;
+
+            OGRPreparedGeometryUniquePtr x_prepared_geom;
+            if (bUsePreparedGeometries)
+            {
+                x_prepared_geom.reset(
+                    OGRCreatePreparedGeometry(OGRGeometry::ToHandle(x_geom)));
+                if (!x_prepared_geom)
+                    return OGRERR_FAILURE;
+            }
+
+            for (const int iY : candidates)
+            {
+                OGRGeometry *y_geom = oIndex.GetFeature(iY)->GetGeometryRef();
+                OGRGeometryUniquePtr z_geom;
+
+                if (x_prepared_geom)
+                {
+                    CPLErrorReset();
+                    if (bPretestContainment &&
+                        OGRPreparedGeometryContains(
+                            x_prepared_geom.get(),
+                            OGRGeometry::ToHandle(y_geom)))
+                    {
+                        if (CPLGetLastErrorType() == CE_None)
+                            z_geom.reset(y_geom->clone());
+                    }
+                    else if (!(OGRPreparedGeometryIntersects(
+                                 x_prepared_geom.get(),
+                                 OGRGeometry::ToHandle(y_geom))))
+                    {
+                        if (CPLGetLastErrorType() == CE_None)
+                            continue;
+                    }
+                    if (CPLGetLastErrorType() != CE_None)
+                    {
+                        if (!bSkipFailures)
+                            return OGRERR_FAILURE;
+                        CPLErrorReset();
+                        continue;
+                    }
+                }
+                if (!z_geom)
+                {
+                    CPLErrorReset();
+                    z_geom.reset(x_geom->Intersection(y_geom));
+                    if (CPLGetLastErrorType() != CE_None || z_geom == nullptr)
+                    {
+                        if (!bSkipFailures)
+                            return OGRERR_FAILURE;
+                        CPLErrorReset();
+                        continue;
+                    }
+                    if (z_geom->IsEmpty() ||
+                        (!bKeepLowerDimGeom &&
+                         (x_geom->getDimension() == y_geom->getDimension() &&
+                          z_geom->getDimension() < x_geom->getDimension())))
+                    {
+                        continue;
+                    }
+                }
+                OGRLayerAlgebraResult result;
+                result.iMethodFeature = iY;
+                result.poGeom = std::move(z_geom);
+                results.push_back(std::move(result));
+            }
+            return OGRERR_NONE;
+        };
+
+        ret = process_in_parallel(this, pLayerResult, oIndex, mapInput,
+                                  mapMethod, bPromoteToMulti, bSkipFailures,
+                                  get_num_threads(papszOptions), progress_max,
+                                  pfnProgress, pProgressArg, process);
+        goto done;
+    }
+
+    bEnvelopeSet = pLayerMethod->GetExtent(&sEnvelopeMethod, 1) == OGRERR_NONE;
+
     for (auto &&x : this)
     {
 
@@ -3639,6 +4279,17 @@ done:
  *     features with lower dimension geometry, but only if the result layer
  *     has an unknown geometry type.
  * </li>
+ * <li>USE_IN_MEMORY_INDEX=YES/NO. (GDAL >= 3.12) Set to YES to load
+ *     the features of the method layer in memory, and to use a spatial
+ *     index on them instead of setting spatial filters on the method layer.
+ *     This is much faster with layers that have no efficient spatial
+ *     filtering, at the expense of memory usage. Defaults to NO.
+ * </li>
+ * <li>NUM_THREADS=number|ALL_CPUS. (GDAL >= 3.12) Number of threads
+ *     used to process the features of the input layer, when
+ *     USE_IN_MEMORY_INDEX=YES. Defaults to the value of the
+ *     GDAL_NUM_THREADS configuration option, or 1.
+ * </li>
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Intersection().
@@ -3735,6 +4386,12 @@ OGRErr OGR_L_Intersection(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  *     features with lower dimension geometry, but only if the result layer
  *     has an unknown geometry type.
  * </li>
+ * <li>USE_IN_MEMORY_INDEX=YES/NO. (GDAL >= 3.12) Set to YES to load
+ *     the features of the method layer and of the input layer in memory,
+ *     and to use a spatial index on them instead of setting spatial filters
+ *     on the layers. This is much faster with layers that have no efficient
+ *     spatial filtering, at the expense of memory usage. Defaults to NO.
+ * </li>
  * </ul>
  *
  * This method is the same as the C function OGR_L_Union().
@@ -3786,6 +4443,11 @@ OGRErr OGRLayer::Union(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     bool bKeepLowerDimGeom = CPLTestBool(CSLFetchNameValueDef(
         papszOptions, "KEEP_LOWER_DIMENSION_GEOMETRIES", "YES"));
 
+    const bool bUseInMemoryIndex = CPLTestBool(
+        CSLFetchNameValueDef(papszOptions, "USE_IN_MEMORY_INDEX", "NO"));
+    OGRLayer *pLayerInput = this;
+    std::unique_ptr<OGRLayerAlgebraIndexedLayer> poIndexedInputLayer;
+    std::unique_ptr<OGRLayerAlgebraIndexedLayer> poIndexedMethodLayer;
     // check for GEOS
     if (!OGRGeometryFactory::haveGEOS())
     {
@@ -3823,8 +4485,18 @@ OGRErr OGRLayer::Union(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         }
     }
 
+    if (bUseInMemoryIndex)
+    {
+        poIndexedInputLayer =
+            std::make_unique<OGRLayerAlgebraIndexedLayer>(this);
+        pLayerInput = poIndexedInputLayer.get();
+        poIndexedMethodLayer =
+            std::make_unique<OGRLayerAlgebraIndexedLayer>(pLayerMethod);
+        pLayerMethod = poIndexedMethodLayer.get();
+    }
+
     // add features based on input layer
-    for (auto &&x : this)
+    for (auto &&x : pLayerInput)
     {
 
         if (pfnProgress)
@@ -4034,7 +4706,7 @@ OGRErr OGRLayer::Union(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         // set up the filter on input layer
         CPLErrorReset();
         OGRGeometry *x_geom =
-            set_filter_from(this, pGeometryInputFilter, x.get());
+            set_filter_from(pLayerInput, pGeometryInputFilter, x.get());
         if (CPLGetLastErrorType() != CE_None)
         {
             if (!bSkipFailures)
@@ -4056,7 +4728,7 @@ OGRErr OGRLayer::Union(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         OGRGeometryUniquePtr x_geom_diff(
             x_geom
                 ->clone());  // this will be the geometry of the result feature
-        for (auto &&y : this)
+        for (auto &&y : pLayerInput)
         {
             OGRGeometry *y_geom = y->GetGeometryRef();
             if (!y_geom)
@@ -4189,6 +4861,12 @@ done:
  *     features with lower dimension geometry, but only if the result layer
  *     has an unknown geometry type.
  * </li>
+ * <li>USE_IN_MEMORY_INDEX=YES/NO. (GDAL >= 3.12) Set to YES to load
+ *     the features of the method layer and of the input layer in memory,
+ *     and to use a spatial index on them instead of setting spatial filters
+ *     on the layers. This is much faster with layers that have no efficient
+ *     spatial filtering, at the expense of memory usage. Defaults to NO.
+ * </li>
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Union().
@@ -4272,6 +4950,12 @@ OGRErr OGR_L_Union(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
  * </li>
+ * <li>USE_IN_MEMORY_INDEX=YES/NO. (GDAL >= 3.12) Set to YES to load
+ *     the features of the method layer and of the input layer in memory,
+ *     and to use a spatial index on them instead of setting spatial filters
+ *     on the layers. This is much faster with layers that have no efficient
+ *     spatial filtering, at the expense of memory usage. Defaults to NO.
+ * </li>
  * </ul>
  *
  * This method is the same as the C function OGR_L_SymDifference().
@@ -4319,6 +5003,11 @@ OGRErr OGRLayer::SymDifference(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     const bool bPromoteToMulti = CPLTestBool(
         CSLFetchNameValueDef(papszOptions, "PROMOTE_TO_MULTI", "NO"));
 
+    const bool bUseInMemoryIndex = CPLTestBool(
+        CSLFetchNameValueDef(papszOptions, "USE_IN_MEMORY_INDEX", "NO"));
+    OGRLayer *pLayerInput = this;
+    std::unique_ptr<OGRLayerAlgebraIndexedLayer> poIndexedInputLayer;
+    std::unique_ptr<OGRLayerAlgebraIndexedLayer> poIndexedMethodLayer;
     // check for GEOS
     if (!OGRGeometryFactory::haveGEOS())
     {
@@ -4346,8 +5035,18 @@ OGRErr OGRLayer::SymDifference(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         goto done;
     poDefnResult = pLayerResult->GetLayerDefn();
 
+    if (bUseInMemoryIndex)
+    {
+        poIndexedInputLayer =
+            std::make_unique<OGRLayerAlgebraIndexedLayer>(this);
+        pLayerInput = poIndexedInputLayer.get();
+        poIndexedMethodLayer =
+            std::make_unique<OGRLayerAlgebraIndexedLayer>(pLayerMethod);
+        pLayerMethod = poIndexedMethodLayer.get();
+    }
+
     // add features based on input layer
-    for (auto &&x : this)
+    for (auto &&x : pLayerInput)
     {
 
         if (pfnProgress)
@@ -4469,7 +5168,7 @@ OGRErr OGRLayer::SymDifference(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         // set up the filter on input layer
         CPLErrorReset();
         OGRGeometry *x_geom =
-            set_filter_from(this, pGeometryInputFilter, x.get());
+            set_filter_from(pLayerInput, pGeometryInputFilter, x.get());
         if (CPLGetLastErrorType() != CE_None)
         {
             if (!bSkipFailures)
@@ -4491,7 +5190,7 @@ OGRErr OGRLayer::SymDifference(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         OGRGeometryUniquePtr geom(
             x_geom
                 ->clone());  // this will be the geometry of the result feature
-        for (auto &&y : this)
+        for (auto &&y : pLayerInput)
         {
             OGRGeometry *y_geom = y->GetGeometryRef();
             if (!y_geom)
@@ -4607,6 +5306,12 @@ done:
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
  * </li>
+ * <li>USE_IN_MEMORY_INDEX=YES/NO. (GDAL >= 3.12) Set to YES to load
+ *     the features of the method layer and of the input layer in memory,
+ *     and to use a spatial index on them instead of setting spatial filters
+ *     on the layers. This is much faster with layers that have no efficient
+ *     spatial filtering, at the expense of memory usage. Defaults to NO.
+ * </li>
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::SymDifference().
@@ -4702,6 +5407,12 @@ OGRErr OGR_L_SymDifference(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  *     features with lower dimension geometry, but only if the result layer
  *     has an unknown geometry type.
  * </li>
+ * <li>USE_IN_MEMORY_INDEX=YES/NO. (GDAL >= 3.12) Set to YES to load
+ *     the features of the method layer in memory, and to use a spatial
+ *     index on them instead of setting spatial filters on the method layer.
+ *     This is much faster with layers that have no efficient spatial
+ *     filtering, at the expense of memory usage. Defaults to NO.
+ * </li>
  * </ul>
  *
  * This method is the same as the C function OGR_L_Identity().
@@ -4750,6 +5461,9 @@ OGRErr OGRLayer::Identity(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     bool bKeepLowerDimGeom = CPLTestBool(CSLFetchNameValueDef(
         papszOptions, "KEEP_LOWER_DIMENSION_GEOMETRIES", "YES"));
 
+    const bool bUseInMemoryIndex = CPLTestBool(
+        CSLFetchNameValueDef(papszOptions, "USE_IN_MEMORY_INDEX", "NO"));
+    std::unique_ptr<OGRLayerAlgebraIndexedLayer> poIndexedMethodLayer;
     // check for GEOS
     if (!OGRGeometryFactory::haveGEOS())
     {
@@ -4784,6 +5498,13 @@ OGRErr OGRLayer::Identity(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         goto done;
     poDefnResult = pLayerResult->GetLayerDefn();
 
+    if (bUseInMemoryIndex)
+    {
+        poIndexedMethodLayer =
+            std::make_unique<OGRLayerAlgebraIndexedLayer>(pLayerMethod);
+        pLayerMethod = poIndexedMethodLayer.get();
+    }
+
     // split the features in input layer to the result layer
     for (auto &&x : this)
     {
@@ -5036,6 +5757,12 @@ done:
  *     features with lower dimension geometry, but only if the result layer
  *     has an unknown geometry type.
  * </li>
+ * <li>USE_IN_MEMORY_INDEX=YES/NO. (GDAL >= 3.12) Set to YES to load
+ *     the features of the method layer in memory, and to use a spatial
+ *     index on them instead of setting spatial filters on the method layer.
+ *     This is much faster with layers that have no efficient spatial
+ *     filtering, at the expense of memory usage. Defaults to NO.
+ * </li>
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Identity().
@@ -5120,6 +5847,12 @@ OGRErr OGR_L_Identity(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
  * </li>
+ * <li>USE_IN_MEMORY_INDEX=YES/NO. (GDAL >= 3.12) Set to YES to load
+ *     the features of the method layer in memory, and to use a spatial
+ *     index on them instead of setting spatial filters on the method layer.
+ *     This is much faster with layers that have no efficient spatial
+ *     filtering, at the expense of memory usage. Defaults to NO.
+ * </li>
  * </ul>
  *
  * This method is the same as the C function OGR_L_Update().
@@ -5166,6 +5899,9 @@ OGRErr OGRLayer::Update(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     const bool bPromoteToMulti = CPLTestBool(
         CSLFetchNameValueDef(papszOptions, "PROMOTE_TO_MULTI", "NO"));
 
+    const bool bUseInMemoryIndex = CPLTestBool(
+        CSLFetchNameValueDef(papszOptions, "USE_IN_MEMORY_INDEX", "NO"));
+    std::unique_ptr<OGRLayerAlgebraIndexedLayer> poIndexedMethodLayer;
     // check for GEOS
     if (!OGRGeometryFactory::haveGEOS())
     {
@@ -5190,6 +5926,13 @@ OGRErr OGRLayer::Update(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         goto done;
     poDefnResult = pLayerResult->GetLayerDefn();
 
+    if (bUseInMemoryIndex)
+    {
+        poIndexedMethodLayer =
+            std::make_unique<OGRLayerAlgebraIndexedLayer>(pLayerMethod);
+        pLayerMethod = poIndexedMethodLayer.get();
+    }
+
     // add clipped features from the input layer
     for (auto &&x : this)
     {
@@ -5392,6 +6135,12 @@ done:
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
  * </li>
+ * <li>USE_IN_MEMORY_INDEX=YES/NO. (GDAL >= 3.12) Set to YES to load
+ *     the features of the method layer in memory, and to use a spatial
+ *     index on them instead of setting spatial filters on the method layer.
+ *     This is much faster with layers that have no efficient spatial
+ *     filtering, at the expense of memory usage. Defaults to NO.
+ * </li>
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Update().
@@ -5469,6 +6218,17 @@ OGRErr OGR_L_Update(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
  * </li>
+ * <li>USE_IN_MEMORY_INDEX=YES/NO. (GDAL >= 3.12) Set to YES to load
+ *     the features of the method layer in memory, and to use a spatial
+ *     index on them instead of setting spatial filters on the method layer.
+ *     This is much faster with layers that have no efficient spatial
+ *     filtering, at the expense of memory usage. Defaults to NO.
+ * </li>
+ * <li>NUM_THREADS=number|ALL_CPUS. (GDAL >= 3.12) Number of threads
+ *     used to process the features of the input layer, when
+ *     USE_IN_MEMORY_INDEX=YES. Defaults to the value of the
+ *     GDAL_NUM_THREADS configuration option, or 1.
+ * </li>
  * </ul>
  *
  * This method is the same as the C function OGR_L_Clip().
@@ -5510,6 +6270,8 @@ OGRErr OGRLayer::Clip(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         CPLTestBool(CSLFetchNameValueDef(papszOptions, "SKIP_FAILURES", "NO"));
     const bool bPromoteToMulti = CPLTestBool(
         CSLFetchNameValueDef(papszOptions, "PROMOTE_TO_MULTI", "NO"));
+    const bool bUseInMemoryIndex = CPLTestBool(
+        CSLFetchNameValueDef(papszOptions, "USE_IN_MEMORY_INDEX", "NO"));
 
     // check for GEOS
     if (!OGRGeometryFactory::haveGEOS())
@@ -5531,6 +6293,87 @@ OGRErr OGRLayer::Clip(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         goto done;
 
     poDefnResult = pLayerResult->GetLayerDefn();
+
+    if (bUseInMemoryIndex)
+    {
+        OGRLayerAlgebraIndex oIndex;
+        oIndex.Load(pLayerMethod);
+
+        const auto process =
+            [&](OGRFeature *x, std::vector<OGRLayerAlgebraResult> &results)
+            -> OGRErr
+        {
+            std::vector<int> candidates;
+            CPLErrorReset();
+            OGRGeometry *x_geom = get_candidates_from(
+                oIndex, pGeometryMethodFilter, x, candidates);
+            if (CPLGetLastErrorType() != CE_None)
+            {
+                if (!bSkipFailures)
+                    return OGRERR_FAILURE;
+                CPLErrorReset();
+            }
+            if (!x_geom)
+                return OGRERR_NONE;
+
+            OGRGeometryUniquePtr
+                geom;  // this will be the geometry of the result feature
+            // incrementally add area from y to geom
+            for (const int iY : candidates)
+            {
+                OGRGeometry *y_geom = oIndex.GetFeature(iY)->GetGeometryRef();
+                if (!geom)
+                {
+                    geom.reset(y_geom->clone());
+                }
+                else
+                {
+                    CPLErrorReset();
+                    OGRGeometryUniquePtr geom_new(geom->Union(y_geom));
+                    if (CPLGetLastErrorType() != CE_None ||
+                        geom_new == nullptr)
+                    {
+                        if (!bSkipFailures)
+                            return OGRERR_FAILURE;
+                        CPLErrorReset();
+                    }
+                    else
+                    {
+                        geom.swap(geom_new);
+                    }
+                }
+            }
+
+            // possibly add a new feature with area x intersection sum of y
+            if (geom)
+            {
+                CPLErrorReset();
+                OGRGeometryUniquePtr poIntersection(
+                    x_geom->Intersection(geom.get()));
+                if (CPLGetLastErrorType() != CE_None ||
+                    poIntersection == nullptr)
+                {
+                    if (!bSkipFailures)
+                        return OGRERR_FAILURE;
+                    CPLErrorReset();
+                }
+                else if (!poIntersection->IsEmpty())
+                {
+                    OGRLayerAlgebraResult result;
+                    result.poGeom = std::move(poIntersection);
+                    results.push_back(std::move(result));
+                }
+            }
+            return OGRERR_NONE;
+        };
+
+        ret = process_in_parallel(this, pLayerResult, oIndex, mapInput,
+                                  nullptr, bPromoteToMulti, bSkipFailures,
+                                  get_num_threads(papszOptions), progress_max,
+                                  pfnProgress, pProgressArg, process);
+        goto done;
+    }
+
     for (auto &&x : this)
     {
 
@@ -5701,6 +6544,17 @@ done:
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
  * </li>
+ * <li>USE_IN_MEMORY_INDEX=YES/NO. (GDAL >= 3.12) Set to YES to load
+ *     the features of the method layer in memory, and to use a spatial
+ *     index on them instead of setting spatial filters on the method layer.
+ *     This is much faster with layers that have no efficient spatial
+ *     filtering, at the expense of memory usage. Defaults to NO.
+ * </li>
+ * <li>NUM_THREADS=number|ALL_CPUS. (GDAL >= 3.12) Number of threads
+ *     used to process the features of the input layer, when
+ *     USE_IN_MEMORY_INDEX=YES. Defaults to the value of the
+ *     GDAL_NUM_THREADS configuration option, or 1.
+ * </li>
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Clip().
@@ -5778,6 +6632,17 @@ OGRErr OGR_L_Clip(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
  * </li>
+ * <li>USE_IN_MEMORY_INDEX=YES/NO. (GDAL >= 3.12) Set to YES to load
+ *     the features of the method layer in memory, and to use a spatial
+ *     index on them instead of setting spatial filters on the method layer.
+ *     This is much faster with layers that have no efficient spatial
+ *     filtering, at the expense of memory usage. Defaults to NO.
+ * </li>
+ * <li>NUM_THREADS=number|ALL_CPUS. (GDAL >= 3.12) Number of threads
+ *     used to process the features of the input layer, when
+ *     USE_IN_MEMORY_INDEX=YES. Defaults to the value of the
+ *     GDAL_NUM_THREADS configuration option, or 1.
+ * </li>
  * </ul>
  *
  * This method is the same as the C function OGR_L_Erase().
@@ -5819,6 +6684,8 @@ OGRErr OGRLayer::Erase(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         CPLTestBool(CSLFetchNameValueDef(papszOptions, "SKIP_FAILURES", "NO"));
     const bool bPromoteToMulti = CPLTestBool(
         CSLFetchNameValueDef(papszOptions, "PROMOTE_TO_MULTI", "NO"));
+    const bool bUseInMemoryIndex = CPLTestBool(
+        CSLFetchNameValueDef(papszOptions, "USE_IN_MEMORY_INDEX", "NO"));
 
     // check for GEOS
     if (!OGRGeometryFactory::haveGEOS())
@@ -5841,6 +6708,67 @@ OGRErr OGRLayer::Erase(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         goto done;
     poDefnResult = pLayerResult->GetLayerDefn();
 
+    if (bUseInMemoryIndex)
+    {
+        OGRLayerAlgebraIndex oIndex;
+        oIndex.Load(pLayerMethod);
+
+        const auto process =
+            [&](OGRFeature *x, std::vector<OGRLayerAlgebraResult> &results)
+            -> OGRErr
+        {
+            std::vector<int> candidates;
+            CPLErrorReset();
+            OGRGeometry *x_geom = get_candidates_from(
+                oIndex, pGeometryMethodFilter, x, candidates);
+            if (CPLGetLastErrorType() != CE_None)
+            {
+                if (!bSkipFailures)
+                    return OGRERR_FAILURE;
+                CPLErrorReset();
+            }
+            if (!x_geom)
+                return OGRERR_NONE;
+
+            OGRGeometryUniquePtr geom(
+                x_geom->clone());  // this will be the geometry of the result
+            // incrementally erase y from geom
+            for (const int iY : candidates)
+            {
+                OGRGeometry *y_geom = oIndex.GetFeature(iY)->GetGeometryRef();
+                CPLErrorReset();
+                OGRGeometryUniquePtr geom_new(geom->Difference(y_geom));
+                if (CPLGetLastErrorType() != CE_None || geom_new == nullptr)
+                {
+                    if (!bSkipFailures)
+                        return OGRERR_FAILURE;
+                    CPLErrorReset();
+                }
+                else
+                {
+                    geom.swap(geom_new);
+                    if (geom->IsEmpty())
+                        break;
+                }
+            }
+
+            // add a new feature if there is remaining area
+            if (!geom->IsEmpty())
+            {
+                OGRLayerAlgebraResult result;
+                result.poGeom = std::move(geom);
+                results.push_back(std::move(result));
+            }
+            return OGRERR_NONE;
+        };
+
+        ret = process_in_parallel(this, pLayerResult, oIndex, mapInput,
+                                  nullptr, bPromoteToMulti, bSkipFailures,
+                                  get_num_threads(papszOptions), progress_max,
+                                  pfnProgress, pProgressArg, process);
+        goto done;
+    }
+
     for (auto &&x : this)
     {
 
@@ -5989,6 +6917,17 @@ done:
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
  * </li>
+ * <li>USE_IN_MEMORY_INDEX=YES/NO. (GDAL >= 3.12) Set to YES to load
+ *     the features of the method layer in memory, and to use a spatial
+ *     index on them instead of setting spatial filters on the method layer.
+ *     This is much faster with layers that have no efficient spatial
+ *     filtering, at the expense of memory usage. Defaults to NO.
+ * </li>
+ * <li>NUM_THREADS=number|ALL_CPUS. (GDAL >= 3.12) Number of threads
+ *     used to process the features of the input layer, when
+ *     USE_IN_MEMORY_INDEX=YES. Defaults to the value of the
+ *     GDAL_NUM_THREADS configuration option, or 1.
+ * </li>
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Erase().
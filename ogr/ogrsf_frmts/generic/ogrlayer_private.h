@@ -14,6 +14,7 @@
 #define OGRLAYER_PRIVATE_H_INCLUDED
 
 #include "ogrsf_frmts.h"
+#include "ogr_wkb.h"
 
 //! @cond Doxygen_Suppress
 struct OGRLayer::Private
@@ -40,6 +41,9 @@ struct OGRLayer::Private
 
     //! Whether OGRGeometry::SetPrecision() should be applied. Only valid after ConvertGeomsIfNecessary() has been called.
     bool m_bApplyGeomSetPrecision = false;
+
+    //! m_poFilterGeom prepared for FilterWKBGeometry(), when it is polygonal
+    std::unique_ptr<OGRWKBPreparedPolygon> m_poPreparedWKBFilterGeom{};
 };
 
 //! @endcond
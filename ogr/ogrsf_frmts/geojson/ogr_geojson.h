@@ -73,6 +73,7 @@ class OGRGeoJSONLayer final : public OGRMemLayer
 
     virtual void ResetReading() override;
     virtual OGRFeature *GetNextFeature() override;
+    bool GetNextFeatureInto(OGRFeature &oFeature) override;
     virtual OGRFeature *GetFeature(GIntBig nFID) override;
     virtual GIntBig GetFeatureCount(int bForce) override;
 
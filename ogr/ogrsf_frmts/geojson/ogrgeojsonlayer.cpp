@@ -163,6 +163,48 @@ OGRFeature *OGRGeoJSONLayer::GetNextFeature()
     }
 }
 
+/************************************************************************/
+/*                         GetNextFeatureInto()                         */
+/************************************************************************/
+
+bool OGRGeoJSONLayer::GetNextFeatureInto(OGRFeature &oFeature)
+{
+    if (oFeature.GetDefnRef() != GetLayerDefn())
+    {
+        return OGRLayer::GetNextFeatureInto(oFeature);
+    }
+    else if (poReader_)
+    {
+        if (bHasAppendedFeatures_)
+        {
+            ResetReading();
+        }
+        while (true)
+        {
+            if (!poReader_->GetNextFeature(this, &oFeature))
+                return false;
+            if ((m_poFilterGeom == nullptr ||
+                 FilterGeometry(
+                     oFeature.GetGeomFieldRef(m_iGeomFieldFilter))) &&
+                (m_poAttrQuery == nullptr ||
+                 m_poAttrQuery->Evaluate(&oFeature)))
+            {
+                nFeatureReadSinceReset_++;
+                return true;
+            }
+        }
+    }
+    else
+    {
+        const bool bRet = OGRMemLayer::GetNextFeatureInto(oFeature);
+        if (bRet)
+        {
+            nFeatureReadSinceReset_++;
+        }
+        return bRet;
+    }
+}
+
 /************************************************************************/
 /*                          GetFeatureCount()                           */
 /************************************************************************/
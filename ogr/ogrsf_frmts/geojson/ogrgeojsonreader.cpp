@@ -21,6 +21,7 @@
 
 #include <cmath>
 #include <limits>
+#include <memory>
 #include <set>
 #include <functional>
 
@@ -36,6 +37,9 @@ class OGRGeoJSONReaderStreamingParser final
 
     std::vector<OGRFeature *> m_apoFeatures{};
     size_t m_nCurFeatureIdx = 0;
+    // Feature objects given back by GetNextFeature(poFeatureToFill), that
+    // are reused by GotFeature()
+    std::vector<std::unique_ptr<OGRFeature>> m_apoFeaturesToReuse{};
     bool m_bOriginalIdModifiedEmitted = false;
     std::set<GIntBig> m_oSetUsedFIDs{};
 
@@ -60,7 +64,7 @@ class OGRGeoJSONReaderStreamingParser final
 
     void FinalizeLayerDefn();
 
-    OGRFeature *GetNextFeature();
+    OGRFeature *GetNextFeature(OGRFeature *poFeatureToFill = nullptr);
 
     inline bool GetOriginalIdModifiedEmitted() const
     {
@@ -251,15 +255,26 @@ OGRGeoJSONReaderStreamingParser::~OGRGeoJSONReaderStreamingParser()
 
 /************************************************************************/
 /*                          GetNextFeature()                            */
+/*                                                                      */
+/*      If poFeatureToFill is not null, the content of the next         */
+/*      feature is swapped into it, and the feature object that held    */
+/*      it is kept to be reused by GotFeature().                        */
 /************************************************************************/
 
-OGRFeature *OGRGeoJSONReaderStreamingParser::GetNextFeature()
+OGRFeature *
+OGRGeoJSONReaderStreamingParser::GetNextFeature(OGRFeature *poFeatureToFill)
 {
     if (m_nCurFeatureIdx < m_apoFeatures.size())
     {
         OGRFeature *poFeat = m_apoFeatures[m_nCurFeatureIdx];
         m_apoFeatures[m_nCurFeatureIdx] = nullptr;
         m_nCurFeatureIdx++;
+        if (poFeatureToFill)
+        {
+            poFeatureToFill->Swap(*poFeat);
+            m_apoFeaturesToReuse.emplace_back(poFeat);
+            return poFeatureToFill;
+        }
         return poFeat;
     }
     m_nCurFeatureIdx = 0;
@@ -285,8 +300,14 @@ void OGRGeoJSONReaderStreamingParser::GotFeature(json_object *poObj,
     }
     else
     {
-        OGRFeature *poFeat =
-            m_oReader.ReadFeature(m_poLayer, poObj, osJson.c_str());
+        OGRFeature *poFeatureToReuse = nullptr;
+        if (!m_apoFeaturesToReuse.empty())
+        {
+            poFeatureToReuse = m_apoFeaturesToReuse.back().release();
+            m_apoFeaturesToReuse.pop_back();
+        }
+        OGRFeature *poFeat = m_oReader.ReadFeature(
+            m_poLayer, poObj, osJson.c_str(), poFeatureToReuse);
         if (poFeat)
         {
             GIntBig nFID = poFeat->GetFID();
@@ -663,9 +684,13 @@ void OGRGeoJSONReader::ResetReading()
 
 /************************************************************************/
 /*                           GetNextFeature()                           */
+/*                                                                      */
+/*      If poFeatureToFill is not null, the next feature is read into   */
+/*      it, and it is returned.                                         */
 /************************************************************************/
 
-OGRFeature *OGRGeoJSONReader::GetNextFeature(OGRGeoJSONLayer *poLayer)
+OGRFeature *OGRGeoJSONReader::GetNextFeature(OGRGeoJSONLayer *poLayer,
+                                             OGRFeature *poFeatureToFill)
 {
     CPLAssert(fp_);
     if (poStreamingParser_ == nullptr)
@@ -679,7 +704,7 @@ OGRFeature *OGRGeoJSONReader::GetNextFeature(OGRGeoJSONLayer *poLayer)
         bJSonPLikeWrapper_ = false;
     }
 
-    OGRFeature *poFeat = poStreamingParser_->GetNextFeature();
+    OGRFeature *poFeat = poStreamingParser_->GetNextFeature(poFeatureToFill);
     if (poFeat)
         return poFeat;
 
@@ -703,7 +728,7 @@ OGRFeature *OGRGeoJSONReader::GetNextFeature(OGRGeoJSONLayer *poLayer)
             break;
         }
 
-        poFeat = poStreamingParser_->GetNextFeature();
+        poFeat = poStreamingParser_->GetNextFeature(poFeatureToFill);
         if (poFeat)
             return poFeat;
 
@@ -2156,12 +2181,22 @@ void OGRGeoJSONReaderSetField(OGRLayer *poLayer, OGRFeature *poFeature,
 
 OGRFeature *OGRGeoJSONBaseReader::ReadFeature(OGRLayer *poLayer,
                                               json_object *poObj,
-                                              const char *pszSerializedObj)
+                                              const char *pszSerializedObj,
+                                              OGRFeature *poFeatureToReuse)
 {
     CPLAssert(nullptr != poObj);
 
     OGRFeatureDefn *poFDefn = poLayer->GetLayerDefn();
-    OGRFeature *poFeature = new OGRFeature(poFDefn);
+    OGRFeature *poFeature = poFeatureToReuse;
+    if (poFeature)
+    {
+        CPLAssert(poFeature->GetDefnRef() == poFDefn);
+        poFeature->Reset();
+    }
+    else
+    {
+        poFeature = new OGRFeature(poFDefn);
+    }
 
     if (bStoreNativeData_)
     {
@@ -84,7 +84,8 @@ class OGRGeoJSONBaseReader
     OGRGeometry *ReadGeometry(json_object *poObj,
                               OGRSpatialReference *poLayerSRS);
     OGRFeature *ReadFeature(OGRLayer *poLayer, json_object *poObj,
-                            const char *pszSerializedObj);
+                            const char *pszSerializedObj,
+                            OGRFeature *poFeatureToReuse = nullptr);
 
     bool ExtentRead() const;
 
@@ -150,7 +151,8 @@ class OGRGeoJSONReader : public OGRGeoJSONBaseReader
     }
 
     void ResetReading();
-    OGRFeature *GetNextFeature(OGRGeoJSONLayer *poLayer);
+    OGRFeature *GetNextFeature(OGRGeoJSONLayer *poLayer,
+                               OGRFeature *poFeatureToFill = nullptr);
     OGRFeature *GetFeature(OGRGeoJSONLayer *poLayer, GIntBig nFID);
     bool IngestAll(OGRGeoJSONLayer *poLayer);
 
@@ -42,6 +42,7 @@
 
 class OGRLayerAttrIndex;
 class OGRSFDriver;
+class OGRWKBPreparedPolygon;
 
 struct ArrowArrayStream;
 
@@ -212,6 +213,7 @@ class CPL_DLL OGRLayer : public GDALMajorObject
 
     virtual void ResetReading() = 0;
     virtual OGRFeature *GetNextFeature() CPL_WARN_UNUSED_RESULT = 0;
+    virtual bool GetNextFeatureInto(OGRFeature &oFeature);
     virtual OGRErr SetNextByIndex(GIntBig nIndex);
     virtual OGRFeature *GetFeature(GIntBig nFID) CPL_WARN_UNUSED_RESULT;
 
@@ -399,6 +401,13 @@ class CPL_DLL OGRLayer : public GDALMajorObject
                                   bool bFilterIsEnvelope,
                                   const OGREnvelope &sFilterEnvelope,
                                   OGRPreparedGeometry *&poPreparedFilterGeom);
+
+    static bool FilterWKBGeometry(
+        const GByte *pabyWKB, size_t nWKBSize, bool bEnvelopeAlreadySet,
+        OGREnvelope &sEnvelope, const OGRGeometry *poFilterGeom,
+        bool bFilterIsEnvelope, const OGREnvelope &sFilterEnvelope,
+        OGRPreparedGeometry *&poPreparedFilterGeom,
+        const OGRWKBPreparedPolygon *poPreparedWKBFilterGeom);
     //! @endcond
 
     /** Field name used by GetArrowSchema() for a FID column when
@@ -20,6 +20,7 @@
 
 #include "cpl_time.h"
 #include "ogr_api.h"
+#include "ogr_wkb.h"
 
 #include "ogr_parquet.h"
 
@@ -396,6 +397,8 @@ static arrow::Status ExecOGRWKBIntersects(cp::KernelContext *ctx,
     OGREnvelope sFilterEnvelope;
     poFilterGeom->getEnvelope(&sFilterEnvelope);
     const bool bFilterIsEnvelope = poFilterGeom->IsRectangle();
+    const auto poPreparedWKBFilterGeom =
+        OGRWKBPreparedPolygon::Create(poFilterGeom.get());
 
     // Deal with input array
     CPLAssert(batch.num_values() == 1);
@@ -432,7 +435,7 @@ static arrow::Status ExecOGRWKBIntersects(cp::KernelContext *ctx,
                 pabyWkb, nWkbSize,
                 /* bEnvelopeAlreadySet = */ false, sEnvelope,
                 poFilterGeom.get(), bFilterIsEnvelope, sFilterEnvelope,
-                pPreparedFilterGeom);
+                pPreparedFilterGeom, poPreparedWKBFilterGeom.get());
         }
         if (bOutputVal)
             arrow::bit_util::SetBit(pabitsOutValues, i + nOutOffset);
@@ -38,9 +38,16 @@
 OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
                               OGRFeatureDefn *poDefn, int iShape,
                               SHPObject *psShape, const char *pszSHPEncoding,
-                              bool &bHasWarnedWrongWindingOrder);
+                              bool &bHasWarnedWrongWindingOrder,
+                              OGRFeature *poFeatureToReuse = nullptr);
 OGRGeometry *SHPReadOGRObject(SHPHandle hSHP, int iShape, SHPObject *psShape,
-                              bool &bHasWarnedWrongWindingOrder);
+                              bool &bHasWarnedWrongWindingOrder,
+                              OGRGeometry *poGeomToReuse = nullptr);
+void SHPReadOGRObjectAsWKB(SHPHandle hSHP, int iShape,
+                           OGRwkbGeometryType eLayerGeomType,
+                           bool &bHasWarnedWrongWindingOrder,
+                           std::vector<GByte> &abyWKB);
+void SHPParseDBFDate(const char *pszDateValue, OGRField &sFld);
 OGRFeatureDefn *SHPReadOGRFeatureDefn(const char *pszName, SHPHandle hSHP,
                                       DBFHandle hDBF,
                                       const char *pszSHPEncoding,
@@ -116,6 +123,7 @@ class OGRShapeLayer final : public OGRAbstractProxiedLayer
     int ResetGeomType(int nNewType);
 
     bool ScanIndices();
+    OGRFeature *GetNextFeatureInternal(OGRFeature *poFeatureToReuse);
 
     GIntBig *m_panMatchingFIDs = nullptr;
     int m_iMatchingFID = 0;
@@ -168,6 +176,7 @@ class OGRShapeLayer final : public OGRAbstractProxiedLayer
     bool m_bRewindOnWrite = false;
     bool m_bHasWarnedWrongWindingOrder = false;
     bool m_bLastGetNextArrowArrayUsedOptimizedCodePath = false;
+    std::vector<GByte> m_abyArrowWKB{};
 
     bool m_bAutoRepack = false;
 
@@ -211,7 +220,8 @@ class OGRShapeLayer final : public OGRAbstractProxiedLayer
 
     void UpdateFollowingDeOrRecompression();
 
-    OGRFeature *FetchShape(int iShapeId);
+    OGRFeature *FetchShape(int iShapeId,
+                           OGRFeature *poFeatureToReuse = nullptr);
     int GetFeatureCountWithSpatialFilterOnly();
 
     OGRShapeLayer(OGRShapeDataSource *poDSIn, const char *pszName,
@@ -226,6 +236,7 @@ class OGRShapeLayer final : public OGRAbstractProxiedLayer
 
     void ResetReading() override;
     OGRFeature *GetNextFeature() override;
+    bool GetNextFeatureInto(OGRFeature &oFeature) override;
     OGRErr SetNextByIndex(GIntBig nIndex) override;
 
     int GetNextArrowArray(struct ArrowArrayStream *,
@@ -880,9 +880,13 @@ OGRErr OGRShapeLayer::SetNextByIndex(GIntBig nIndex)
 /*                                                                      */
 /*      Take a shape id, a geometry, and a feature, and set the feature */
 /*      if the shapeid bbox intersects the geometry.                    */
+/*                                                                      */
+/*      If poFeatureToReuse is not null, it is filled and returned,     */
+/*      instead of a new feature.                                       */
 /************************************************************************/
 
-OGRFeature *OGRShapeLayer::FetchShape(int iShapeId)
+OGRFeature *OGRShapeLayer::FetchShape(int iShapeId,
+                                      OGRFeature *poFeatureToReuse)
 
 {
     OGRFeature *poFeature = nullptr;
@@ -901,9 +905,9 @@ OGRFeature *OGRShapeLayer::FetchShape(int iShapeId)
               psShape->dfYMin == psShape->dfYMax)) ||
             psShape->nSHPType == SHPT_NULL)
         {
-            poFeature = SHPReadOGRFeature(m_hSHP, m_hDBF, m_poFeatureDefn,
-                                          iShapeId, psShape, m_osEncoding,
-                                          m_bHasWarnedWrongWindingOrder);
+            poFeature = SHPReadOGRFeature(
+                m_hSHP, m_hDBF, m_poFeatureDefn, iShapeId, psShape,
+                m_osEncoding, m_bHasWarnedWrongWindingOrder, poFeatureToReuse);
         }
         else if (m_sFilterEnvelope.MaxX < psShape->dfXMin ||
                  m_sFilterEnvelope.MaxY < psShape->dfYMin ||
@@ -915,16 +919,16 @@ OGRFeature *OGRShapeLayer::FetchShape(int iShapeId)
         }
         else
         {
-            poFeature = SHPReadOGRFeature(m_hSHP, m_hDBF, m_poFeatureDefn,
-                                          iShapeId, psShape, m_osEncoding,
-                                          m_bHasWarnedWrongWindingOrder);
+            poFeature = SHPReadOGRFeature(
+                m_hSHP, m_hDBF, m_poFeatureDefn, iShapeId, psShape,
+                m_osEncoding, m_bHasWarnedWrongWindingOrder, poFeatureToReuse);
         }
     }
     else
     {
-        poFeature = SHPReadOGRFeature(m_hSHP, m_hDBF, m_poFeatureDefn, iShapeId,
-                                      nullptr, m_osEncoding,
-                                      m_bHasWarnedWrongWindingOrder);
+        poFeature = SHPReadOGRFeature(
+            m_hSHP, m_hDBF, m_poFeatureDefn, iShapeId, nullptr, m_osEncoding,
+            m_bHasWarnedWrongWindingOrder, poFeatureToReuse);
     }
 
     return poFeature;
@@ -936,6 +940,32 @@ OGRFeature *OGRShapeLayer::FetchShape(int iShapeId)
 
 OGRFeature *OGRShapeLayer::GetNextFeature()
 
+{
+    return GetNextFeatureInternal(nullptr);
+}
+
+/************************************************************************/
+/*                         GetNextFeatureInto()                         */
+/************************************************************************/
+
+bool OGRShapeLayer::GetNextFeatureInto(OGRFeature &oFeature)
+
+{
+    if (oFeature.GetDefnRef() != m_poFeatureDefn)
+        return OGRLayer::GetNextFeatureInto(oFeature);
+
+    return GetNextFeatureInternal(&oFeature) != nullptr;
+}
+
+/************************************************************************/
+/*                       GetNextFeatureInternal()                       */
+/*                                                                      */
+/*      Return the next feature, either in a newly allocated feature    */
+/*      or in poFeatureToReuse if it is not null.                       */
+/************************************************************************/
+
+OGRFeature *OGRShapeLayer::GetNextFeatureInternal(OGRFeature *poFeatureToReuse)
+
 {
     if (!TouchLayer())
         return nullptr;
@@ -968,7 +998,8 @@ OGRFeature *OGRShapeLayer::GetNextFeature()
             // Check the shape object's geometry, and if it matches
             // any spatial filter, return it.
             poFeature =
-                FetchShape(static_cast<int>(m_panMatchingFIDs[m_iMatchingFID]));
+                FetchShape(static_cast<int>(m_panMatchingFIDs[m_iMatchingFID]),
+                           poFeatureToReuse);
 
             m_iMatchingFID++;
         }
@@ -987,10 +1018,10 @@ OGRFeature *OGRShapeLayer::GetNextFeature()
                          VSIFErrorL(VSI_SHP_GetVSIL(m_hDBF->fp)))
                     return nullptr;  //* I/O error.
                 else
-                    poFeature = FetchShape(m_iNextShapeId);
+                    poFeature = FetchShape(m_iNextShapeId, poFeatureToReuse);
             }
             else
-                poFeature = FetchShape(m_iNextShapeId);
+                poFeature = FetchShape(m_iNextShapeId, poFeatureToReuse);
 
             m_iNextShapeId++;
         }
@@ -1012,7 +1043,8 @@ OGRFeature *OGRShapeLayer::GetNextFeature()
                 return poFeature;
             }
 
-            delete poFeature;
+            if (poFeature != poFeatureToReuse)
+                delete poFeature;
         }
     }
 }
@@ -3848,12 +3880,113 @@ GDALDataset *OGRShapeLayer::GetDataset()
     return m_poDS;
 }
 
+/************************************************************************/
+/*                          ParseDBFInteger()                           */
+/*                                                                      */
+/*      Fast parsing of a DBF numeric value made of an optional sign    */
+/*      and at most 18 digits. Returns false if the value must go       */
+/*      through the generic parsing functions.                          */
+/************************************************************************/
+
+static bool ParseDBFInteger(const char *pszVal, int64_t &nVal)
+{
+    const char *pszIter = pszVal;
+    const bool bNegative = *pszIter == '-';
+    if (*pszIter == '-' || *pszIter == '+')
+        ++pszIter;
+    const char *const pszDigitsStart = pszIter;
+    uint64_t nAbsVal = 0;
+    while (*pszIter >= '0' && *pszIter <= '9')
+    {
+        nAbsVal = nAbsVal * 10 + static_cast<unsigned>(*pszIter - '0');
+        ++pszIter;
+    }
+    const auto nDigits = pszIter - pszDigitsStart;
+    if (*pszIter != '\0' || nDigits == 0 || nDigits > 18)
+        return false;
+    nVal = bNegative ? -static_cast<int64_t>(nAbsVal)
+                     : static_cast<int64_t>(nAbsVal);
+    return true;
+}
+
+/************************************************************************/
+/*                           ParseDBFReal()                             */
+/*                                                                      */
+/*      Fast parsing of a DBF numeric value in fixed point notation.    */
+/*      Only values whose significant digits fit in the 53 bit          */
+/*      mantissa of a double, with at most 22 fractional digits, are    */
+/*      handled: the result of the division by an exact power of ten    */
+/*      is then correctly rounded, and thus the same as CPLStrtod().    */
+/*      Returns false if the value must go through CPLStrtod().         */
+/************************************************************************/
+
+static bool ParseDBFReal(const char *pszVal, double &dfVal)
+{
+    static const double adfPowersOfTen[] = {
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+    const char *pszIter = pszVal;
+    const bool bNegative = *pszIter == '-';
+    if (*pszIter == '-' || *pszIter == '+')
+        ++pszIter;
+    uint64_t nMantissa = 0;
+    int nDigits = 0;
+    int nFractionalDigits = 0;
+    while (*pszIter >= '0' && *pszIter <= '9')
+    {
+        nMantissa = nMantissa * 10 + static_cast<unsigned>(*pszIter - '0');
+        ++nDigits;
+        ++pszIter;
+    }
+    if (*pszIter == '.')
+    {
+        ++pszIter;
+        // Trailing zeros, as written for fields with a large precision,
+        // are skipped.
+        int nPendingZeros = 0;
+        while (*pszIter >= '0' && *pszIter <= '9')
+        {
+            if (*pszIter == '0')
+            {
+                ++nPendingZeros;
+            }
+            else
+            {
+                for (; nPendingZeros >= 0; --nPendingZeros)
+                {
+                    nMantissa *= 10;
+                    ++nDigits;
+                    ++nFractionalDigits;
+                }
+                nMantissa += static_cast<unsigned>(*pszIter - '0');
+                nPendingZeros = 0;
+                if (nDigits > 19)
+                    return false;
+            }
+            ++pszIter;
+        }
+    }
+    constexpr uint64_t MAX_EXACT_MANTISSA = static_cast<uint64_t>(1) << 53;
+    if (*pszIter != '\0' || nDigits == 0 || nDigits > 19 ||
+        nMantissa > MAX_EXACT_MANTISSA ||
+        nFractionalDigits >= static_cast<int>(CPL_ARRAYSIZE(adfPowersOfTen)))
+    {
+        return false;
+    }
+    dfVal = static_cast<double>(nMantissa) / adfPowersOfTen[nFractionalDigits];
+    if (bNegative)
+        dfVal = -dfVal;
+    return true;
+}
+
 /************************************************************************/
 /*                        GetNextArrowArray()                           */
 /************************************************************************/
 
-// Specialized implementation restricted to situations where only retrieving
-// of FID values is asked (without filters)
+// Specialized implementation that decodes the .shp and .dbf records
+// straight into the buffers of the Arrow array, without going through
+// OGRFeature and OGRGeometry objects, for situations without filters.
 // In other cases, fall back to generic implementation.
 int OGRShapeLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
                                      struct ArrowArray *out_array)
@@ -3865,21 +3998,32 @@ int OGRShapeLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
         return EIO;
     }
 
-    if (!m_hDBF || m_poAttrQuery != nullptr || m_poFilterGeom != nullptr)
+    if (m_poAttrQuery != nullptr || m_poFilterGeom != nullptr ||
+        !m_poSharedArrowArrayStreamPrivateData->m_anQueriedFIDs.empty() ||
+        (m_hSHP && m_hDBF && m_hSHP->nRecords != m_hDBF->nRecords) ||
+        CPLTestBool(CPLGetConfigOption("OGR_SHAPE_STREAM_BASE_IMPL", "NO")))
     {
         return OGRLayer::GetNextArrowArray(stream, out_array);
     }
 
-    // If any field is not ignored, use generic implementation
     const int nFieldCount = m_poFeatureDefn->GetFieldCount();
     for (int i = 0; i < nFieldCount; ++i)
     {
-        if (!m_poFeatureDefn->GetFieldDefn(i)->IsIgnored())
+        const auto poFieldDefn = m_poFeatureDefn->GetFieldDefn(i);
+        if (poFieldDefn->IsIgnored())
+            continue;
+        const auto eType = poFieldDefn->GetType();
+        const auto eSubType = poFieldDefn->GetSubType();
+        if (!((eType == OFTString && eSubType == OFSTNone) ||
+              (eType == OFTInteger &&
+               (eSubType == OFSTNone || eSubType == OFSTBoolean)) ||
+              (eType == OFTInteger64 && eSubType == OFSTNone) ||
+              (eType == OFTReal && eSubType == OFSTNone) ||
+              (eType == OFTDate && eSubType == OFSTNone)))
+        {
             return OGRLayer::GetNextArrowArray(stream, out_array);
+        }
     }
-    if (GetGeomType() != wkbNone &&
-        !m_poFeatureDefn->GetGeomFieldDefn(0)->IsIgnored())
-        return OGRLayer::GetNextArrowArray(stream, out_array);
 
     OGRArrowArrayHelper sHelper(m_poDS, m_poFeatureDefn,
                                 m_aosArrowArrayStreamOptions, out_array);
@@ -3888,41 +4032,336 @@ int OGRShapeLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
         return ENOMEM;
     }
 
-    if (!sHelper.m_bIncludeFID)
+    if (sHelper.m_nChildren == 0)
     {
         out_array->release(out_array);
         return OGRLayer::GetNextArrowArray(stream, out_array);
     }
 
     m_bLastGetNextArrowArrayUsedOptimizedCodePath = true;
-    int nCount = 0;
-    while (m_iNextShapeId < m_nTotalShapeCount)
-    {
-        const bool bIsDeleted =
-            CPL_TO_BOOL(DBFIsRecordDeleted(m_hDBF, m_iNextShapeId));
-        if (bIsDeleted)
+
+    const int iGeomArrowField = sHelper.m_nGeomFieldCount > 0
+                                    ? sHelper.m_mapOGRGeomFieldToArrowField[0]
+                                    : -1;
+    const OGRwkbGeometryType eLayerGeomType =
+        iGeomArrowField >= 0 ? m_poFeatureDefn->GetGeomFieldDefn(0)->GetType()
+                             : wkbNone;
+    const bool bGeomNullable =
+        iGeomArrowField >= 0 &&
+        CPL_TO_BOOL(m_poFeatureDefn->GetGeomFieldDefn(0)->IsNullable());
+
+    // Only recode strings with non-ASCII characters when the encoding is
+    // a superset of ASCII.
+    const bool bRecode = !m_osEncoding.empty();
+    const bool bASCIICompatibleEncoding =
+        EQUAL(m_osEncoding.c_str(), CPL_ENC_UTF8) ||
+        STARTS_WITH_CI(m_osEncoding.c_str(), "ISO-8859-") ||
+        STARTS_WITH_CI(m_osEncoding.c_str(), "CP125");
+
+    const bool bWarn = CPLTestBool(
+        CPLGetConfigOption("OGR_SETFIELD_NUMERIC_WARNING", "YES"));
+    const uint32_t nMemLimit = OGRArrowArrayHelper::GetMemLimit();
+
+    struct tm brokenDown;
+    memset(&brokenDown, 0, sizeof(brokenDown));
+
+    // Null values are only flagged once all the values of a record have
+    // been written, as the record may be deferred to the next batch if
+    // the memory limit is reached in the middle of it.
+    std::vector<int> anNullArrowFields;
+
+    int iFeat = 0;
+    while (iFeat < sHelper.m_nMaxBatchSize &&
+           m_iNextShapeId < m_nTotalShapeCount)
+    {
+        const int iShape = m_iNextShapeId;
+        if (m_hDBF)
         {
-            ++m_iNextShapeId;
-            continue;
+            if (DBFIsRecordDeleted(m_hDBF, iShape))
+            {
+                ++m_iNextShapeId;
+                continue;
+            }
+            if (VSIFEofL(VSI_SHP_GetVSIL(m_hDBF->fp)) ||
+                VSIFErrorL(VSI_SHP_GetVSIL(m_hDBF->fp)))
+            {
+                sHelper.ClearArray();
+                return EIO;
+            }
         }
-        if (VSIFEofL(VSI_SHP_GetVSIL(m_hDBF->fp)) ||
-            VSIFErrorL(VSI_SHP_GetVSIL(m_hDBF->fp)))
+
+        anNullArrowFields.clear();
+
+        if (sHelper.m_panFIDValues)
+            sHelper.m_panFIDValues[iFeat] = iShape;
+
+        if (iGeomArrowField >= 0)
         {
-            out_array->release(out_array);
-            memset(out_array, 0, sizeof(*out_array));
-            return EIO;
+            if (m_hSHP)
+            {
+                SHPReadOGRObjectAsWKB(m_hSHP, iShape, eLayerGeomType,
+                                      m_bHasWarnedWrongWindingOrder,
+                                      m_abyArrowWKB);
+            }
+            else
+            {
+                m_abyArrowWKB.clear();
+            }
+
+            if (m_abyArrowWKB.empty())
+            {
+                if (bGeomNullable)
+                    anNullArrowFields.push_back(iGeomArrowField);
+                else
+                    OGRArrowArrayHelper::SetEmptyStringOrBinary(
+                        out_array->children[iGeomArrowField], iFeat);
+            }
+            else
+            {
+                const size_t nWKBSize = m_abyArrowWKB.size();
+                if (iFeat > 0)
+                {
+                    auto psArray = out_array->children[iGeomArrowField];
+                    auto panOffsets = static_cast<int32_t *>(
+                        const_cast<void *>(psArray->buffers[1]));
+                    const uint32_t nCurLength =
+                        static_cast<uint32_t>(panOffsets[iFeat]);
+                    if (nWKBSize <= nMemLimit &&
+                        nWKBSize > nMemLimit - nCurLength)
+                    {
+                        break;
+                    }
+                }
+
+                GByte *outPtr = sHelper.GetPtrForStringOrBinary(
+                    iGeomArrowField, iFeat, nWKBSize);
+                if (outPtr == nullptr)
+                {
+                    sHelper.ClearArray();
+                    return ENOMEM;
+                }
+                memcpy(outPtr, m_abyArrowWKB.data(), nWKBSize);
+            }
         }
-        sHelper.m_panFIDValues[nCount] = m_iNextShapeId;
-        ++m_iNextShapeId;
-        ++nCount;
-        if (nCount == sHelper.m_nMaxBatchSize)
+
+        bool bMemLimitReached = false;
+        for (int iField = 0; m_hDBF != nullptr && iField < nFieldCount;
+             ++iField)
+        {
+            const int iArrowField = sHelper.m_mapOGRFieldToArrowField[iField];
+            if (iArrowField < 0)
+                continue;
+            const auto poFieldDefn = m_poFeatureDefn->GetFieldDefn(iField);
+            const bool bNullable = sHelper.m_abNullableFields[iField];
+            auto psArray = out_array->children[iArrowField];
+
+            switch (poFieldDefn->GetType())
+            {
+                case OFTString:
+                {
+                    const char *pszVal =
+                        DBFReadStringAttribute(m_hDBF, iShape, iField);
+                    if (pszVal == nullptr || pszVal[0] == '\0')
+                    {
+                        if (bNullable)
+                            anNullArrowFields.push_back(iArrowField);
+                        else
+                            OGRArrowArrayHelper::SetEmptyStringOrBinary(
+                                psArray, iFeat);
+                        break;
+                    }
+
+                    size_t nLen = 0;
+                    bool bIsASCII = true;
+                    for (; pszVal[nLen] != '\0'; ++nLen)
+                    {
+                        if (static_cast<GByte>(pszVal[nLen]) >= 0x80)
+                            bIsASCII = false;
+                    }
+
+                    char *pszUTF8Val = nullptr;
+                    if (bRecode && !(bIsASCII && bASCIICompatibleEncoding))
+                    {
+                        pszUTF8Val = CPLRecode(pszVal, m_osEncoding.c_str(),
+                                               CPL_ENC_UTF8);
+                        pszVal = pszUTF8Val;
+                        nLen = strlen(pszVal);
+                    }
+
+                    if (iFeat > 0)
+                    {
+                        auto panOffsets = static_cast<int32_t *>(
+                            const_cast<void *>(psArray->buffers[1]));
+                        const uint32_t nCurLength =
+                            static_cast<uint32_t>(panOffsets[iFeat]);
+                        if (nLen <= nMemLimit && nLen > nMemLimit - nCurLength)
+                        {
+                            CPLFree(pszUTF8Val);
+                            bMemLimitReached = true;
+                            break;
+                        }
+                    }
+
+                    GByte *outPtr = sHelper.GetPtrForStringOrBinary(
+                        iArrowField, iFeat, nLen);
+                    if (outPtr == nullptr)
+                    {
+                        CPLFree(pszUTF8Val);
+                        sHelper.ClearArray();
+                        return ENOMEM;
+                    }
+                    memcpy(outPtr, pszVal, nLen);
+                    CPLFree(pszUTF8Val);
+                    break;
+                }
+
+                case OFTInteger:
+                {
+                    if (DBFIsAttributeNULL(m_hDBF, iShape, iField))
+                    {
+                        if (bNullable)
+                            anNullArrowFields.push_back(iArrowField);
+                        break;
+                    }
+
+                    if (poFieldDefn->GetSubType() == OFSTBoolean)
+                    {
+                        const char *pszVal =
+                            DBFReadLogicalAttribute(m_hDBF, iShape, iField);
+                        if (pszVal[0] == 'T' || pszVal[0] == 't' ||
+                            pszVal[0] == 'Y' || pszVal[0] == 'y')
+                        {
+                            OGRArrowArrayHelper::SetBoolOn(psArray, iFeat);
+                        }
+                        break;
+                    }
+
+                    const char *pszVal =
+                        DBFReadStringAttribute(m_hDBF, iShape, iField);
+                    int64_t nVal = 0;
+                    if (ParseDBFInteger(pszVal, nVal) && nVal >= INT_MIN &&
+                        nVal <= INT_MAX)
+                    {
+                        OGRArrowArrayHelper::SetInt32(
+                            psArray, iFeat, static_cast<int32_t>(nVal));
+                        break;
+                    }
+
+                    // Same as OGRFeature::SetField(int, const char*)
+                    errno = 0;
+                    char *pszLast = nullptr;
+                    const long long nVal64 = std::strtoll(pszVal, &pszLast, 10);
+                    const int nVal32 = nVal64 > INT_MAX   ? INT_MAX
+                                       : nVal64 < INT_MIN ? INT_MIN
+                                                          : static_cast<int>(
+                                                                nVal64);
+                    if (bWarn && (errno == ERANGE || nVal32 != nVal64 ||
+                                  !pszLast || *pszLast))
+                    {
+                        CPLError(CE_Warning, CPLE_AppDefined,
+                                 "Value '%s' of field %s.%s parsed "
+                                 "incompletely to integer %d.",
+                                 pszVal, m_poFeatureDefn->GetName(),
+                                 poFieldDefn->GetNameRef(), nVal32);
+                    }
+                    OGRArrowArrayHelper::SetInt32(psArray, iFeat, nVal32);
+                    break;
+                }
+
+                case OFTInteger64:
+                {
+                    if (DBFIsAttributeNULL(m_hDBF, iShape, iField))
+                    {
+                        if (bNullable)
+                            anNullArrowFields.push_back(iArrowField);
+                        break;
+                    }
+
+                    const char *pszVal =
+                        DBFReadStringAttribute(m_hDBF, iShape, iField);
+                    int64_t nVal = 0;
+                    if (!ParseDBFInteger(pszVal, nVal))
+                        nVal = CPLAtoGIntBigEx(pszVal, bWarn, nullptr);
+                    OGRArrowArrayHelper::SetInt64(psArray, iFeat, nVal);
+                    break;
+                }
+
+                case OFTReal:
+                {
+                    if (DBFIsAttributeNULL(m_hDBF, iShape, iField))
+                    {
+                        if (bNullable)
+                            anNullArrowFields.push_back(iArrowField);
+                        break;
+                    }
+
+                    const char *pszVal =
+                        DBFReadStringAttribute(m_hDBF, iShape, iField);
+                    double dfVal = 0;
+                    if (!ParseDBFReal(pszVal, dfVal))
+                    {
+                        // Same as OGRFeature::SetField(int, const char*)
+                        char *pszLast = nullptr;
+                        dfVal = CPLStrtod(pszVal, &pszLast);
+                        if (bWarn && (!pszLast || *pszLast))
+                        {
+                            CPLError(CE_Warning, CPLE_AppDefined,
+                                     "Value '%s' of field %s.%s parsed "
+                                     "incompletely to real %.16g.",
+                                     pszVal, m_poFeatureDefn->GetName(),
+                                     poFieldDefn->GetNameRef(), dfVal);
+                        }
+                    }
+                    OGRArrowArrayHelper::SetDouble(psArray, iFeat, dfVal);
+                    break;
+                }
+
+                case OFTDate:
+                {
+                    if (DBFIsAttributeNULL(m_hDBF, iShape, iField))
+                    {
+                        if (bNullable)
+                            anNullArrowFields.push_back(iArrowField);
+                        break;
+                    }
+
+                    OGRField sFld;
+                    SHPParseDBFDate(
+                        DBFReadStringAttribute(m_hDBF, iShape, iField), sFld);
+                    OGRArrowArrayHelper::SetDate(psArray, iFeat, brokenDown,
+                                                 sFld);
+                    break;
+                }
+
+                default:
+                    CPLAssert(false);
+                    break;
+            }
+
+            if (bMemLimitReached)
+                break;
+        }
+        if (bMemLimitReached)
             break;
+
+        for (const int iArrowField : anNullArrowFields)
+        {
+            if (!sHelper.SetNull(iArrowField, iFeat))
+            {
+                sHelper.ClearArray();
+                return ENOMEM;
+            }
+        }
+
+        ++m_iNextShapeId;
+        ++m_nFeaturesRead;
+        ++iFeat;
     }
-    sHelper.Shrink(nCount);
-    if (nCount == 0)
+
+    sHelper.Shrink(iFeat);
+    if (iFeat == 0)
     {
-        out_array->release(out_array);
-        memset(out_array, 0, sizeof(*out_array));
+        sHelper.ClearArray();
     }
     return 0;
 }
@@ -57,18 +57,20 @@ static void RingStartEnd(SHPObject *psShape, int ring, int *start, int *end)
 }
 
 /************************************************************************/
-/*                        CreateLinearRing                              */
+/*                         FillLinearRing()                             */
 /************************************************************************/
-static OGRLinearRing *CreateLinearRing(SHPObject *psShape, int ring, bool bHasZ,
-                                       bool bHasM)
+static void FillLinearRing(OGRLinearRing *poRing, SHPObject *psShape, int ring,
+                           bool bHasZ, bool bHasM)
 {
     int nRingStart = 0;
     int nRingEnd = 0;
     RingStartEnd(psShape, ring, &nRingStart, &nRingEnd);
 
-    OGRLinearRing *const poRing = new OGRLinearRing();
     if (!(nRingEnd >= nRingStart))
-        return poRing;
+    {
+        poRing->empty();
+        return;
+    }
 
     const int nRingPoints = nRingEnd - nRingStart + 1;
 
@@ -85,24 +87,55 @@ static OGRLinearRing *CreateLinearRing(SHPObject *psShape, int ring, bool bHasZ,
     else
         poRing->setPoints(nRingPoints, psShape->padfX + nRingStart,
                           psShape->padfY + nRingStart);
+}
 
+/************************************************************************/
+/*                        CreateLinearRing                              */
+/************************************************************************/
+static OGRLinearRing *CreateLinearRing(SHPObject *psShape, int ring, bool bHasZ,
+                                       bool bHasM)
+{
+    OGRLinearRing *const poRing = new OGRLinearRing();
+    FillLinearRing(poRing, psShape, ring, bHasZ, bHasM);
     return poRing;
 }
 
+/************************************************************************/
+/*                        GetGeometryToReuse()                          */
+/*                                                                      */
+/*      Return the geometry of a previously read feature, if it is of   */
+/*      the requested type, so that its coordinate arrays are recycled. */
+/************************************************************************/
+static OGRGeometry *
+GetGeometryToReuse(std::unique_ptr<OGRGeometry> &poGeomToReuse,
+                   OGRwkbGeometryType eFlatType)
+{
+    if (poGeomToReuse &&
+        wkbFlatten(poGeomToReuse->getGeometryType()) == eFlatType)
+        return poGeomToReuse.release();
+    return nullptr;
+}
+
 /************************************************************************/
 /*                          SHPReadOGRObject()                          */
 /*                                                                      */
 /*      Read an item in a shapefile, and translate to OGR geometry      */
 /*      representation.                                                 */
+/*                                                                      */
+/*      If poGeomToReuse is not null, its ownership is transferred to   */
+/*      this function, which may recycle it to store the new shape.     */
 /************************************************************************/
 
 OGRGeometry *SHPReadOGRObject(SHPHandle hSHP, int iShape, SHPObject *psShape,
-                              bool &bHasWarnedWrongWindingOrder)
+                              bool &bHasWarnedWrongWindingOrder,
+                              OGRGeometry *poGeomToReuseIn)
 {
 #if DEBUG_VERBOSE
     CPLDebug("Shape", "SHPReadOGRObject( iShape=%d )", iShape);
 #endif
 
+    std::unique_ptr<OGRGeometry> poGeomToReuse(poGeomToReuseIn);
+
     if (psShape == nullptr)
         psShape = SHPReadObject(hSHP, iShape);
 
@@ -116,29 +149,37 @@ OGRGeometry *SHPReadOGRObject(SHPHandle hSHP, int iShape, SHPObject *psShape,
     /* -------------------------------------------------------------------- */
     /*      Point.                                                          */
     /* -------------------------------------------------------------------- */
-    if (psShape->nSHPType == SHPT_POINT)
-    {
-        poOGR = new OGRPoint(psShape->padfX[0], psShape->padfY[0]);
-    }
-    else if (psShape->nSHPType == SHPT_POINTZ)
+    if (psShape->nSHPType == SHPT_POINT ||
+        psShape->nSHPType == SHPT_POINTZ || psShape->nSHPType == SHPT_POINTM)
     {
-        if (psShape->bMeasureIsUsed)
+        OGRGeometry *poReused = GetGeometryToReuse(poGeomToReuse, wkbPoint);
+        OGRPoint *poPoint = poReused ? poReused->toPoint() : new OGRPoint();
+        poOGR = poPoint;
+
+        if (psShape->nSHPType == SHPT_POINT)
+        {
+            *poPoint = OGRPoint(psShape->padfX[0], psShape->padfY[0]);
+        }
+        else if (psShape->nSHPType == SHPT_POINTZ)
         {
-            poOGR = new OGRPoint(psShape->padfX[0], psShape->padfY[0],
-                                 psShape->padfZ[0], psShape->padfM[0]);
+            if (psShape->bMeasureIsUsed)
+            {
+                *poPoint = OGRPoint(psShape->padfX[0], psShape->padfY[0],
+                                    psShape->padfZ[0], psShape->padfM[0]);
+            }
+            else
+            {
+                *poPoint = OGRPoint(psShape->padfX[0], psShape->padfY[0],
+                                    psShape->padfZ[0]);
+            }
         }
         else
         {
-            poOGR = new OGRPoint(psShape->padfX[0], psShape->padfY[0],
-                                 psShape->padfZ[0]);
+            *poPoint = OGRPoint(psShape->padfX[0], psShape->padfY[0], 0.0,
+                                psShape->padfM[0]);
+            poPoint->set3D(FALSE);
         }
     }
-    else if (psShape->nSHPType == SHPT_POINTM)
-    {
-        poOGR = new OGRPoint(psShape->padfX[0], psShape->padfY[0], 0.0,
-                             psShape->padfM[0]);
-        poOGR->set3D(FALSE);
-    }
     /* -------------------------------------------------------------------- */
     /*      Multipoint.                                                     */
     /* -------------------------------------------------------------------- */
@@ -209,19 +250,30 @@ OGRGeometry *SHPReadOGRObject(SHPHandle hSHP, int iShape, SHPObject *psShape,
         }
         else if (psShape->nParts == 1)
         {
-            OGRLineString *poOGRLine = new OGRLineString();
+            OGRGeometry *poReused =
+                GetGeometryToReuse(poGeomToReuse, wkbLineString);
+            OGRLineString *poOGRLine =
+                poReused ? poReused->toLineString() : new OGRLineString();
             poOGR = poOGRLine;
 
             if (psShape->nSHPType == SHPT_ARCZ)
+            {
                 poOGRLine->setPoints(psShape->nVertices, psShape->padfX,
                                      psShape->padfY, psShape->padfZ,
                                      psShape->padfM);
+            }
             else if (psShape->nSHPType == SHPT_ARCM)
+            {
+                poOGRLine->set3D(FALSE);
                 poOGRLine->setPointsM(psShape->nVertices, psShape->padfX,
                                       psShape->padfY, psShape->padfM);
+            }
             else
+            {
+                poOGRLine->setMeasured(FALSE);
                 poOGRLine->setPoints(psShape->nVertices, psShape->padfX,
                                      psShape->padfY);
+            }
         }
         else
         {
@@ -295,11 +347,33 @@ OGRGeometry *SHPReadOGRObject(SHPHandle hSHP, int iShape, SHPObject *psShape,
         else if (psShape->nParts == 1)
         {
             // Surely outer ring.
-            OGRPolygon *poOGRPoly = new OGRPolygon();
-            poOGR = poOGRPoly;
+            OGRGeometry *poReused =
+                GetGeometryToReuse(poGeomToReuse, wkbPolygon);
+            OGRPolygon *poOGRPoly = poReused ? poReused->toPolygon() : nullptr;
+            if (poOGRPoly && poOGRPoly->getNumInteriorRings() == 0 &&
+                poOGRPoly->getExteriorRing() != nullptr)
+            {
+                poOGR = poOGRPoly;
+
+                OGRLinearRing *poRing = poOGRPoly->getExteriorRing();
+                if (!bHasZ)
+                    poRing->set3D(FALSE);
+                if (!bHasM)
+                    poRing->setMeasured(FALSE);
+                FillLinearRing(poRing, psShape, 0, bHasZ, bHasM);
+                poOGRPoly->set3D(poRing->Is3D());
+                poOGRPoly->setMeasured(poRing->IsMeasured());
+            }
+            else
+            {
+                delete poOGRPoly;
+                poOGRPoly = new OGRPolygon();
+                poOGR = poOGRPoly;
 
-            OGRLinearRing *poRing = CreateLinearRing(psShape, 0, bHasZ, bHasM);
-            poOGRPoly->addRingDirectly(poRing);
+                OGRLinearRing *poRing =
+                    CreateLinearRing(psShape, 0, bHasZ, bHasM);
+                poOGRPoly->addRingDirectly(poRing);
+            }
         }
         else
         {
@@ -469,6 +543,299 @@ OGRGeometry *SHPReadOGRObject(SHPHandle hSHP, int iShape, SHPObject *psShape,
     return poOGR;
 }
 
+/************************************************************************/
+/*                   SetGeometryDimensionsFromLayer()                   */
+/*                                                                      */
+/*      Add or remove the Z and M dimensions of a geometry read from    */
+/*      a shape so that they match the ones of the layer.               */
+/************************************************************************/
+
+static void SetGeometryDimensionsFromLayer(OGRGeometry *poGeometry,
+                                           OGRwkbGeometryType eLayerGeomType)
+{
+    if (eLayerGeomType == wkbUnknown)
+        return;
+
+    const OGRwkbGeometryType eGeomInType = poGeometry->getGeometryType();
+    if (wkbHasZ(eLayerGeomType) && !wkbHasZ(eGeomInType))
+    {
+        poGeometry->set3D(TRUE);
+    }
+    else if (!wkbHasZ(eLayerGeomType) && wkbHasZ(eGeomInType))
+    {
+        poGeometry->set3D(FALSE);
+    }
+    if (wkbHasM(eLayerGeomType) && !wkbHasM(eGeomInType))
+    {
+        poGeometry->setMeasured(TRUE);
+    }
+    else if (!wkbHasM(eLayerGeomType) && wkbHasM(eGeomInType))
+    {
+        poGeometry->setMeasured(FALSE);
+    }
+}
+
+/************************************************************************/
+/*                          WriteWKBHeader()                            */
+/************************************************************************/
+
+static GByte *WriteWKBHeader(GByte *pabyOut, OGRwkbGeometryType eFlatType,
+                             bool bHasZ, bool bHasM)
+{
+    *pabyOut = wkbNDR;
+    uint32_t nISOType = static_cast<uint32_t>(eFlatType);
+    if (bHasZ)
+        nISOType += 1000;
+    if (bHasM)
+        nISOType += 2000;
+    CPL_LSBPTR32(&nISOType);
+    memcpy(pabyOut + 1, &nISOType, sizeof(nISOType));
+    return pabyOut + 1 + sizeof(nISOType);
+}
+
+/************************************************************************/
+/*                          WriteWKBUInt32()                            */
+/************************************************************************/
+
+static GByte *WriteWKBUInt32(GByte *pabyOut, uint32_t nVal)
+{
+    CPL_LSBPTR32(&nVal);
+    memcpy(pabyOut, &nVal, sizeof(nVal));
+    return pabyOut + sizeof(nVal);
+}
+
+/************************************************************************/
+/*                          WriteWKBPoints()                            */
+/*                                                                      */
+/*      Write nCount vertices of a shape starting at iStart, with the   */
+/*      requested dimensions. Dimensions that the shape does not have   */
+/*      are written as 0, like OGRGeometry::set3D() / setMeasured() do. */
+/************************************************************************/
+
+static GByte *WriteWKBPoints(GByte *pabyOut, const SHPObject *psShape,
+                             int iStart, int nCount, bool bHasZ, bool bHasM,
+                             bool bShapeHasZ, bool bShapeHasM)
+{
+    for (int i = iStart; i < iStart + nCount; ++i)
+    {
+        double adfXYZM[4];
+        int nDims = 0;
+        adfXYZM[nDims++] = psShape->padfX[i];
+        adfXYZM[nDims++] = psShape->padfY[i];
+        if (bHasZ)
+            adfXYZM[nDims++] = bShapeHasZ ? psShape->padfZ[i] : 0.0;
+        if (bHasM)
+            adfXYZM[nDims++] = bShapeHasM ? psShape->padfM[i] : 0.0;
+        for (int j = 0; j < nDims; ++j)
+            CPL_LSBPTR64(&adfXYZM[j]);
+        memcpy(pabyOut, adfXYZM, nDims * sizeof(double));
+        pabyOut += nDims * sizeof(double);
+    }
+    return pabyOut;
+}
+
+/************************************************************************/
+/*                       SHPReadOGRObjectAsWKB()                        */
+/*                                                                      */
+/*      Read an item in a shapefile and translate it to ISO WKB, as     */
+/*      SHPReadOGRFeature() followed by exportToWkb() would do.         */
+/*      Points, multipoints, lines and single ring polygons are         */
+/*      encoded directly from the shape, without instantiating an       */
+/*      OGRGeometry. abyWKB is left empty for a null geometry.          */
+/************************************************************************/
+
+void SHPReadOGRObjectAsWKB(SHPHandle hSHP, int iShape,
+                           OGRwkbGeometryType eLayerGeomType,
+                           bool &bHasWarnedWrongWindingOrder,
+                           std::vector<GByte> &abyWKB)
+{
+    abyWKB.clear();
+
+    SHPObject *psShape = SHPReadObject(hSHP, iShape);
+    if (psShape == nullptr)
+        return;
+
+    const int nSHPType = psShape->nSHPType;
+    const bool bShapeHasZ =
+        nSHPType == SHPT_POINTZ || nSHPType == SHPT_MULTIPOINTZ ||
+        nSHPType == SHPT_ARCZ || nSHPType == SHPT_POLYGONZ;
+    const bool bShapeIsM =
+        nSHPType == SHPT_POINTM || nSHPType == SHPT_MULTIPOINTM ||
+        nSHPType == SHPT_ARCM || nSHPType == SHPT_POLYGONM;
+    // Mimic the rules of SHPReadOGRObject() regarding when the M values
+    // of the shape are used.
+    const bool bShapeHasM =
+        psShape->padfM != nullptr && (bShapeIsM || bShapeHasZ) &&
+        (nSHPType != SHPT_POINTZ || psShape->bMeasureIsUsed);
+
+    OGRwkbGeometryType eFlatType = wkbUnknown;
+    if (nSHPType == SHPT_POINT || nSHPType == SHPT_POINTZ ||
+        nSHPType == SHPT_POINTM)
+    {
+        eFlatType = wkbPoint;
+    }
+    else if ((nSHPType == SHPT_MULTIPOINT || nSHPType == SHPT_MULTIPOINTZ ||
+              nSHPType == SHPT_MULTIPOINTM) &&
+             psShape->nVertices > 0)
+    {
+        eFlatType = wkbMultiPoint;
+    }
+    else if ((nSHPType == SHPT_ARC || nSHPType == SHPT_ARCZ ||
+              nSHPType == SHPT_ARCM) &&
+             psShape->nParts > 0)
+    {
+        eFlatType = psShape->nParts == 1 ? wkbLineString : wkbMultiLineString;
+    }
+    else if ((nSHPType == SHPT_POLYGON || nSHPType == SHPT_POLYGONZ ||
+              nSHPType == SHPT_POLYGONM) &&
+             psShape->nParts == 1)
+    {
+        int nRingStart = 0;
+        int nRingEnd = 0;
+        RingStartEnd(psShape, 0, &nRingStart, &nRingEnd);
+        if (nRingEnd >= nRingStart)
+            eFlatType = wkbPolygon;
+    }
+
+    // M shapes without M values go through the generic code path.
+    if (eFlatType == wkbUnknown || (bShapeIsM && psShape->padfM == nullptr))
+    {
+        // Multi-part polygons need to be organized, and other shapes are
+        // rare or null: go through an OGRGeometry.
+        std::unique_ptr<OGRGeometry> poGeometry(SHPReadOGRObject(
+            hSHP, iShape, psShape, bHasWarnedWrongWindingOrder));
+        if (poGeometry)
+        {
+            SetGeometryDimensionsFromLayer(poGeometry.get(), eLayerGeomType);
+            abyWKB.resize(poGeometry->WkbSize());
+            poGeometry->exportToWkb(wkbNDR, abyWKB.data(), wkbVariantIso);
+        }
+        return;
+    }
+
+    bool bHasZ = bShapeHasZ;
+    bool bHasM = bShapeHasM;
+    if (eLayerGeomType != wkbUnknown)
+    {
+        bHasZ = CPL_TO_BOOL(wkbHasZ(eLayerGeomType));
+        bHasM = CPL_TO_BOOL(wkbHasM(eLayerGeomType));
+    }
+    const size_t nPointSize =
+        (2 + (bHasZ ? 1 : 0) + (bHasM ? 1 : 0)) * sizeof(double);
+    constexpr size_t HEADER_SIZE = 1 + sizeof(uint32_t);
+    const size_t nVertices = static_cast<size_t>(psShape->nVertices);
+
+    switch (eFlatType)
+    {
+        case wkbPoint:
+        {
+            abyWKB.resize(HEADER_SIZE + nPointSize);
+            GByte *pabyOut =
+                WriteWKBHeader(abyWKB.data(), wkbPoint, bHasZ, bHasM);
+            WriteWKBPoints(pabyOut, psShape, 0, 1, bHasZ, bHasM, bShapeHasZ,
+                           bShapeHasM);
+            break;
+        }
+
+        case wkbMultiPoint:
+        {
+            abyWKB.resize(HEADER_SIZE + sizeof(uint32_t) +
+                          nVertices * (HEADER_SIZE + nPointSize));
+            GByte *pabyOut =
+                WriteWKBHeader(abyWKB.data(), wkbMultiPoint, bHasZ, bHasM);
+            pabyOut = WriteWKBUInt32(pabyOut, psShape->nVertices);
+            for (int i = 0; i < psShape->nVertices; ++i)
+            {
+                pabyOut = WriteWKBHeader(pabyOut, wkbPoint, bHasZ, bHasM);
+                pabyOut = WriteWKBPoints(pabyOut, psShape, i, 1, bHasZ, bHasM,
+                                         bShapeHasZ, bShapeHasM);
+            }
+            break;
+        }
+
+        case wkbLineString:
+        {
+            abyWKB.resize(HEADER_SIZE + sizeof(uint32_t) +
+                          nVertices * nPointSize);
+            GByte *pabyOut =
+                WriteWKBHeader(abyWKB.data(), wkbLineString, bHasZ, bHasM);
+            pabyOut = WriteWKBUInt32(pabyOut, psShape->nVertices);
+            WriteWKBPoints(pabyOut, psShape, 0, psShape->nVertices, bHasZ,
+                           bHasM, bShapeHasZ, bShapeHasM);
+            break;
+        }
+
+        case wkbMultiLineString:
+        {
+            const auto GetPartStartAndCount =
+                [psShape](int iPart, int &nStart, int &nCount)
+            {
+                if (psShape->panPartStart == nullptr)
+                {
+                    nStart = 0;
+                    nCount = psShape->nVertices;
+                }
+                else
+                {
+                    nStart = psShape->panPartStart[iPart];
+                    nCount = (iPart == psShape->nParts - 1
+                                  ? psShape->nVertices
+                                  : psShape->panPartStart[iPart + 1]) -
+                             nStart;
+                }
+            };
+
+            size_t nWKBSize = HEADER_SIZE + sizeof(uint32_t);
+            for (int iPart = 0; iPart < psShape->nParts; ++iPart)
+            {
+                int nStart = 0;
+                int nCount = 0;
+                GetPartStartAndCount(iPart, nStart, nCount);
+                nWKBSize += HEADER_SIZE + sizeof(uint32_t) +
+                            static_cast<size_t>(nCount) * nPointSize;
+            }
+            abyWKB.resize(nWKBSize);
+            GByte *pabyOut = WriteWKBHeader(abyWKB.data(), wkbMultiLineString,
+                                            bHasZ, bHasM);
+            pabyOut = WriteWKBUInt32(pabyOut, psShape->nParts);
+            for (int iPart = 0; iPart < psShape->nParts; ++iPart)
+            {
+                int nStart = 0;
+                int nCount = 0;
+                GetPartStartAndCount(iPart, nStart, nCount);
+                pabyOut = WriteWKBHeader(pabyOut, wkbLineString, bHasZ, bHasM);
+                pabyOut = WriteWKBUInt32(pabyOut, nCount);
+                pabyOut = WriteWKBPoints(pabyOut, psShape, nStart, nCount,
+                                         bHasZ, bHasM, bShapeHasZ, bShapeHasM);
+            }
+            break;
+        }
+
+        case wkbPolygon:
+        {
+            int nRingStart = 0;
+            int nRingEnd = 0;
+            RingStartEnd(psShape, 0, &nRingStart, &nRingEnd);
+            const int nRingPoints = nRingEnd - nRingStart + 1;
+            abyWKB.resize(HEADER_SIZE + 2 * sizeof(uint32_t) +
+                          static_cast<size_t>(nRingPoints) * nPointSize);
+            GByte *pabyOut =
+                WriteWKBHeader(abyWKB.data(), wkbPolygon, bHasZ, bHasM);
+            pabyOut = WriteWKBUInt32(pabyOut, 1);
+            pabyOut = WriteWKBUInt32(pabyOut, nRingPoints);
+            WriteWKBPoints(pabyOut, psShape, nRingStart, nRingPoints, bHasZ,
+                           bHasM, bShapeHasZ, bShapeHasM);
+            break;
+        }
+
+        default:
+            CPLAssert(false);
+            break;
+    }
+
+    SHPDestroyObject(psShape);
+}
+
 /************************************************************************/
 /*                      CheckNonFiniteCoordinates()                     */
 /************************************************************************/
@@ -1276,14 +1643,47 @@ OGRFeatureDefn *SHPReadOGRFeatureDefn(const char *pszName, SHPHandle hSHP,
     return poDefn;
 }
 
+/************************************************************************/
+/*                          SHPParseDBFDate()                           */
+/*                                                                      */
+/*      Parse the value of a DBF date field, either as YYYYMMDD or as   */
+/*      MM/DD/YYYY.                                                     */
+/************************************************************************/
+
+void SHPParseDBFDate(const char *pszDateValue, OGRField &sFld)
+{
+    memset(&sFld, 0, sizeof(sFld));
+
+    if (strlen(pszDateValue) >= 10 && pszDateValue[2] == '/' &&
+        pszDateValue[5] == '/')
+    {
+        sFld.Date.Month = static_cast<GByte>(atoi(pszDateValue + 0));
+        sFld.Date.Day = static_cast<GByte>(atoi(pszDateValue + 3));
+        sFld.Date.Year = static_cast<GInt16>(atoi(pszDateValue + 6));
+    }
+    else
+    {
+        const int nFullDate = atoi(pszDateValue);
+        sFld.Date.Year = static_cast<GInt16>(nFullDate / 10000);
+        sFld.Date.Month = static_cast<GByte>((nFullDate / 100) % 100);
+        sFld.Date.Day = static_cast<GByte>(nFullDate % 100);
+    }
+}
+
 /************************************************************************/
 /*                         SHPReadOGRFeature()                          */
+/*                                                                      */
+/*      If poFeatureToReuse is not null, it is filled with the content  */
+/*      of the shape and returned, instead of a new feature. Its        */
+/*      geometry and string fields are recycled when possible. It is    */
+/*      left untouched if nullptr is returned.                          */
 /************************************************************************/
 
 OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
                               OGRFeatureDefn *poDefn, int iShape,
                               SHPObject *psShape, const char *pszSHPEncoding,
-                              bool &bHasWarnedWrongWindingOrder)
+                              bool &bHasWarnedWrongWindingOrder,
+                              OGRFeature *poFeatureToReuse)
 
 {
     if (iShape < 0 || (hSHP != nullptr && iShape >= hSHP->nRecords) ||
@@ -1307,7 +1707,20 @@ OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
         return nullptr;
     }
 
-    OGRFeature *poFeature = new OGRFeature(poDefn);
+    OGRFeature *poFeature = poFeatureToReuse;
+    OGRGeometry *poGeomToReuse = nullptr;
+    if (poFeature)
+    {
+        CPLAssert(poFeature->GetDefnRef() == poDefn);
+        poGeomToReuse = poFeature->StealGeometry();
+        poFeature->SetStyleString(nullptr);
+        poFeature->SetNativeData(nullptr);
+        poFeature->SetNativeMediaType(nullptr);
+    }
+    else
+    {
+        poFeature = new OGRFeature(poDefn);
+    }
 
     /* -------------------------------------------------------------------- */
     /*      Fetch geometry from Shapefile to OGRFeature.                    */
@@ -1316,8 +1729,10 @@ OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
     {
         if (!poDefn->IsGeometryIgnored())
         {
-            OGRGeometry *poGeometry = SHPReadOGRObject(
-                hSHP, iShape, psShape, bHasWarnedWrongWindingOrder);
+            OGRGeometry *poGeometry =
+                SHPReadOGRObject(hSHP, iShape, psShape,
+                                 bHasWarnedWrongWindingOrder, poGeomToReuse);
+            poGeomToReuse = nullptr;
 
             // Two possibilities are expected here (both are tested by
             // GDAL Autotests):
@@ -1329,31 +1744,9 @@ OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
 
             if (poGeometry)
             {
-                // Set/unset flags.
-                const OGRwkbGeometryType eMyGeomType =
-                    poFeature->GetDefnRef()->GetGeomFieldDefn(0)->GetType();
-
-                if (eMyGeomType != wkbUnknown)
-                {
-                    OGRwkbGeometryType eGeomInType =
-                        poGeometry->getGeometryType();
-                    if (wkbHasZ(eMyGeomType) && !wkbHasZ(eGeomInType))
-                    {
-                        poGeometry->set3D(TRUE);
-                    }
-                    else if (!wkbHasZ(eMyGeomType) && wkbHasZ(eGeomInType))
-                    {
-                        poGeometry->set3D(FALSE);
-                    }
-                    if (wkbHasM(eMyGeomType) && !wkbHasM(eGeomInType))
-                    {
-                        poGeometry->setMeasured(TRUE);
-                    }
-                    else if (!wkbHasM(eMyGeomType) && wkbHasM(eGeomInType))
-                    {
-                        poGeometry->setMeasured(FALSE);
-                    }
-                }
+                SetGeometryDimensionsFromLayer(
+                    poGeometry,
+                    poFeature->GetDefnRef()->GetGeomFieldDefn(0)->GetType());
             }
 
             poFeature->SetGeometryDirectly(poGeometry);
@@ -1363,6 +1756,7 @@ OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
             SHPDestroyObject(psShape);
         }
     }
+    delete poGeomToReuse;
 
     /* -------------------------------------------------------------------- */
     /*      Fetch feature attributes to OGRFeature fields.                  */
@@ -1373,7 +1767,11 @@ OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
     {
         const OGRFieldDefn *const poFieldDefn = poDefn->GetFieldDefn(iField);
         if (poFieldDefn->IsIgnored())
+        {
+            if (poFeatureToReuse)
+                poFeature->UnsetField(iField);
             continue;
+        }
 
         switch (poFieldDefn->GetType())
         {
@@ -1436,30 +1834,9 @@ OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
                     continue;
                 }
 
-                const char *const pszDateValue =
-                    DBFReadStringAttribute(hDBF, iShape, iField);
-
                 OGRField sFld;
-                memset(&sFld, 0, sizeof(sFld));
-
-                if (strlen(pszDateValue) >= 10 && pszDateValue[2] == '/' &&
-                    pszDateValue[5] == '/')
-                {
-                    sFld.Date.Month =
-                        static_cast<GByte>(atoi(pszDateValue + 0));
-                    sFld.Date.Day = static_cast<GByte>(atoi(pszDateValue + 3));
-                    sFld.Date.Year =
-                        static_cast<GInt16>(atoi(pszDateValue + 6));
-                }
-                else
-                {
-                    const int nFullDate = atoi(pszDateValue);
-                    sFld.Date.Year = static_cast<GInt16>(nFullDate / 10000);
-                    sFld.Date.Month =
-                        static_cast<GByte>((nFullDate / 100) % 100);
-                    sFld.Date.Day = static_cast<GByte>(nFullDate % 100);
-                }
-
+                SHPParseDBFDate(DBFReadStringAttribute(hDBF, iShape, iField),
+                                sFld);
                 poFeature->SetField(iField, &sFld);
             }
             break;
@@ -385,8 +385,13 @@ const char *swq_select_summarize(swq_select *select_info, int dest_column,
                 {
                     oComparator.eType = SWQ_STRING;
                 }
-                select_info->column_summary[i].oSetDistinctValues =
-                    std::set<CPLString, swq_summary::Comparator>(oComparator);
+                swq_summary &oSummary = select_info->column_summary[i];
+                oSummary.oComparator = oComparator;
+                oSummary.oSetDistinctValues =
+                    std::unordered_set<CPLString, swq_summary::Hash,
+                                       swq_summary::Equal>(
+                        0, swq_summary::Hash(oComparator.eType),
+                        swq_summary::Equal(oComparator.eType));
             }
             select_info->column_summary[i].min =
                 std::numeric_limits<double>::infinity();
@@ -409,14 +414,10 @@ const char *swq_select_summarize(swq_select *select_info, int dest_column,
             pszValue = SZ_OGR_NULL;
         try
         {
-            if (!cpl::contains(summary.oSetDistinctValues, pszValue))
+            // Values are sorted afterwards if needed
+            if (summary.oSetDistinctValues.insert(pszValue).second)
             {
-                summary.oSetDistinctValues.insert(pszValue);
-                if (select_info->order_specs == 0)
-                {
-                    // If not sorted, keep values in their original order
-                    summary.oVectorDistinctValues.emplace_back(pszValue);
-                }
+                summary.oVectorDistinctValues.emplace_back(pszValue);
                 summary.count++;
             }
         }
@@ -611,7 +612,17 @@ static bool Compare(swq_field_type eType, const CPLString &a,
         if (eType == SWQ_INTEGER64)
             return CPLAtoGIntBig(a) < CPLAtoGIntBig(b);
         else if (eType == SWQ_FLOAT)
-            return CPLAtof(a) < CPLAtof(b);
+        {
+            // NaN are sorted after other values, so that this is a strict
+            // weak ordering, as required by std::sort()
+            const double dfA = CPLAtof(a);
+            const double dfB = CPLAtof(b);
+            if (std::isnan(dfA))
+                return false;
+            if (std::isnan(dfB))
+                return true;
+            return dfA < dfB;
+        }
         else if (eType == SWQ_STRING)
             return a < b;
         else
@@ -635,6 +646,41 @@ bool swq_summary::Comparator::operator()(const CPLString &a,
         return Compare(eType, b, a);
     }
 }
+
+size_t swq_summary::Hash::operator()(const CPLString &s) const
+{
+    if (s != SZ_OGR_NULL)
+    {
+        if (eType == SWQ_INTEGER64)
+            return std::hash<GIntBig>()(CPLAtoGIntBig(s));
+        else if (eType == SWQ_FLOAT)
+        {
+            const double dfVal = CPLAtof(s);
+            if (std::isnan(dfVal))
+                return 0;
+            // +0.0 and -0.0 must have the same hash
+            return std::hash<double>()(dfVal == 0 ? 0.0 : dfVal);
+        }
+    }
+    return std::hash<std::string>()(s);
+}
+
+bool swq_summary::Equal::operator()(const CPLString &a,
+                                    const CPLString &b) const
+{
+    if (a == SZ_OGR_NULL || b == SZ_OGR_NULL)
+        return a == b;
+    else if (eType == SWQ_INTEGER64)
+        return CPLAtoGIntBig(a) == CPLAtoGIntBig(b);
+    else if (eType == SWQ_FLOAT)
+    {
+        const double dfA = CPLAtof(a);
+        const double dfB = CPLAtof(b);
+        return dfA == dfB || (std::isnan(dfA) && std::isnan(dfB));
+    }
+    else
+        return a == b;
+}
 #endif
 
 /************************************************************************/
@@ -0,0 +1,172 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  Test scaling of the global raster block cache with the number
+ *           of threads.
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_conv.h"
+#include "cpl_string.h"
+#include "gdal_priv.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+#include <vector>
+
+static void Usage()
+{
+    printf("Usage: testperfblockcache [-max_threads N] [-iters N] "
+           "[-size N] [-blocksize N]\n");
+    printf("                          [--config GDAL_BLOCK_CACHE_SHARDS "
+           "<val>]\n");
+    printf("\n");
+    printf("Runs random block accesses through GetLockedBlockRef() from 1 to "
+           "max_threads threads,\n");
+    printf("each one using its own dataset handle, once with a cache that "
+           "holds the whole dataset\n");
+    printf("(lookup and LRU touch path) and once with a cache of a quarter "
+           "of it (eviction path).\n");
+    exit(1);
+}
+
+static void Worker(const char *pszFilename, int nIters, unsigned nSeed)
+{
+    auto poDS = std::unique_ptr<GDALDataset>(
+        GDALDataset::Open(pszFilename, GDAL_OF_RASTER));
+    if (!poDS)
+        return;
+    auto poBand = poDS->GetRasterBand(1);
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    const int nBlocksPerRow = DIV_ROUND_UP(poBand->GetXSize(), nBlockXSize);
+    const int nBlocksPerCol = DIV_ROUND_UP(poBand->GetYSize(), nBlockYSize);
+    const unsigned nBlocks = static_cast<unsigned>(nBlocksPerRow) *
+                             static_cast<unsigned>(nBlocksPerCol);
+    unsigned nState = nSeed;
+    for (int i = 0; i < nIters; ++i)
+    {
+        // Linear congruential generator: we do not want to measure the
+        // cost of a thread-safe random generator.
+        nState = nState * 1103515245U + 12345U;
+        const unsigned nBlock = (nState >> 8) % nBlocks;
+        GDALRasterBlock *poBlock = poBand->GetLockedBlockRef(
+            static_cast<int>(nBlock % nBlocksPerRow),
+            static_cast<int>(nBlock / nBlocksPerRow));
+        if (poBlock)
+            poBlock->DropLock();
+    }
+}
+
+static double Run(const char *pszFilename, int nThreads, int nIters)
+{
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> aoThreads;
+    for (int i = 0; i < nThreads; ++i)
+    {
+        aoThreads.emplace_back(Worker, pszFilename, nIters,
+                               static_cast<unsigned>(i + 1));
+    }
+    for (auto &oThread : aoThreads)
+        oThread.join();
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(end - start).count();
+}
+
+int main(int argc, char *argv[])
+{
+    argc = GDALGeneralCmdLineProcessor(argc, &argv, 0);
+    if (argc < 1)
+        exit(-argc);
+
+    int nMaxThreads = std::max(1, CPLGetNumCPUs());
+    int nIters = 1000 * 1000;
+    int nSize = 8192;
+    int nBlockSize = 64;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (EQUAL(argv[i], "-max_threads") && i + 1 < argc)
+            nMaxThreads = std::max(1, atoi(argv[++i]));
+        else if (EQUAL(argv[i], "-iters") && i + 1 < argc)
+            nIters = std::max(1, atoi(argv[++i]));
+        else if (EQUAL(argv[i], "-size") && i + 1 < argc)
+            nSize = std::max(1, atoi(argv[++i]));
+        else if (EQUAL(argv[i], "-blocksize") && i + 1 < argc)
+            nBlockSize = std::max(16, atoi(argv[++i]) / 16 * 16);
+        else
+            Usage();
+    }
+
+    GDALAllRegister();
+
+    const char *pszFilename = "/vsimem/testperfblockcache.tif";
+    {
+        auto poDriver = GetGDALDriverManager()->GetDriverByName("GTiff");
+        if (!poDriver)
+        {
+            fprintf(stderr, "GTiff driver not available\n");
+            exit(1);
+        }
+        CPLStringList aosOptions;
+        aosOptions.SetNameValue("TILED", "YES");
+        aosOptions.SetNameValue("BLOCKXSIZE", CPLSPrintf("%d", nBlockSize));
+        aosOptions.SetNameValue("BLOCKYSIZE", CPLSPrintf("%d", nBlockSize));
+        auto poDS = std::unique_ptr<GDALDataset>(
+            poDriver->Create(pszFilename, nSize, nSize, 1, GDT_Byte,
+                             aosOptions.List()));
+        if (!poDS)
+            exit(1);
+        poDS->GetRasterBand(1)->Fill(1);
+    }
+
+    printf("GDAL_BLOCK_CACHE_SHARDS = %s\n",
+           CPLGetConfigOption("GDAL_BLOCK_CACHE_SHARDS", "1"));
+
+    const GIntBig nDatasetBytes = static_cast<GIntBig>(nSize) * nSize;
+    for (const bool bEviction : {false, true})
+    {
+        // The per-thread datasets each hold their own copy of a block, hence
+        // the multiplication by the maximum number of threads.
+        GDALSetCacheMax64(bEviction ? nDatasetBytes / 4
+                                    : 2 * nDatasetBytes * nMaxThreads);
+        printf("\n%s (GDAL_CACHEMAX = " CPL_FRMT_GIB " MB)\n",
+               bEviction ? "Eviction path" : "Cache hit path",
+               GDALGetCacheMax64() / (1024 * 1024));
+
+        // Warm-up
+        Run(pszFilename, 1, nIters);
+
+        double dfRefTime = 0;
+        for (int nThreads = 1;;)
+        {
+            const double dfTime = Run(pszFilename, nThreads, nIters);
+            if (nThreads == 1)
+                dfRefTime = dfTime;
+            // With perfect scaling, the elapsed time stays constant, since
+            // each thread does the same amount of work.
+            printf("%3d thread(s): %.3f s, %.2f M blocks/s, "
+                   "scaling efficiency %.0f %%\n",
+                   nThreads, dfTime,
+                   static_cast<double>(nIters) * nThreads / dfTime / 1e6,
+                   100.0 * dfRefTime / dfTime);
+            if (nThreads == nMaxThreads)
+                break;
+            nThreads = std::min(nThreads * 2, nMaxThreads);
+        }
+    }
+
+    VSIUnlink(pszFilename);
+    GDALDestroyDriverManager();
+    CSLDestroy(argv);
+
+    return 0;
+}
@@ -0,0 +1,141 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Gridding API
+ * Purpose:  Test performance of GDALGridCreate() with the index of points,
+ *           against the exhaustive search of points.
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_conv.h"
+#include "cpl_string.h"
+#include "gdal_priv.h"
+#include "gdalgrid.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+static void Usage()
+{
+    printf("Usage: testperfgrid [-points N] [-size N] [-algorithm ALG]\n");
+    printf("\n");
+    printf("Grids N random points (default 1000000) on a size x size "
+           "(default 1000) raster,\n");
+    printf("with and without the index of points, and checks that the "
+           "results are identical.\n");
+    printf("ALG is a gdal_grid algorithm string, e.g. "
+           "\"nearest\" (default), \"average:radius1=2:radius2=2\", \n");
+    printf("\"count:radius1=2:radius2=1:angle=30\".\n");
+    printf("GDAL_NUM_THREADS can be set to use several threads.\n");
+    exit(1);
+}
+
+static double Run(GDALGridAlgorithm eAlgorithm, const void *pOptions,
+                  const std::vector<double> &adfX,
+                  const std::vector<double> &adfY,
+                  const std::vector<double> &adfZ, int nSize,
+                  std::vector<double> &adfOut)
+{
+    const auto start = std::chrono::steady_clock::now();
+    if (GDALGridCreate(eAlgorithm, pOptions,
+                       static_cast<GUInt32>(adfX.size()), adfX.data(),
+                       adfY.data(), adfZ.data(), 0, 100, 0, 100, nSize, nSize,
+                       GDT_Float64, adfOut.data(), nullptr,
+                       nullptr) != CE_None)
+    {
+        fprintf(stderr, "GDALGridCreate() failed\n");
+        exit(1);
+    }
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(end - start).count();
+}
+
+int main(int argc, char *argv[])
+{
+    argc = GDALGeneralCmdLineProcessor(argc, &argv, 0);
+    if (argc < 1)
+        exit(-argc);
+
+    int nPoints = 1000 * 1000;
+    int nSize = 1000;
+    const char *pszAlgorithm = "nearest";
+    for (int i = 1; i < argc; ++i)
+    {
+        if (EQUAL(argv[i], "-points") && i + 1 < argc)
+            nPoints = atoi(argv[++i]);
+        else if (EQUAL(argv[i], "-size") && i + 1 < argc)
+            nSize = atoi(argv[++i]);
+        else if (EQUAL(argv[i], "-algorithm") && i + 1 < argc)
+            pszAlgorithm = argv[++i];
+        else
+            Usage();
+    }
+    if (nPoints <= 0 || nSize <= 0)
+        Usage();
+
+    GDALGridAlgorithm eAlgorithm;
+    void *pOptions = nullptr;
+    if (GDALGridParseAlgorithmAndOptions(pszAlgorithm, &eAlgorithm,
+                                         &pOptions) != CE_None)
+    {
+        exit(1);
+    }
+
+    // Points in [0,100]x[0,100], denser in some areas, like LiDAR data
+    std::vector<double> adfX(nPoints);
+    std::vector<double> adfY(nPoints);
+    std::vector<double> adfZ(nPoints);
+    unsigned nState = 1;
+    const auto Random = [&nState]()
+    {
+        nState = nState * 1103515245U + 12345U;
+        return static_cast<double>((nState >> 8) & 0xFFFFFF) / 0x1000000;
+    };
+    for (int i = 0; i < nPoints; ++i)
+    {
+        const double dfX = Random();
+        const double dfY = Random();
+        adfX[i] = 100 * dfX * dfX;
+        adfY[i] = 100 * dfY;
+        adfZ[i] = std::sin(adfX[i] / 10) * std::cos(adfY[i] / 10) + Random();
+    }
+
+    std::vector<double> adfIndexed(static_cast<size_t>(nSize) * nSize);
+    const double dfIndexedTime =
+        Run(eAlgorithm, pOptions, adfX, adfY, adfZ, nSize, adfIndexed);
+    printf("With index of points:    %.3f s\n", dfIndexedTime);
+
+    // Exhaustive search (or quadtree for algorithms that require it)
+    std::vector<double> adfExhaustive(adfIndexed.size());
+    CPLSetConfigOption("GDAL_GRID_POINT_COUNT_THRESHOLD",
+                       CPLSPrintf("%d", nPoints));
+    const double dfExhaustiveTime =
+        Run(eAlgorithm, pOptions, adfX, adfY, adfZ, nSize, adfExhaustive);
+    CPLSetConfigOption("GDAL_GRID_POINT_COUNT_THRESHOLD", nullptr);
+    printf("Without index of points: %.3f s (x%.1f)\n", dfExhaustiveTime,
+           dfExhaustiveTime / dfIndexedTime);
+
+    size_t nDiffs = 0;
+    for (size_t i = 0; i < adfIndexed.size(); ++i)
+    {
+        if (adfIndexed[i] != adfExhaustive[i] &&
+            std::fabs(adfIndexed[i] - adfExhaustive[i]) >
+                1e-10 * std::fabs(adfExhaustive[i]))
+        {
+            ++nDiffs;
+        }
+    }
+    printf("%d differing cell(s)\n", static_cast<int>(nDiffs));
+
+    CPLFree(pOptions);
+    GDALDestroyDriverManager();
+    CSLDestroy(argv);
+
+    return nDiffs == 0 ? 0 : 1;
+}
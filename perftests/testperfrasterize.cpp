@@ -0,0 +1,124 @@
+/******************************************************************************
+ *
+ * Project:  GDAL
+ * Purpose:  Test performance of the rasterization of large polygons, such as
+ *           coastlines or administrative boundaries.
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_conv.h"
+#include "cpl_string.h"
+#include "gdal_alg.h"
+#include "gdal_priv.h"
+#include "ogr_geometry.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+
+static void Usage()
+{
+    printf("Usage: testperfrasterize [-size N] [-vertices N] [-rings N] "
+           "[-all_touched]\n");
+    printf("\n");
+    printf("Rasterizes a synthetic coastline-like polygon with N vertices "
+           "(default 1000000)\n");
+    printf("per ring, and the specified number of rings (default 1), into "
+           "a raster of\n");
+    printf("N x N pixels (default 10000 x 10000).\n");
+    exit(1);
+}
+
+int main(int argc, char *argv[])
+{
+    argc = GDALGeneralCmdLineProcessor(argc, &argv, 0);
+    if (argc < 1)
+        exit(-argc);
+
+    int nSize = 10000;
+    int nVertices = 1000 * 1000;
+    int nRings = 1;
+    bool bAllTouched = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (EQUAL(argv[i], "-size") && i + 1 < argc)
+            nSize = atoi(argv[++i]);
+        else if (EQUAL(argv[i], "-vertices") && i + 1 < argc)
+            nVertices = atoi(argv[++i]);
+        else if (EQUAL(argv[i], "-rings") && i + 1 < argc)
+            nRings = atoi(argv[++i]);
+        else if (EQUAL(argv[i], "-all_touched"))
+            bAllTouched = true;
+        else
+            Usage();
+    }
+    if (nSize <= 0 || nVertices < 3 || nRings <= 0)
+        Usage();
+
+    GDALAllRegister();
+
+    auto poDriver = GetGDALDriverManager()->GetDriverByName("MEM");
+    if (poDriver == nullptr)
+    {
+        fprintf(stderr, "MEM driver not available\n");
+        exit(1);
+    }
+    auto poDS = std::unique_ptr<GDALDataset>(
+        poDriver->Create("", nSize, nSize, 1, GDT_Byte, nullptr));
+    if (poDS == nullptr)
+        exit(1);
+    double adfGT[6] = {0, 1, 0, 0, 0, 1};
+    poDS->SetGeoTransform(adfGT);
+
+    // Concentric rings with a jagged outline, alternately outer and inner
+    // boundaries.
+    OGRPolygon oPoly;
+    for (int iRing = 0; iRing < nRings; ++iRing)
+    {
+        auto poRing = std::make_unique<OGRLinearRing>();
+        poRing->setNumPoints(nVertices + 1, false);
+        const double dfRadius = nSize * 0.45 * (nRings - iRing) / nRings;
+        for (int i = 0; i < nVertices; ++i)
+        {
+            const double t = 2 * M_PI * i / nVertices;
+            const double r =
+                dfRadius * (1 + 0.05 * std::sin(t * 97) +
+                            0.01 * std::sin(t * 1013 + iRing) +
+                            0.002 * std::sin(t * 10007));
+            poRing->setPoint(i, nSize / 2.0 + r * std::cos(t),
+                             nSize / 2.0 + r * std::sin(t));
+        }
+        poRing->closeRings();
+        oPoly.addRingDirectly(poRing.release());
+    }
+
+    CPLStringList aosOptions;
+    if (bAllTouched)
+        aosOptions.SetNameValue("ALL_TOUCHED", "YES");
+    int nBand = 1;
+    double dfBurnValue = 255;
+    OGRGeometryH hGeom = OGRGeometry::ToHandle(&oPoly);
+    const auto start = std::chrono::steady_clock::now();
+    if (GDALRasterizeGeometries(GDALDataset::ToHandle(poDS.get()), 1, &nBand,
+                                1, &hGeom, nullptr, nullptr, &dfBurnValue,
+                                aosOptions.List(), nullptr,
+                                nullptr) != CE_None)
+    {
+        exit(1);
+    }
+    const auto end = std::chrono::steady_clock::now();
+    printf("Rasterization of %d ring(s) of %d vertices: %.3f s\n", nRings,
+           nVertices, std::chrono::duration<double>(end - start).count());
+
+    poDS.reset();
+    GDALDestroyDriverManager();
+    CSLDestroy(argv);
+
+    return 0;
+}
@@ -0,0 +1,268 @@
+/******************************************************************************
+ *
+ * Project:  GDAL
+ * Purpose:  Test performance of the RPC transformer, with points transformed
+ *           by whole lines, against points transformed one at a time.
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_conv.h"
+#include "cpl_string.h"
+#include "gdal_alg.h"
+#include "gdal_priv.h"
+#include "ogr_srs_api.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+static void Usage()
+{
+    printf("Usage: testperfrpc [-size N] [-dem] "
+           "[-interp near|bilinear|cubic]\n");
+    printf("\n");
+    printf("Transforms a grid of N x N (default 2000 x 2000) long/lat points "
+           "into image\n");
+    printf("coordinates with a synthetic RPC model, line by line, and "
+           "then one point at a\n");
+    printf("time, and checks that the results are consistent.\n");
+    printf("-dem uses a synthetic DEM, with the specified interpolation "
+           "(default bilinear).\n");
+    printf("GDAL_USE_AVX=NO can be set to disable the AVX code path.\n");
+    exit(1);
+}
+
+static constexpr const char *DEM_FILENAME = "/vsimem/testperfrpc_dem.tif";
+
+static void CreateDEM()
+{
+    auto poDriver = GetGDALDriverManager()->GetDriverByName("GTiff");
+    if (poDriver == nullptr)
+    {
+        fprintf(stderr, "GTiff driver not available\n");
+        exit(1);
+    }
+    constexpr int DEM_SIZE = 1000;
+    auto poDS = std::unique_ptr<GDALDataset>(poDriver->Create(
+        DEM_FILENAME, DEM_SIZE, DEM_SIZE, 1, GDT_Float32, nullptr));
+    if (poDS == nullptr)
+        exit(1);
+    // Covers [1.5,2.5]x[48.5,49.5]
+    double adfGT[6] = {1.5, 1.0 / DEM_SIZE, 0, 49.5, 0, -1.0 / DEM_SIZE};
+    poDS->SetGeoTransform(adfGT);
+    poDS->SetProjection(SRS_WKT_WGS84_LAT_LONG);
+    std::vector<float> afElev(static_cast<size_t>(DEM_SIZE) * DEM_SIZE);
+    for (int j = 0; j < DEM_SIZE; ++j)
+    {
+        for (int i = 0; i < DEM_SIZE; ++i)
+        {
+            afElev[static_cast<size_t>(j) * DEM_SIZE + i] = static_cast<float>(
+                200 + 100 * std::sin(i / 50.0) * std::cos(j / 70.0));
+        }
+    }
+    if (poDS->GetRasterBand(1)->RasterIO(GF_Write, 0, 0, DEM_SIZE, DEM_SIZE,
+                                         afElev.data(), DEM_SIZE, DEM_SIZE,
+                                         GDT_Float32, 0, 0,
+                                         nullptr) != CE_None)
+    {
+        exit(1);
+    }
+}
+
+static void *CreateTransformer(const GDALRPCInfoV2 &sRPC, bool bDEM,
+                               const char *pszInterp)
+{
+    CPLStringList aosOptions;
+    if (bDEM)
+    {
+        aosOptions.SetNameValue("RPC_DEM", DEM_FILENAME);
+        aosOptions.SetNameValue("RPC_DEMINTERPOLATION", pszInterp);
+    }
+    void *pTransformer =
+        GDALCreateRPCTransformerV2(&sRPC, FALSE, 0, aosOptions.List());
+    if (pTransformer == nullptr)
+    {
+        fprintf(stderr, "GDALCreateRPCTransformerV2() failed\n");
+        exit(1);
+    }
+    return pTransformer;
+}
+
+int main(int argc, char *argv[])
+{
+    argc = GDALGeneralCmdLineProcessor(argc, &argv, 0);
+    if (argc < 1)
+        exit(-argc);
+
+    int nSize = 2000;
+    bool bDEM = false;
+    const char *pszInterp = "bilinear";
+    for (int i = 1; i < argc; ++i)
+    {
+        if (EQUAL(argv[i], "-size") && i + 1 < argc)
+            nSize = atoi(argv[++i]);
+        else if (EQUAL(argv[i], "-dem"))
+            bDEM = true;
+        else if (EQUAL(argv[i], "-interp") && i + 1 < argc)
+            pszInterp = argv[++i];
+        else
+            Usage();
+    }
+    if (nSize <= 0)
+        Usage();
+
+    GDALAllRegister();
+
+    // Roughly a 10000 x 10000 pixel scene, centered on (2, 49), with
+    // small cross terms.
+    GDALRPCInfoV2 sRPC;
+    memset(&sRPC, 0, sizeof(sRPC));
+    sRPC.dfLINE_OFF = 5000;
+    sRPC.dfSAMP_OFF = 5000;
+    sRPC.dfLAT_OFF = 49;
+    sRPC.dfLONG_OFF = 2;
+    sRPC.dfHEIGHT_OFF = 200;
+    sRPC.dfLINE_SCALE = 5000;
+    sRPC.dfSAMP_SCALE = 5000;
+    sRPC.dfLAT_SCALE = 0.1;
+    sRPC.dfLONG_SCALE = 0.1;
+    sRPC.dfHEIGHT_SCALE = 500;
+    for (int i = 0; i < 20; ++i)
+    {
+        sRPC.adfLINE_NUM_COEFF[i] = 1e-3 * std::cos(i);
+        sRPC.adfLINE_DEN_COEFF[i] = 1e-4 * std::sin(i);
+        sRPC.adfSAMP_NUM_COEFF[i] = 1e-3 * std::sin(i + 1);
+        sRPC.adfSAMP_DEN_COEFF[i] = 1e-4 * std::cos(i + 1);
+    }
+    sRPC.adfLINE_NUM_COEFF[2] = -1;
+    sRPC.adfLINE_NUM_COEFF[3] = 0.02;
+    sRPC.adfLINE_DEN_COEFF[0] = 1;
+    sRPC.adfSAMP_NUM_COEFF[1] = 1;
+    sRPC.adfSAMP_NUM_COEFF[3] = 0.03;
+    sRPC.adfSAMP_DEN_COEFF[0] = 1;
+    sRPC.dfMIN_LONG = 1.9;
+    sRPC.dfMAX_LONG = 2.1;
+    sRPC.dfMIN_LAT = 48.9;
+    sRPC.dfMAX_LAT = 49.1;
+
+    if (bDEM)
+        CreateDEM();
+
+    // Grid of long/lat points covering the scene.
+    const size_t nPoints = static_cast<size_t>(nSize) * nSize;
+    std::vector<double> adfLong(nPoints);
+    std::vector<double> adfLat(nPoints);
+    for (int j = 0; j < nSize; ++j)
+    {
+        for (int i = 0; i < nSize; ++i)
+        {
+            adfLong[static_cast<size_t>(j) * nSize + i] =
+                sRPC.dfMIN_LONG + (i + 0.5) / nSize * 0.2;
+            adfLat[static_cast<size_t>(j) * nSize + i] =
+                sRPC.dfMAX_LAT - (j + 0.5) / nSize * 0.2;
+        }
+    }
+
+    // Line by line, as done by the warper.
+    void *pTransformer = CreateTransformer(sRPC, bDEM, pszInterp);
+    std::vector<double> adfXLines(adfLong);
+    std::vector<double> adfYLines(adfLat);
+    std::vector<double> adfZ(nSize);
+    std::vector<int> anSuccessLines(nPoints);
+    auto start = std::chrono::steady_clock::now();
+    for (int j = 0; j < nSize; ++j)
+    {
+        const size_t nOffset = static_cast<size_t>(j) * nSize;
+        std::fill(adfZ.begin(), adfZ.end(), 0.0);
+        GDALRPCTransform(pTransformer, TRUE, nSize, adfXLines.data() + nOffset,
+                         adfYLines.data() + nOffset, adfZ.data(),
+                         anSuccessLines.data() + nOffset);
+    }
+    auto end = std::chrono::steady_clock::now();
+    const double dfLinesTime =
+        std::chrono::duration<double>(end - start).count();
+    printf("Forward, by lines:      %.3f s\n", dfLinesTime);
+    GDALDestroyRPCTransformer(pTransformer);
+
+    // One point at a time.
+    pTransformer = CreateTransformer(sRPC, bDEM, pszInterp);
+    std::vector<double> adfXPoints(adfLong);
+    std::vector<double> adfYPoints(adfLat);
+    std::vector<int> anSuccessPoints(nPoints);
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < nPoints; ++i)
+    {
+        double dfZ = 0;
+        GDALRPCTransform(pTransformer, TRUE, 1, &adfXPoints[i],
+                         &adfYPoints[i], &dfZ, &anSuccessPoints[i]);
+    }
+    end = std::chrono::steady_clock::now();
+    const double dfPointsTime =
+        std::chrono::duration<double>(end - start).count();
+    printf("Forward, by points:     %.3f s\n", dfPointsTime);
+
+    size_t nMismatches = 0;
+    size_t nFailures = 0;
+    for (size_t i = 0; i < nPoints; ++i)
+    {
+        if (!anSuccessLines[i])
+            ++nFailures;
+        // Whole lines of constant latitude use a specific DEM interpolation
+        // code path, which may differ very slightly.
+        if (anSuccessLines[i] != anSuccessPoints[i] ||
+            (anSuccessLines[i] &&
+             (std::fabs(adfXLines[i] - adfXPoints[i]) > 1e-6 ||
+              std::fabs(adfYLines[i] - adfYPoints[i]) > 1e-6)))
+        {
+            ++nMismatches;
+        }
+    }
+    printf("%u failed points, %u mismatches\n",
+           static_cast<unsigned>(nFailures),
+           static_cast<unsigned>(nMismatches));
+
+    // Inverse transform of a subset of the points, for reference.
+    const int nInverseStep = std::max(1, nSize / 200);
+    std::vector<double> adfXInv;
+    std::vector<double> adfYInv;
+    for (int j = 0; j < nSize; j += nInverseStep)
+    {
+        for (int i = 0; i < nSize; i += nInverseStep)
+        {
+            const size_t k = static_cast<size_t>(j) * nSize + i;
+            if (anSuccessLines[k])
+            {
+                adfXInv.push_back(adfXLines[k]);
+                adfYInv.push_back(adfYLines[k]);
+            }
+        }
+    }
+    std::vector<double> adfZInv(adfXInv.size());
+    std::vector<int> anSuccessInv(adfXInv.size());
+    start = std::chrono::steady_clock::now();
+    GDALRPCTransform(pTransformer, FALSE, static_cast<int>(adfXInv.size()),
+                     adfXInv.data(), adfYInv.data(), adfZInv.data(),
+                     anSuccessInv.data());
+    end = std::chrono::steady_clock::now();
+    printf("Inverse, %u points:  %.3f s\n",
+           static_cast<unsigned>(adfXInv.size()),
+           std::chrono::duration<double>(end - start).count());
+    GDALDestroyRPCTransformer(pTransformer);
+
+    if (bDEM)
+        VSIUnlink(DEM_FILENAME);
+
+    GDALDestroyDriverManager();
+    CSLDestroy(argv);
+
+    return nMismatches == 0 ? 0 : 1;
+}
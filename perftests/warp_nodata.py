@@ -0,0 +1,48 @@
+# SPDX-License-Identifier: MIT
+# Copyright 2025, GDAL contributors
+
+# Benchmark of the warping of sources with and without nodata values,
+# compared with the general case of the warping kernel.
+
+import time
+
+from osgeo import gdal
+
+
+def doit(typestr, alg_name, nodata, general_case):
+
+    src_ds = gdal.GetDriverByName("MEM").Create(
+        "", 4000, 4000, 1, gdal.GetDataTypeByName(typestr)
+    )
+    src_ds.SetGeoTransform([0, 1, 0, 0, 0, -1])
+    band = src_ds.GetRasterBand(1)
+    band.Fill(100)
+    # A few nodata holes
+    for y in range(0, 4000, 97):
+        band.WriteRaster(y, y, 10, 10, b"\0" * 100, buf_type=gdal.GDT_Byte)
+    if nodata:
+        band.SetNoDataValue(0)
+
+    options = f"-of MEM -r {alg_name} -ts 4500 4500 -wm 256"
+    if general_case:
+        options += " -wo USE_GENERAL_CASE=TRUE"
+    start = time.time()
+    gdal.Warp("", src_ds, options=options)
+    end = time.time()
+    print(
+        "%s, %s, nodata=%s, %s: %.2f"
+        % (
+            typestr,
+            alg_name,
+            "yes" if nodata else "no",
+            "general case" if general_case else "default",
+            end - start,
+        )
+    )
+
+
+for typestr in ("Byte", "Int16", "UInt16", "Float32"):
+    for alg_name in ("bilinear", "cubic", "lanczos"):
+        for nodata in (False, True):
+            doit(typestr, alg_name, nodata, False)
+            doit(typestr, alg_name, nodata, True)
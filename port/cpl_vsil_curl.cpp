@@ -1910,6 +1910,22 @@ std::string VSICurlHandle::DownloadRegion(const vsi_l_offset startOffset,
         return currentDownload.GetAlreadyDownloadedData();
     }
 
+    const std::string osDiskCacheValidator = GetDiskCacheValidator();
+    if (!osDiskCacheValidator.empty())
+    {
+        std::string osData;
+        if (ReadRegionFromDiskCache(osDiskCacheValidator, startOffset, nBlocks,
+                                    osData))
+        {
+            NetworkStatisticsLogger::LogDiskCacheHit(osData.size());
+            DownloadRegionPostProcess(startOffset, nBlocks, osData.data(),
+                                      osData.size());
+            currentDownload.SetData(osData);
+            return osData;
+        }
+        NetworkStatisticsLogger::LogDiskCacheMiss();
+    }
+
 begin:
     CURLM *hCurlMultiHandle = poFS->GetCurlMultiHandleFor(m_pszURL);
 
@@ -2204,6 +2220,15 @@ retry:
     DownloadRegionPostProcess(startOffset, nBlocks, sWriteFuncData.pBuffer,
                               sWriteFuncData.nSize);
 
+    // The validator might have been unknown before the request, if the
+    // modification time was only returned by it.
+    const std::string osNewDiskCacheValidator = GetDiskCacheValidator();
+    if (!osNewDiskCacheValidator.empty())
+    {
+        WriteRegionToDiskCache(osNewDiskCacheValidator, startOffset,
+                               sWriteFuncData.pBuffer, sWriteFuncData.nSize);
+    }
+
     std::string osRet;
     osRet.assign(sWriteFuncData.pBuffer, sWriteFuncData.nSize);
 
@@ -2268,6 +2293,83 @@ void VSICurlHandle::UpdateRedirectInfo(
     }
 }
 
+/************************************************************************/
+/*                       GetDiskCacheValidator()                        */
+/************************************************************************/
+
+// Returns a string identifying the version of the remote file, to be used
+// as part of the key of the persistent disk cache, or an empty string if the
+// disk cache is disabled or cannot be used for this file.
+std::string VSICurlHandle::GetDiskCacheValidator() const
+{
+    if (!m_bCached || !VSICurlDiskCache::IsEnabled())
+        return std::string();
+    if (!oFileProp.ETag.empty())
+        return "ETag:" + oFileProp.ETag;
+    if (oFileProp.mTime > 0 && oFileProp.bHasComputedFileSize)
+    {
+        return CPLSPrintf("mtime:" CPL_FRMT_GIB ",size:" CPL_FRMT_GUIB,
+                          static_cast<GIntBig>(oFileProp.mTime),
+                          static_cast<GUIntBig>(oFileProp.fileSize));
+    }
+    return std::string();
+}
+
+/************************************************************************/
+/*                      ReadRegionFromDiskCache()                       */
+/************************************************************************/
+
+// Returns true if all the chunks of the region (up to the end of file) are
+// in the persistent disk cache.
+bool VSICurlHandle::ReadRegionFromDiskCache(const std::string &osValidator,
+                                            const vsi_l_offset startOffset,
+                                            const int nBlocks,
+                                            std::string &osData)
+{
+    const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
+    osData.clear();
+    for (int i = 0; i < nBlocks; ++i)
+    {
+        const vsi_l_offset nOffset =
+            startOffset + static_cast<vsi_l_offset>(i) * knDOWNLOAD_CHUNK_SIZE;
+        if (oFileProp.bHasComputedFileSize && nOffset >= oFileProp.fileSize)
+            break;
+        std::string osChunk;
+        if (!VSICurlDiskCache::Get(m_pszURL, osValidator, nOffset,
+                                   knDOWNLOAD_CHUNK_SIZE, osChunk))
+        {
+            return false;
+        }
+        osData += osChunk;
+        // Truncated chunk: end of file
+        if (osChunk.size() < static_cast<size_t>(knDOWNLOAD_CHUNK_SIZE))
+            break;
+    }
+    return !osData.empty();
+}
+
+/************************************************************************/
+/*                       WriteRegionToDiskCache()                       */
+/************************************************************************/
+
+void VSICurlHandle::WriteRegionToDiskCache(const std::string &osValidator,
+                                           const vsi_l_offset startOffset,
+                                           const char *pBuffer, size_t nSize)
+{
+    const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
+    vsi_l_offset l_startOffset = startOffset;
+    while (nSize > 0)
+    {
+        const size_t nChunkSize =
+            std::min(static_cast<size_t>(knDOWNLOAD_CHUNK_SIZE), nSize);
+        VSICurlDiskCache::Put(m_pszURL, osValidator, l_startOffset,
+                              knDOWNLOAD_CHUNK_SIZE, pBuffer, nChunkSize);
+        l_startOffset += nChunkSize;
+        pBuffer += nChunkSize;
+        nSize -= nChunkSize;
+    }
+}
+
 /************************************************************************/
 /*                      DownloadRegionPostProcess()                     */
 /************************************************************************/
@@ -4245,6 +4347,12 @@ const char *VSICurlFilesystemHandlerBase::GetActualURL(const char *pszFilename)
     "  <Option name='CPL_VSIL_CURL_CACHE_SIZE' type='integer' "                \
     "description='Size in bytes of the global /vsicurl/ cache' "               \
     "default='16384000'/>"                                                     \
+    "  <Option name='CPL_VSIL_CURL_DISK_CACHE_DIR' type='string' "             \
+    "description='Directory of the persistent disk cache of downloaded "       \
+    "content. The cache is disabled if not set'/>"                             \
+    "  <Option name='CPL_VSIL_CURL_DISK_CACHE_SIZE' type='integer' "           \
+    "description='Maximum size in bytes of the persistent disk cache' "        \
+    "default='1073741824'/>"                                                   \
     "  <Option name='CPL_VSIL_CURL_IGNORE_GLACIER_STORAGE' type='boolean' "    \
     "description='Whether to skip files with Glacier storage class in "        \
     "directory listing.' default='YES'/>"                                      \
@@ -5997,6 +6105,29 @@ void NetworkStatisticsLogger::LogDELETE()
     }
 }
 
+void NetworkStatisticsLogger::LogDiskCacheHit(size_t nReadBytes)
+{
+    if (!IsEnabled())
+        return;
+    std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
+    for (auto counters : gInstance.GetCountersForContext())
+    {
+        counters->nDiskCacheHits++;
+        counters->nDiskCacheReadBytes += nReadBytes;
+    }
+}
+
+void NetworkStatisticsLogger::LogDiskCacheMiss()
+{
+    if (!IsEnabled())
+        return;
+    std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
+    for (auto counters : gInstance.GetCountersForContext())
+    {
+        counters->nDiskCacheMisses++;
+    }
+}
+
 void NetworkStatisticsLogger::Reset()
 {
     std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
@@ -6026,6 +6157,14 @@ void NetworkStatisticsLogger::Stats::AsJSON(CPLJSONObject &oJSON) const
     if (counters.nDELETE)
         oMethods.Add("DELETE/count", counters.nDELETE);
     oJSON.Add("methods", oMethods);
+    if (counters.nDiskCacheHits || counters.nDiskCacheMisses)
+    {
+        CPLJSONObject oDiskCache;
+        oDiskCache.Add("hit/count", counters.nDiskCacheHits);
+        oDiskCache.Add("hit/read_bytes", counters.nDiskCacheReadBytes);
+        oDiskCache.Add("miss/count", counters.nDiskCacheMisses);
+        oJSON.Add("disk_cache", oDiskCache);
+    }
     CPLJSONObject oFiles;
     bool bFilesAdded = false;
     for (const auto &kv : children)
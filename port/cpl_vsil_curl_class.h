@@ -346,6 +346,35 @@ class VSICurlFilesystemHandler : public VSICurlFilesystemHandlerBase
     GetStreamingFilename(const std::string &osFilename) const override;
 };
 
+/************************************************************************/
+/*                          VSICurlDiskCache                            */
+/************************************************************************/
+
+// Persistent on-disk cache of downloaded chunks, shared between processes.
+// Enabled by setting the CPL_VSIL_CURL_DISK_CACHE_DIR configuration option.
+class VSICurlDiskCache
+{
+    static std::string GetDirectory();
+    static GIntBig GetMaxSize();
+    static std::string GetFilename(const std::string &osDirectory,
+                                   const std::string &osURL,
+                                   const std::string &osValidator,
+                                   vsi_l_offset nOffset, int nChunkSize);
+    static void Trim(const std::string &osDirectory, GIntBig nMaxSize);
+
+  public:
+    static bool IsEnabled();
+
+    // osValidator identifies the version of the remote file (ETag, or
+    // modification time and size), and must not be empty.
+    static bool Get(const std::string &osURL, const std::string &osValidator,
+                    vsi_l_offset nOffset, int nChunkSize, std::string &osData);
+
+    static void Put(const std::string &osURL, const std::string &osValidator,
+                    vsi_l_offset nOffset, int nChunkSize, const char *pData,
+                    size_t nSize);
+};
+
 /************************************************************************/
 /*                           VSICurlHandle                              */
 /************************************************************************/
@@ -392,6 +421,14 @@ class VSICurlHandle : public VSIVirtualHandle
 
     virtual std::string DownloadRegion(vsi_l_offset startOffset, int nBlocks);
 
+    std::string GetDiskCacheValidator() const;
+    bool ReadRegionFromDiskCache(const std::string &osValidator,
+                                 vsi_l_offset startOffset, int nBlocks,
+                                 std::string &osData);
+    void WriteRegionToDiskCache(const std::string &osValidator,
+                                vsi_l_offset startOffset, const char *pBuffer,
+                                size_t nSize);
+
     bool m_bUseHead = false;
     bool m_bUseRedirectURLIfNoQueryStringParams = false;
 
@@ -1108,6 +1145,9 @@ class NetworkStatisticsLogger
         GIntBig nPUTUploadedBytes = 0;
         GIntBig nPOSTDownloadedBytes = 0;
         GIntBig nPOSTUploadedBytes = 0;
+        GIntBig nDiskCacheHits = 0;
+        GIntBig nDiskCacheMisses = 0;
+        GIntBig nDiskCacheReadBytes = 0;
     };
 
     enum class ContextPathType
@@ -1187,6 +1227,10 @@ class NetworkStatisticsLogger
 
     static void LogDELETE();
 
+    static void LogDiskCacheHit(size_t nReadBytes);
+
+    static void LogDiskCacheMiss();
+
     static void Reset();
 
     static std::string GetReportAsSerializedJSON();
@@ -0,0 +1,322 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Persistent on-disk cache of chunks downloaded by /vsicurl/ and
+ *           related file systems.
+ *
+ ******************************************************************************
+ * Copyright (c) 2025, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_port.h"
+#include "cpl_vsil_curl_class.h"
+
+#ifdef HAVE_CURL
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#ifdef _WIN32
+#include <sys/utime.h>
+#else
+#include <utime.h>
+#endif
+
+#include "cpl_aws.h"
+#include "cpl_conv.h"
+#include "cpl_multiproc.h"
+#include "cpl_string.h"
+#include "cpl_vsi.h"
+
+//! @cond Doxygen_Suppress
+#ifndef DOXYGEN_SKIP
+
+namespace cpl
+{
+
+// Bytes written by this process since the last trimming of the cache.
+static std::atomic<GIntBig> gnBytesWrittenSinceLastTrim{0};
+// Whether this process has already trimmed the cache once.
+static std::atomic<bool> gbHasTrimmed{false};
+static std::mutex goTrimMutex{};
+
+// Suffix of files being written, before they are renamed to their final name
+constexpr const char *TMP_SUFFIX = ".tmp";
+// Name of the lock file, relative to the cache directory
+constexpr const char *LOCK_FILENAME = ".lock";
+
+/************************************************************************/
+/*                           GetDirectory()                             */
+/************************************************************************/
+
+std::string VSICurlDiskCache::GetDirectory()
+{
+    return CPLGetConfigOption("CPL_VSIL_CURL_DISK_CACHE_DIR", "");
+}
+
+/************************************************************************/
+/*                             IsEnabled()                              */
+/************************************************************************/
+
+bool VSICurlDiskCache::IsEnabled()
+{
+    return !GetDirectory().empty();
+}
+
+/************************************************************************/
+/*                            GetMaxSize()                              */
+/************************************************************************/
+
+GIntBig VSICurlDiskCache::GetMaxSize()
+{
+    constexpr GIntBig DEFAULT_MAX_SIZE = 1024 * 1024 * 1024;
+    const char *pszSize =
+        CPLGetConfigOption("CPL_VSIL_CURL_DISK_CACHE_SIZE", nullptr);
+    GIntBig nSize = DEFAULT_MAX_SIZE;
+    if (pszSize)
+    {
+        if (CPLParseMemorySize(pszSize, &nSize, nullptr) != CE_None ||
+            nSize <= 0)
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Could not parse value for "
+                     "CPL_VSIL_CURL_DISK_CACHE_SIZE. "
+                     "Using default value of " CPL_FRMT_GIB " instead.",
+                     DEFAULT_MAX_SIZE);
+            nSize = DEFAULT_MAX_SIZE;
+        }
+    }
+    return nSize;
+}
+
+/************************************************************************/
+/*                           GetFilename()                              */
+/************************************************************************/
+
+// Returns the path of the cache file for a chunk, in the form
+// {cache_dir}/{first 2 characters of key}/{key}, where key is the hexadecimal
+// SHA256 of the URL, the validator of the file content, the chunk size and
+// the chunk offset.
+std::string VSICurlDiskCache::GetFilename(const std::string &osDirectory,
+                                          const std::string &osURL,
+                                          const std::string &osValidator,
+                                          vsi_l_offset nOffset, int nChunkSize)
+{
+    std::string osKey(osURL);
+    osKey += '\n';
+    osKey += osValidator;
+    osKey += CPLSPrintf("\n%d\n" CPL_FRMT_GUIB, nChunkSize,
+                        static_cast<GUIntBig>(nOffset));
+    const std::string osHash = CPLGetLowerCaseHexSHA256(osKey);
+    return CPLFormFilenameSafe(
+        CPLFormFilenameSafe(osDirectory.c_str(), osHash.substr(0, 2).c_str(),
+                            nullptr)
+            .c_str(),
+        osHash.c_str(), nullptr);
+}
+
+/************************************************************************/
+/*                              Touch()                                 */
+/************************************************************************/
+
+// Update the modification time of a cache file, which is used as the
+// last access time for least-recently-used eviction.
+static void Touch(const std::string &osFilename)
+{
+#ifdef _WIN32
+    wchar_t *pwszFilename =
+        CPLRecodeToWChar(osFilename.c_str(), CPL_ENC_UTF8, CPL_ENC_UCS2);
+    CPL_IGNORE_RET_VAL(_wutime(pwszFilename, nullptr));
+    CPLFree(pwszFilename);
+#else
+    CPL_IGNORE_RET_VAL(utime(osFilename.c_str(), nullptr));
+#endif
+}
+
+/************************************************************************/
+/*                                Get()                                 */
+/************************************************************************/
+
+bool VSICurlDiskCache::Get(const std::string &osURL,
+                           const std::string &osValidator,
+                           vsi_l_offset nOffset, int nChunkSize,
+                           std::string &osData)
+{
+    const std::string osDirectory = GetDirectory();
+    if (osDirectory.empty() || osValidator.empty())
+        return false;
+
+    const std::string osFilename =
+        GetFilename(osDirectory, osURL, osValidator, nOffset, nChunkSize);
+    // A missing file is a cache miss, not an error: do not use
+    // VSIIngestFile(nullptr, ...) that would emit one.
+    VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "rb");
+    if (!fp)
+        return false;
+    GByte *pabyData = nullptr;
+    vsi_l_offset nSize = 0;
+    const bool bOK = VSIIngestFile(fp, osFilename.c_str(), &pabyData, &nSize,
+                                   nChunkSize) != 0;
+    VSIFCloseL(fp);
+    if (bOK)
+    {
+        osData.assign(reinterpret_cast<const char *>(pabyData),
+                      static_cast<size_t>(nSize));
+        Touch(osFilename);
+    }
+    CPLFree(pabyData);
+    return bOK;
+}
+
+/************************************************************************/
+/*                                Put()                                 */
+/************************************************************************/
+
+void VSICurlDiskCache::Put(const std::string &osURL,
+                           const std::string &osValidator,
+                           vsi_l_offset nOffset, int nChunkSize,
+                           const char *pData, size_t nSize)
+{
+    const std::string osDirectory = GetDirectory();
+    if (osDirectory.empty() || osValidator.empty() ||
+        nSize > static_cast<size_t>(nChunkSize))
+        return;
+
+    const std::string osFilename =
+        GetFilename(osDirectory, osURL, osValidator, nOffset, nChunkSize);
+    VSIStatBufL sStat;
+    if (VSIStatL(osFilename.c_str(), &sStat) == 0)
+        return;
+
+    const std::string osSubDir = CPLGetPathSafe(osFilename.c_str());
+    if (VSIStatL(osSubDir.c_str(), &sStat) != 0 &&
+        VSIMkdirRecursive(osSubDir.c_str(), 0755) != 0 &&
+        VSIStatL(osSubDir.c_str(), &sStat) != 0)
+    {
+        CPLDebugOnce("VSICURL", "Cannot create disk cache directory %s",
+                     osSubDir.c_str());
+        return;
+    }
+
+    // Write into a file name unique to this process and thread, and rename
+    // it to its final name once complete, so that concurrent readers, in
+    // this process or in other ones, never see partially written files.
+    const std::string osTmpFilename =
+        osFilename + CPLSPrintf(".%d." CPL_FRMT_GIB "%s",
+                                CPLGetCurrentProcessID(), CPLGetPID(),
+                                TMP_SUFFIX);
+    VSILFILE *fp = VSIFOpenL(osTmpFilename.c_str(), "wb");
+    if (!fp)
+        return;
+    bool bOK = VSIFWriteL(pData, 1, nSize, fp) == nSize;
+    bOK = VSIFCloseL(fp) == 0 && bOK;
+    if (!bOK || VSIRename(osTmpFilename.c_str(), osFilename.c_str()) != 0)
+    {
+        VSIUnlink(osTmpFilename.c_str());
+        return;
+    }
+
+    const GIntBig nMaxSize = GetMaxSize();
+    const GIntBig nWritten =
+        gnBytesWrittenSinceLastTrim += static_cast<GIntBig>(nSize);
+    if (!gbHasTrimmed || nWritten > nMaxSize / 10)
+    {
+        Trim(osDirectory, nMaxSize);
+    }
+}
+
+/************************************************************************/
+/*                                Trim()                                */
+/************************************************************************/
+
+// Evict the least recently used files until the cache size is below 90% of
+// nMaxSize. Only one process at a time trims the cache, the others skip it.
+void VSICurlDiskCache::Trim(const std::string &osDirectory, GIntBig nMaxSize)
+{
+    std::unique_lock<std::mutex> oLock(goTrimMutex, std::try_to_lock);
+    if (!oLock.owns_lock())
+        return;
+    gbHasTrimmed = true;
+    gnBytesWrittenSinceLastTrim = 0;
+
+    const std::string osLockFilename =
+        CPLFormFilenameSafe(osDirectory.c_str(), LOCK_FILENAME, nullptr);
+    CPLLockFileHandle hLockFileHandle = nullptr;
+    CPLStringList aosOptions;
+    aosOptions.SetNameValue("WAIT_TIME", "0");
+    if (CPLLockFileEx(osLockFilename.c_str(), &hLockFileHandle,
+                      aosOptions.List()) != CLFS_OK)
+    {
+        return;
+    }
+
+    struct CacheFile
+    {
+        std::string osFilename{};
+        time_t nMTime = 0;
+        GIntBig nSize = 0;
+    };
+
+    std::vector<CacheFile> asFiles;
+    GIntBig nTotalSize = 0;
+    const time_t nNow = time(nullptr);
+    const CPLStringList aosFiles(VSIReadDirRecursive(osDirectory.c_str()));
+    for (const char *pszFilename : aosFiles)
+    {
+        if (EQUAL(pszFilename, LOCK_FILENAME))
+            continue;
+        CacheFile sFile;
+        sFile.osFilename =
+            CPLFormFilenameSafe(osDirectory.c_str(), pszFilename, nullptr);
+        VSIStatBufL sStat;
+        if (VSIStatL(sFile.osFilename.c_str(), &sStat) != 0 ||
+            !VSI_ISREG(sStat.st_mode))
+        {
+            continue;
+        }
+        if (cpl::ends_with(std::string(pszFilename), TMP_SUFFIX))
+        {
+            // Leftover of a process that was killed while writing
+            constexpr int ONE_HOUR = 3600;
+            if (sStat.st_mtime + ONE_HOUR < nNow)
+                VSIUnlink(sFile.osFilename.c_str());
+            continue;
+        }
+        sFile.nMTime = sStat.st_mtime;
+        sFile.nSize = static_cast<GIntBig>(sStat.st_size);
+        nTotalSize += sFile.nSize;
+        asFiles.push_back(std::move(sFile));
+    }
+
+    if (nTotalSize > nMaxSize)
+    {
+        std::sort(asFiles.begin(), asFiles.end(),
+                  [](const CacheFile &a, const CacheFile &b)
+                  { return a.nMTime < b.nMTime; });
+        const GIntBig nTargetSize = nMaxSize / 10 * 9;
+        for (const auto &sFile : asFiles)
+        {
+            if (nTotalSize <= nTargetSize)
+                break;
+            // Might fail if another process has evicted it in the meantime,
+            // or, on Windows, if it is opened.
+            if (VSIUnlink(sFile.osFilename.c_str()) == 0)
+                nTotalSize -= sFile.nSize;
+        }
+        CPLDebug("VSICURL", "Disk cache %s trimmed to " CPL_FRMT_GIB " bytes",
+                 osDirectory.c_str(), nTotalSize);
+    }
+
+    CPLUnlockFileEx(hLockFileHandle);
+}
+
+} /* end of namespace cpl */
+
+#endif  // DOXYGEN_SKIP
+//! @endcond
+
+#endif  // HAVE_CURL